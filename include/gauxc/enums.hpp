@@ -38,9 +38,11 @@ enum class AtomicGridSizeDefault {
  *  molecular integration
  */
 enum class XCWeightAlg {
-  Becke, ///< The original Becke weighting scheme
-  SSF,   ///< The Stratmann-Scuseria-Frisch weighting scheme
-  LKO    ///< The Lauqua-Kuessman-Ochsenfeld weighting scheme
+  Becke,         ///< The original Becke weighting scheme
+  SSF,           ///< The Stratmann-Scuseria-Frisch weighting scheme
+  LKO,           ///< The Lauqua-Kuessman-Ochsenfeld weighting scheme
+  ScreenedBecke, ///< Becke weights with tolerance screening (host only)
+  ScreenedSSF    ///< SSF weights restricted to contributing atoms (host only)
 };
 
 /**
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <gauxc/types.hpp>
 
 namespace GauXC {
@@ -29,6 +30,14 @@ namespace detail {
   class GridImpl;
 }
 
+/// A batch of a spherical quadrature
+struct GridBatch {
+  std::array<double,3> lo; ///< Lower corner of the bounding box of the batch
+  std::array<double,3> up; ///< Upper corner of the bounding box of the batch
+  quadrature_type::point_container  points;  ///< Quadrature points
+  quadrature_type::weight_container weights; ///< Quadrature weights
+};
+
 /// A class to manage a particular spherical (atomic) quadrature
 class Grid {
 
@@ -81,6 +90,34 @@ public:
    */
   batcher_type& batcher();
 
+  /// Number of quadrature batches of the Grid object
+  size_t nbatches() const;
+
+  /**
+   *  @brief Get the quadrature batches of the Grid object centered at the
+   *  origin
+   *
+   *  Generated on first use and shared by copies of the Grid object.
+   *  Thread-safe.
+   *
+   *  @returns Batches of the unit-centered quadrature
+   */
+  const std::vector<GridBatch>& batch_template() const;
+
+  /**
+   *  @brief Generate a quadrature batch centered at a particular point
+   *
+   *  The batch is translated from the batch template, i.e. unlike 
+   *  batcher().at(), this does not require (nor modify) the center of the 
+   *  underlying quadrature. Thread-safe.
+   *
+   *  @param[in] ibatch Index of the batch
+   *  @param[in] center Center of the quadrature
+   *
+   *  @returns The requested batch centered at center
+   */
+  GridBatch batch( size_t ibatch, const std::array<double,3>& center ) const;
+
 }; // class Grid
 
 } // namespace GauXC
@@ -10,6 +10,7 @@
 #include <integratorxx/composite_quadratures/spherical_quadrature.hpp>
 #include <integratorxx/composite_quadratures/pruned_spherical_quadrature.hpp>
 
+#include <limits>
 #include <variant>
 
 namespace GauXC {
@@ -57,11 +58,56 @@ PrunedAtomicGridSpecification treutler_pruning_scheme(
   UnprunedAtomicGridSpecification
 );
 
+/// Neighboring atom entering the density proxy of adaptive pruning
+struct AdaptivePruningNeighbor {
+  double distance;               ///< Distance of the neighbor to the atom
+  double weight;                 ///< Weight of the neighbor in the density proxy
+  std::vector<double> exponents; ///< Primitive exponents of the shells centered on the neighbor
+};
+
+/// Basis set dependent data which drives the adaptive pruning of an atomic quadrature
+struct AdaptivePruningSpecification {
+  std::vector<AdaptivePruningNeighbor> neighbors; ///< Neighbors inside the partition range
+  int32_t max_l = 0;             ///< Maximum angular momentum of the shells centered on the atom
+  double  tolerance = 1e-8;      ///< Target angular integration error of the atomic quadrature
+};
+
+/**
+ *  @brief Determine the angular quadrature orders required to meet a target
+ *  integration error over a radial quadrature
+ *
+ *  The angular integration error is estimated for a density proxy of 
+ *  normalized s-type Gaussians (one per exponent) centered on each of the 
+ *  neighbors in spec.neighbors, i.e. from the angular anisotropy of the 
+ *  weighted density of the neighbors as seen from the atom. The tolerance is 
+ *  distributed uniformly over the radial points. Orders are bounded below by 
+ *  max(7, 2*max_l+1) and above by max_order, isolated atoms (no neighbors) 
+ *  are assigned the lower bound.
+ *
+ *  @param[in] rad_points  Radial quadrature points
+ *  @param[in] rad_weights Radial quadrature weights (including r**2)
+ *  @param[in] max_order   Maximum algebraic order of the angular quadrature
+ *  @param[in] spec        Adaptive pruning specification
+ *
+ *  @returns Minimum algebraic order of the angular quadrature per radial point
+ */
+std::vector<int32_t> adaptive_angular_orders( 
+  const std::vector<double>& rad_points, const std::vector<double>& rad_weights,
+  int32_t max_order, const AdaptivePruningSpecification& spec
+);
+
+/// Generate an accuracy-targeted Pruning specification from an unpruned 
+/// specification (the unpruned angular size is the largest admissible size)
+PrunedAtomicGridSpecification adaptive_pruning_scheme(
+  UnprunedAtomicGridSpecification, const AdaptivePruningSpecification&
+);
+
 /// High-level specification of pruning schemes for atomic quadratures
 enum class PruningScheme {
   Unpruned, /// Unpruned atomic quadrature
   Robust,   /// The "Robust" scheme of Psi4
-  Treutler  /// The Treutler-Aldrichs scheme
+  Treutler, /// The Treutler-Aldrichs scheme
+  Adaptive  /// Accuracy-targeted pruning from the basis set
 };
 
 /// Generate a pruning specification from a specificed pruning scheme and 
@@ -70,6 +116,14 @@ PrunedAtomicGridSpecification create_pruned_spec(
   PruningScheme, UnprunedAtomicGridSpecification
 );
 
+/// Generate a pruning specification from a specificed pruning scheme and 
+/// an unpruned grid specification, PruningScheme::Adaptive is driven by
+/// the supplied adaptive pruning specification
+PrunedAtomicGridSpecification create_pruned_spec(
+  PruningScheme, UnprunedAtomicGridSpecification, 
+  const AdaptivePruningSpecification&
+);
+
 using atomic_grid_variant = 
   std::variant<UnprunedAtomicGridSpecification,
                PrunedAtomicGridSpecification>;
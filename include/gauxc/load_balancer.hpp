@@ -13,8 +13,11 @@
 #include <gauxc/basisset_map.hpp>
 #include <gauxc/shell_pair.hpp>
 #include <gauxc/xc_task.hpp>
+#include <gauxc/task_store.hpp>
+#include <gauxc/task_cost_model.hpp>
 #include <gauxc/util/timer.hpp>
 #include <gauxc/runtime_environment.hpp>
+#include <gauxc/enums.hpp>
 
 namespace GauXC {
 
@@ -27,6 +30,22 @@ namespace detail {
 struct LoadBalancerState {
   bool modified_weights_are_stored = false; 
     ///< Whether the load balancer currently stores partitioned weights
+  XCWeightAlg weight_alg = XCWeightAlg::SSF;
+    ///< Partitioning scheme of the stored weights
+  bool becke_size_adjustment = false;
+    ///< Whether the stored weights were partitioned with size adjustments
+  bool retain_quadrature_weights = false;
+    ///< Whether MolecularWeights::modify_weights retains the unpartitioned 
+    ///< weights in XCTask::quadrature_weights, required to update the 
+    ///< geometry of modified weights (cf. LoadBalancer::update_geometry)
+  uint64_t geometry_version = 0;
+    ///< Number of geometry updates (and plan loads) of the load balancer, 
+    ///< used to invalidate geometry dependent caches
+  uint64_t task_version = 0;
+    ///< Generation of the local tasks, incremented whenever the tasks are
+    ///< created, replaced, reordered or their weights modified. Caches of 
+    ///< per-task data are keyed on the position of a task within a 
+    ///< generation, external modifications of the tasks must increment it
 };
 
 
@@ -65,14 +84,91 @@ public:
   /// Get underlying (local) quadrature tasks for this process (non-cost)
         std::vector<XCTask>& get_tasks()      ;
 
+  /**
+   *  @brief Get the local quadrature tasks with their points and weights 
+   *  packed into contiguous (SoA) storage
+   *
+   *  The load balancer owns its tasks through a TaskStore. get_tasks 
+   *  exposes them in their AoS form and unpacks the store, task_store 
+   *  packs it. Packing and unpacking move the point data but neither the
+   *  tasks nor their order, i.e. they do not start a new task generation
+   *  (cf. LoadBalancerState::task_version).
+   */
+  TaskStore& task_store();
+
   /// Rebalance quadrature batches according to weight-only cost
   void rebalance_weights();
 
-  /// Rebalance quadrature batches according to exc-vxc cost
+  /// Rebalance quadrature batches according to exc-vxc cost (calibrated
+  /// from the measured task costs if available)
   void rebalance_exc_vxc();
 
-  /// Rebalance quadrature batches according to exx cost 
+  /// Rebalance quadrature batches according to exx cost (calibrated from 
+  /// the measured task costs if available)
   void rebalance_exx();
+
+  /// Fit the task cost models to the measured costs of the (global) tasks,
+  /// models without measured tasks are left unchanged
+  void calibrate_cost_models();
+
+  /// Write the task cost models to file (on the root process)
+  void save_cost_models( const std::string& fname ) const;
+
+  /// Read task cost models written by save_cost_models
+  void load_cost_models( const std::string& fname );
+
+  /**
+   *  @brief Write the local tasks of all processes to a load balancer plan
+   *
+   *  Collective. The plan is a versioned binary file which holds the tasks 
+   *  (with the current weights, screening data and measured costs) 
+   *  partitioned by process, the MolMeta and a fingerprint of the molecule,
+   *  grid and basis.
+   */
+  void save_plan( const std::string& fname ) const;
+
+  /**
+   *  @brief Replace the local tasks by those of a plan written by save_plan
+   *
+   *  Collective. Throws if the plan was generated for a different 
+   *  molecule, grid or basis, or for a different number of processes.
+   */
+  void load_plan( const std::string& fname );
+
+  /**
+   *  @brief Move the atoms of the underlying molecule to a new geometry
+   *
+   *  Rather than regenerating the quadrature, the (atom-centered) points of
+   *  the local tasks and the basis shells are rigidly translated with their
+   *  atoms. The MolMeta is updated for the pairs of displaced atoms, the
+   *  weights are reset to the unpartitioned quadrature weights (such that
+   *  they may be repartitioned) and the basis function screening is only 
+   *  redone for tasks whose bounding box has crossed the cutoff radius of a 
+   *  displaced shell. Tasks which no longer carry any shells are dropped.
+   *
+   *  If the weights have already been modified, they are restored from
+   *  XCTask::quadrature_weights, which MolecularWeights::modify_weights
+   *  only keeps if LoadBalancerState::retain_quadrature_weights is set
+   *  (throws otherwise).
+   *
+   *  @param[in] mol New geometry, must contain the same atoms (in the same 
+   *                 order) as the current molecule
+   */
+  void update_geometry( const Molecule& mol );
+
+  /// Return the exc-vxc task cost model
+  const TaskCostModel& exc_vxc_cost_model() const;
+
+  /// Return the exx task cost model
+  const TaskCostModel& exx_cost_model() const;
+
+  /// Predicted and measured exc-vxc load of the local tasks across all
+  /// processes (collective), e.g. to assess a rebalance
+  TaskLoadStatistics exc_vxc_load_statistics() const;
+
+  /// Predicted and measured exx load of the local tasks across all
+  /// processes (collective)
+  TaskLoadStatistics exx_load_statistics() const;
   
   /// Return internal timing tracker
   const util::Timer& get_timings() const;
@@ -141,6 +237,17 @@ public:
    *                           This gurantees contiguous memory access but leads
    *                           to significantly more work. Not advised for general 
    *                           usage
+   *    - "DISTRIBUTED": Read as "DISTRIBUTED-PETITE"
+   *    - "DISTRIBUTED-PETITE": Same as "REPLICATED-PETITE" except that each
+   *                            rank only generates a contiguous share of the
+   *                            quadrature batches, tasks are then migrated
+   *                            between ranks to balance their cost
+   *    - "DISTRIBUTED-FILLIN": Distributed variant of "REPLICATED-FILLIN"
+   *
+   *    Any of the above may be suffixed with "-SFC" (e.g. "DEFAULT-SFC"), in
+   *    which case the points of the merged tasks are ordered along a Hilbert
+   *    curve and tasks with more than 512 points are split into spatially
+   *    compact, individually screened sub-batches.
    * 
    *    Currently accepted values for Device execution space:
    *      - "DEFAULT": Read as "REPLICATED"
@@ -180,6 +287,29 @@ public:
     const RuntimeEnvironment& rt,
     const Molecule& mol, const MolGrid& mg, const BasisSet<double>&);
 
+  /** 
+   *  @brief Generate a LoadBalancer instance whose tasks are loaded from a
+   *         load balancer plan (see LoadBalancer::save_plan) rather than 
+   *         generated
+   *
+   *  @param[in] rt      Runtime handle, must match the number of processes 
+   *                     of the plan
+   *  @param[in] mol     Molecule on which the quadrature is defined.
+   *  @param[in] mg      The batched molecular quadrature
+   *  @param[in] bs      The basis set whcih will be used for numerical integration
+   *  @param[in] fname   Plan file
+   *
+   *  @returns A LoadBalancer instance with the tasks of the plan
+   */
+  LoadBalancer get_instance_from_plan( const RuntimeEnvironment& rt, 
+    const Molecule& mol, const MolGrid& mg, const BasisSet<double>& bs,
+    const std::string& fname );
+
+  /// Shared pointer variant of get_instance_from_plan
+  std::shared_ptr<LoadBalancer> get_shared_instance_from_plan( 
+    const RuntimeEnvironment& rt, const Molecule& mol, const MolGrid& mg, 
+    const BasisSet<double>& bs, const std::string& fname );
+
 private:
 
   ExecutionSpace ex_; ///< Execution space for the generated LoadBalancer instances
@@ -56,6 +56,8 @@ public:
   MolecularWeights( MolecularWeights&& ) noexcept;
 
   /// Apply weight partitioning scheme to pre-generated local quadrature tasks
+  /// (no-op if the stored weights were partitioned with the same scheme,
+  /// throws if they were partitioned with a different one)
   void modify_weights(load_balancer_reference lb) const;
 
   /// Return local timing tracker
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <gauxc/molgrid.hpp>
+#include <gauxc/basisset.hpp>
 
 namespace GauXC {
 
@@ -34,6 +35,26 @@ namespace GauXC {
       AtomicNumber, RadialQuad, AtomicGridSizeDefault
     );
 
+    /**
+     *  @brief Generate the adaptive pruning specification of an element
+     *
+     *  Collects the maximum angular momentum of the shells centered on atoms
+     *  of the element and, for the neighbors of such an atom within its 
+     *  partition range (distance d up to d_0 (1+a)/(1-a), with d_0 the 
+     *  nearest neighbor distance and a the SSF parameter), the distance, the
+     *  weight (d_0/d)**2 and the primitive exponents of the shells centered
+     *  on the neighbor.
+     *
+     *  @param[in] mol   Molecule
+     *  @param[in] basis Basis set of the molecule
+     *  @param[in] Z     Atomic number of the element
+     *  @param[in] tol   Target angular integration error of the atomic quadrature
+     */
+    static AdaptivePruningSpecification create_adaptive_pruning_spec(
+      const Molecule& mol, const BasisSet<double>& basis, AtomicNumber Z,
+      double tol = AdaptivePruningSpecification().tolerance
+    );
+
     template <typename... Args>
     inline static atomic_grid_variant 
       create_default_pruned_grid_spec( PruningScheme scheme, Args&&... args ) {
@@ -58,6 +79,30 @@ namespace GauXC {
       return molmap;
     }
 
+    /// Basis set dependent variant of create_default_grid_spec_map, 
+    /// required for PruningScheme::Adaptive
+    template <typename... Args>
+    inline static atomic_grid_spec_map create_default_grid_spec_map( 
+      const Molecule& mol, const BasisSet<double>& basis, PruningScheme scheme, 
+      Args&&... args ) {
+
+      if( scheme != PruningScheme::Adaptive )
+        return create_default_grid_spec_map( mol, scheme, 
+          std::forward<Args>(args)... );
+
+      atomic_grid_spec_map molmap;
+      for( const auto& atom : mol ) 
+      if( !molmap.count(atom.Z) ) {
+        molmap.emplace( atom.Z, 
+          adaptive_pruning_scheme( 
+            create_default_unpruned_grid_spec(atom.Z, std::forward<Args>(args)...),
+            create_adaptive_pruning_spec(mol, basis, atom.Z) )
+        );
+      }
+
+      return molmap;
+    }
+
     inline static atomic_grid_map generate_gridmap(
       const atomic_grid_spec_map& gs_map, BatchSize bsz ) {
 
@@ -79,6 +124,16 @@ namespace GauXC {
 
     }
 
+    template <typename... Args>
+    inline static atomic_grid_map create_default_gridmap( 
+      const Molecule& mol, const BasisSet<double>& basis, PruningScheme scheme, 
+      BatchSize bsz, Args&&... args ) {
+
+      return generate_gridmap( create_default_grid_spec_map(mol, basis, scheme, 
+        std::forward<Args>(args)...), bsz );
+
+    }
+
     template <typename... Args>
     inline static MolGrid create_default_molgrid( Args&&... args ) {
       return MolGrid( create_default_gridmap(std::forward<Args>(args)...) );
@@ -41,6 +41,17 @@ public:
 
   size_t sum_atomic_charges() const { return sum_atomic_charges_; }
 
+  /**
+   *  @brief Update the metadata after a subset of atoms has been displaced
+   *
+   *  Only the interatomic distances involving the displaced atoms are 
+   *  recomputed, followed by the nearest neighbor distances.
+   *
+   *  @param[in] mol   Molecule at the new geometry (same atoms)
+   *  @param[in] moved Indices of the displaced atoms
+   */
+  void update_geometry( const Molecule& mol, const std::vector<int32_t>& moved );
+
   template <typename Archive>
   void serialize( Archive& ar ) {
     ar( natoms_, rab_, dist_nearest_ );
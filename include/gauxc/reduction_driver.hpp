@@ -11,6 +11,7 @@
 #include <gauxc/runtime_environment.hpp>
 #include <typeindex>
 #include <any>
+#include <vector>
 
 namespace GauXC {
 
@@ -51,9 +52,63 @@ public:
   void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any );
   void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any );
 
+  /**
+   *  @brief Allreduce a set of symmetric matrices and scalars in a single message
+   *
+   *  Only the lower triangles of the (n x n) matrices are communicated. The
+   *  lower triangles and the scalars are packed into one message, reduced
+   *  in a single collective and unpacked, upon return the upper triangles
+   *  are set by symmetry. Matrices in node shared memory (all or none) are
+   *  reduced on-node by the leader. Requires host memory.
+   *
+   *  @param[in]     n        Dimension of the matrices
+   *  @param[in/out] matrices Matrices to reduce (column major)
+   *  @param[in]     ld       Leading dimensions of matrices
+   *  @param[in/out] scalars  Scalars to reduce
+   *  @param[in]     nscalars Number of scalars
+   */
+  template <typename T>
+  inline void allreduce_packed_symmetric( size_t n, const std::vector<T*>& matrices,
+    const std::vector<size_t>& ld, T* scalars, size_t nscalars, ReductionOp op ) {
+    std::vector<void*> matrices_te( matrices.begin(), matrices.end() );
+    allreduce_packed_symmetric_typeerased( n, matrices_te, ld, scalars, nscalars,
+      op, std::type_index(typeid(T)) );
+  }
+
+  void allreduce_packed_symmetric_typeerased( size_t, const std::vector<void*>&,
+    const std::vector<size_t>&, void*, size_t, ReductionOp, std::type_index );
+
   bool takes_host_memory() const;
   bool takes_device_memory() const;
 
+  /**
+   *  @brief Allocate memory which is shared by all processes of a node
+   *
+   *  Collective over the runtime communicator. Every process of a node
+   *  obtains a pointer to the same (single) copy. Integrands which reside in
+   *  node shared memory are accumulated on-node and only reduced across
+   *  nodes by allreduce_inplace. Throws if the driver does not support node
+   *  shared memory.
+   */
+  template <typename T>
+  inline T* allocate_node_shared( size_t size ) {
+    return static_cast<T*>( allocate_node_shared_typeerased( size * sizeof(T) ) );
+  }
+
+  void* allocate_node_shared_typeerased( size_t );
+
+  /// Release memory obtained from allocate_node_shared (collective)
+  void free_node_shared( void* );
+
+  /// Whether data resides in node shared memory
+  bool is_node_shared( const void* ) const;
+
+  /// Whether the calling process is the leader (rank 0) of its node
+  bool is_node_leader() const;
+
+  /// Synchronize the processes of a node, including node shared memory
+  void node_barrier();
+
 };
 
 
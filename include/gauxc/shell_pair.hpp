@@ -41,107 +41,68 @@ struct PrimitivePair {
   F gamma_inv;
 };
 
+/// Primitive pairs of a shell pair (view into a ShellPairCollection)
 template <typename F>
 class ShellPair {
 
-  using shell_type = Shell<F>;
-  using const_shell_ref = const shell_type&;
-
-  std::vector<PrimitivePair<F>> prim_pairs_;
-
-  void generate( const_shell_ref bra, const_shell_ref ket ) {
-
-    detail::cartesian_point A{ bra.O()[0], bra.O()[1], bra.O()[2] };
-    detail::cartesian_point B{ ket.O()[0], ket.O()[1], ket.O()[2] };
-
-    const auto rABx = A.x - B.x;
-    const auto rABy = A.y - B.y;
-    const auto rABz = A.z - B.z;
-
-    const auto dAB = rABx*rABx + rABy*rABy + rABz*rABz;
-
-    const auto np_bra = bra.nprim();
-    const auto np_ket = ket.nprim();
-    for( auto i = 0; i < np_bra; ++i )
-    for( auto j = 0; j < np_ket; ++j ) {
-
-      const auto alpha_bra = bra.alpha()[i];
-      const auto alpha_ket = ket.alpha()[j];
-
-      const auto g    = alpha_bra + alpha_ket;
-      const auto oo_g = 1 / g;
-
-      const auto Kab = 2 * M_PI * oo_g *
-        bra.coeff()[i] * ket.coeff()[j] *
-        std::exp( -alpha_bra * alpha_ket * dAB * oo_g );
-
-      // TODO Make configurable
-      if(std::abs(Kab) < 1e-12) continue;
-      auto& pair = prim_pairs_.emplace_back();
-
-      pair.P.x = (alpha_bra * A.x + alpha_ket * B.x) * oo_g;
-      pair.P.y = (alpha_bra * A.y + alpha_ket * B.y) * oo_g;
-      pair.P.z = (alpha_bra * A.z + alpha_ket * B.z) * oo_g;
-
-      pair.PA.x = pair.P.x - A.x;
-      pair.PA.y = pair.P.y - A.y;
-      pair.PA.z = pair.P.z - A.z;
-
-      pair.PB.x = pair.P.x - B.x;
-      pair.PB.y = pair.P.y - B.y;
-      pair.PB.z = pair.P.z - B.z;
-
-      pair.K_coeff_prod = Kab;
-      pair.gamma = g;
-      pair.gamma_inv = oo_g;
-    } // loop over prim pairs
-  } // generate
+  PrimitivePair<F>* prim_pairs_  = nullptr;
+  size_t            nprim_pairs_ = 0;
 
 public:
 
   ShellPair() = default;
+  ShellPair( PrimitivePair<F>* prim_pairs, size_t nprim_pairs ) :
+    prim_pairs_(prim_pairs), nprim_pairs_(nprim_pairs) { }
 
-  ShellPair( const Shell<F>& bra, const Shell<F>& ket ) {
-    if( bra.l() >= ket.l() ) generate(bra,ket);
-    else                     generate(ket,bra);
-  }
-
-  inline PrimitivePair<F>* prim_pairs() { return prim_pairs_.data(); }
-  inline const PrimitivePair<F>* prim_pairs() const { return prim_pairs_.data(); }
+  inline PrimitivePair<F>* prim_pairs() { return prim_pairs_; }
+  inline const PrimitivePair<F>* prim_pairs() const { return prim_pairs_; }
 
-  inline size_t nprim_pairs() const { return prim_pairs_.size(); }
+  inline size_t nprim_pairs() const { return nprim_pairs_; }
 
 };
 
-
+/**
+ *  Significant shell pairs of a basis (lower triangle, CSR storage)
+ *
+ *  Primitive pairs with |K_coeff_prod| below the screening tolerance are
+ *  discarded, as are the shell pairs without any significant primitive pair.
+ *  Primitive pairs are expanded about the shell of higher angular momentum 
+ *  and stored contiguously (in CSR order) for all shell pairs.
+ */
 template <typename F>
 class ShellPairCollection {
   size_t nshells_ = 0;
   std::vector<ShellPair<F>> shell_pairs_;
+  std::vector<PrimitivePair<F>> prim_pairs_;
   std::vector<size_t> row_ptr_, col_ind_;
   ShellPair<F> dummy;
 
+  // Point the shell pairs at the primitive pair storage
+  void rebase_shell_pairs( const PrimitivePair<F>* old_base );
+
 public:
-  ShellPairCollection( const BasisSet<F>& basis ) {
-    nshells_ = basis.size();
-
-    // Sparse Storage based on primitive screening
-    row_ptr_.resize(nshells_+1);
-    row_ptr_[0] = 0;
-    for(size_t i = 0; i < nshells_; ++i) {
-
-      size_t nnz_row = 0;
-      for(size_t j = 0; j <= i; ++j) {
-        ShellPair<F> sp(basis[i], basis[j]);
-        if(sp.nprim_pairs()) {
-          nnz_row++;
-          col_ind_.emplace_back(j);
-          shell_pairs_.emplace_back(std::move(sp));
-        }
-      }
-      row_ptr_[i+1] = row_ptr_[i] + nnz_row;
-    }    
+
+  /**
+   *  Construct the significant shell pairs of a basis (parallel over shells)
+   *
+   *  @param[in] basis           Basis set
+   *  @param[in] prim_screen_tol Screening tolerance for primitive pairs
+   */
+  ShellPairCollection( const BasisSet<F>& basis, F prim_screen_tol = 1e-12 );
+
+  ShellPairCollection( const ShellPairCollection& other ) :
+    nshells_(other.nshells_), shell_pairs_(other.shell_pairs_),
+    prim_pairs_(other.prim_pairs_), row_ptr_(other.row_ptr_),
+    col_ind_(other.col_ind_) {
+    rebase_shell_pairs( other.prim_pairs_.data() );
+  }
+  ShellPairCollection( ShellPairCollection&& ) noexcept = default;
+
+  ShellPairCollection& operator=( const ShellPairCollection& other ) {
+    if( this != &other ) *this = ShellPairCollection(other);
+    return *this;
   }
+  ShellPairCollection& operator=( ShellPairCollection&& ) noexcept = default;
 
   inline int64_t get_linear_shell_pair_index(size_t i, size_t j) const {
     return detail::csr_index(i, j, row_ptr_.data(), col_ind_.data());
@@ -160,13 +121,14 @@ public:
 
   inline size_t nshells() const { return nshells_; }
   inline size_t npairs() const { return shell_pairs_.size(); }
-  inline size_t nprim_pair_total() const {
-    return std::accumulate( shell_pairs_.cbegin(), shell_pairs_.cend(), 0ul,
-      [](const auto& a, const auto& b){ return a + b.nprim_pairs(); });
-  }
+  inline size_t nprim_pair_total() const { return prim_pairs_.size(); }
   inline auto* shell_pairs() { return shell_pairs_.data(); }
   inline auto* shell_pairs() const { return shell_pairs_.data(); }
 
+  /// Primitive pairs of all shell pairs (in CSR order)
+  inline auto* prim_pairs() { return prim_pairs_.data(); }
+  inline auto* prim_pairs() const { return prim_pairs_.data(); }
+
   inline auto& row_ptr() { return row_ptr_; }
   inline auto& row_ptr() const { return row_ptr_; }
   inline auto& col_ind() { return col_ind_; }
@@ -179,4 +141,6 @@ public:
   inline auto end() const { return shell_pairs_.end(); }  
 };
 
+extern template class ShellPairCollection<double>;
+
 }
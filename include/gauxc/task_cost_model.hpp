@@ -0,0 +1,122 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <array>
+#include <iosfwd>
+#include <string>
+#include <gauxc/xc_task.hpp>
+
+namespace GauXC {
+
+/**
+ *  @brief Linear model of the wall time of a quadrature task
+ *
+ *  The cost of a task is modeled as c . f(task), where f are the leading
+ *  terms of the work of the task for a particular integrand:
+ *    - ExcVXC: [ npts, npts*nbe, npts*nbe^2 ]
+ *    - EXX:    [ npts*nbe, npts*nbe*nbe_cou, npts*nshell_pairs ]
+ *  The coefficients are obtained from a non-negative least-squares fit to the
+ *  measured task costs (XCTask::measured_cost), such that they absorb the
+ *  dependence on the functional, the spin polarization and the hardware.
+ *  An uncalibrated model falls back to the analytic XCTask cost estimates.
+ */
+class TaskCostModel {
+
+public:
+
+  enum class Kind {
+    ExcVXC,
+    EXX
+  };
+
+  static constexpr size_t nterms = 3;
+  using term_type = std::array<double, nterms>;
+
+  /// Number of entries of the packed normal equations (A, b, t.t, nsamples)
+  static constexpr size_t normal_equations_size = nterms*nterms + nterms + 2;
+  using normal_equations_type = std::array<double, normal_equations_size>;
+
+  TaskCostModel() = default;
+  TaskCostModel( Kind kind ) : kind_(kind) { }
+
+  Kind kind() const { return kind_; }
+  const term_type& coeff() const { return coeff_; }
+  size_t nsamples() const { return nsamples_; }
+
+  /// Whether the model has been fit to (or loaded from) measured costs
+  bool calibrated() const { return nsamples_ > 0; }
+
+  /// Model terms of a task
+  term_type terms( const XCTask& task ) const;
+
+  /// Measured cost (s) of a task for this model's integrand
+  double measured( const XCTask& task ) const;
+
+  /// Predicted cost (s) of a task, only meaningful if calibrated()
+  double predict( const XCTask& task ) const;
+
+  /**
+   *  @brief Cost of a task in integral units for cost based task distribution
+   *
+   *  Predicted cost in ns if calibrated(), the analytic XCTask estimate
+   *  otherwise
+   */
+  size_t cost( const XCTask& task ) const;
+
+  /// Normal equations of the least-squares problem over the measured tasks
+  /// in [begin, end), may be summed across processes prior to fit()
+  normal_equations_type normal_equations(
+    std::vector<XCTask>::const_iterator begin,
+    std::vector<XCTask>::const_iterator end ) const;
+
+  /**
+   *  @brief Fit the model coefficients to the passed normal equations
+   *
+   *  The fit is constrained to non-negative coefficients. Leaves the
+   *  model unchanged if the normal equations contain no samples.
+   *
+   *  @returns Whether the model has been updated
+   */
+  bool fit( const normal_equations_type& ne );
+
+  /// Write the model as a single line of text
+  void write( std::ostream& os ) const;
+
+  /// Read a model written by write(), throws on kind mismatch
+  void read( std::istream& is );
+
+private:
+
+  Kind      kind_     = Kind::ExcVXC;
+  term_type coeff_    = {0., 0., 0.};
+  size_t    nsamples_ = 0;
+
+};
+
+/// Predicted (cost model) and measured load (s) of a distributed task list
+struct TaskLoadStatistics {
+  double predicted_max = 0.; ///< Maximum predicted load of a process
+  double predicted_avg = 0.; ///< Average predicted load of a process
+  double measured_max  = 0.; ///< Maximum measured load of a process
+  double measured_avg  = 0.; ///< Average measured load of a process
+
+  /// Predicted load imbalance (max/avg), 1 without load
+  double predicted_imbalance() const {
+    return predicted_avg > 0. ? predicted_max / predicted_avg : 1.;
+  }
+  /// Measured load imbalance (max/avg), 1 without load
+  double measured_imbalance() const {
+    return measured_avg > 0. ? measured_max / measured_avg : 1.;
+  }
+};
+
+/// String representation of a task cost model kind
+std::string to_string( TaskCostModel::Kind kind );
+
+}
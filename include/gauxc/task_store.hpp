@@ -0,0 +1,147 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+
+namespace GauXC {
+
+/**
+ *  @brief Owning store of a set of quadrature tasks with contiguous
+ *  (structure-of-arrays) storage of their points and weights
+ *
+ *  When packed, the points and weights of all tasks are held in two
+ *  buffers and the per-task vectors are released, task i is a view
+ *  (offset, npts) into the buffers. The points of a task are stored as
+ *  x(npts), y(npts), z(npts). The remaining task data (screening, costs)
+ *  stays on the XCTask instances, XCTask::npts holds the number of points
+ *  of a packed task.
+ *
+ *  Unpacking restores the per-task vectors, i.e. the tasks in their AoS
+ *  form (cf. LoadBalancer::get_tasks). Neither operation moves the XCTask
+ *  instances or changes their order.
+ */
+class TaskStore {
+
+public:
+
+  TaskStore() = default;
+
+  /// Take ownership of a set of (unpacked) tasks
+  explicit TaskStore( std::vector<XCTask>&& tasks ) :
+    tasks_( std::move(tasks) ) { }
+
+  /// Tasks of the store, their points and weights are empty if packed
+  std::vector<XCTask>&       tasks()       noexcept { return tasks_; }
+  const std::vector<XCTask>& tasks() const noexcept { return tasks_; }
+
+  size_t ntasks() const noexcept { return tasks_.size(); }
+  bool   packed() const noexcept { return packed_; }
+
+  /// Move the points and weights of all tasks into the SoA buffers
+  void pack() {
+
+    if( packed_ ) return;
+
+    const size_t ntasks = tasks_.size();
+    offsets_.assign( ntasks + 1, 0 );
+    for( size_t i = 0; i < ntasks; ++i ) {
+      const auto& task = tasks_[i];
+      if( task.weights.size() != task.points.size() )
+        GAUXC_GENERIC_EXCEPTION("Task Points and Weights Differ in Size");
+      offsets_[i+1] = offsets_[i] + task.points.size();
+    }
+
+    points_.resize( 3 * offsets_.back() );
+    weights_.resize( offsets_.back() );
+    for( size_t i = 0; i < ntasks; ++i ) {
+      auto& task = tasks_[i];
+      const size_t n = task.points.size();
+      double* _x = points_.data() + 3 * offsets_[i];
+      double* _y = _x + n;
+      double* _z = _y + n;
+      for( size_t j = 0; j < n; ++j ) {
+        _x[j] = task.points[j][0];
+        _y[j] = task.points[j][1];
+        _z[j] = task.points[j][2];
+      }
+      std::copy( task.weights.begin(), task.weights.end(),
+        weights_.data() + offsets_[i] );
+
+      task.npts = n;
+      decltype(task.points)().swap( task.points );
+      decltype(task.weights)().swap( task.weights );
+    }
+
+    packed_ = true;
+
+  }
+
+  /// Move the points and weights back into the tasks (AoS)
+  void unpack() {
+
+    if( not packed_ ) return;
+
+    const size_t ntasks = tasks_.size();
+    for( size_t i = 0; i < ntasks; ++i ) {
+      auto& task = tasks_[i];
+      const size_t n = npts(i);
+      const double* _x = x(i);
+      const double* _y = y(i);
+      const double* _z = z(i);
+      task.points.resize( n );
+      for( size_t j = 0; j < n; ++j )
+        task.points[j] = { _x[j], _y[j], _z[j] };
+      task.weights.assign( weights(i), weights(i) + n );
+      task.npts = n;
+    }
+
+    decltype(offsets_)().swap( offsets_ );
+    decltype(points_)().swap( points_ );
+    decltype(weights_)().swap( weights_ );
+    packed_ = false;
+
+  }
+
+  /// Total number of points (packed store)
+  size_t npts() const noexcept { return weights_.size(); }
+
+  /// Number of points of task i (packed store)
+  size_t npts( size_t i ) const noexcept {
+    return offsets_[i+1] - offsets_[i];
+  }
+
+  /// Points of task i as x(npts), y(npts), z(npts) (packed store)
+  const double* points( size_t i ) const noexcept {
+    return points_.data() + 3 * offsets_[i];
+  }
+  const double* x( size_t i ) const noexcept { return points(i); }
+  const double* y( size_t i ) const noexcept { return points(i) + npts(i); }
+  const double* z( size_t i ) const noexcept {
+    return points(i) + 2 * npts(i);
+  }
+
+  /// Weights of task i (packed store)
+  double*       weights( size_t i )       noexcept {
+    return weights_.data() + offsets_[i];
+  }
+  const double* weights( size_t i ) const noexcept {
+    return weights_.data() + offsets_[i];
+  }
+
+private:
+
+  std::vector<XCTask> tasks_;
+  bool                packed_ = false;
+  std::vector<size_t> offsets_; ///< Point offsets of the tasks (ntasks+1)
+  std::vector<double> points_;  ///< Per task x(npts), y(npts), z(npts)
+  std::vector<double> weights_;
+
+};
+
+}
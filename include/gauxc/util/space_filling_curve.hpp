@@ -0,0 +1,115 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace GauXC {
+namespace geometry {
+
+/// Maximum number of bits per dimension of 3D space filling curve keys
+inline constexpr int sfc_max_bits = 21;
+
+/**
+ *  @brief Morton (Z-order) key of a point on a (2^nbits)^3 integer grid
+ */
+inline uint64_t morton_key( std::array<uint32_t,3> x, int nbits = sfc_max_bits ) {
+  uint64_t key = 0;
+  for( int b = nbits - 1; b >= 0; --b )
+  for( int i = 0; i < 3; ++i ) key = (key << 1) | ((x[i] >> b) & 1u);
+  return key;
+}
+
+/**
+ *  @brief Hilbert key of a point on a (2^nbits)^3 integer grid
+ *
+ *  Uses the transpose formulation of J. Skilling, AIP Conf. Proc. 707, 381
+ *  (2004). Points with consecutive keys are adjacent on the grid.
+ */
+inline uint64_t hilbert_key( std::array<uint32_t,3> x, int nbits = sfc_max_bits ) {
+
+  const uint32_t M = 1u << (nbits - 1);
+
+  // Inverse undo
+  for( uint32_t Q = M; Q > 1; Q >>= 1 ) {
+    const uint32_t P = Q - 1;
+    for( int i = 0; i < 3; ++i )
+    if( x[i] & Q ) x[0] ^= P;
+    else {
+      const uint32_t t = (x[0] ^ x[i]) & P;
+      x[0] ^= t; x[i] ^= t;
+    }
+  }
+
+  // Gray encode
+  for( int i = 1; i < 3; ++i ) x[i] ^= x[i-1];
+  uint32_t t = 0;
+  for( uint32_t Q = M; Q > 1; Q >>= 1 ) if( x[2] & Q ) t ^= Q - 1;
+  for( int i = 0; i < 3; ++i ) x[i] ^= t;
+
+  return morton_key( x, nbits );
+
+}
+
+enum class SpaceFillingCurve {
+  Hilbert,
+  Morton
+};
+
+/**
+ *  @brief Permutation which orders a set of points along a space filling
+ *  curve over their (cubic) bounding box
+ *
+ *  @param[in] points Points to order
+ *  @param[in] curve  Space filling curve
+ *  @returns   order  Indices of points in curve order (stable for equal keys)
+ */
+template <typename T>
+std::vector<size_t> space_filling_curve_order(
+  const std::vector<std::array<T,3>>& points,
+  SpaceFillingCurve curve = SpaceFillingCurve::Hilbert ) {
+
+  const size_t npts = points.size();
+  std::vector<size_t> order( npts );
+  std::iota( order.begin(), order.end(), 0 );
+  if( npts < 2 ) return order;
+
+  std::array<T,3> lo, up;
+  lo.fill( std::numeric_limits<T>::max() );
+  up.fill( std::numeric_limits<T>::lowest() );
+  for( const auto& p : points )
+  for( int i = 0; i < 3; ++i ) {
+    lo[i] = std::min( lo[i], p[i] );
+    up[i] = std::max( up[i], p[i] );
+  }
+
+  const T extent = std::max( { up[0] - lo[0], up[1] - lo[1], up[2] - lo[2] } );
+  const T scale  = extent > T(0) ? T((1u << sfc_max_bits) - 1) / extent : T(0);
+
+  std::vector<uint64_t> keys( npts );
+  for( size_t ipt = 0; ipt < npts; ++ipt ) {
+    std::array<uint32_t,3> x;
+    for( int i = 0; i < 3; ++i )
+      x[i] = static_cast<uint32_t>( (points[ipt][i] - lo[i]) * scale );
+    keys[ipt] = curve == SpaceFillingCurve::Hilbert ? hilbert_key(x) :
+                                                      morton_key(x);
+  }
+
+  std::stable_sort( order.begin(), order.end(),
+    [&]( size_t a, size_t b ){ return keys[a] < keys[b]; } );
+  return order;
+
+}
+
+}
+}
@@ -0,0 +1,177 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/util/geometry.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <limits>
+
+namespace GauXC {
+namespace geometry {
+
+/**
+ *  @brief Uniform cell list over a set of spheres (e.g. shell centers and
+ *  their cutoff radii).
+ *
+ *  Each sphere is binned into every cell overlapped by its bounding cube
+ *  such that box queries only need to visit the cells overlapped by the
+ *  query box. Query results are identical to a brute force
+ *  cube_sphere_intersect over all spheres (in ascending index order).
+ */
+template <typename T>
+class SphereCellList {
+
+  using point_type = std::array<T,3>;
+
+  std::vector<point_type> centers_;
+  std::vector<T>          radii_;
+
+  point_type            origin_;
+  T                     cell_size_;
+  std::array<int64_t,3> ncells_;
+
+  std::vector<int64_t> cell_ptr_; ///< CSR row pointer over cells
+  std::vector<int32_t> cell_ind_; ///< Sphere indices binned into cells
+
+  inline int64_t cell_coord( T x, int k ) const noexcept {
+    const int64_t c = static_cast<int64_t>( std::floor((x - origin_[k]) / cell_size_) );
+    return std::clamp( c, int64_t(0), ncells_[k] - 1 );
+  }
+
+  inline int64_t cell_index( int64_t i, int64_t j, int64_t k ) const noexcept {
+    return i + ncells_[0] * (j + ncells_[1] * k);
+  }
+
+public:
+
+  /**
+   *  @param[in] centers   Sphere centers
+   *  @param[in] radii     Sphere radii
+   *  @param[in] cell_size Edge length of a cell (<= 0 selects the mean radius)
+   *  @param[in] max_cells_per_sphere Upper bound on the average number of
+   *                       cells per sphere (cells are grown if exceeded)
+   */
+  SphereCellList( std::vector<point_type> centers, std::vector<T> radii,
+    T cell_size = 0., size_t max_cells_per_sphere = 8 ) :
+    centers_(std::move(centers)), radii_(std::move(radii)) {
+
+    if( centers_.size() != radii_.size() )
+      GAUXC_GENERIC_EXCEPTION("SphereCellList: Inconsistent Centers/Radii");
+
+    const size_t nsph = centers_.size();
+
+    // Bounding box of all spheres
+    point_type lo, up;
+    lo.fill( std::numeric_limits<T>::max() );
+    up.fill( std::numeric_limits<T>::lowest() );
+    T rad_sum = 0.;
+    for( size_t i = 0; i < nsph; ++i ) {
+      for( int k = 0; k < 3; ++k ) {
+        lo[k] = std::min( lo[k], centers_[i][k] - radii_[i] );
+        up[k] = std::max( up[k], centers_[i][k] + radii_[i] );
+      }
+      rad_sum += radii_[i];
+    }
+    if( !nsph ) { lo.fill(0.); up.fill(0.); }
+    origin_ = lo;
+
+    if( cell_size <= 0. ) cell_size = nsph ? rad_sum / nsph : T(1.);
+    cell_size = std::max( cell_size, std::numeric_limits<T>::epsilon() );
+
+    // Grow cells until the grid is bounded by the number of spheres
+    const size_t max_cells = std::max<size_t>( 1, max_cells_per_sphere * nsph );
+    for(;;) {
+      size_t ntot = 1;
+      for( int k = 0; k < 3; ++k ) {
+        ncells_[k] = std::max<int64_t>( 1,
+          static_cast<int64_t>( std::ceil((up[k] - lo[k]) / cell_size) ) );
+        ntot *= ncells_[k];
+      }
+      if( ntot <= max_cells ) break;
+      cell_size *= 1.25;
+    }
+    cell_size_ = cell_size;
+
+    // Bin spheres into the cells overlapped by their bounding cubes
+    const size_t ncells_tot = ncells_[0] * ncells_[1] * ncells_[2];
+    cell_ptr_.assign( ncells_tot + 1, 0 );
+
+    auto for_each_cell = [&]( size_t isph, auto&& op ) {
+      const auto& c = centers_[isph];
+      const auto  r = radii_[isph];
+      const int64_t i_st = cell_coord(c[0]-r,0), i_en = cell_coord(c[0]+r,0);
+      const int64_t j_st = cell_coord(c[1]-r,1), j_en = cell_coord(c[1]+r,1);
+      const int64_t k_st = cell_coord(c[2]-r,2), k_en = cell_coord(c[2]+r,2);
+      for( int64_t k = k_st; k <= k_en; ++k )
+      for( int64_t j = j_st; j <= j_en; ++j )
+      for( int64_t i = i_st; i <= i_en; ++i ) op( cell_index(i,j,k) );
+    };
+
+    for( size_t i = 0; i < nsph; ++i )
+      for_each_cell( i, [&](int64_t ic){ cell_ptr_[ic+1]++; } );
+    for( size_t ic = 0; ic < ncells_tot; ++ic ) cell_ptr_[ic+1] += cell_ptr_[ic];
+
+    cell_ind_.resize( cell_ptr_.back() );
+    std::vector<int64_t> cell_fill( cell_ptr_.begin(), cell_ptr_.end()-1 );
+    for( size_t i = 0; i < nsph; ++i )
+      for_each_cell( i, [&](int64_t ic){ cell_ind_[cell_fill[ic]++] = i; } );
+
+  }
+
+  inline size_t nspheres()  const noexcept { return centers_.size(); }
+  inline T      cell_size() const noexcept { return cell_size_; }
+  inline size_t ncells()    const noexcept { return cell_ptr_.size() - 1; }
+
+  /// Apply op(isph) to every sphere which intersects the box [lo, up]
+  /// (each sphere exactly once, order unspecified)
+  template <typename Op>
+  void for_each_intersecting( const point_type& lo, const point_type& up,
+    Op&& op ) const {
+
+    std::array<int64_t,3> q_st, q_en;
+    for( int k = 0; k < 3; ++k ) {
+      q_st[k] = cell_coord( lo[k], k );
+      q_en[k] = cell_coord( up[k], k );
+    }
+
+    for( int64_t k = q_st[2]; k <= q_en[2]; ++k )
+    for( int64_t j = q_st[1]; j <= q_en[1]; ++j )
+    for( int64_t i = q_st[0]; i <= q_en[0]; ++i ) {
+      const auto ic = cell_index(i,j,k);
+      for( auto _s = cell_ptr_[ic]; _s < cell_ptr_[ic+1]; ++_s ) {
+        const auto isph = cell_ind_[_s];
+        const auto& c = centers_[isph];
+        const auto  r = radii_[isph];
+
+        // Only visit a sphere in the first cell shared by the sphere and the
+        // query box to avoid duplicates
+        if( i != std::max( q_st[0], cell_coord(c[0]-r,0) ) ) continue;
+        if( j != std::max( q_st[1], cell_coord(c[1]-r,1) ) ) continue;
+        if( k != std::max( q_st[2], cell_coord(c[2]-r,2) ) ) continue;
+
+        if( cube_sphere_intersect( lo, up, c, r ) ) op( isph );
+      }
+    }
+
+  }
+
+  /// Indices (ascending) of all spheres which intersect the box [lo, up]
+  std::vector<int32_t> query( const point_type& lo, const point_type& up ) const {
+    std::vector<int32_t> list;
+    for_each_intersecting( lo, up, [&](int32_t i){ list.emplace_back(i); } );
+    std::sort( list.begin(), list.end() );
+    return list;
+  }
+
+};
+
+}
+}
@@ -41,6 +41,7 @@ class Timer {
   using duration = std::chrono::duration<Rep,Period>;
 
   std::map< std::string, duration<double, std::milli>> timings_;
+  std::map< std::string, std::string > annotations_; ///< Non-timing metadata
 
 public:
 
@@ -159,6 +160,13 @@ public:
 
   inline const auto& all_timings() const { return timings_; }
 
+  /// Attach metadata (e.g. the selected kernel variant) to the timings
+  inline void add_annotation( std::string name, std::string value ) {
+    annotations_.insert_or_assign( std::move(name), std::move(value) );
+  }
+
+  inline const auto& all_annotations() const { return annotations_; }
+
 };
 
 
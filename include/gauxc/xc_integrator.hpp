@@ -71,6 +71,12 @@ public:
   exx_type      eval_exx     ( const MatrixType&, 
                                const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
 
+  exc_vxc_type_rks  eval_exc_vxc_incremental( const MatrixType&, 
+                                   const IntegratorSettingsXC& = IntegratorSettingsXC{} );
+  exx_type      eval_exx_incremental( const MatrixType&, 
+                               const IntegratorSettingsEXX& = IntegratorSettingsEXX{} );
+  void          reset_incremental();
+
 
   const util::Timer& get_timings() const;
   const LoadBalancer& load_balancer() const;
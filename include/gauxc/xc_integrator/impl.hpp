@@ -89,6 +89,28 @@ typename XCIntegrator<MatrixType>::exx_type
   return pimpl_->eval_exx(P,settings);
 };
 
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exc_vxc_type_rks
+  XCIntegrator<MatrixType>::eval_exc_vxc_incremental( const MatrixType& dP, 
+                                                      const IntegratorSettingsXC& ks_settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exc_vxc_incremental(dP, ks_settings);
+};
+
+template <typename MatrixType>
+typename XCIntegrator<MatrixType>::exx_type
+  XCIntegrator<MatrixType>::eval_exx_incremental( const MatrixType&     dP,
+                                                  const IntegratorSettingsEXX& settings ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->eval_exx_incremental(dP,settings);
+};
+
+template <typename MatrixType>
+void XCIntegrator<MatrixType>::reset_incremental() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->reset_incremental();
+};
+
 template <typename MatrixType>
 const util::Timer& XCIntegrator<MatrixType>::get_timings() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
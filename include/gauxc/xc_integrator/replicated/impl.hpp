@@ -186,5 +186,43 @@ typename ReplicatedXCIntegrator<MatrixType>::exx_type
 
 }
 
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exc_vxc_type_rks 
+  ReplicatedXCIntegrator<MatrixType>::eval_exc_vxc_incremental_( const MatrixType& dP, const IntegratorSettingsXC& ks_settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  matrix_type VXC( dP.rows(), dP.cols() );
+  value_type  EXC;
+
+  pimpl_->eval_exc_vxc_incremental( dP.rows(), dP.cols(), dP.data(), dP.rows(),
+                                    VXC.data(), VXC.rows(), &EXC, ks_settings );
+
+  return std::make_tuple( EXC, VXC );
+
+}
+
+template <typename MatrixType>
+typename ReplicatedXCIntegrator<MatrixType>::exx_type 
+  ReplicatedXCIntegrator<MatrixType>::eval_exx_incremental_( const MatrixType& dP, const IntegratorSettingsEXX& settings ) {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  
+  matrix_type K( dP.rows(), dP.cols() );
+
+  pimpl_->eval_exx_incremental( dP.rows(), dP.cols(), dP.data(), dP.rows(),
+                                K.data(), K.rows(), settings );
+
+  return K;
+
+}
+
+template <typename MatrixType>
+void ReplicatedXCIntegrator<MatrixType>::reset_incremental_() {
+
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->reset_incremental();
+
+}
+
 }
 }
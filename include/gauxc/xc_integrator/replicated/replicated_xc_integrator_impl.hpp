@@ -80,6 +80,24 @@ protected:
                           int64_t ldp, value_type* K, int64_t ldk,
                           const IntegratorSettingsEXX& settings ) = 0;
 
+  // Incremental evaluation is optional for implementations
+  virtual void eval_exc_vxc_incremental_( int64_t m, int64_t n, 
+                                          const value_type* dP, int64_t lddp, 
+                                          value_type* VXC, int64_t ldvxc,
+                                          value_type* EXC, 
+                                          const IntegratorSettingsXC& ks_settings );
+  virtual void eval_exx_incremental_( int64_t m, int64_t n, const value_type* dP,
+                                      int64_t lddp, value_type* K, int64_t ldk,
+                                      const IntegratorSettingsEXX& settings );
+  virtual void reset_incremental_();
+
+  std::vector<value_type> xc_incremental_P_;  ///< Reference density of incremental XC
+  std::vector<value_type> exx_incremental_K_; ///< Reference K of incremental EXX
+
+  /// Accumulate dP (m x n) into a reference density (zero if uninitialized)
+  static void accumulate_incremental( int64_t m, int64_t n, const value_type* dP,
+    int64_t lddp, std::vector<value_type>& P_ref );
+
 public:
 
   ReplicatedXCIntegratorImpl( std::shared_ptr< functional_type >   func,
@@ -137,6 +155,14 @@ public:
                  int64_t ldp, value_type* K, int64_t ldk,
                  const IntegratorSettingsEXX& settings );
 
+  void eval_exc_vxc_incremental( int64_t m, int64_t n, const value_type* dP,
+                                 int64_t lddp, value_type* VXC, int64_t ldvxc,
+                                 value_type* EXC, const IntegratorSettingsXC& ks_settings ); 
+  void eval_exx_incremental( int64_t m, int64_t n, const value_type* dP,
+                             int64_t lddp, value_type* K, int64_t ldk,
+                             const IntegratorSettingsEXX& settings );
+  void reset_incremental();
+
   inline const util::Timer& get_timings() const { return timer_; }
 
   inline std::unique_ptr< LocalWorkDriver > release_local_work_driver() {
@@ -48,6 +48,9 @@ private:
   exc_vxc_type_gks  eval_exc_vxc_ ( const MatrixType&, const MatrixType&, const MatrixType&, const MatrixType&, const IntegratorSettingsXC& ) override;
   exc_grad_type eval_exc_grad_( const MatrixType& ) override;
   exx_type      eval_exx_     ( const MatrixType&, const IntegratorSettingsEXX& ) override;
+  exc_vxc_type_rks  eval_exc_vxc_incremental_ ( const MatrixType&, const IntegratorSettingsXC& ) override;
+  exx_type      eval_exx_incremental_( const MatrixType&, const IntegratorSettingsEXX& ) override;
+  void          reset_incremental_() override;
   const util::Timer& get_timings_() const override;
   const LoadBalancer& get_load_balancer_() const override;
   LoadBalancer& get_load_balancer_() override;
@@ -41,6 +41,11 @@ protected:
   virtual exc_grad_type eval_exc_grad_( const MatrixType& P ) = 0;
   virtual exx_type      eval_exx_     ( const MatrixType&     P, 
                                         const IntegratorSettingsEXX& settings ) = 0;
+  virtual exc_vxc_type_rks  eval_exc_vxc_incremental_ ( const MatrixType& dP, 
+                                        const IntegratorSettingsXC& ks_settings ) = 0;
+  virtual exx_type      eval_exx_incremental_( const MatrixType& dP, 
+                                        const IntegratorSettingsEXX& settings ) = 0;
+  virtual void          reset_incremental_() = 0;
   virtual const util::Timer& get_timings_() const = 0;
   virtual const LoadBalancer& get_load_balancer_() const = 0;
   virtual LoadBalancer& get_load_balancer_() = 0;
@@ -127,6 +132,44 @@ public:
     return eval_exx_(P,settings);
   }
 
+  /** Incrementally integrate EXC / VXC for RKS
+   *
+   *  The reference density is the sum of every dP passed since construction
+   *  (or the last reset_incremental or geometry update of the load balancer,
+   *  after which dP is the full density). Tasks for which the density change on
+   *  their basis function submatrix is negligible reuse their cached
+   *  contributions. The cached contributions are discarded whenever the
+   *  tasks of the load balancer change (see LoadBalancerState::task_version).
+   *
+   *  Incremental evaluation is only available for RKS densities, UKS / GKS
+   *  EXC / VXC are evaluated with eval_exc_vxc.
+   *
+   *  @param[in] dP Change of the alpha density matrix since the last call
+   *  @returns EXC / VXC at the updated reference density
+   */
+  exc_vxc_type_rks eval_exc_vxc_incremental( const MatrixType& dP, const IntegratorSettingsXC& ks_settings ) {
+    return eval_exc_vxc_incremental_(dP, ks_settings);
+  }
+
+  /** Incrementally integrate Exact Exchange for RHF
+   *
+   *  Only the change of the exchange matrix is integrated, and screened, 
+   *  with respect to dP. As for eval_exc_vxc_incremental, the reference is
+   *  discarded by reset_incremental and by geometry updates of the load 
+   *  balancer.
+   *
+   *  @param[in] dP Change of the alpha density matrix since the last call
+   *  @returns Exact Exchange Matrix at the updated reference density
+   */
+  exx_type eval_exx_incremental( const MatrixType& dP, const IntegratorSettingsEXX& settings ) {
+    return eval_exx_incremental_(dP, settings);
+  }
+
+  /// Discard the reference densities and cached incremental contributions
+  void reset_incremental() {
+    reset_incremental_();
+  }
+
   /** Get internal timers
    *
    *  @returns Timer instance for internal timings
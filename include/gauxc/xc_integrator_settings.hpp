@@ -6,19 +6,37 @@
  * See LICENSE.txt for details
  */
 #pragma once
+#include <cstddef>
 
 namespace GauXC {
 
+/// Strategy for accumulating task-local contributions into shared
+/// (nbf x nbf) host matrices
+enum class HostAccumulationStrategy {
+  Auto,          ///< Select based on nbf and the number of threads
+  Atomic,        ///< Atomic update of every matrix element
+  ThreadPrivate, ///< Thread-private replicas reduced after the task loop
+  TileLock       ///< Lock tiles of the target matrix while updating
+};
+
 struct IntegratorSettingsEXX { virtual ~IntegratorSettingsEXX() noexcept = default; };
 struct IntegratorSettingsSNLinK : public IntegratorSettingsEXX {
   bool screen_ek = true;
   double energy_tol = 1e-10;
   double k_tol      = 1e-10;
+  HostAccumulationStrategy accumulation = HostAccumulationStrategy::Auto;
+  bool reuse_screening_plan = true;
+  size_t collocation_cache_bytes = 0;   ///< Host collocation cache budget (0 disables)
+  bool   collocation_cache_fp32  = false; ///< Store cached collocation in single precision
 };
 
 struct IntegratorSettingsXC { virtual ~IntegratorSettingsXC() noexcept = default; };
 struct IntegratorSettingsKS : public IntegratorSettingsXC {
   double gks_dtol = 1e-12;
+  double incremental_dtol = 1e-10;
+  HostAccumulationStrategy accumulation = HostAccumulationStrategy::Auto;
+  size_t collocation_cache_bytes = 0;   ///< Host collocation cache budget (0 disables)
+  bool   collocation_cache_fp32  = false; ///< Store cached collocation in single precision
 };
 
 }
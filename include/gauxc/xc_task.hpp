@@ -25,6 +25,10 @@ struct XCTask {
   std::vector< double  >               weights;
   int32_t                              npts = 0;
 
+  /// Unpartitioned quadrature weights, retained upon modification of the
+  /// weights if requested (cf. LoadBalancerState::retain_quadrature_weights)
+  std::vector< double  >               quadrature_weights;
+
   double                               dist_nearest;
   double                               max_weight = std::numeric_limits<double>::infinity();
 
@@ -50,18 +54,40 @@ struct XCTask {
 
   inline size_t volume() const {
     return 2 * sizeof(int32_t) +
-      (3*points.size() + weights.size() + 2) * sizeof(double) +
+      (3*points.size() + weights.size() + quadrature_weights.size() + 2) * 
+        sizeof(double) +
       bfn_screening.volume() + cou_screening.volume();
   }
 
   screening_data bfn_screening;
   screening_data cou_screening;
 
+  /// Measured wall time (s) of the last evaluation of this task per
+  /// integrand, zero if the task has not been timed
+  struct measured_cost_data {
+    double exc_vxc = 0.;
+    double exx     = 0.;
+  } measured_cost;
+
+  /// Whether the unpartitioned quadrature weights of the task are retained
+  inline bool has_quadrature_weights() const {
+    return quadrature_weights.size() and 
+      quadrature_weights.size() == weights.size();
+  }
+
   void merge_with( const XCTask& other ) {
     if( !equiv_with(other) )
       GAUXC_GENERIC_EXCEPTION("Cannot Perform Requested Merge: Incompatible Tasks");
+    const bool merge_qw = 
+      quadrature_weights.size() or other.quadrature_weights.size();
+    if( merge_qw and 
+        (!has_quadrature_weights() or !other.has_quadrature_weights()) )
+      GAUXC_GENERIC_EXCEPTION("Cannot Perform Requested Merge: Inconsistent Quadrature Weights");
     points.insert( points.end(), other.points.begin(), other.points.end() );
     weights.insert( weights.end(), other.weights.begin(), other.weights.end() );
+    if( merge_qw )
+      quadrature_weights.insert( quadrature_weights.end(), 
+        other.quadrature_weights.begin(), other.quadrature_weights.end() );
     npts = points.size();
   }
 
@@ -74,17 +100,31 @@ struct XCTask {
         return a + t.points.size();
       });
 
+    // Quadrature weights are merged if retained by any of the tasks, in
+    // which case they have to be retained by all of them
+    const bool merge_qw = quadrature_weights.size() or 
+      std::any_of( begin, end, 
+        []( const auto& t ){ return t.quadrature_weights.size(); } );
+    if( merge_qw and ( !has_quadrature_weights() or !std::all_of( begin, end,
+        []( const auto& t ){ return t.has_quadrature_weights(); } ) ) )
+      GAUXC_GENERIC_EXCEPTION("Cannot Perform Requested Task Merge: Inconsistent Quadrature Weights");
+
     size_t new_sz = old_sz + pts_add;
     points.resize( new_sz );
     weights.resize( new_sz );
+    if( merge_qw ) quadrature_weights.resize( new_sz );
 
     auto points_it  = points.begin()  + old_sz;
     auto weights_it = weights.begin() + old_sz;
+    auto qw_it      = quadrature_weights.begin() + (merge_qw ? old_sz : 0);
     for( auto it = begin; it != end; ++it ) {
       if( !equiv_with(*it) )
         GAUXC_GENERIC_EXCEPTION("Cannot Perform Requested Task Merge");
       points_it  = std::copy( it->points.begin(), it->points.end(), points_it );
       weights_it = std::copy( it->weights.begin(), it->weights.end(), weights_it );
+      if( merge_qw )
+        qw_it = std::copy( it->quadrature_weights.begin(), 
+          it->quadrature_weights.end(), qw_it );
     }
 
     npts = points.size();
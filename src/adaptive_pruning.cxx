@@ -0,0 +1,216 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/grid_factory.hpp>
+#include <gauxc/exceptions.hpp>
+
+#include <integratorxx/quadratures/lebedev_laikov.hpp>
+#include <integratorxx/quadratures/muraknowles.hpp>
+#include <integratorxx/quadratures/mhl.hpp>
+#include <integratorxx/quadratures/treutlerahlrichs.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ *  Accuracy-targeted pruning of atomic quadratures.
+ *
+ *  The density proxy of an element is a weighted sum over the neighbors in
+ *  its partition range of normalized squared s-type Gaussians, one per 
+ *  primitive exponent of the basis functions centered on the neighbor. On 
+ *  the sphere of radius r around an atom, the proxy of a neighbor B at 
+ *  distance d with weight w_B is
+ *
+ *    rho(r,theta) = w_B sum_p c_p N_p exp(-2 a_p (r-d)**2) exp(-k_p (1-cos theta))
+ *
+ *  with k_p = 4 a_p r d. Its Legendre expansion is
+ *
+ *    exp(-k (1-cos theta)) = sum_l (2l+1) s_l(k) P_l(cos theta)
+ *
+ *  with s_l(k) = exp(-k) i_l(k) (scaled modified spherical Bessel functions)
+ *  and sum_l (2l+1) s_l(k) = 1. An angular quadrature of algebraic order L
+ *  integrates the terms l <= L exactly, the angular integration error is
+ *  thus bounded by 4 pi times the part of the expansion with l > L.
+ */
+
+namespace GauXC {
+
+namespace {
+
+/// Above this argument, the Gaussian (large k) limit of s_l(k) is used
+constexpr double large_kappa = 500.;
+
+/**
+ *  Part of the Legendre expansion of exp(-k (1-cos theta)) beyond degree L,
+ *  i.e. sum_{l>L} (2l+1) s_l(k), for L = 0..lmax
+ */
+std::vector<double> angular_tail( double kappa, int32_t lmax ) {
+
+  std::vector<double> tail( lmax + 1, 0. );
+  if( kappa <= 0. ) return tail;
+
+  // s_l(k) ~ exp(-l(l+1)/2k) / 2k
+  if( kappa > large_kappa ) {
+    for( int32_t L = 0; L <= lmax; ++L )
+      tail[L] = std::exp( -(L + 1.) * (L + 2.) / (2. * kappa) );
+    return tail;
+  }
+
+  // Ratios s_l / s_{l-1} by (stable) downward recurrence
+  const int32_t lstart = std::max<int32_t>( lmax, std::ceil(kappa) ) + 40;
+  std::vector<double> ratio( lstart + 1, 0. );
+  double r = 0.;
+  for( int32_t l = lstart; l >= 1; --l )
+    ratio[l] = r = kappa / ( 2*l + 1 + kappa * r );
+
+  std::vector<double> term( lstart + 1 );
+  double s = -std::expm1( -2. * kappa ) / ( 2. * kappa ); // s_0
+  term[0] = s;
+  for( int32_t l = 1; l <= lstart; ++l ) {
+    s *= ratio[l];
+    term[l] = ( 2*l + 1 ) * s;
+  }
+
+  double acc = 0.;
+  for( int32_t l = lstart; l > lmax; --l ) acc += term[l];
+  for( int32_t L = lmax; L >= 0; --L ) {
+    tail[L] = acc;
+    acc += term[L];
+  }
+
+  return tail;
+
+}
+
+template <typename RadialQuadType>
+auto radial_nodes( RadialSize nrad, RadialScale rscal ) {
+  RadialQuadType rq( nrad.get(), rscal.get() );
+  return std::make_tuple(
+    std::vector<double>( rq.points().begin(),  rq.points().end()  ),
+    std::vector<double>( rq.weights().begin(), rq.weights().end() )
+  );
+}
+
+}
+
+std::vector<int32_t> adaptive_angular_orders(
+  const std::vector<double>& rad_points, const std::vector<double>& rad_weights,
+  int32_t max_order, const AdaptivePruningSpecification& spec ) {
+
+  const size_t nrad = rad_points.size();
+  if( rad_weights.size() != nrad )
+    GAUXC_GENERIC_EXCEPTION("Radial Points and Weights Must Be the Same Size");
+  if( spec.tolerance <= 0. )
+    GAUXC_GENERIC_EXCEPTION("Adaptive Pruning Requires A Positive Tolerance");
+
+  const int32_t min_order =
+    std::min( max_order, std::max( 7, 2*spec.max_l + 1 ) );
+  std::vector<int32_t> orders( nrad, min_order );
+
+  // Isotropic proxy for isolated atoms
+  if( nrad == 0 or spec.neighbors.empty() ) return orders;
+
+  size_t nprim = 0;
+  for( const auto& nbr : spec.neighbors ) {
+    if( not (nbr.distance > 0.) or not std::isfinite(nbr.distance) )
+      GAUXC_GENERIC_EXCEPTION("Adaptive Pruning Requires Finite Neighbor Distances");
+    if( nbr.exponents.empty() )
+      GAUXC_GENERIC_EXCEPTION("Adaptive Pruning Requires Basis Exponents");
+    nprim += nbr.exponents.size();
+  }
+
+  const double allowance = spec.tolerance / nrad;
+
+  // Neglected primitives contribute at most 1e-3 of the allowance
+  const double neglect = 1e-3 * allowance / nprim;
+
+  std::vector<double> err( max_order + 1 );
+  for( size_t i = 0; i < nrad; ++i ) {
+
+    const double r = rad_points[i];
+    std::fill( err.begin(), err.end(), 0. );
+
+    for( const auto& nbr : spec.neighbors ) {
+      const double d  = nbr.distance;
+      const double dr = r - d;
+      const double c  = nbr.weight / nbr.exponents.size();
+      for( auto alpha : nbr.exponents ) {
+        const double norm = c * std::pow( 2. * alpha / M_PI, 1.5 );
+        const double pref =
+          4. * M_PI * rad_weights[i] * norm * std::exp( -2. * alpha * dr * dr );
+        if( pref <= neglect ) continue;
+
+        const auto tail = angular_tail( 4. * alpha * r * d, max_order );
+        for( int32_t L = 0; L <= max_order; ++L ) err[L] += pref * tail[L];
+      }
+    }
+
+    int32_t L = min_order;
+    while( L < max_order and err[L] > allowance ) ++L;
+    orders[i] = L;
+
+  }
+
+  return orders;
+
+}
+
+
+
+PrunedAtomicGridSpecification adaptive_pruning_scheme(
+  UnprunedAtomicGridSpecification unp,
+  const AdaptivePruningSpecification& spec ) {
+
+  // Look up order
+  // XXX: THIS ONLY WORKS FOR LEBEDEV
+  using namespace IntegratorXX::detail::lebedev;
+  const auto base_order = algebraic_order_by_npts(unp.angular_size.get());
+  if( base_order < 0 ) GAUXC_GENERIC_EXCEPTION("Invalid Base Grid");
+
+  using mk_type  = IntegratorXX::MuraKnowles<double,double>;
+  using mhl_type = IntegratorXX::MurrayHandyLaming<double,double>;
+  using ta_type  = IntegratorXX::TreutlerAhlrichs<double,double>;
+
+  std::vector<double> rad_points, rad_weights;
+  switch( unp.radial_quad ) {
+    case RadialQuad::MuraKnowles:
+      std::tie(rad_points, rad_weights) =
+        radial_nodes<mk_type>( unp.radial_size, unp.radial_scale );
+      break;
+    case RadialQuad::MurrayHandyLaming:
+      std::tie(rad_points, rad_weights) =
+        radial_nodes<mhl_type>( unp.radial_size, unp.radial_scale );
+      break;
+    case RadialQuad::TreutlerAldrichs:
+      std::tie(rad_points, rad_weights) =
+        radial_nodes<ta_type>( unp.radial_size, unp.radial_scale );
+      break;
+    default:
+      GAUXC_GENERIC_EXCEPTION("Unsupported Radial Quadrature");
+      abort();
+  }
+
+  const auto orders =
+    adaptive_angular_orders( rad_points, rad_weights, base_order, spec );
+
+  // Create Pruning Regions (contiguous radial points of equal angular size)
+  std::vector<PruningRegion> pruning_regions;
+  for( size_t i = 0; i < orders.size(); ++i ) {
+    AngularSize asz( npts_by_algebraic_order(next_algebraic_order(orders[i])) );
+    if( pruning_regions.size() and pruning_regions.back().angular_size == asz )
+      pruning_regions.back().idx_en = i + 1;
+    else
+      pruning_regions.push_back( {i, i + 1, asz} );
+  }
+
+  return PrunedAtomicGridSpecification{
+    unp.radial_quad, unp.radial_size, unp.radial_scale, pruning_regions
+  };
+
+}
+
+}
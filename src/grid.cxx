@@ -24,4 +24,29 @@ Grid::~Grid() noexcept = default;
 const batcher_type& Grid::batcher() const { return pimpl_->batcher(); }
       batcher_type& Grid::batcher()       { return pimpl_->batcher(); }
 
+size_t Grid::nbatches() const { return pimpl_->batcher().nbatches(); }
+
+const std::vector<GridBatch>& Grid::batch_template() const {
+  return pimpl_->batch_template();
+}
+
+GridBatch Grid::batch( size_t ibatch, const std::array<double,3>& center ) const {
+
+  const auto& unit = pimpl_->batch_template().at(ibatch);
+
+  GridBatch b;
+  b.points.resize( unit.points.size() );
+  for( int k = 0; k < 3; ++k ) {
+    b.lo[k] = unit.lo[k] + center[k];
+    b.up[k] = unit.up[k] + center[k];
+  }
+  for( size_t i = 0; i < unit.points.size(); ++i )
+  for( int k = 0; k < 3; ++k ) 
+    b.points[i][k] = unit.points[i][k] + center[k];
+  b.weights = unit.weights;
+
+  return b;
+
+}
+
 }
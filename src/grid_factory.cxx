@@ -213,6 +213,9 @@ PrunedAtomicGridSpecification create_pruned_spec(
       return robust_psi4_pruning_scheme(unp);
     case PruningScheme::Treutler:
       return treutler_pruning_scheme(unp);
+    case PruningScheme::Adaptive:
+      GAUXC_GENERIC_EXCEPTION("Adaptive Pruning Requires An AdaptivePruningSpecification");
+      abort();
     
     // Default to Unpruned Grid
     case PruningScheme::Unpruned:
@@ -227,4 +230,15 @@ PrunedAtomicGridSpecification create_pruned_spec(
 
 }
 
+PrunedAtomicGridSpecification create_pruned_spec(
+  PruningScheme scheme, UnprunedAtomicGridSpecification unp,
+  const AdaptivePruningSpecification& spec
+) {
+
+  if( scheme == PruningScheme::Adaptive ) 
+    return adaptive_pruning_scheme(unp, spec);
+  return create_pruned_spec(scheme, unp);
+
+}
+
 }
@@ -10,7 +10,8 @@
 namespace GauXC {
 namespace detail {
 
-GridImpl::GridImpl( std::shared_ptr<quadrature_type> q, BatchSize bs ) : quad_(q) {
+GridImpl::GridImpl( std::shared_ptr<quadrature_type> q, BatchSize bs ) : 
+  quad_(q), batch_template_( std::make_shared<batch_template_type>() ) {
   generate_batcher(bs);
 }
 
@@ -33,5 +34,36 @@ void GridImpl::generate_batcher(BatchSize max_batch_sz) {
 
 }
 
+void GridImpl::generate_batch_template() const {
+
+  // Batches are read from the shared batcher and translated to the origin in
+  // a private copy, the shared quadrature (and its center) is left untouched
+  const auto& batcher = *batcher_;
+  const auto  center  = batcher.quadrature().center();
+
+  const size_t nbatches = batcher.nbatches();
+  auto& batches = batch_template_->batches;
+  batches.resize( nbatches );
+
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
+    auto [lo, up, points, weights] = batcher.at(ibatch);
+    for( int k = 0; k < 3; ++k ) {
+      lo[k] -= center[k];
+      up[k] -= center[k];
+    }
+    for( auto& p : points )
+    for( int k = 0; k < 3; ++k ) p[k] -= center[k];
+    batches[ibatch] = GridBatch{ lo, up, std::move(points), std::move(weights) };
+  }
+
+}
+
+const std::vector<GridBatch>& GridImpl::batch_template() const {
+  std::call_once( batch_template_->generated, 
+    [this](){ generate_batch_template(); } );
+  return batch_template_->batches;
+}
+
 }
 }
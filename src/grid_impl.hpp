@@ -8,6 +8,7 @@
 #pragma once
 
 #include <gauxc/grid.hpp>
+#include <mutex>
 
 namespace GauXC {
 namespace detail {
@@ -17,7 +18,15 @@ class GridImpl {
   std::shared_ptr< quadrature_type > quad_    = nullptr;
   std::shared_ptr< batcher_type    > batcher_ = nullptr;
 
+  /// Unit-centered batches, generated once and shared between copies
+  struct batch_template_type {
+    std::once_flag         generated;
+    std::vector<GridBatch> batches;
+  };
+  std::shared_ptr< batch_template_type > batch_template_ = nullptr;
+
   void generate_batcher(BatchSize);
+  void generate_batch_template() const;
 
 public:
 
@@ -36,6 +45,8 @@ public:
   const batcher_type& batcher() const;
         batcher_type& batcher()      ;
 
+  const std::vector<GridBatch>& batch_template() const;
+
 };
 
 }
@@ -18,6 +18,7 @@ protected:
 
   using basis_type = BasisSet<double>;
   std::vector< XCTask > create_local_tasks_() const override;
+  std::string task_settings_() const override;
 
 public:
 
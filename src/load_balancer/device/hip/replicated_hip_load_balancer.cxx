@@ -45,6 +45,10 @@ DeviceReplicatedLoadBalancer::DeviceReplicatedLoadBalancer( DeviceReplicatedLoad
 
 DeviceReplicatedLoadBalancer::~DeviceReplicatedLoadBalancer() noexcept = default;
 
+std::string DeviceReplicatedLoadBalancer::task_settings_() const {
+  return "DEVICE-REPLICATED";
+}
+
 std::unique_ptr<LoadBalancerImpl> DeviceReplicatedLoadBalancer::clone() const {
   return std::make_unique<DeviceReplicatedLoadBalancer>(*this);
 }
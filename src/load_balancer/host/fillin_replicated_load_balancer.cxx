@@ -6,7 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "fillin_replicated_load_balancer.hpp"
-#include <gauxc/util/geometry.hpp>
+#include <numeric>
 
 namespace GauXC  {
 namespace detail {
@@ -20,12 +20,17 @@ std::unique_ptr<LoadBalancerImpl> FillInHostReplicatedLoadBalancer::clone() cons
   return std::make_unique<FillInHostReplicatedLoadBalancer>(*this);
 }
 
+std::string FillInHostReplicatedLoadBalancer::task_settings_() const {
+  return "FILLIN;" + HostReplicatedLoadBalancer::task_settings_();
+}
+
 
 
 
 
 std::pair<std::vector<int32_t>,size_t> FillInHostReplicatedLoadBalancer::micro_batch_screen(
   const BasisSet<double>&      bs,
+  const shell_index_type&      shell_index,
   const std::array<double,3>&  box_lo,
   const std::array<double,3>&  box_up
 ) const {
@@ -33,19 +38,10 @@ std::pair<std::vector<int32_t>,size_t> FillInHostReplicatedLoadBalancer::micro_b
 
   int32_t first_shell = -1;
   int32_t last_shell  = -1;
-  for(auto iSh = 0ul; iSh < bs.size(); ++iSh) {
-
-    const auto& center = bs[iSh].O();
-    const auto  crad   = bs[iSh].cutoff_radius();
-    const bool intersect = 
-      geometry::cube_sphere_intersect( box_lo, box_up, center, crad );
-    
-    if( intersect ) {
-      if( first_shell < 0 ) first_shell = iSh;
-      last_shell = iSh;
-    }
-
-  }
+  shell_index.for_each_intersecting( box_lo, box_up, [&]( int32_t iSh ) {
+    if( first_shell < 0 or iSh < first_shell ) first_shell = iSh;
+    last_shell = std::max( last_shell, iSh );
+  });
 
   if( first_shell < 0 ) {
     return std::pair( std::vector<int32_t>{}, 0ul );
@@ -62,5 +58,15 @@ std::pair<std::vector<int32_t>,size_t> FillInHostReplicatedLoadBalancer::micro_b
 
 }
 
+void FillInHostReplicatedLoadBalancer::fill_in_shell_list_( 
+  std::vector<int32_t>& shell_list ) const {
+
+  if( shell_list.empty() ) return;
+  const int32_t first_shell = shell_list.front();
+  shell_list.resize( shell_list.back() - first_shell + 1 );
+  std::iota( shell_list.begin(), shell_list.end(), first_shell );
+
+}
+
 }
 }
@@ -25,8 +25,15 @@ struct FillInHostReplicatedLoadBalancer : public HostReplicatedLoadBalancer {
   std::unique_ptr<LoadBalancerImpl> clone() const override final;
 
   std::pair< std::vector<int32_t>, size_t > micro_batch_screen(
-    const BasisSet<double>&, const std::array<double,3>&,
-    const std::array<double,3>& ) const override final;
+    const BasisSet<double>&, const shell_index_type&, 
+    const std::array<double,3>&, const std::array<double,3>& ) const override final;
+
+protected:
+
+  /// Fill the gaps between the first and last shell of the list
+  void fill_in_shell_list_( std::vector<int32_t>& ) const override final;
+
+  std::string task_settings_() const override final;
 
 };
 
@@ -12,6 +12,9 @@ namespace GauXC {
 
 struct LoadBalancerHostFactory {
 
+  /// Maximum number of points per task after spatial reordering ("-SFC")
+  static constexpr size_t default_spatial_batch_size = 512;
+
   static std::shared_ptr<LoadBalancer> get_shared_instance(
     std::string kernel_name, const RuntimeEnvironment& rt,
     const Molecule& mol, const MolGrid& mg, const BasisSet<double>& basis
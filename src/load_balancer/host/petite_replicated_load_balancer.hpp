@@ -25,8 +25,12 @@ struct PetiteHostReplicatedLoadBalancer : public HostReplicatedLoadBalancer {
   std::unique_ptr<LoadBalancerImpl> clone() const override final;
 
   std::pair< std::vector<int32_t>, size_t > micro_batch_screen(
-    const BasisSet<double>&, const std::array<double,3>&,
-    const std::array<double,3>& ) const override final;
+    const BasisSet<double>&, const shell_index_type&, 
+    const std::array<double,3>&, const std::array<double,3>& ) const override final;
+
+protected:
+
+  std::string task_settings_() const override final;
 
 };
 
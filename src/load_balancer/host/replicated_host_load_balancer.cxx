@@ -6,6 +6,12 @@
  * See LICENSE.txt for details
  */
 #include "replicated_host_load_balancer.hpp"
+#include "rebalance.hpp"
+#include <gauxc/util/div_ceil.hpp>
+#include <gauxc/util/space_filling_curve.hpp>
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 
 namespace GauXC {
 namespace detail {
@@ -15,115 +21,211 @@ HostReplicatedLoadBalancer::HostReplicatedLoadBalancer( HostReplicatedLoadBalanc
 
 HostReplicatedLoadBalancer::~HostReplicatedLoadBalancer() noexcept = default;
 
+std::vector<int32_t> HostReplicatedLoadBalancer::screen_box_( 
+  const shell_index_type& shell_index, const std::array<double,3>& lo, 
+  const std::array<double,3>& up ) const {
+  return micro_batch_screen( *this->basis_, shell_index, lo, up ).first;
+}
+
+std::string HostReplicatedLoadBalancer::task_settings_() const {
+  return std::string("HOST-REPLICATED;DISTRIBUTED=") + 
+    (distributed_generation_ ? "1" : "0") + ";SPATIAL_BATCH=" +
+    std::to_string(spatial_batch_size_);
+}
+
 std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
 
-  const int32_t n_deriv = 1; // Effects cost heuristic
+  auto local_work = distributed_generation_ ? 
+    generate_distributed_tasks_() : generate_replicated_tasks_();
 
-  int32_t world_rank = runtime_.comm_rank();
-  int32_t world_size = runtime_.comm_size();
+  merge_equivalent_tasks_( local_work );
+  if( spatial_batch_size_ ) spatially_reorder_tasks_( local_work );
+  return local_work;
 
-  std::vector< XCTask > local_work;
-  std::vector<size_t> global_workload( world_size, 0 );   
+}
 
-  const auto natoms = this->mol_->natoms();
-  int32_t iCurrent  = 0;
-  int32_t atBatchSz = 1;
+XCTask HostReplicatedLoadBalancer::generate_task_( const shell_index_type& shell_index,
+  int32_t iAtom, const std::array<double,3>& lo, const std::array<double,3>& up, 
+  std::vector<std::array<double,3>>&& points, std::vector<double>&& weights ) const {
+
+  XCTask task;
+  if( points.size() == 0 ) return task;
+
+  // Microbatch Screening
+  auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), shell_index, 
+    lo, up );
+
+  // Course grain screening
+  if( not shell_list.size() ) return task; 
+
+  // Copy task data
+  task.iParent    = iAtom;
+  // This enables lazy assignment of points vector (see CUDA impl)
+  task.npts       = points.size(); 
+  task.points     = std::move( points );
+  task.weights    = std::move( weights );
+  task.bfn_screening.shell_list = std::move(shell_list);
+  task.bfn_screening.nbe        = nbe;
+  task.dist_nearest = molmeta_->dist_nearest()[iAtom];
 
-  const size_t max_nbatches = mg_->max_nbatches();
-  std::vector< std::pair<size_t, XCTask> > temp_tasks;
-  temp_tasks.reserve( max_nbatches );
+  return task;
 
-  // For batching of multiple atom screening
-  size_t batch_idx_offset = 0;
+}
+
+std::pair< std::vector<const Grid*>, std::vector<size_t> > 
+  HostReplicatedLoadBalancer::atomic_batch_layout_() const {
+
+  const auto& mol   = *this->mol_;
+  const auto natoms = mol.natoms();
+
+  std::vector<const Grid*> atom_grids( natoms );
+  std::vector<size_t>      atom_batch_offset( natoms + 1, 0 );
+  for( size_t iAtom = 0; iAtom < natoms; ++iAtom ) {
+    const Grid& grid = mg_->get_grid(mol[iAtom].Z);
+    grid.batch_template(); // Generated outside of the parallel generation
+    atom_grids[iAtom] = &grid;
+    atom_batch_offset[iAtom+1] = atom_batch_offset[iAtom] + grid.nbatches();
+  }
+
+  return std::pair( std::move(atom_grids), std::move(atom_batch_offset) );
 
-  // Loop over Atoms
-  for( const auto& atom : *this->mol_ ) {
+}
 
-    const std::array<double,3> center = { atom.x, atom.y, atom.z };
+std::vector< XCTask > HostReplicatedLoadBalancer::generate_batch_tasks_(
+  const shell_index_type& shell_index, 
+  const std::vector<const Grid*>& atom_grids,
+  const std::vector<size_t>& atom_batch_offset, 
+  size_t batch_st, size_t batch_en ) const {
 
-    auto& batcher = mg_->get_grid(atom.Z).batcher();
-    batcher.quadrature().recenter( center );
-    const size_t nbatches = batcher.nbatches();
+  const auto& mol = *this->mol_;
+  std::vector< XCTask > tasks( batch_en - batch_st );
 
-    #pragma omp parallel for
-    for( size_t ibatch = 0; ibatch < nbatches; ++ibatch ) {
-    
-      size_t batch_idx = ibatch + batch_idx_offset;
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t ibatch = batch_st; ibatch < batch_en; ++ibatch ) {
 
-      // Generate the batch (non-negligible cost)
-      auto [lo, up, points, weights] = batcher.at(ibatch);
+    // Parent atom of the batch
+    const int32_t iAtom = std::distance( atom_batch_offset.begin(),
+      std::upper_bound( atom_batch_offset.begin(), atom_batch_offset.end(), 
+        ibatch ) ) - 1;
+    const auto& atom = mol[iAtom];
 
-      if( points.size() == 0 ) continue;
+    // Generate the batch (non-negligible cost)
+    auto [lo, up, points, weights] = atom_grids[iAtom]->batch( 
+      ibatch - atom_batch_offset[iAtom], { atom.x, atom.y, atom.z } );
 
-      // Microbatch Screening
-      auto [shell_list, nbe] = micro_batch_screen( (*this->basis_), lo, up );
+    // Screen the batch
+    tasks[ibatch - batch_st] = generate_task_( shell_index, iAtom, lo, up, 
+      std::move(points), std::move(weights) );
 
-      // Course grain screening
-      if( not shell_list.size() ) continue; 
+  } // omp parallel for over (atom, batch) pairs
 
-      // Copy task data
-      XCTask task;
-      task.iParent    = iCurrent;
-      // This enables lazy assignment of points vector (see CUDA impl)
-      task.npts       = points.size(); 
-      task.points     = std::move( points );
-      task.weights    = std::move( weights );
-      task.bfn_screening.shell_list = std::move(shell_list);
-      task.bfn_screening.nbe        = nbe;
-      task.dist_nearest = molmeta_->dist_nearest()[iCurrent];
+  return tasks;
 
-      #pragma omp critical
-      temp_tasks.push_back( 
-        std::pair(batch_idx,std::move( task )) 
-      );
+}
 
-    } // omp parallel for over batches
+std::vector< XCTask > HostReplicatedLoadBalancer::generate_replicated_tasks_() const {
 
+  const int32_t n_deriv = 1; // Effects cost heuristic
 
+  int32_t world_rank = runtime_.comm_rank();
+  int32_t world_size = runtime_.comm_size();
 
+  std::vector< XCTask > local_work;
+  std::vector<size_t> global_workload( world_size, 0 );   
 
+  const auto natoms = this->mol_->natoms();
+  const auto [atom_grids, atom_batch_offset] = atomic_batch_layout_();
 
-    // Assign Tasks to MPI ranks
-    if( (iCurrent+1) % atBatchSz == 0 or iCurrent == ((int32_t)natoms-1) ) {
+  // Spatial index for micro batch screening
+  const auto shell_index = make_shell_index( *this->basis_ );
 
-      // Sort based on task index for deterministic assignment
-      std::sort( temp_tasks.begin(), temp_tasks.end(), 
-        []( const auto& a, const auto& b ) {
-          return a.first < b.first;
-        } );
+  // Batches are generated for blocks of consecutive atoms with at least 
+  // as many batches as the largest atomic grid (bounding the number of
+  // tasks held at once), in parallel over all batches of a block
+  const size_t block_nbatches = mg_->max_nbatches();
+  for( size_t iAtom_st = 0, iAtom_en; iAtom_st < natoms; iAtom_st = iAtom_en ) {
 
-      // Assign batches to MPI ranks
-      for( size_t ibatch = 0; ibatch < temp_tasks.size(); ++ibatch ) {
+    iAtom_en = iAtom_st + 1;
+    while( iAtom_en < natoms and 
+      atom_batch_offset[iAtom_en] - atom_batch_offset[iAtom_st] < block_nbatches )
+      iAtom_en++;
 
-        XCTask task = std::move(temp_tasks.at(ibatch).second);
-        //auto& points = task.points;
-        //auto  nbe    = task.nbe;
+    auto block_tasks = generate_batch_tasks_( shell_index, atom_grids, 
+      atom_batch_offset, atom_batch_offset[iAtom_st], 
+      atom_batch_offset[iAtom_en] );
 
-        // Get rank with minimum work
-        auto min_rank_it = 
-          std::min_element( global_workload.begin(), global_workload.end() );
-        int64_t min_rank = std::distance( global_workload.begin(), min_rank_it );
+    // Assign Tasks to MPI ranks (deterministic, in batch order)
+    for( auto& task : block_tasks ) {
 
-        // Compute cost heuristic and increment total work
-        global_workload[ min_rank ] += task.cost( n_deriv, natoms );
+      if( task.iParent < 0 ) continue;
 
-        if( world_rank == min_rank ) 
-          local_work.push_back( std::move(task) );
+      // Get rank with minimum work
+      auto min_rank_it = 
+        std::min_element( global_workload.begin(), global_workload.end() );
+      int64_t min_rank = std::distance( global_workload.begin(), min_rank_it );
 
-      }
+      // Compute cost heuristic and increment total work
+      global_workload[ min_rank ] += task.cost( n_deriv, natoms );
 
-      temp_tasks.clear();
+      if( world_rank == min_rank ) 
+        local_work.push_back( std::move(task) );
 
     }
 
+  } // Loop over atom blocks
 
-    // Update counters and offsets
-    iCurrent++;
-    batch_idx_offset += nbatches;
+  return local_work;
 
-  } // Loop over Atoms
+}
+
+std::vector< XCTask > HostReplicatedLoadBalancer::generate_distributed_tasks_() const {
+
+  const int32_t n_deriv = 1; // Effects cost heuristic
+
+  int32_t world_rank = runtime_.comm_rank();
+  int32_t world_size = runtime_.comm_size();
+
+  const auto [atom_grids, atom_batch_offset] = atomic_batch_layout_();
+
+  // Each rank generates a contiguous, deterministic share of the batches
+  const size_t nbatches_total = atom_batch_offset.back();
+  const size_t nbatches_rank  = util::div_ceil( nbatches_total, world_size );
+  const size_t batch_st = std::min( world_rank * nbatches_rank, nbatches_total );
+  const size_t batch_en = std::min( batch_st + nbatches_rank, nbatches_total );
+
+  // Spatial index for micro batch screening
+  const auto shell_index = make_shell_index( *this->basis_ );
+
+  auto batch_tasks = generate_batch_tasks_( shell_index, atom_grids, 
+    atom_batch_offset, batch_st, batch_en );
+
+  // Keep the non-negligible tasks (in global batch order)
+  std::vector< XCTask > local_work; 
+  for( auto& task : batch_tasks ) 
+  if( task.iParent >= 0 ) local_work.emplace_back( std::move(task) );
+  batch_tasks.clear();
+
+  // Migrate tasks such that each rank holds a contiguous segment of the 
+  // global task list with approximately equal cost
+#ifdef GAUXC_HAS_MPI
+  if( world_size > 1 ) {
+    const auto natoms = this->mol_->natoms();
+    auto cost = [=](const XCTask& task){ return task.cost(n_deriv, natoms); };
+    local_work = rebalance( local_work.begin(), local_work.end(), cost, 
+      runtime_.comm() );
+  }
+#else
+  (void)(n_deriv);
+#endif
+
+  return local_work;
+
+}
+
+void HostReplicatedLoadBalancer::merge_equivalent_tasks_( 
+  std::vector< XCTask >& local_work ) {
 
-//return local_work;
+  if( local_work.empty() ) return;
 
   // Lexicographic ordering of tasks
   auto task_order = []( const auto& a, const auto& b ) {
@@ -141,58 +243,126 @@ std::vector< XCTask > HostReplicatedLoadBalancer::create_local_tasks_() const  {
     task_order ); 
 
 
-  // Get unique tasks
+  // Task equivalence
   auto task_equiv = []( const auto& a, const auto& b ) {
     return a.equiv_with(b);
   };
 
-  auto local_work_unique = local_work;
-  auto last_unique = 
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-  
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
+  // Merge each run of equivalent tasks into its first task in place, the
+  // merged task is moved to the front. Only one run is duplicated at a time
+  // (rather than the entire task list)
+  auto merged_end = local_work.begin();
+  for( auto run_st = local_work.begin(); run_st != local_work.end(); ) {
+
+    auto run_en = std::find_if_not( std::next(run_st), local_work.end(),
+      [&]( const auto& t ){ return task_equiv( *run_st, t ); } );
+
+    if( merged_end != run_st ) *merged_end = std::move(*run_st);
+    merged_end->merge_with( std::next(run_st), run_en );
+
+    // Release the merged constituents
+    for( auto it = std::next(run_st); it != run_en; ++it ) {
+      it->points  = decltype(it->points)();
+      it->weights = decltype(it->weights)();
+    }
+
+    ++merged_end;
+    run_st = run_en;
+
   }
 
-  auto cur_lw_begin = local_work.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
+  local_work.erase( merged_end, local_work.end() );
 
-  for( auto lw_it = local_work.begin(); lw_it != local_work.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
+}
 
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
 
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
+void HostReplicatedLoadBalancer::spatially_reorder_tasks_( 
+  std::vector< XCTask >& local_work ) const {
 
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
+  const size_t ntasks   = local_work.size();
+  const size_t max_npts = spatial_batch_size_;
 
-  }
+  // Spatial index for micro batch screening
+  const auto shell_index = make_shell_index( *this->basis_ );
 
-  // Merge the last set of batches
-  for( ; cur_lw_begin != local_work.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
-  
+  std::vector< std::vector<XCTask> > sub_tasks( ntasks );
 
-  local_work = std::move(local_work_unique);
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
 
-  return local_work;
-}
+    auto& task = local_work[iT];
+    const size_t npts = task.points.size();
 
+    // Reorder points along the curve
+    const auto order = geometry::space_filling_curve_order( task.points );
+    std::vector< std::array<double,3> > points( npts );
+    std::vector< double >               weights( npts );
+    for( size_t i = 0; i < npts; ++i ) {
+      points[i]  = task.points[order[i]];
+      weights[i] = task.weights[order[i]];
+    }
+    task.points  = std::move(points);
+    task.weights = std::move(weights);
+
+    if( npts <= max_npts ) continue;
+
+    // Split into contiguous segments of the curve of (nearly) equal size.
+    // Both the screening over the bounding box of a segment and that of the
+    // parent task are valid for its points, the intersection is kept
+    const auto& basis = *this->basis_;
+    const auto& shell_list = task.bfn_screening.shell_list;
+    const size_t nsplit = util::div_ceil( npts, max_npts );
+    for( size_t is = 0; is < nsplit; ++is ) {
+
+      const size_t st = (is * npts)     / nsplit;
+      const size_t en = ((is+1) * npts) / nsplit;
+
+      std::array<double,3> lo = task.points[st], up = task.points[st];
+      for( size_t i = st; i < en; ++i )
+      for( int k = 0; k < 3; ++k ) {
+        lo[k] = std::min( lo[k], task.points[i][k] );
+        up[k] = std::max( up[k], task.points[i][k] );
+      }
 
+      auto [box_shell_list, box_nbe] = 
+        micro_batch_screen( basis, shell_index, lo, up );
+      (void)(box_nbe);
+
+      std::vector<int32_t> sub_shell_list;
+      std::set_intersection( shell_list.begin(), shell_list.end(),
+        box_shell_list.begin(), box_shell_list.end(), 
+        std::back_inserter(sub_shell_list) );
+      if( sub_shell_list.empty() ) continue;
+
+      XCTask sub_task;
+      sub_task.iParent = task.iParent;
+      sub_task.points.assign( task.points.begin() + st, task.points.begin() + en );
+      sub_task.weights.assign( task.weights.begin() + st, task.weights.begin() + en );
+      sub_task.npts = sub_task.points.size();
+      sub_task.bfn_screening.nbe = std::accumulate( sub_shell_list.begin(),
+        sub_shell_list.end(), 0, [&]( int32_t n, int32_t ish ) { 
+          return n + (int32_t)basis[ish].size(); } );
+      sub_task.bfn_screening.shell_list = std::move(sub_shell_list);
+      sub_task.dist_nearest = task.dist_nearest;
+
+      sub_tasks[iT].emplace_back( std::move(sub_task) );
 
+    }
 
+  }
 
+  // Replace split tasks by their sub-batches (in place)
+  std::vector< XCTask > reordered_work; reordered_work.reserve( ntasks );
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+    if( local_work[iT].points.size() <= max_npts ) 
+      reordered_work.emplace_back( std::move(local_work[iT]) );
+    else
+      for( auto& t : sub_tasks[iT] ) reordered_work.emplace_back( std::move(t) );
+  }
+
+  local_work = std::move(reordered_work);
 
+}
 
 }
 }
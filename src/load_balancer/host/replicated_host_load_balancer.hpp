@@ -19,6 +19,51 @@ protected:
   using basis_type = BasisSet<double>;
   std::vector< XCTask > create_local_tasks_() const override;
 
+  /// Screen through micro_batch_screen
+  std::vector<int32_t> screen_box_( const shell_index_type&, 
+    const std::array<double,3>& lo, 
+    const std::array<double,3>& up ) const override;
+
+  /// Generate a screened task from a quadrature batch (iParent < 0 if empty)
+  XCTask generate_task_( const shell_index_type&, int32_t iAtom, 
+    const std::array<double,3>& lo, const std::array<double,3>& up,
+    std::vector<std::array<double,3>>&& points, 
+    std::vector<double>&& weights ) const;
+
+  /// Atomic grid of each atom and the offsets of each atom's batches in 
+  /// the global (atom, batch) ordering, generates the batch templates
+  std::pair< std::vector<const Grid*>, std::vector<size_t> > 
+    atomic_batch_layout_() const;
+
+  /// Generate (screened) tasks for the batches [batch_st, batch_en) of the
+  /// global (atom, batch) ordering, in parallel over all batches. Tasks of
+  /// negligible batches are returned with iParent < 0
+  std::vector< XCTask > generate_batch_tasks_( const shell_index_type&,
+    const std::vector<const Grid*>& atom_grids, 
+    const std::vector<size_t>& atom_batch_offset,
+    size_t batch_st, size_t batch_en ) const;
+
+  /// Every rank generates every batch and keeps its (cost balanced) share
+  std::vector< XCTask > generate_replicated_tasks_() const;
+
+  /// Every rank generates a contiguous share of the batches, followed by
+  /// a cost based migration of the resulting tasks
+  std::vector< XCTask > generate_distributed_tasks_() const;
+
+  /// Sort local tasks and merge those with equivalent screening data
+  static void merge_equivalent_tasks_( std::vector< XCTask >& );
+
+  /// Order the points of each task along a space filling curve and split
+  /// tasks exceeding spatial_batch_size_ points into spatially compact,
+  /// rescreened sub-batches
+  void spatially_reorder_tasks_( std::vector< XCTask >& ) const;
+
+  /// Generation scheme and spatial batching of the tasks
+  std::string task_settings_() const override;
+
+  bool   distributed_generation_ = false;
+  size_t spatial_batch_size_     = 0;
+
 public:
 
   HostReplicatedLoadBalancer() = delete;
@@ -31,9 +76,26 @@ public:
 
   virtual ~HostReplicatedLoadBalancer() noexcept;
 
+  /// Toggle distributed (non-replicated) generation of the quadrature tasks
+  inline void set_distributed_generation( bool d ) noexcept {
+    distributed_generation_ = d;
+  }
+  inline bool distributed_generation() const noexcept {
+    return distributed_generation_;
+  }
+
+  /// Toggle spatial reordering (and splitting) of the merged tasks with
+  /// the maximum number of points per split task (0 disables)
+  inline void set_spatial_batch_size( size_t n ) noexcept {
+    spatial_batch_size_ = n;
+  }
+  inline size_t spatial_batch_size() const noexcept {
+    return spatial_batch_size_;
+  }
+
   virtual std::pair< std::vector<int32_t>, size_t > micro_batch_screen(
-    const BasisSet<double>&, const std::array<double,3>&,
-    const std::array<double,3>& ) const = 0;
+    const BasisSet<double>&, const shell_index_type&, 
+    const std::array<double,3>&, const std::array<double,3>& ) const = 0;
 
 };
 
@@ -31,6 +31,11 @@ std::vector<XCTask>& LoadBalancer::get_tasks() {
   return pimpl_->get_tasks();
 }
 
+TaskStore& LoadBalancer::task_store() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->task_store();
+}
+
 void LoadBalancer::rebalance_weights() {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   pimpl_->rebalance_weights();
@@ -46,6 +51,56 @@ void LoadBalancer::rebalance_exx() {
   pimpl_->rebalance_exx();
 }
 
+void LoadBalancer::calibrate_cost_models() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->calibrate_cost_models();
+}
+
+void LoadBalancer::save_cost_models( const std::string& fname ) const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->save_cost_models(fname);
+}
+
+void LoadBalancer::load_cost_models( const std::string& fname ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->load_cost_models(fname);
+}
+
+void LoadBalancer::save_plan( const std::string& fname ) const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->save_plan(fname);
+}
+
+void LoadBalancer::load_plan( const std::string& fname ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->load_plan(fname);
+}
+
+void LoadBalancer::update_geometry( const Molecule& mol ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->update_geometry(mol);
+}
+
+const TaskCostModel& LoadBalancer::exc_vxc_cost_model() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->exc_vxc_cost_model();
+}
+
+const TaskCostModel& LoadBalancer::exx_cost_model() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->exx_cost_model();
+}
+
+TaskLoadStatistics LoadBalancer::exc_vxc_load_statistics() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->exc_vxc_load_statistics();
+}
+
+TaskLoadStatistics LoadBalancer::exx_load_statistics() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->exx_load_statistics();
+}
+
 const util::Timer& LoadBalancer::get_timings() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->get_timings();
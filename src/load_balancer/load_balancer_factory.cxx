@@ -50,6 +50,28 @@ LoadBalancer LoadBalancerFactory::get_instance(
 
 }
 
+std::shared_ptr<LoadBalancer> LoadBalancerFactory::get_shared_instance_from_plan(
+  const RuntimeEnvironment& rt, const Molecule& mol, const MolGrid& mg, 
+  const BasisSet<double>& basis, const std::string& fname
+) {
+
+  // Task generation is deferred to the first get_tasks, such that the
+  // instance is cheap to construct prior to loading the plan
+  auto ptr = get_shared_instance(rt, mol, mg, basis);
+  ptr->load_plan(fname);
+  return ptr;
 
 }
 
+LoadBalancer LoadBalancerFactory::get_instance_from_plan(
+  const RuntimeEnvironment& rt, const Molecule& mol, const MolGrid& mg, 
+  const BasisSet<double>& basis, const std::string& fname
+) {
+
+  auto ptr = get_shared_instance_from_plan(rt, mol, mg, basis, fname);
+  return LoadBalancer(std::move(*ptr));
+
+}
+
+
+}
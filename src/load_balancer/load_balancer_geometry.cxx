@@ -0,0 +1,203 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "load_balancer_impl.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <numeric>
+
+/**
+ *  Geometry updates of load balancers (e.g. between the steps of a molecular
+ *  dynamics trajectory or a geometry optimization).
+ *
+ *  All quadrature points of a task belong to the atom-centered grid of its
+ *  parent atom, and the unpartitioned quadrature weights do not depend on the
+ *  geometry. Tasks are thus carried over to a new geometry by a rigid
+ *  translation with their parent atom. The screening status of a shell
+ *  with respect to a task may only change if the shell has been displaced
+ *  relative to the parent atom of the task.
+ */
+
+namespace GauXC::detail {
+
+namespace {
+
+/// Displacements (bohr) below this threshold are treated as zero
+constexpr double displacement_tol = 1e-12;
+
+inline bool displaced( const std::array<double,3>& a,
+  const std::array<double,3>& b ) {
+  return std::abs(a[0] - b[0]) > displacement_tol or
+         std::abs(a[1] - b[1]) > displacement_tol or
+         std::abs(a[2] - b[2]) > displacement_tol;
+}
+
+}
+
+void LoadBalancerImpl::update_task_screening_(
+  const std::vector<std::array<double,3>>& disp ) {
+
+  const auto& basis = *basis_;
+  const auto& shell_to_center = basis_map_->shell_to_center();
+  const size_t nshells = basis.nshells();
+
+  // Shells which are not centered on an atom remain in place
+  std::vector<std::array<double,3>> shell_disp( nshells, {0., 0., 0.} );
+  for( size_t ish = 0; ish < nshells; ++ish )
+  if( shell_to_center[ish] >= 0 ) shell_disp[ish] = disp[shell_to_center[ish]];
+
+  // Nothing may change screening under a rigid translation
+  const auto& ref = disp.front();
+  const bool rigid =
+    std::none_of( disp.begin(), disp.end(),
+      [&]( const auto& d ){ return displaced(d, ref); } ) and
+    std::none_of( shell_disp.begin(), shell_disp.end(),
+      [&]( const auto& d ){ return displaced(d, ref); } );
+  if( rigid ) return;
+
+  const auto shell_index = make_shell_index( basis );
+
+  auto& tasks = local_tasks_();
+  const size_t ntasks = tasks.size();
+  std::vector<char> keep( ntasks, 1 );
+
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    auto& task = tasks[iT];
+    if( task.points.empty() ) continue;
+    const auto& d = disp[task.iParent];
+
+    std::array<double,3> lo = task.points.front(), up = task.points.front();
+    for( const auto& p : task.points )
+    for( int k = 0; k < 3; ++k ) {
+      lo[k] = std::min( lo[k], p[k] );
+      up[k] = std::max( up[k], p[k] );
+    }
+
+    // Shells which moved with the parent atom keep their status, those
+    // displaced relative to it are screened over the current bounding box
+    const auto& shell_list = task.bfn_screening.shell_list;
+    std::vector<int32_t> static_shells, displaced_shells;
+    static_shells.reserve( shell_list.size() );
+    for( auto ish : shell_list )
+    if( not displaced( shell_disp[ish], d ) ) static_shells.emplace_back( ish );
+    for( auto ish : screen_box_( shell_index, lo, up ) )
+    if( displaced( shell_disp[ish], d ) ) displaced_shells.emplace_back( ish );
+
+    std::vector<int32_t> new_shell_list;
+    new_shell_list.reserve( static_shells.size() + displaced_shells.size() );
+    std::merge( static_shells.begin(), static_shells.end(),
+      displaced_shells.begin(), displaced_shells.end(),
+      std::back_inserter(new_shell_list) );
+    fill_in_shell_list_( new_shell_list );
+
+    // No shell cutoff boundary has been crossed
+    if( new_shell_list == shell_list ) continue;
+
+    if( new_shell_list.empty() ) { keep[iT] = 0; continue; }
+
+    task.bfn_screening = XCTask::screening_data();
+    task.bfn_screening.nbe = std::accumulate( new_shell_list.begin(),
+      new_shell_list.end(), 0, [&]( int32_t n, int32_t ish ) {
+        return n + (int32_t)basis[ish].size(); } );
+    task.bfn_screening.shell_list = std::move(new_shell_list);
+    task.measured_cost = XCTask::measured_cost_data();
+
+  }
+
+  // Drop tasks without any screened shells
+  size_t ikeep = 0;
+  for( size_t iT = 0; iT < ntasks; ++iT )
+  if( keep[iT] ) {
+    if( ikeep != iT ) tasks[ikeep] = std::move(tasks[iT]);
+    ++ikeep;
+  }
+  tasks.erase( tasks.begin() + ikeep, tasks.end() );
+
+}
+
+void LoadBalancerImpl::update_geometry( const Molecule& mol ) {
+
+  auto update_st = std::chrono::high_resolution_clock::now();
+
+  const auto& old_mol = *mol_;
+  const size_t natoms = old_mol.natoms();
+  if( mol.natoms() != natoms )
+    GAUXC_GENERIC_EXCEPTION("Geometry Update Requires The Same Number of Atoms");
+  for( size_t i = 0; i < natoms; ++i )
+  if( mol[i].Z.get() != old_mol[i].Z.get() )
+    GAUXC_GENERIC_EXCEPTION("Geometry Update Requires The Same Atoms");
+
+  // The unpartitioned weights are required to repartition modified weights
+  auto& tasks = local_tasks_();
+  const bool restore_weights = state_.modified_weights_are_stored;
+  if( restore_weights )
+  for( const auto& task : tasks )
+  if( task.weights.size() and not task.has_quadrature_weights() )
+    GAUXC_GENERIC_EXCEPTION("Geometry Update Requires Retained Quadrature Weights");
+
+  std::vector<std::array<double,3>> disp( natoms );
+  std::vector<int32_t> moved;
+  for( size_t i = 0; i < natoms; ++i ) {
+    disp[i] = { mol[i].x - old_mol[i].x, mol[i].y - old_mol[i].y,
+                mol[i].z - old_mol[i].z };
+    if( disp[i][0] != 0. or disp[i][1] != 0. or disp[i][2] != 0. )
+      moved.emplace_back( i );
+  }
+  if( moved.empty() ) return;
+
+  // Translate the basis shells with their centers. The molecule, basis and
+  // metadata are replaced rather than modified as they may be shared with
+  // copies of this load balancer
+  auto basis = std::make_shared<basis_type>( *basis_ );
+  const auto& shell_to_center = basis_map_->shell_to_center();
+  for( size_t ish = 0; ish < basis->size(); ++ish ) {
+    const auto iAt = shell_to_center[ish];
+    if( iAt < 0 ) continue;
+    double* O = (*basis)[ish].O_data();
+    O[0] = mol[iAt].x; O[1] = mol[iAt].y; O[2] = mol[iAt].z;
+  }
+
+  auto molmeta = std::make_shared<MolMeta>( *molmeta_ );
+  molmeta->update_geometry( mol, moved );
+
+  mol_       = std::make_shared<Molecule>( mol );
+  basis_     = basis;
+  basis_map_ = std::make_shared<basis_map_type>( *basis_, *mol_ );
+  molmeta_   = molmeta;
+  if( shell_pairs_ ) shell_pairs_ = std::make_shared<shell_pair_type>( *basis_ );
+
+  // Translate the tasks with their parent atoms
+  const auto& dist_nearest = molmeta_->dist_nearest();
+  const size_t ntasks = tasks.size();
+  #pragma omp parallel for
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+    auto& task = tasks[iT];
+    const auto& d = disp[task.iParent];
+    for( auto& p : task.points ) {
+      p[0] += d[0]; p[1] += d[1]; p[2] += d[2];
+    }
+    if( restore_weights ) task.weights = task.quadrature_weights;
+    task.dist_nearest  = dist_nearest[task.iParent];
+    task.cou_screening = XCTask::screening_data();
+  }
+  state_.modified_weights_are_stored = false;
+
+  if( ntasks ) update_task_screening_( disp );
+  state_.geometry_version++;
+  state_.task_version++;
+
+  auto update_en = std::chrono::high_resolution_clock::now();
+  timer_.add_timing("LoadBalancer.UpdateGeometry",
+    std::chrono::duration<double>( update_en - update_st ));
+
+}
+
+}
@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
+#include <fstream>
 
 namespace GauXC::detail {
 
@@ -35,23 +36,61 @@ LoadBalancerImpl::LoadBalancerImpl( LoadBalancerImpl&& ) noexcept = default;
 
 LoadBalancerImpl::~LoadBalancerImpl() noexcept = default;
 
+LoadBalancerImpl::shell_index_type 
+  LoadBalancerImpl::make_shell_index( const basis_type& bs ) {
+
+  std::vector<std::array<double,3>> centers; centers.reserve(bs.nshells());
+  std::vector<double>               radii;   radii.reserve(bs.nshells());
+  for( const auto& sh : bs ) {
+    centers.emplace_back( sh.O() );
+    radii.emplace_back( sh.cutoff_radius() );
+  }
+
+  return shell_index_type( std::move(centers), std::move(radii) );
+
+}
+
+std::vector<int32_t> LoadBalancerImpl::screen_box_( 
+  const shell_index_type& shell_index, const std::array<double,3>& lo, 
+  const std::array<double,3>& up ) const {
+  return shell_index.query( lo, up );
+}
+
+std::vector<XCTask>& LoadBalancerImpl::local_tasks_() {
+  task_store_.unpack();
+  return task_store_.tasks();
+}
+
+const std::vector<XCTask>& LoadBalancerImpl::local_tasks_() const {
+  task_store_.unpack();
+  return task_store_.tasks();
+}
+
 const std::vector<XCTask>& LoadBalancerImpl::get_tasks() const {
-  if( not local_tasks_.size() ) GAUXC_GENERIC_EXCEPTION("No Tasks Created");
-  return local_tasks_;
+  if( not tasks_created_ ) GAUXC_GENERIC_EXCEPTION("No Tasks Created");
+  return local_tasks_();
 }
 
 std::vector<XCTask>& LoadBalancerImpl::get_tasks() {
 
-  if( not local_tasks_.size() ) {
+  if( not tasks_created_ ) {
     auto create_tasks_st = std::chrono::high_resolution_clock::now();
-    local_tasks_ = create_local_tasks_();
+    task_store_ = TaskStore( create_local_tasks_() );
+    tasks_created_ = true;
+    state_.task_version++;
     auto create_tasks_en = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double> create_tasks_dr = create_tasks_en - create_tasks_st; 
     timer_.add_timing("LoadBalancer.CreateTasks", create_tasks_dr);
   }
 
 
-  return local_tasks_;
+  return local_tasks_();
+}
+
+TaskStore& LoadBalancerImpl::task_store() {
+  if( not tasks_created_ ) get_tasks();
+  task_store_.pack();
+  return task_store_;
 }
 
 const util::Timer& LoadBalancerImpl::get_timings() const {
@@ -59,21 +98,27 @@ const util::Timer& LoadBalancerImpl::get_timings() const {
 }
 
 
+size_t LoadBalancerImpl::task_npts_( const XCTask& task ) const {
+  return task_store_.packed() ? task.npts : task.points.size();
+}
+
 size_t LoadBalancerImpl::max_npts() const {
 
-  if( not local_tasks_.size() ) return 0ul;
+  const auto& tasks = task_store_.tasks();
+  if( not tasks.size() ) return 0ul;
 
-  return std::max_element( local_tasks_.cbegin(), local_tasks_.cend(),
-    []( const auto& a, const auto& b ) {
-      return a.points.size() < b.points.size();
-    })->points.size();
+  return task_npts_( *std::max_element( tasks.cbegin(), tasks.cend(),
+    [&]( const auto& a, const auto& b ) {
+      return task_npts_(a) < task_npts_(b);
+    }) );
 
 }
 size_t LoadBalancerImpl::max_nbe() const {
 
-  if( not local_tasks_.size() ) return 0ul;
+  const auto& tasks = task_store_.tasks();
+  if( not tasks.size() ) return 0ul;
 
-  return std::max_element( local_tasks_.cbegin(), local_tasks_.cend(),
+  return std::max_element( tasks.cbegin(), tasks.cend(),
     []( const auto& a, const auto& b ) {
       return a.bfn_screening.nbe < b.bfn_screening.nbe;
     })->bfn_screening.nbe;
@@ -81,14 +126,16 @@ size_t LoadBalancerImpl::max_nbe() const {
 }
 size_t LoadBalancerImpl::max_npts_x_nbe() const {
 
-  if( not local_tasks_.size() ) return 0ul;
+  const auto& tasks = task_store_.tasks();
+  if( not tasks.size() ) return 0ul;
 
-  auto it = std::max_element( local_tasks_.cbegin(), local_tasks_.cend(),
-    []( const auto& a, const auto& b ) {
-      return a.bfn_screening.nbe * a.points.size() < b.bfn_screening.nbe * b.points.size();
+  auto it = std::max_element( tasks.cbegin(), tasks.cend(),
+    [&]( const auto& a, const auto& b ) {
+      return a.bfn_screening.nbe * task_npts_(a) < 
+             b.bfn_screening.nbe * task_npts_(b);
     });
 
-  return it->bfn_screening.nbe * it->points.size();
+  return it->bfn_screening.nbe * task_npts_(*it);
 
 }
 
@@ -128,4 +175,26 @@ LoadBalancerState& LoadBalancerImpl::state() {
   return state_;
 }
 
+const TaskCostModel& LoadBalancerImpl::exc_vxc_cost_model() const {
+  return exc_vxc_cost_model_;
+}
+const TaskCostModel& LoadBalancerImpl::exx_cost_model() const {
+  return exx_cost_model_;
+}
+
+void LoadBalancerImpl::save_cost_models( const std::string& fname ) const {
+  if( runtime_.comm_rank() ) return;
+  std::ofstream file( fname );
+  if( not file ) GAUXC_GENERIC_EXCEPTION("Could Not Open " + fname);
+  exc_vxc_cost_model_.write( file );
+  exx_cost_model_.write( file );
+}
+
+void LoadBalancerImpl::load_cost_models( const std::string& fname ) {
+  std::ifstream file( fname );
+  if( not file ) GAUXC_GENERIC_EXCEPTION("Could Not Open " + fname);
+  exc_vxc_cost_model_.read( file );
+  exx_cost_model_.read( file );
+}
+
 }
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <gauxc/load_balancer.hpp>
+#include <gauxc/task_store.hpp>
+#include <gauxc/util/sphere_cell_list.hpp>
 
 namespace GauXC  {
 namespace detail {
@@ -22,6 +24,8 @@ public:
 
 protected:
 
+  using shell_index_type = geometry::SphereCellList<double>;
+
   RuntimeEnvironment          runtime_;
   std::shared_ptr<Molecule>   mol_;
   std::shared_ptr<MolGrid>    mg_;
@@ -30,14 +34,59 @@ protected:
   std::shared_ptr<basis_map_type> basis_map_;
   std::shared_ptr<shell_pair_type> shell_pairs_;
 
-  std::vector< XCTask >     local_tasks_;
+  // Local tasks, packed on request of the SoA consumers (cf. task_store)
+  // and unpacked on access of the tasks in their AoS form
+  mutable TaskStore         task_store_;
+
+  // Whether the local tasks have been created or loaded (they may be empty)
+  bool                      tasks_created_ = false;
 
   LoadBalancerState         state_;
 
+  TaskCostModel             exc_vxc_cost_model_{TaskCostModel::Kind::ExcVXC};
+  TaskCostModel             exx_cost_model_{TaskCostModel::Kind::EXX};
+
   util::Timer               timer_;
 
   virtual std::vector< XCTask > create_local_tasks_() const = 0;
 
+  /// Local tasks (AoS), unpacks the task store
+  std::vector< XCTask >&       local_tasks_();
+  const std::vector< XCTask >& local_tasks_() const;
+
+  /// Number of points of a local task (packed or unpacked)
+  size_t task_npts_( const XCTask& ) const;
+
+  /// Spatial index over the shell centers and cutoff radii of a basis
+  static shell_index_type make_shell_index( const basis_type& );
+
+  /// Shells screened for a batch with the passed bounding box (ascending),
+  /// defaults to the shells whose cutoff sphere intersects the box
+  virtual std::vector<int32_t> screen_box_( const shell_index_type&, 
+    const std::array<double,3>& lo, const std::array<double,3>& up ) const;
+
+  /// Description of the load balancer settings which shape the generated
+  /// tasks (beyond the molecule, grid and basis), enters the plan fingerprint
+  virtual std::string task_settings_() const = 0;
+
+  /// Adjust an updated (ascending) shell list to the screening scheme of 
+  /// the load balancer, no-op by default
+  virtual void fill_in_shell_list_( std::vector<int32_t>& ) const { }
+
+  /**
+   *  @brief Update the basis function screening of the local tasks after a
+   *  geometry update
+   *
+   *  Called with the translated tasks, basis and basis map in place. Only 
+   *  shells displaced relative to the parent atom of a task may change
+   *  their screening status, the shell list is updated with the displaced
+   *  shells screened over the bounding box of the task (which is only
+   *  committed if it differs from the current list).
+   *
+   *  @param[in] disp Displacement of each atom
+   */
+  void update_task_screening_( const std::vector<std::array<double,3>>& disp );
+
 public:
 
   LoadBalancerImpl() = delete;
@@ -57,10 +106,27 @@ public:
   const std::vector< XCTask >& get_tasks() const;
         std::vector< XCTask >& get_tasks()      ;
 
+  TaskStore& task_store();
+
   void rebalance_weights();
   void rebalance_exc_vxc();
   void rebalance_exx();
 
+  void calibrate_cost_models();
+  void save_cost_models( const std::string& fname ) const;
+  void load_cost_models( const std::string& fname );
+
+  void save_plan( const std::string& fname ) const;
+  void load_plan( const std::string& fname );
+
+  void update_geometry( const Molecule& mol );
+
+  const TaskCostModel& exc_vxc_cost_model() const;
+  const TaskCostModel& exx_cost_model() const;
+
+  TaskLoadStatistics exc_vxc_load_statistics() const;
+  TaskLoadStatistics exx_load_statistics() const;
+
   const util::Timer& get_timings() const;
 
   size_t max_npts()       const;
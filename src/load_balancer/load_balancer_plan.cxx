@@ -0,0 +1,394 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "load_balancer_impl.hpp"
+#include <gauxc/util/mpi.hpp>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#if __has_include(<sys/mman.h>)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define GAUXC_LB_PLAN_HAS_MMAP
+#endif
+
+/**
+ *  Load balancer plan layout (native byte order):
+ *
+ *    lb_plan_header
+ *    uint64_t offsets[nranks+1]  byte offsets of the task partitions
+ *    MolMeta
+ *    partition 0 ... partition nranks-1
+ *
+ *  A partition is the number of tasks followed by the packed tasks. Arrays
+ *  are stored as their size followed by their contiguous elements.
+ */
+
+namespace GauXC::detail {
+
+namespace {
+
+constexpr char     lb_plan_magic[8] = {'G','A','U','X','C','L','B','P'};
+constexpr uint32_t lb_plan_version  = 3;
+
+struct lb_plan_header {
+  char     magic[8];
+  uint32_t version;
+  uint32_t byte_order;  ///< 0x01020304 in the byte order of the writer
+  uint64_t fingerprint; ///< Hash of molecule, grid, basis and LB settings
+  uint64_t nranks;      ///< Number of partitions
+  uint64_t modified_weights_are_stored;
+  int32_t  weight_alg;  ///< Partitioning scheme of stored weights
+  int32_t  becke_size_adjustment;
+};
+
+/// FNV-1a hash of the data which determines the quadrature tasks
+class plan_fingerprint {
+  uint64_t hash_ = 0xcbf29ce484222325ull;
+public:
+  void add( const void* data, size_t nbytes ) {
+    const auto* p = static_cast<const unsigned char*>(data);
+    for( size_t i = 0; i < nbytes; ++i ) {
+      hash_ ^= p[i];
+      hash_ *= 0x100000001b3ull;
+    }
+  }
+  template <typename T>
+  void add( const T& x ) {
+    static_assert( std::is_arithmetic_v<T> );
+    add( &x, sizeof(T) );
+  }
+  uint64_t value() const { return hash_; }
+};
+
+/// Types stored by their object representation (incl. std::pair, which is
+/// not trivially copyable due to its assignment operators)
+template <typename T>
+inline constexpr bool is_plan_pod_v = 
+  std::is_trivially_copy_constructible_v<T> and 
+  std::is_trivially_destructible_v<T>;
+
+/// Serialization of plan data into a byte buffer
+class plan_writer {
+  std::vector<char> buffer_;
+public:
+  void pack( const void* data, size_t nbytes ) {
+    const auto* p = static_cast<const char*>(data);
+    buffer_.insert( buffer_.end(), p, p + nbytes );
+  }
+  template <typename T>
+  void pack( const T& x ) {
+    static_assert( is_plan_pod_v<T> );
+    pack( &x, sizeof(T) );
+  }
+  template <typename T>
+  void pack( const std::vector<T>& v ) {
+    static_assert( is_plan_pod_v<T> );
+    pack( uint64_t(v.size()) );
+    pack( v.data(), v.size() * sizeof(T) );
+  }
+  const std::vector<char>& buffer() const { return buffer_; }
+};
+
+/// Deserialization of plan data from a (mapped) byte range
+class plan_reader {
+  const char* ptr_;
+  const char* end_;
+public:
+  plan_reader( const char* begin, const char* end ) : ptr_(begin), end_(end) {}
+  void unpack( void* data, size_t nbytes ) {
+    if( size_t(end_ - ptr_) < nbytes )
+      GAUXC_GENERIC_EXCEPTION("Truncated LoadBalancer Plan");
+    std::memcpy( data, ptr_, nbytes );
+    ptr_ += nbytes;
+  }
+  template <typename T>
+  void unpack( T& x ) {
+    static_assert( is_plan_pod_v<T> );
+    unpack( &x, sizeof(T) );
+  }
+  template <typename T>
+  void unpack( std::vector<T>& v ) {
+    uint64_t n; unpack( n );
+    if( n > size_t(end_ - ptr_) / sizeof(T) )
+      GAUXC_GENERIC_EXCEPTION("Truncated LoadBalancer Plan");
+    v.resize( n );
+    unpack( v.data(), n * sizeof(T) );
+  }
+};
+
+/// Read-only view of a plan file (memory mapped if supported)
+class plan_file {
+  const char* data_ = nullptr;
+  size_t      size_ = 0;
+  std::vector<char> buffer_;
+public:
+  plan_file( const std::string& fname ) {
+    #ifdef GAUXC_LB_PLAN_HAS_MMAP
+    int fd = ::open( fname.c_str(), O_RDONLY );
+    if( fd < 0 ) GAUXC_GENERIC_EXCEPTION("Could Not Open " + fname);
+    struct stat st;
+    if( ::fstat( fd, &st ) ) {
+      ::close(fd);
+      GAUXC_GENERIC_EXCEPTION("Could Not Stat " + fname);
+    }
+    size_ = st.st_size;
+    if( size_ ) {
+      void* ptr = ::mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 );
+      if( ptr == MAP_FAILED ) {
+        ::close(fd);
+        GAUXC_GENERIC_EXCEPTION("Could Not Map " + fname);
+      }
+      data_ = static_cast<const char*>(ptr);
+    }
+    ::close(fd);
+    #else
+    std::ifstream file( fname, std::ios::binary );
+    if( not file ) GAUXC_GENERIC_EXCEPTION("Could Not Open " + fname);
+    buffer_.assign( std::istreambuf_iterator<char>(file),
+      std::istreambuf_iterator<char>() );
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+    #endif
+  }
+  ~plan_file() noexcept {
+    #ifdef GAUXC_LB_PLAN_HAS_MMAP
+    if( size_ ) ::munmap( const_cast<char*>(data_), size_ );
+    #endif
+  }
+  plan_file( const plan_file& ) = delete;
+
+  const char* data() const { return data_; }
+  size_t      size() const { return size_; }
+};
+
+
+void pack_screening( const XCTask::screening_data& s, plan_writer& buffer ) {
+  buffer.pack( s.shell_list );
+  buffer.pack( s.shell_pair_list );
+  buffer.pack( s.shell_pair_idx_list );
+  buffer.pack( s.submat_block );
+  buffer.pack( s.submat_map );
+  buffer.pack( s.nbe );
+}
+
+void unpack_screening( XCTask::screening_data& s, plan_reader& buffer ) {
+  buffer.unpack( s.shell_list );
+  buffer.unpack( s.shell_pair_list );
+  buffer.unpack( s.shell_pair_idx_list );
+  buffer.unpack( s.submat_block );
+  buffer.unpack( s.submat_map );
+  buffer.unpack( s.nbe );
+}
+
+void pack_task( const XCTask& task, plan_writer& buffer ) {
+  buffer.pack( task.iParent );
+  buffer.pack( task.npts );
+  buffer.pack( task.dist_nearest );
+  buffer.pack( task.max_weight );
+  buffer.pack( task.points );
+  buffer.pack( task.weights );
+  buffer.pack( task.quadrature_weights );
+  pack_screening( task.bfn_screening, buffer );
+  pack_screening( task.cou_screening, buffer );
+  buffer.pack( task.measured_cost );
+}
+
+void unpack_task( XCTask& task, plan_reader& buffer ) {
+  buffer.unpack( task.iParent );
+  buffer.unpack( task.npts );
+  buffer.unpack( task.dist_nearest );
+  buffer.unpack( task.max_weight );
+  buffer.unpack( task.points );
+  buffer.unpack( task.weights );
+  buffer.unpack( task.quadrature_weights );
+  unpack_screening( task.bfn_screening, buffer );
+  unpack_screening( task.cou_screening, buffer );
+  buffer.unpack( task.measured_cost );
+}
+
+/// MolMeta exposes its state through (cereal) serialize
+struct molmeta_pack_archive {
+  plan_writer& buffer;
+  template <typename... Args>
+  void operator()( const Args&... args ) { ( buffer.pack(args), ... ); }
+};
+struct molmeta_unpack_archive {
+  plan_reader& buffer;
+  template <typename... Args>
+  void operator()( Args&... args ) { ( buffer.unpack(args), ... ); }
+};
+
+/// Fingerprint of the data which determines the quadrature tasks
+uint64_t make_fingerprint( const Molecule& mol, const MolGrid& mg,
+  const BasisSet<double>& basis, const std::string& task_settings ) {
+
+  plan_fingerprint fp;
+
+  fp.add( uint64_t(task_settings.size()) );
+  fp.add( task_settings.data(), task_settings.size() );
+
+  fp.add( uint64_t(mol.size()) );
+  for( const auto& atom : mol ) {
+    fp.add( atom.Z.get() );
+    fp.add( atom.x ); fp.add( atom.y ); fp.add( atom.z );
+
+    // Atomic grids enter through their batching and (center independent)
+    // quadrature weights
+    const auto& batcher = mg.get_grid(atom.Z).batcher();
+    const auto& weights = batcher.quadrature().weights();
+    fp.add( uint64_t(batcher.nbatches()) );
+    fp.add( uint64_t(weights.size()) );
+    fp.add( weights.data(), weights.size() * sizeof(weights[0]) );
+  }
+
+  fp.add( uint64_t(basis.size()) );
+  for( const auto& sh : basis ) {
+    fp.add( sh.nprim() ); fp.add( sh.l() ); fp.add( sh.pure() );
+    fp.add( sh.alpha_data(), sh.nprim() * sizeof(double) );
+    fp.add( sh.coeff_data(), sh.nprim() * sizeof(double) );
+    fp.add( sh.O().data(), 3 * sizeof(double) );
+  }
+
+  return fp.value();
+
+}
+
+}
+
+
+void LoadBalancerImpl::save_plan( const std::string& fname ) const {
+
+  const auto& tasks = local_tasks_();
+  const int world_rank = runtime_.comm_rank();
+  const int world_size = runtime_.comm_size();
+
+  // Pack local partition
+  plan_writer partition;
+  partition.pack( uint64_t(tasks.size()) );
+  for( const auto& task : tasks ) pack_task( task, partition );
+
+  plan_writer meta;
+  molmeta_pack_archive meta_ar{meta};
+  MolMeta( *molmeta_ ).serialize( meta_ar );
+
+  // Byte offsets of the partitions
+  std::vector<uint64_t> partition_sizes( world_size );
+  partition_sizes[world_rank] = partition.buffer().size();
+  #ifdef GAUXC_HAS_MPI
+  MPI_Allgather( MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, partition_sizes.data(),
+    1, mpi_data_type<uint64_t>(), runtime_.comm() );
+  #endif
+
+  std::vector<uint64_t> offsets( world_size + 1 );
+  offsets[0] = sizeof(lb_plan_header) + offsets.size() * sizeof(uint64_t) +
+    meta.buffer().size();
+  for( int i = 0; i < world_size; ++i )
+    offsets[i+1] = offsets[i] + partition_sizes[i];
+
+  // The root writes the preamble (truncating the file)...
+  if( not world_rank ) {
+    lb_plan_header header;
+    std::memcpy( header.magic, lb_plan_magic, sizeof(lb_plan_magic) );
+    header.version     = lb_plan_version;
+    header.byte_order  = 0x01020304;
+    header.fingerprint = make_fingerprint( *mol_, *mg_, *basis_, task_settings_() );
+    header.nranks      = world_size;
+    header.modified_weights_are_stored = state_.modified_weights_are_stored;
+    header.weight_alg  = int32_t(state_.weight_alg);
+    header.becke_size_adjustment = state_.becke_size_adjustment;
+
+    plan_writer preamble;
+    preamble.pack( header );
+    preamble.pack( offsets.data(), offsets.size() * sizeof(uint64_t) );
+    preamble.pack( meta.buffer().data(), meta.buffer().size() );
+
+    std::ofstream file( fname, std::ios::binary | std::ios::trunc );
+    if( not file ) GAUXC_GENERIC_EXCEPTION("Could Not Open " + fname);
+    file.write( preamble.buffer().data(), preamble.buffer().size() );
+  }
+  #ifdef GAUXC_HAS_MPI
+  MPI_Barrier( runtime_.comm() );
+  #endif
+
+  // ...then all processes write their partition at its offset
+  {
+    std::fstream file( fname, std::ios::binary | std::ios::in | std::ios::out );
+    if( not file ) GAUXC_GENERIC_EXCEPTION("Could Not Open " + fname);
+    file.seekp( offsets[world_rank] );
+    file.write( partition.buffer().data(), partition.buffer().size() );
+    if( not file ) GAUXC_GENERIC_EXCEPTION("Could Not Write " + fname);
+  }
+  #ifdef GAUXC_HAS_MPI
+  MPI_Barrier( runtime_.comm() );
+  #endif
+
+}
+
+void LoadBalancerImpl::load_plan( const std::string& fname ) {
+
+  auto load_st = std::chrono::high_resolution_clock::now();
+
+  const int world_rank = runtime_.comm_rank();
+  const int world_size = runtime_.comm_size();
+
+  plan_file file( fname );
+  plan_reader reader( file.data(), file.data() + file.size() );
+
+  lb_plan_header header;
+  reader.unpack( header );
+  if( std::memcmp( header.magic, lb_plan_magic, sizeof(lb_plan_magic) ) )
+    GAUXC_GENERIC_EXCEPTION(fname + " Is Not A LoadBalancer Plan");
+  if( header.version != lb_plan_version )
+    GAUXC_GENERIC_EXCEPTION("Unsupported LoadBalancer Plan Version " +
+      std::to_string(header.version));
+  if( header.byte_order != 0x01020304 )
+    GAUXC_GENERIC_EXCEPTION("LoadBalancer Plan Byte Order Mismatch");
+  if( header.fingerprint != make_fingerprint( *mol_, *mg_, *basis_, task_settings_() ) )
+    GAUXC_GENERIC_EXCEPTION("LoadBalancer Plan Does Not Match Molecule/Grid/Basis/Settings");
+  if( header.nranks != uint64_t(world_size) )
+    GAUXC_GENERIC_EXCEPTION("LoadBalancer Plan Partitioned For " +
+      std::to_string(header.nranks) + " Processes");
+
+  std::vector<uint64_t> offsets( world_size + 1 );
+  reader.unpack( offsets.data(), offsets.size() * sizeof(uint64_t) );
+  if( offsets.back() > file.size() )
+    GAUXC_GENERIC_EXCEPTION("Truncated LoadBalancer Plan");
+
+  auto molmeta = std::make_shared<MolMeta>( *molmeta_ );
+  molmeta_unpack_archive meta_ar{reader};
+  molmeta->serialize( meta_ar );
+
+  // Local partition
+  plan_reader partition( file.data() + offsets[world_rank],
+    file.data() + offsets[world_rank+1] );
+  uint64_t ntasks; partition.unpack( ntasks );
+  std::vector<XCTask> tasks( ntasks );
+  for( auto& task : tasks ) unpack_task( task, partition );
+
+  molmeta_     = std::move(molmeta);
+  task_store_ = TaskStore( std::move(tasks) );
+  tasks_created_ = true;
+  state_.modified_weights_are_stored = header.modified_weights_are_stored;
+  state_.weight_alg = XCWeightAlg(header.weight_alg);
+  state_.becke_size_adjustment = header.becke_size_adjustment;
+
+  // Loaded tasks replace those cached state may refer to
+  state_.geometry_version++;
+  state_.task_version++;
+
+  auto load_en = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> load_dr = load_en - load_st;
+  timer_.add_timing("LoadBalancer.LoadPlan", load_dr);
+
+}
+
+}
@@ -6,15 +6,80 @@
  * See LICENSE.txt for details
  */
 #include "load_balancer_impl.hpp"
+#include "rebalance.hpp"
 #include <gauxc/util/mpi.hpp>
 #include <gauxc/util/div_ceil.hpp>
-#include <fstream>
+#include <chrono>
+#include <cstdio>
 
 namespace GauXC::detail {
 
 #ifdef GAUXC_HAS_MPI
-template <typename TaskIterator, typename CostFunctor>
-auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MPI_Comm comm) {
+namespace {
+
+/// Upper bound on the packed size of a task
+size_t task_pack_size( const XCTask& task, MPI_Comm comm ) {
+
+  auto bytes = [&]( size_t n ) {
+    int sz = 0; MPI_Pack_size( n, MPI_BYTE, comm, &sz );
+    return size_t(sz);
+  };
+  auto vec_bytes = [&]( const auto& v ) {
+    return bytes(sizeof(size_t)) + 
+      (v.size() ? bytes(v.size() * sizeof(v[0])) : 0ul);
+  };
+
+  return bytes(sizeof(task.iParent)) + bytes(sizeof(task.npts)) +
+    vec_bytes(task.points) + vec_bytes(task.weights) +
+    vec_bytes(task.quadrature_weights) +
+    vec_bytes(task.bfn_screening.shell_list) + 
+    bytes(sizeof(task.bfn_screening.nbe)) +
+    vec_bytes(task.cou_screening.shell_list) +
+    vec_bytes(task.cou_screening.shell_pair_list) +
+    vec_bytes(task.cou_screening.shell_pair_idx_list) +
+    bytes(sizeof(task.cou_screening.nbe)) + 
+    bytes(sizeof(task.dist_nearest)) + 
+    bytes(sizeof(task.measured_cost));
+
+}
+
+void pack_task( const XCTask& task, MPI_Packed_Buffer& mpi_buffer ) {
+  mpi_buffer.pack(task.iParent);
+  mpi_buffer.pack(task.npts);
+  mpi_buffer.pack(task.points);
+  mpi_buffer.pack(task.weights);
+  mpi_buffer.pack(task.quadrature_weights);
+  mpi_buffer.pack(task.bfn_screening.shell_list);
+  mpi_buffer.pack(task.bfn_screening.nbe);
+  mpi_buffer.pack(task.cou_screening.shell_list);
+  mpi_buffer.pack(task.cou_screening.shell_pair_list);
+  mpi_buffer.pack(task.cou_screening.shell_pair_idx_list);
+  mpi_buffer.pack(task.cou_screening.nbe);
+  mpi_buffer.pack(task.dist_nearest);
+  mpi_buffer.pack(task.measured_cost);
+}
+
+void unpack_task( XCTask& task, MPI_Packed_Buffer& mpi_buffer ) {
+  mpi_buffer.unpack(task.iParent);
+  mpi_buffer.unpack(task.npts);
+  mpi_buffer.unpack(task.points);
+  mpi_buffer.unpack(task.weights);
+  mpi_buffer.unpack(task.quadrature_weights);
+  mpi_buffer.unpack(task.bfn_screening.shell_list);
+  mpi_buffer.unpack(task.bfn_screening.nbe);
+  mpi_buffer.unpack(task.cou_screening.shell_list);
+  mpi_buffer.unpack(task.cou_screening.shell_pair_list);
+  mpi_buffer.unpack(task.cou_screening.shell_pair_idx_list);
+  mpi_buffer.unpack(task.cou_screening.nbe);
+  mpi_buffer.unpack(task.dist_nearest);
+  mpi_buffer.unpack(task.measured_cost);
+}
+
+}
+
+std::vector<XCTask> rebalance( std::vector<XCTask>::iterator begin,
+  std::vector<XCTask>::iterator end, const rebalance_cost_type& cost,
+  MPI_Comm comm, bool verbose ) {
 
   using hrt_t = std::chrono::high_resolution_clock;
   using dur_t = std::chrono::duration<double, std::milli>;
@@ -23,20 +88,18 @@ auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MP
   MPI_Comm_rank(comm, &world_rank);
   MPI_Comm_size(comm, &world_size);
 
-  MPI_Barrier(MPI_COMM_WORLD);
-  printf(
-  "RANK %d BEFORE REBALNACE: LW = %lu\n",
-    world_rank,
-    std::accumulate(begin, end, 0ul,
-      [=](const auto& a, const auto& b){ return a + cost(b); })
-  );
-
   // Compute local task costs
   size_t ntask_local = std::distance(begin, end);
   std::vector<size_t> local_task_cost(ntask_local);
   std::transform(begin, end, local_task_cost.begin(),
     [&](const auto& task){ return cost(task); });
 
+  if(verbose) {
+    MPI_Barrier(comm);
+    printf("RANK %d BEFORE REBALANCE: LW = %lu\n", world_rank,
+      std::accumulate(local_task_cost.begin(), local_task_cost.end(), 0ul));
+  }
+
   // Compute task prefix sum
   auto prefix_st = hrt_t::now();
   std::vector<size_t> local_prefix_sum(ntask_local);
@@ -46,346 +109,229 @@ auto rebalance(TaskIterator begin, TaskIterator end, const CostFunctor& cost, MP
 
   // Compute total/avg cost
   auto total_task_sum = allreduce( local_task_sum, MPI_SUM, comm );
-  size_t task_avg = util::div_ceil(total_task_sum, world_size);
+  size_t task_avg = std::max( 1ul, util::div_ceil(total_task_sum, world_size) );
 
+  // Destination of a task given its (exclusive) prefix sum. Destinations
+  // are monotonic in the global task order
+  auto task_dst = [&](size_t prefix) {
+    return std::min<size_t>( prefix / task_avg, world_size - 1 );
+  };
 
-  // Generate outgoing messages
+  // Generate outgoing messages (contiguous runs of the local task list)
   struct task_message {
     int dst;
     size_t idx_st, idx_en, vol;
   };
 
   std::vector<task_message> task_outgoing;
-  auto it = local_prefix_sum.begin();
-  for( int i = 0; i < world_size; ++i) {
-    auto n_it = std::lower_bound(it, local_prefix_sum.end(), i,
-      [=](auto a, auto b) { return a / task_avg < b+1; });
-    size_t st_idx = std::distance(local_prefix_sum.begin(), it  );
-    size_t en_idx = std::distance(local_prefix_sum.begin(), n_it);
-    if(st_idx != en_idx and i != world_rank) {
-      size_t vol = 0;
-      for( size_t t = st_idx; t < en_idx; ++t ) {
-        vol += (begin + t)->volume();
-      }
-      task_outgoing.push_back({i,st_idx,en_idx,vol});
-      size_t work_to_send = 0;
-      for( size_t t = st_idx; t < en_idx; ++t ) {
-        work_to_send += cost(*(begin + t));
-      }
-      printf("RANK %d SENDING %lu to RANK %d\n", world_rank, work_to_send, i);
+  size_t local_st = 0, local_en = 0;
+  for( size_t st = 0; st < ntask_local; ) {
+    const int dst = task_dst(local_prefix_sum[st]);
+    size_t en = st + 1;
+    while( en < ntask_local and task_dst(local_prefix_sum[en]) == size_t(dst) ) en++;
+
+    if( dst == world_rank ) { local_st = st; local_en = en; }
+    else {
+      int hdr = 0; MPI_Pack_size( sizeof(size_t), MPI_BYTE, comm, &hdr );
+      size_t vol = hdr;
+      for( size_t t = st; t < en; ++t ) vol += task_pack_size(*(begin + t), comm);
+      task_outgoing.push_back({dst, st, en, vol});
     }
-    it = n_it;
+    st = en;
   }
 
   auto prefix_en = hrt_t::now();
 
-  // Sanity check
-  if(task_outgoing.size() > 2 )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank) + " SZ = " + std::to_string(task_outgoing.size()));
-
-  MPI_Barrier(comm);
-  ring_execute(
-  [&]() {
-    printf("RANK %d MESSAGES:\n", world_rank);
-    for(auto& msg : task_outgoing) {
-      printf("  DST %d ST %lu EN %lu V %lu\n",
-        msg.dst, msg.idx_st, msg.idx_en, msg.vol);
-    }
-  } , comm);
-  MPI_Barrier(comm);
-
-  std::vector<MPI_Request> packed_req; packed_req.reserve(8);
-
-  // Ask neighbors if they're sending messages
-  int recv_from_backward = 0;
-  int recv_from_forward = 0;
-  int send_forward = 0;
-  int send_backward = 0;
-  if(world_rank) {
-    auto& req = packed_req.emplace_back();
-    MPI_Irecv( &recv_from_backward, 1, MPI_INT, world_rank-1, 0, comm, &req );
-  }
-  if(world_rank < world_size-1) {
-    auto& req = packed_req.emplace_back();
-    MPI_Irecv( &recv_from_forward, 1, MPI_INT, world_rank+1, 1, comm, &req );
-  }
-  if(world_rank < world_size-1) {
-    auto& req = packed_req.emplace_back();
-    for(auto& msg : task_outgoing) send_forward |= (msg.dst == world_rank+1);
-    MPI_Isend( &send_forward, 1, MPI_INT, world_rank+1, 0, comm, &req );
-  }
-  if(world_rank) {
-    auto& req = packed_req.emplace_back();
-    for(auto& msg : task_outgoing) send_backward |= (msg.dst == world_rank-1);
-    MPI_Isend( &send_backward, 1, MPI_INT, world_rank-1, 1, comm, &req );
-  }
-
-
-
-  // Wait for messages to complete
-  if(packed_req.size()) {
-    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUS_IGNORE);
+  if(verbose) {
+    MPI_Barrier(comm);
+    ring_execute(
+    [&]() {
+      printf("RANK %d MESSAGES:\n", world_rank);
+      for(auto& msg : task_outgoing) {
+        printf("  DST %d ST %lu EN %lu V %lu\n",
+          msg.dst, msg.idx_st, msg.idx_en, msg.vol);
+      }
+    } , comm);
+    MPI_Barrier(comm);
   }
-  // Reset messages
-  packed_req.clear();
-
-  printf("RANK %d, BW %d, FW %d\n", world_rank, recv_from_backward, recv_from_forward );
-  MPI_Barrier(MPI_COMM_WORLD);
-
 
-#if 0
-  // Sanity check
-  if( world_rank < world_size - 1 and task_outgoing.size() != 1 )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank));
-  if( world_rank == world_size - 1 and task_outgoing.size() )
-    GAUXC_GENERIC_EXCEPTION("Incorrect Outgoing Task Message Size RANK = " + std::to_string(world_rank));
-#endif
+  // Exchange message sizes
+  std::vector<size_t> send_sizes(world_size, 0), recv_sizes(world_size, 0);
+  for(auto& msg : task_outgoing) send_sizes[msg.dst] = msg.vol;
+  MPI_Alltoall( send_sizes.data(), 1, mpi_data_type<size_t>(),
+                recv_sizes.data(), 1, mpi_data_type<size_t>(), comm );
 
-  // Allocate incoming and outgoing buffers = 64 MiB
-  constexpr size_t packed_buffer_size = 64 * 1024 * 1024;
-  MPI_Packed_Buffer packed_outgoing_forward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_incoming_forward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_outgoing_backward( packed_buffer_size, comm );
-  MPI_Packed_Buffer packed_incoming_backward( packed_buffer_size, comm );
+  std::vector<MPI_Request> packed_req; 
 
   // Post receives
-  if(recv_from_backward) {
-    auto& packed_recv_req = packed_req.emplace_back();
-    MPI_Irecv( packed_incoming_backward.buffer(), packed_buffer_size, MPI_PACKED,
-      world_rank-1, 0, comm, &packed_recv_req );
-  }
-  if(recv_from_forward) {
-    auto& packed_recv_req = packed_req.emplace_back();
-    MPI_Irecv( packed_incoming_forward.buffer(), packed_buffer_size, MPI_PACKED,
-      world_rank+1, 0, comm, &packed_recv_req );
+  std::vector<std::pair<int,MPI_Packed_Buffer>> packed_incoming;
+  packed_incoming.reserve(world_size);
+  for( int i = 0; i < world_size; ++i ) 
+  if( recv_sizes[i] ) {
+    auto& [src, buffer] = packed_incoming.emplace_back( i, 
+      MPI_Packed_Buffer(recv_sizes[i], comm) );
+    MPI_Irecv( buffer.buffer(), int(buffer.size()), MPI_PACKED, src, 0, comm,
+      &packed_req.emplace_back() );
   }
 
+  // Pack and send
   auto pack_st = hrt_t::now();
-  {
-
-  //std::ofstream ofile("task_send." + std::to_string(world_rank) + ".txt");
-
-  auto pack_msg = [&](const auto& msg, auto& mpi_buffer) {
-    size_t ntask_send = msg.idx_en - msg.idx_st;
-    //ofile << "DEST " << msg.dst << std::endl;
-    mpi_buffer.pack(ntask_send); //ofile << ntask_send << std::endl;
-    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) {
-      const auto& task = *(begin + i);
-      mpi_buffer.pack(task.iParent);
-      mpi_buffer.pack(task.npts);
-      mpi_buffer.pack(task.points);
-      mpi_buffer.pack(task.weights);
-      mpi_buffer.pack(task.bfn_screening.shell_list);
-      mpi_buffer.pack(task.bfn_screening.nbe);
-      mpi_buffer.pack(task.cou_screening.shell_list);
-      mpi_buffer.pack(task.cou_screening.shell_pair_list);
-      mpi_buffer.pack(task.cou_screening.shell_pair_idx_list);
-      mpi_buffer.pack(task.cou_screening.nbe);
-      mpi_buffer.pack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() <<
-      //  ", " << task.cou_screening.nbe << ", " << task.cou_screening.shell_list.size() <<
-      //  ", " << task.cou_screening.shell_pair_list.size() << ", " << task.cou_screening.shell_pair_idx_list.size()
-      //  << std::endl;
-    }
-
-    // Send data to neighbor
-    auto& packed_send_req = packed_req.emplace_back();
-    auto* buffer = mpi_buffer.buffer();
-    MPI_Isend(buffer, packed_buffer_size, MPI_PACKED, msg.dst, 0,
-      comm, &packed_send_req);
-  };
-
-  // Pack and send to neighbor
-  #if 0
-  if(send_backward or send_forward) {
-    // Pack Data
-    auto& msg = task_outgoing[0];
-    if( msg.dst != world_rank+1 )
-      GAUXC_GENERIC_EXCEPTION("Invalid Destination Rank");
-
-    size_t ntask_send = msg.idx_en - msg.idx_st;
-
-    //std::ofstream ofile("task_send." + std::to_string(world_rank) + ".txt");
-
-    packed_outgoing.pack(ntask_send); //ofile << ntask_send << std::endl;
-    //printf("RANK = %d SEND = %lu\n", world_rank, ntask_send);
-    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) {
-      const auto& task = *(begin + i);
-      packed_outgoing.pack(task.iParent);
-      packed_outgoing.pack(task.npts);
-      packed_outgoing.pack(task.points);
-      packed_outgoing.pack(task.weights);
-      packed_outgoing.pack(task.bfn_screening.shell_list);
-      packed_outgoing.pack(task.bfn_screening.nbe);
-      packed_outgoing.pack(task.cou_screening.shell_list);
-      packed_outgoing.pack(task.cou_screening.shell_pair_list);
-      packed_outgoing.pack(task.cou_screening.shell_pair_idx_list);
-      packed_outgoing.pack(task.cou_screening.nbe);
-      packed_outgoing.pack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() << std::endl;
-    }
-
-    // Send data to neighbor
-    auto& packed_send_req = packed_req.emplace_back();
-    auto* buffer = packed_outgoing.buffer();
-    MPI_Isend(buffer, packed_buffer_size, MPI_PACKED, world_rank+1, 0,
-      comm, &packed_send_req);
-
-  }
-  #else
+  std::vector<MPI_Packed_Buffer> packed_outgoing;
+  packed_outgoing.reserve(task_outgoing.size());
   for( auto& msg : task_outgoing ) {
-    if(msg.dst == world_rank + 1)
-      pack_msg(msg, packed_outgoing_forward);
-    else
-      pack_msg(msg, packed_outgoing_backward);
-  }
-  #endif
+    auto& buffer = packed_outgoing.emplace_back( msg.vol, comm );
+    buffer.pack( msg.idx_en - msg.idx_st );
+    for(size_t i = msg.idx_st; i < msg.idx_en; ++i) 
+      pack_task( *(begin + i), buffer );
+    MPI_Isend( buffer.buffer(), int(buffer.size()), MPI_PACKED, msg.dst, 0, comm,
+      &packed_req.emplace_back() );
   }
-
   auto pack_en = hrt_t::now();
 
-  // Local task storage
-  std::vector< XCTask > local_work;
-
-  // Move local tasks to task storage
-  {
-    auto func = [=](auto a, auto b) { return a / task_avg < b+1; };
-    auto lps_begin = local_prefix_sum.begin();
-    auto lps_end   = local_prefix_sum.end();
-    auto local_begin =
-      world_rank ? std::lower_bound(lps_begin,lps_end,world_rank-1,func) : lps_begin;
-    auto local_end = std::lower_bound(local_begin, lps_end, world_rank,func);
-    size_t st_idx = std::distance(lps_begin, local_begin);
-    size_t en_idx = std::distance(lps_begin, local_end  );
-
-    size_t local_cost = 0;
-    for(size_t i = st_idx; i < en_idx; ++i) {
-      local_work.emplace_back( std::move(*(begin + i)) );
-      local_cost += cost(local_work.back());
-    }
-    printf("RANK %d LC %lu\n", world_rank, local_cost);
-  }
-
-
   // Wait on sends and receives
   auto wait_st = hrt_t::now();
   if(packed_req.size()) {
-    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUS_IGNORE);
+    MPI_Waitall(packed_req.size(), packed_req.data(), MPI_STATUSES_IGNORE);
   }
   auto wait_en = hrt_t::now();
 
-
+  // Assemble local tasks in global order: lower ranks, local, higher ranks
   auto unpack_st  = hrt_t::now();
-
-  {
-
-  //std::ofstream ofile("task_recv." + std::to_string(world_rank) + ".txt");
+  std::vector< XCTask > local_work;
   auto unpack_msg = [&](auto& mpi_buffer) {
     size_t ntask_recv = 0;
-    //if(&mpi_buffer == &packed_incoming_backward) ofile << "SRC " << world_rank - 1 << std::endl;
-    //else ofile << "SRC " << world_rank + 1 << std::endl;
-
-    mpi_buffer.unpack(ntask_recv); //ofile << ntask_recv << std::endl;
-    for(size_t i = 0; i < ntask_recv; ++i) {
-      auto& task = local_work.emplace_back();
-      mpi_buffer.unpack(task.iParent);
-      mpi_buffer.unpack(task.npts);
-      mpi_buffer.unpack(task.points);
-      mpi_buffer.unpack(task.weights);
-      mpi_buffer.unpack(task.bfn_screening.shell_list);
-      mpi_buffer.unpack(task.bfn_screening.nbe);
-      mpi_buffer.unpack(task.cou_screening.shell_list);
-      mpi_buffer.unpack(task.cou_screening.shell_pair_list);
-      mpi_buffer.unpack(task.cou_screening.shell_pair_idx_list);
-      mpi_buffer.unpack(task.cou_screening.nbe);
-      mpi_buffer.unpack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() <<
-      //  ", " << task.cou_screening.nbe << ", " << task.cou_screening.shell_list.size() <<
-      //  ", " << task.cou_screening.shell_pair_list.size() << ", " << task.cou_screening.shell_pair_idx_list.size()
-      //  << std::endl;
-    }
+    mpi_buffer.unpack(ntask_recv);
+    for( size_t i = 0; i < ntask_recv; ++i )
+      unpack_task( local_work.emplace_back(), mpi_buffer );
   };
-  #if 0
-  // Unpack
-  if(world_rank) {
-    size_t ntask_recv = 0;
-    packed_incoming.unpack(ntask_recv); 
-    for(size_t i = 0; i < ntask_recv; ++i) {
-      auto& task = local_work.emplace_back();
-      packed_incoming.unpack(task.iParent);
-      packed_incoming.unpack(task.npts);
-      packed_incoming.unpack(task.points);
-      packed_incoming.unpack(task.weights);
-      packed_incoming.unpack(task.bfn_screening.shell_list);
-      packed_incoming.unpack(task.bfn_screening.nbe);
-      packed_incoming.unpack(task.cou_screening.shell_list);
-      packed_incoming.unpack(task.cou_screening.shell_pair_list);
-      packed_incoming.unpack(task.cou_screening.shell_pair_idx_list);
-      packed_incoming.unpack(task.cou_screening.nbe);
-      packed_incoming.unpack(task.dist_nearest);
-      //ofile << task.iParent << ", " << task.npts << ", " << task.dist_nearest <<
-      //  ", " << task.bfn_screening.nbe << ", " << task.points.size() << std::endl;
-    }
 
-  }
-  #else
-  if(recv_from_backward) unpack_msg(packed_incoming_backward);
-  if(recv_from_forward ) unpack_msg(packed_incoming_forward );
-  #endif
-  }
+  auto inc_it = packed_incoming.begin();
+  for( ; inc_it != packed_incoming.end() and inc_it->first < world_rank; ++inc_it )
+    unpack_msg( inc_it->second );
+  for( size_t i = local_st; i < local_en; ++i )
+    local_work.emplace_back( std::move(*(begin + i)) );
+  for( ; inc_it != packed_incoming.end(); ++inc_it )
+    unpack_msg( inc_it->second );
   auto unpack_en  = hrt_t::now();
 
-
-  MPI_Barrier(MPI_COMM_WORLD);
-  printf(
-  "RANK %d AFTER REBALNACE: PREFIX_DUR = %f PACK_DUR = %f WAIT_DUR = %f UNPACK_DUR = %f LW = %lu\n",
-    world_rank,
-    dur_t(prefix_en-prefix_st).count(),
-    dur_t(pack_en-pack_st).count(),
-    dur_t(wait_en-wait_st).count(),
-    dur_t(unpack_en-unpack_st).count(),
-    //local_work.size()
-    std::accumulate(local_work.begin(),local_work.end(),0ul,
-      [=](const auto& a, const auto& b){ return a + cost(b); })
-  );
+  if(verbose) {
+    MPI_Barrier(comm);
+    printf(
+    "RANK %d AFTER REBALANCE: PREFIX_DUR = %f PACK_DUR = %f WAIT_DUR = %f UNPACK_DUR = %f LW = %lu\n",
+      world_rank,
+      dur_t(prefix_en-prefix_st).count(),
+      dur_t(pack_en-pack_st).count(),
+      dur_t(wait_en-wait_st).count(),
+      dur_t(unpack_en-unpack_st).count(),
+      std::accumulate(local_work.begin(),local_work.end(),0ul,
+        [&](const auto& a, const auto& b){ return a + cost(b); })
+    );
+  }
 
   return local_work;
 
 }
 #endif
 
+bool calibrate_cost_model( TaskCostModel& model, 
+  const std::vector<XCTask>& tasks, const RuntimeEnvironment& rt ) {
+
+  auto ne = model.normal_equations( tasks.cbegin(), tasks.cend() );
+#ifdef GAUXC_HAS_MPI
+  MPI_Allreduce( MPI_IN_PLACE, ne.data(), ne.size(), MPI_DOUBLE, MPI_SUM, 
+    rt.comm() );
+#else
+  (void)rt;
+#endif
+  return model.fit( ne );
+
+}
+
+TaskLoadStatistics task_load_statistics( const TaskCostModel& model,
+  const std::vector<XCTask>& tasks, const RuntimeEnvironment& rt ) {
+
+  std::array<double,2> load = {0., 0.};
+  for( const auto& task : tasks ) {
+    load[0] += model.predict(task);
+    load[1] += model.measured(task);
+  }
+
+  auto max_load = load, sum_load = load;
+  int world_size = 1;
+#ifdef GAUXC_HAS_MPI
+  MPI_Allreduce( MPI_IN_PLACE, max_load.data(), 2, MPI_DOUBLE, MPI_MAX, 
+    rt.comm() );
+  MPI_Allreduce( MPI_IN_PLACE, sum_load.data(), 2, MPI_DOUBLE, MPI_SUM, 
+    rt.comm() );
+  world_size = rt.comm_size();
+#else
+  (void)rt;
+#endif
+
+  TaskLoadStatistics stats;
+  stats.predicted_max = max_load[0];
+  stats.predicted_avg = sum_load[0] / world_size;
+  stats.measured_max  = max_load[1];
+  stats.measured_avg  = sum_load[1] / world_size;
+  return stats;
+
+}
+
 
 void LoadBalancerImpl::rebalance_weights() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
   const size_t natoms = molecule().natoms();
   auto cost = [=](const auto& task){ return task.cost(1,natoms); };
-  auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
+  auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm(), true );
   tasks = std::move(new_tasks);
+  state_.task_version++;
 #endif
 }
 
 void LoadBalancerImpl::rebalance_exc_vxc() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  const size_t natoms = molecule().natoms();
-  auto cost = [=](const auto& task){ return task.cost_exc_vxc(1); };
-  auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
+  auto& model = exc_vxc_cost_model_;
+  calibrate_cost_model( model, tasks, runtime_ );
+
+  auto cost = [&](const auto& task){ return model.cost(task); };
+  auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm(), true );
   tasks = std::move(new_tasks);
+  state_.task_version++;
 #endif
 }
 
 void LoadBalancerImpl::rebalance_exx() {
 #ifdef GAUXC_HAS_MPI
   auto& tasks = get_tasks();
-  auto cost = [=](const auto& task){ return task.cost_exx(); };
-  auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm());
-  local_tasks_ = std::move(new_tasks);
+  auto& model = exx_cost_model_;
+  calibrate_cost_model( model, tasks, runtime_ );
+
+  auto cost = [&](const auto& task){ return model.cost(task); };
+  auto new_tasks = rebalance( tasks.begin(), tasks.end(), cost, runtime_.comm(), true );
+  tasks = std::move(new_tasks);
+  state_.task_version++;
   MPI_Barrier(MPI_COMM_WORLD);
 #endif
 }
 
+void LoadBalancerImpl::calibrate_cost_models() {
+  // The cost models only refer to the task sizes and screening, the tasks
+  // are not unpacked
+  const auto& tasks = task_store_.tasks();
+  calibrate_cost_model( exc_vxc_cost_model_, tasks, runtime_ );
+  calibrate_cost_model( exx_cost_model_,     tasks, runtime_ );
+}
+
+TaskLoadStatistics LoadBalancerImpl::exc_vxc_load_statistics() const {
+  return task_load_statistics( exc_vxc_cost_model_, task_store_.tasks(), 
+    runtime_ );
+}
+
+TaskLoadStatistics LoadBalancerImpl::exx_load_statistics() const {
+  return task_load_statistics( exx_cost_model_, task_store_.tasks(), 
+    runtime_ );
+}
+
 }
@@ -0,0 +1,69 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+
+#include <gauxc/xc_task.hpp>
+#include <gauxc/task_cost_model.hpp>
+#include <gauxc/runtime_environment.hpp>
+#include <gauxc/util/mpi.hpp>
+#include <functional>
+
+namespace GauXC::detail {
+
+#ifdef GAUXC_HAS_MPI
+
+using rebalance_cost_type = std::function<size_t(const XCTask&)>;
+
+/**
+ *  @brief Redistribute a distributed task list by cost
+ *
+ *  The global task list is interpreted as the concatenation of the local
+ *  task lists in rank order. Upon return, each rank holds a contiguous
+ *  segment of the global list of approximately equal total cost. The global
+ *  order of the tasks is preserved.
+ *
+ *  @param[in] begin   Start of the local task list
+ *  @param[in] end     End of the local task list
+ *  @param[in] cost    Cost of a task
+ *  @param[in] comm    MPI Communicator over which to rebalance
+ *  @param[in] verbose Print load / communication diagnostics
+ *
+ *  @returns Local tasks after rebalance (local tasks in [begin,end) are 
+ *  moved from)
+ */
+std::vector<XCTask> rebalance( std::vector<XCTask>::iterator begin,
+  std::vector<XCTask>::iterator end, const rebalance_cost_type& cost,
+  MPI_Comm comm, bool verbose = false );
+
+#endif
+
+/**
+ *  @brief Fit a task cost model to the measured costs of a distributed
+ *  task list
+ *
+ *  @param[in,out] model Cost model to calibrate
+ *  @param[in]     tasks Local task list
+ *  @param[in]     rt    Runtime over which the task list is distributed
+ *
+ *  @returns Whether any measured tasks were found (i.e. the model was updated)
+ */
+bool calibrate_cost_model( TaskCostModel& model, 
+  const std::vector<XCTask>& tasks, const RuntimeEnvironment& rt );
+
+/**
+ *  @brief Predicted and measured load of a distributed task list for a
+ *  cost model
+ *
+ *  @param[in] model Cost model (predictions only meaningful if calibrated)
+ *  @param[in] tasks Local task list
+ *  @param[in] rt    Runtime over which the task list is distributed
+ */
+TaskLoadStatistics task_load_statistics( const TaskCostModel& model,
+  const std::vector<XCTask>& tasks, const RuntimeEnvironment& rt );
+
+}
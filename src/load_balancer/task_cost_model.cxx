@@ -0,0 +1,188 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/task_cost_model.hpp>
+#include <gauxc/exceptions.hpp>
+#include <cmath>
+#include <iomanip>
+#include <istream>
+#include <limits>
+#include <ostream>
+
+namespace GauXC {
+
+std::string to_string( TaskCostModel::Kind kind ) {
+  switch(kind) {
+    case TaskCostModel::Kind::ExcVXC: return "EXC_VXC";
+    case TaskCostModel::Kind::EXX:    return "EXX";
+  }
+  return "UNKNOWN";
+}
+
+TaskCostModel::term_type TaskCostModel::terms( const XCTask& task ) const {
+  const double npts = task.npts;
+  const double nbe  = task.bfn_screening.nbe;
+  if( kind_ == Kind::ExcVXC ) return { npts, npts * nbe, npts * nbe * nbe };
+
+  const double nbe_cou = task.cou_screening.nbe;
+  const double npairs  = task.cou_screening.shell_pair_list.size();
+  return { npts * nbe, npts * nbe * nbe_cou, npts * npairs };
+}
+
+double TaskCostModel::measured( const XCTask& task ) const {
+  return kind_ == Kind::ExcVXC ? task.measured_cost.exc_vxc : 
+                                 task.measured_cost.exx;
+}
+
+double TaskCostModel::predict( const XCTask& task ) const {
+  const auto f = terms(task);
+  double t = 0.;
+  for( size_t i = 0; i < nterms; ++i ) t += coeff_[i] * f[i];
+  return t;
+}
+
+size_t TaskCostModel::cost( const XCTask& task ) const {
+  if( calibrated() ) 
+    return std::max<size_t>( 1, std::llround( 1e9 * predict(task) ) );
+  return kind_ == Kind::ExcVXC ? task.cost_exc_vxc(1) : task.cost_exx();
+}
+
+TaskCostModel::normal_equations_type TaskCostModel::normal_equations(
+  std::vector<XCTask>::const_iterator begin,
+  std::vector<XCTask>::const_iterator end ) const {
+
+  normal_equations_type ne; ne.fill(0.);
+  auto* A  = ne.data();
+  auto* b  = A + nterms*nterms;
+  auto& tt = ne[nterms*nterms + nterms];
+  auto& n  = ne[nterms*nterms + nterms + 1];
+
+  for( auto it = begin; it != end; ++it ) {
+    const auto t = measured(*it);
+    if( not (t > 0.) ) continue;
+    const auto f = terms(*it);
+    for( size_t j = 0; j < nterms; ++j ) {
+      for( size_t i = 0; i < nterms; ++i ) A[i + j*nterms] += f[i] * f[j];
+      b[j] += f[j] * t;
+    }
+    tt += t * t;
+    n  += 1.;
+  }
+
+  return ne;
+}
+
+bool TaskCostModel::fit( const normal_equations_type& ne ) {
+
+  const auto* A  = ne.data();
+  const auto* b  = A + nterms*nterms;
+  const auto  tt = ne[nterms*nterms + nterms];
+  const auto  n  = ne[nterms*nterms + nterms + 1];
+  if( n < 1. ) return false;
+
+  // Scale the terms to unit diagonal, the magnitude of the terms spans
+  // several orders of magnitude. Terms which vanish for all samples are
+  // excluded from the fit
+  term_type s;
+  for( size_t i = 0; i < nterms; ++i ) {
+    const auto a_ii = A[i*(nterms+1)];
+    s[i] = a_ii > 0. ? 1. / std::sqrt(a_ii) : 0.;
+  }
+
+  // Non-negative least squares by enumeration of the active sets: the
+  // NNLS solution is the (positive) unconstrained solution on its support
+  // with the smallest residual
+  double    res_min = std::numeric_limits<double>::infinity();
+  term_type c_min   = {0., 0., 0.};
+  for( unsigned mask = 1; mask < (1u << nterms); ++mask ) {
+
+    std::array<size_t, nterms> idx; size_t m = 0;
+    bool valid = true;
+    for( size_t i = 0; i < nterms; ++i ) 
+    if( mask & (1u << i) ) {
+      valid = valid and s[i] > 0.;
+      idx[m++] = i;
+    }
+    if( not valid ) continue;
+
+    // Scaled subsystem M y = r
+    std::array<double, nterms*nterms> M;
+    term_type y;
+    for( size_t j = 0; j < m; ++j ) {
+      for( size_t i = 0; i < m; ++i )
+        M[i + j*m] = s[idx[i]] * s[idx[j]] * A[idx[i] + idx[j]*nterms];
+      y[j] = s[idx[j]] * b[idx[j]];
+    }
+
+    // Gaussian elimination with partial pivoting
+    for( size_t k = 0; k < m and valid; ++k ) {
+      size_t p = k;
+      for( size_t i = k+1; i < m; ++i ) 
+        if( std::abs(M[i + k*m]) > std::abs(M[p + k*m]) ) p = i;
+      if( std::abs(M[p + k*m]) < 1e-12 ) { valid = false; break; }
+      if( p != k ) {
+        for( size_t j = 0; j < m; ++j ) std::swap( M[k + j*m], M[p + j*m] );
+        std::swap( y[k], y[p] );
+      }
+      for( size_t i = k+1; i < m; ++i ) {
+        const auto l = M[i + k*m] / M[k + k*m];
+        for( size_t j = k; j < m; ++j ) M[i + j*m] -= l * M[k + j*m];
+        y[i] -= l * y[k];
+      }
+    }
+    if( not valid ) continue;
+    for( size_t k = m; k-- > 0; ) {
+      for( size_t j = k+1; j < m; ++j ) y[k] -= M[k + j*m] * y[j];
+      y[k] /= M[k + k*m];
+    }
+
+    term_type c = {0., 0., 0.};
+    for( size_t i = 0; i < m; ++i ) {
+      c[idx[i]] = s[idx[i]] * y[i];
+      valid = valid and c[idx[i]] >= 0.;
+    }
+    if( not valid ) continue;
+
+    // Residual |t - F c|^2 = t.t - 2 c.b + c.A.c
+    double res = tt;
+    for( size_t j = 0; j < nterms; ++j ) {
+      res -= 2. * c[j] * b[j];
+      for( size_t i = 0; i < nterms; ++i ) res += c[i] * A[i + j*nterms] * c[j];
+    }
+    if( res < res_min ) { res_min = res; c_min = c; }
+
+  }
+
+  if( res_min == std::numeric_limits<double>::infinity() ) return false;
+
+  coeff_    = c_min;
+  nsamples_ = n;
+  return true;
+
+}
+
+void TaskCostModel::write( std::ostream& os ) const {
+  os << to_string(kind_) << " " << nsamples_ << std::setprecision(17);
+  for( auto c : coeff_ ) os << " " << c;
+  os << std::endl;
+}
+
+void TaskCostModel::read( std::istream& is ) {
+  std::string name;
+  size_t      nsamples;
+  term_type   coeff;
+  is >> name >> nsamples;
+  for( auto& c : coeff ) is >> c;
+  if( not is ) GAUXC_GENERIC_EXCEPTION("Failed to Read TaskCostModel");
+  if( name != to_string(kind_) ) 
+    GAUXC_GENERIC_EXCEPTION("TaskCostModel Kind Mismatch: " + name);
+
+  coeff_    = coeff;
+  nsamples_ = nsamples;
+}
+
+}
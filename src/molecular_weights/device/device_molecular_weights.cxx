@@ -79,6 +79,8 @@ void DeviceMolecularWeights::modify_weights( LoadBalancer& lb ) const {
   rt.device_backend()->master_queue_synchronize();
  
   lb.state().modified_weights_are_stored = true;
+  lb.state().weight_alg = this->settings_.weight_alg;
+  lb.state().becke_size_adjustment = this->settings_.becke_size_adjustment;
 
 }
 
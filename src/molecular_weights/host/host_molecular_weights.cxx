@@ -27,13 +27,15 @@ void HostMolecularWeights::modify_weights( LoadBalancer& lb ) const {
   };
   std::sort( tasks.begin(), tasks.end(), task_comparator );
 
-  // Modify the weights
+  // Modify the weights (SoA points and weights of the task store)
   const auto& mol  = lb.molecule();
   const auto& meta = lb.molmeta();
   lwd->partition_weights( this->settings_.weight_alg, mol, meta, 
-    tasks.begin(), tasks.end() );
+    lb.task_store() );
 
   lb.state().modified_weights_are_stored = true;
+  lb.state().weight_alg = this->settings_.weight_alg;
+  lb.state().becke_size_adjustment = this->settings_.becke_size_adjustment;
 }
 
 }
@@ -23,7 +23,27 @@ MolecularWeights::MolecularWeights(pimpl_ptr_type&& ptr) :
 void MolecularWeights::modify_weights(load_balancer_reference lb) const {
   if(not pimpl_) GAUXC_PIMPL_NOT_INITIALIZED();
   auto& timer = pimpl_->get_timer();
-  timer.time_op("MolecularWeights",[&](){ pimpl_->modify_weights(lb);});
+  timer.time_op("MolecularWeights",[&](){ 
+    // Weights already partitioned with the requested scheme (e.g. stored 
+    // by a loaded plan) are kept
+    const auto& state    = lb.state();
+    const auto& settings = pimpl_->settings();
+    if( state.modified_weights_are_stored ) {
+      if( state.weight_alg == settings.weight_alg and 
+          state.becke_size_adjustment == settings.becke_size_adjustment ) 
+        return;
+      GAUXC_GENERIC_EXCEPTION("Stored Weights Were Partitioned With A Different Scheme");
+    }
+
+    // Keep the unpartitioned weights if requested (geometry updates)
+    const bool retain = state.retain_quadrature_weights;
+    for( auto& task : lb.get_tasks() ) {
+      if( retain ) task.quadrature_weights = task.weights;
+      else         std::vector<double>().swap( task.quadrature_weights );
+    }
+    pimpl_->modify_weights(lb);
+    lb.state().task_version++;
+  });
 }
 
 const util::Timer& MolecularWeights::get_timings() const {
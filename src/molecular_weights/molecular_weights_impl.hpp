@@ -32,6 +32,9 @@ public:
     settings_(settings) {}
 
   virtual void modify_weights(LoadBalancer&) const = 0;
+  inline const MolecularWeightsSettings& settings() const {
+    return settings_;
+  }
   inline const util::Timer& get_timings() const {
     return timer_;
   };
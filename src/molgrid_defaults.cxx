@@ -7,7 +7,12 @@
  */
 #include <gauxc/molgrid/defaults.hpp>
 #include <gauxc/exceptions.hpp>
+#include <gauxc/basisset_map.hpp>
+#include "xc_integrator/local_work_driver/common/integrator_constants.hpp"
 #include <integratorxx/quadratures/lebedev_laikov.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace GauXC {
 
@@ -144,6 +149,99 @@ UnprunedAtomicGridSpecification MolGridFactory::create_default_unpruned_grid_spe
 
 
 
+AdaptivePruningSpecification MolGridFactory::create_adaptive_pruning_spec(
+  const Molecule& mol, const BasisSet<double>& basis, AtomicNumber Z, 
+  double tol
+) {
+
+  AdaptivePruningSpecification spec;
+  spec.tolerance = tol;
+
+  const size_t natoms = mol.size();
+  auto dist = [&]( size_t i, size_t j ) {
+    return std::hypot( mol[i].x - mol[j].x, mol[i].y - mol[j].y, 
+      mol[i].z - mol[j].z );
+  };
+
+  // Maximum angular momentum and (unique) primitive exponents of the 
+  // shells centered on each atom
+  BasisSetMap basis_map( basis, mol );
+  std::vector<int32_t> atom_max_l( natoms, -1 );
+  std::vector<std::vector<double>> atom_exponents( natoms );
+  for( size_t ish = 0; ish < basis.size(); ++ish ) {
+    const auto iat = basis_map.shell_to_center(ish);
+    if( iat < 0 ) continue;
+
+    const auto& shell = basis[ish];
+    atom_max_l[iat] = std::max( atom_max_l[iat], shell.l() );
+    atom_exponents[iat].insert( atom_exponents[iat].end(), shell.alpha_data(),
+      shell.alpha_data() + shell.nprim() );
+  }
+  for( auto& alpha : atom_exponents ) {
+    std::sort( alpha.begin(), alpha.end() );
+    alpha.erase( std::unique( alpha.begin(), alpha.end() ), alpha.end() );
+  }
 
+  // The partition range of an atom extends to the neighbors whose SSF 
+  // transition layer (|mu| < a) starts, at r = (1-a) d / 2, before the 
+  // outer edge (1+a) d_0 / 2 of the transition layer of its nearest 
+  // neighbor (distance d_0). Neighbors are weighted by the solid angle of 
+  // their cell boundary relative to the nearest one, (d_0 / d)**2.
+  constexpr double a = integrator::magic_ssf_factor<>;
+  constexpr double partition_range = (1. + a) / (1. - a);
+
+  // Neighbors of the atoms of the element are merged by distance (to a 
+  // relative tolerance) and basis, keeping the largest weight, i.e. 
+  // symmetry equivalent atoms contribute their environment once
+  auto equivalent = []( const AdaptivePruningNeighbor& x, 
+    const AdaptivePruningNeighbor& y ) {
+    return std::abs( x.distance - y.distance ) <= 1e-8 * x.distance and
+           x.exponents == y.exponents;
+  };
+
+  bool has_shells = false;
+  std::vector<AdaptivePruningNeighbor> atom_neighbors;
+  for( size_t i = 0; i < natoms; ++i ) 
+  if( mol[i].Z == Z ) {
+    if( atom_max_l[i] >= 0 ) {
+      has_shells = true;
+      spec.max_l = std::max( spec.max_l, atom_max_l[i] );
+    }
+
+    double d_0 = std::numeric_limits<double>::infinity();
+    for( size_t j = 0; j < natoms; ++j ) 
+      if( j != i and dist(i,j) > 0. ) d_0 = std::min( d_0, dist(i,j) );
+    if( not std::isfinite(d_0) ) continue;
+
+    // Neighbors of atom i, equivalent neighbors accumulate their weights
+    atom_neighbors.clear();
+    const double r_max = ( 1. + 1e-8 ) * partition_range * d_0;
+    for( size_t j = 0; j < natoms; ++j ) {
+      const double d = dist(i,j);
+      if( not (d > 0.) or d > r_max or atom_exponents[j].empty() ) continue;
+
+      AdaptivePruningNeighbor nbr{ d, (d_0 * d_0) / (d * d), 
+        atom_exponents[j] };
+      auto it = std::find_if( atom_neighbors.begin(), atom_neighbors.end(),
+        [&]( const auto& x ){ return equivalent(x, nbr); } );
+      if( it == atom_neighbors.end() ) atom_neighbors.emplace_back( nbr );
+      else it->weight += nbr.weight;
+    }
+
+    for( auto& nbr : atom_neighbors ) {
+      auto it = std::find_if( spec.neighbors.begin(), spec.neighbors.end(),
+        [&]( const auto& x ){ return equivalent(x, nbr); } );
+      if( it == spec.neighbors.end() ) 
+        spec.neighbors.emplace_back( std::move(nbr) );
+      else it->weight = std::max( it->weight, nbr.weight );
+    }
+  }
+
+  if( not has_shells )
+    GAUXC_GENERIC_EXCEPTION("No Basis Functions Centered on Element");
+
+  return spec;
+
+}
 
 }
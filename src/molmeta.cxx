@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include <gauxc/molmeta.hpp>
+#include <gauxc/exceptions.hpp>
 
 namespace GauXC {
 
@@ -39,6 +40,27 @@ void MolMeta::compute_rab(const Molecule& mol) {
 
 }
 
+void MolMeta::update_geometry( const Molecule& mol, 
+  const std::vector<int32_t>& moved ) {
+
+  if( mol.natoms() != natoms_ )
+    GAUXC_GENERIC_EXCEPTION("MolMeta Update Requires The Same Number of Atoms");
+
+  for( auto i : moved )
+  for( size_t j = 0; j < natoms_; ++j ) 
+  if( j != size_t(i) ) {
+    const double dab_x = mol[i].x - mol[j].x;
+    const double dab_y = mol[i].y - mol[j].y;
+    const double dab_z = mol[i].z - mol[j].z;
+
+    rab_[i + j*natoms_] = std::sqrt(dab_x*dab_x + dab_y*dab_y + dab_z*dab_z);
+    rab_[j + i*natoms_] = rab_[i + j*natoms_];
+  }
+
+  if( moved.size() ) compute_dist_nearest();
+
+}
+
 void MolMeta::compute_dist_nearest() {
 
   dist_nearest_.resize(natoms_);
@@ -10,6 +10,12 @@
 
 namespace GauXC {
 
+#ifdef GAUXC_HAS_MPI
+MPI_Datatype get_mpi_datatype( std::type_index idx );
+MPI_Op get_mpi_op( ReductionOp op );
+#endif
+size_t get_dtype_size( std::type_index idx );
+
 struct BasicMPIReductionDriver : public HostReductionDriver {
 
   BasicMPIReductionDriver(const RuntimeEnvironment& rt);
@@ -0,0 +1,301 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "node_shared_mpi_reduction_driver.hpp"
+#include "basic_mpi_reduction_driver.hpp"
+#include "../packed_symmetric.hpp"
+#include <gauxc/exceptions.hpp>
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+namespace GauXC {
+
+/// Communicators of the node hierarchy of a runtime communicator
+struct NodeSharedMPIReductionDriver::node_topology {
+
+  int node_rank = 0; ///< Rank within the node
+  int nnodes    = 1; ///< Number of nodes
+
+  #ifdef GAUXC_HAS_MPI
+  MPI_Comm node   = MPI_COMM_NULL; ///< Processes of the node
+  MPI_Comm leader = MPI_COMM_NULL; ///< Node leaders (null on other processes)
+
+  node_topology( MPI_Comm comm ) {
+    int world_rank; MPI_Comm_rank( comm, &world_rank );
+    MPI_Comm_split_type( comm, MPI_COMM_TYPE_SHARED, world_rank, 
+      MPI_INFO_NULL, &node );
+    MPI_Comm_rank( node, &node_rank );
+    MPI_Comm_split( comm, node_rank ? MPI_UNDEFINED : 0, world_rank, &leader );
+
+    if( not node_rank ) MPI_Comm_size( leader, &nnodes );
+    MPI_Bcast( &nnodes, 1, MPI_INT, 0, node );
+  }
+
+  ~node_topology() noexcept {
+    int finalized; MPI_Finalized( &finalized );
+    if( finalized ) return;
+    if( leader != MPI_COMM_NULL ) MPI_Comm_free( &leader );
+    if( node   != MPI_COMM_NULL ) MPI_Comm_free( &node   );
+  }
+  #else
+  node_topology() = default;
+  #endif
+
+};
+
+namespace {
+
+/// Node shared allocation (one per allocate_node_shared call)
+struct node_shared_window {
+  size_t size;
+  std::shared_ptr<NodeSharedMPIReductionDriver::node_topology> topology;
+  #ifdef GAUXC_HAS_MPI
+  MPI_Win win;
+  #else
+  std::unique_ptr<char[]> data;
+  #endif
+};
+
+/// Process wide registry of node shared allocations keyed by base address,
+/// allows any instance to identify node shared integrands
+struct node_shared_registry {
+
+  std::mutex mtx;
+  std::map<const char*, node_shared_window> windows;
+
+  /// Window containing [ptr, ptr+size), nullptr if none
+  node_shared_window* find( const void* ptr, size_t size = 1 ) {
+    std::lock_guard<std::mutex> lock(mtx);
+    const auto* p = static_cast<const char*>(ptr);
+    auto it = windows.upper_bound(p);
+    if( it == windows.begin() ) return nullptr;
+    --it;
+    if( p + size > it->first + it->second.size ) return nullptr;
+    return &it->second;
+  }
+
+  /// Synchronize the public and private copies of all windows
+  void sync() {
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    #ifdef GAUXC_HAS_MPI
+    std::lock_guard<std::mutex> lock(mtx);
+    for( auto& [ptr, w] : windows ) MPI_Win_sync( w.win );
+    #endif
+  }
+
+};
+
+node_shared_registry& registry() {
+  static node_shared_registry r;
+  return r;
+}
+
+}
+
+
+
+NodeSharedMPIReductionDriver::NodeSharedMPIReductionDriver(
+  const RuntimeEnvironment& rt) : HostReductionDriver(rt), 
+  #ifdef GAUXC_HAS_MPI
+  topology_( std::make_shared<node_topology>(rt.comm()) ) { }
+  #else
+  topology_( std::make_shared<node_topology>() ) { }
+  #endif
+
+NodeSharedMPIReductionDriver::~NodeSharedMPIReductionDriver() noexcept = default;
+NodeSharedMPIReductionDriver::NodeSharedMPIReductionDriver(
+  const NodeSharedMPIReductionDriver&) = default;
+
+
+void* NodeSharedMPIReductionDriver::allocate_node_shared_typeerased( 
+  size_t size ) {
+
+  if( not size ) return nullptr;
+
+  node_shared_window w{ size, topology_ };
+  char* ptr = nullptr;
+
+  #ifdef GAUXC_HAS_MPI
+  // The leader allocates the window, other processes map its segment
+  char* base = nullptr;
+  const MPI_Aint local_size = topology_->node_rank ? 0 : size;
+  MPI_Win_allocate_shared( local_size, 1, MPI_INFO_NULL, topology_->node, 
+    &base, &w.win );
+
+  MPI_Aint leader_size; int disp_unit;
+  MPI_Win_shared_query( w.win, 0, &leader_size, &disp_unit, &ptr );
+
+  // Passive target epoch for the lifetime of the window, synchronization
+  // through MPI_Win_sync + node barriers
+  MPI_Win_lock_all( MPI_MODE_NOCHECK, w.win );
+  #else
+  w.data = std::make_unique<char[]>(size);
+  ptr = w.data.get();
+  #endif
+
+  auto& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mtx);
+  reg.windows.emplace( ptr, std::move(w) );
+  return ptr;
+
+}
+
+void NodeSharedMPIReductionDriver::free_node_shared( void* ptr ) {
+
+  if( not ptr ) return;
+
+  auto& reg = registry();
+  std::lock_guard<std::mutex> lock(reg.mtx);
+  auto it = reg.windows.find( static_cast<const char*>(ptr) );
+  if( it == reg.windows.end() )
+    GAUXC_GENERIC_EXCEPTION("Pointer Not Allocated By allocate_node_shared");
+
+  #ifdef GAUXC_HAS_MPI
+  MPI_Win_unlock_all( it->second.win );
+  MPI_Win_free( &it->second.win );
+  #endif
+  reg.windows.erase(it);
+
+}
+
+bool NodeSharedMPIReductionDriver::is_node_shared( const void* ptr ) const {
+  return ptr and registry().find(ptr);
+}
+
+bool NodeSharedMPIReductionDriver::is_node_leader() const {
+  return topology_->node_rank == 0;
+}
+
+void NodeSharedMPIReductionDriver::node_barrier() {
+  auto& reg = registry();
+  reg.sync();
+  #ifdef GAUXC_HAS_MPI
+  MPI_Barrier( topology_->node );
+  #endif
+  reg.sync();
+}
+
+
+void NodeSharedMPIReductionDriver::allreduce_typeerased( const void* src, 
+  void* dest, size_t size, ReductionOp op, std::type_index idx, 
+  std::any optional_args ) {
+
+  if( is_node_shared(dest) )
+    GAUXC_GENERIC_EXCEPTION("Out-of-Place Reduction Into Node Shared Memory");
+
+  if( src != dest ) std::memcpy( dest, src, size * get_dtype_size(idx) );
+  allreduce_inplace_typeerased( dest, size, op, idx, optional_args );
+
+}
+
+void NodeSharedMPIReductionDriver::allreduce_inplace_typeerased( void* data, 
+  size_t size, ReductionOp op, std::type_index idx, std::any optional_args ) {
+
+  if( optional_args.has_value() )
+    std::cout << "** Warning: Optional Args Are Not Used in NodeSharedMPIReductionDriver::allreduce" << std::endl;
+
+  if( runtime_.comm_size() == 1 ) return;
+
+  #ifdef GAUXC_HAS_MPI
+  const auto dtype  = get_mpi_datatype(idx);
+  const auto mpi_op = get_mpi_op(op);
+  const auto& topo  = *topology_;
+
+  if( auto* w = registry().find( data, size * get_dtype_size(idx) ) ) {
+
+    // Node shared: wait for the on-node accumulation, the leaders reduce
+    // the node copies (over the communicators of the allocating instance)
+    const auto& w_topo = *w->topology;
+    int cmp; MPI_Comm_compare( w_topo.node, topo.node, &cmp );
+    if( cmp != MPI_IDENT and cmp != MPI_CONGRUENT )
+      GAUXC_GENERIC_EXCEPTION("Node Shared Memory From Incompatible Runtime");
+
+    auto& reg = registry();
+    reg.sync(); MPI_Barrier( w_topo.node ); reg.sync();
+    if( not w_topo.node_rank and w_topo.nnodes > 1 )
+      MPI_Allreduce( MPI_IN_PLACE, data, size, dtype, mpi_op, w_topo.leader );
+    reg.sync(); MPI_Barrier( w_topo.node ); reg.sync();
+
+  } else {
+
+    // Process private: reduce onto the leader, allreduce across the
+    // leaders, broadcast within the node
+    if( topo.node_rank ) 
+      MPI_Reduce( data, nullptr, size, dtype, mpi_op, 0, topo.node );
+    else {
+      MPI_Reduce( MPI_IN_PLACE, data, size, dtype, mpi_op, 0, topo.node );
+      if( topo.nnodes > 1 )
+        MPI_Allreduce( MPI_IN_PLACE, data, size, dtype, mpi_op, topo.leader );
+    }
+    MPI_Bcast( data, size, dtype, 0, topo.node );
+
+  }
+  #endif
+
+}
+
+void NodeSharedMPIReductionDriver::allreduce_packed_symmetric_typeerased( 
+  size_t n, const std::vector<void*>& matrices, const std::vector<size_t>& ld,
+  void* scalars, size_t nscalars, ReductionOp op, std::type_index idx ) {
+
+  // Process private matrices: single hierarchical reduction of the message
+  size_t nshared = 0;
+  for( auto* A : matrices ) nshared += is_node_shared(A);
+  if( not nshared ) {
+    HostReductionDriver::allreduce_packed_symmetric_typeerased( n, matrices, 
+      ld, scalars, nscalars, op, idx );
+    return;
+  }
+  if( nshared != matrices.size() )
+    GAUXC_GENERIC_EXCEPTION("Mixed Node Shared / Private Packed Reduction");
+
+  detail::PackedSymmetricMessage msg( n, matrices, ld, scalars, nscalars, idx );
+
+  #ifdef GAUXC_HAS_MPI
+  // Node shared matrices: the (private) scalars are reduced onto the 
+  // leader, which reduces the node copies of the lower triangles together 
+  // with the scalars across the leaders
+  const auto& w_topo = *registry().find( matrices.front() )->topology;
+  int cmp; MPI_Comm_compare( w_topo.node, topology_->node, &cmp );
+  if( cmp != MPI_IDENT and cmp != MPI_CONGRUENT )
+    GAUXC_GENERIC_EXCEPTION("Node Shared Memory From Incompatible Runtime");
+
+  const auto dtype  = get_mpi_datatype(idx);
+  const auto mpi_op = get_mpi_op(op);
+
+  auto& reg = registry();
+  reg.sync(); MPI_Barrier( w_topo.node ); reg.sync();
+  if( w_topo.node_rank ) {
+    if( nscalars ) 
+      MPI_Reduce( scalars, nullptr, nscalars, dtype, mpi_op, 0, w_topo.node );
+  } else {
+    if( nscalars ) 
+      MPI_Reduce( MPI_IN_PLACE, scalars, nscalars, dtype, mpi_op, 0, 
+        w_topo.node );
+    if( w_topo.nnodes > 1 ) {
+      auto* buffer = msg.pack();
+      MPI_Allreduce( MPI_IN_PLACE, buffer, msg.size(), dtype, mpi_op, 
+        w_topo.leader );
+      msg.unpack();
+    } else msg.symmetrize();
+  }
+  if( nscalars ) MPI_Bcast( scalars, nscalars, dtype, 0, w_topo.node );
+  reg.sync(); MPI_Barrier( w_topo.node ); reg.sync();
+  #else
+  msg.symmetrize();
+  #endif
+
+}
+
+std::unique_ptr<detail::ReductionDriverImpl> NodeSharedMPIReductionDriver::clone() {
+  return std::make_unique<NodeSharedMPIReductionDriver>(*this);
+}
+
+}
@@ -0,0 +1,49 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "host_reduction_driver.hpp"
+
+namespace GauXC {
+
+/**
+ *  Host reduction driver which exploits MPI-3 shared memory windows.
+ *
+ *  Integrands allocated through allocate_node_shared exist once per node:
+ *  the processes of a node accumulate into the same copy and 
+ *  allreduce_inplace only reduces it across the node leaders. Process 
+ *  private data is reduced hierarchically (reduce onto the node leader, 
+ *  allreduce across the node leaders, broadcast within the node).
+ */
+struct NodeSharedMPIReductionDriver : public HostReductionDriver {
+
+  NodeSharedMPIReductionDriver(const RuntimeEnvironment& rt);
+  virtual ~NodeSharedMPIReductionDriver() noexcept;
+  NodeSharedMPIReductionDriver(const NodeSharedMPIReductionDriver& );
+
+  void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any ) override;
+  void allreduce_packed_symmetric_typeerased( size_t, const std::vector<void*>&,
+    const std::vector<size_t>&, void*, size_t, ReductionOp, std::type_index ) override;
+
+  void* allocate_node_shared_typeerased( size_t ) override;
+  void  free_node_shared( void* ) override;
+  bool  is_node_shared( const void* ) const override;
+  bool  is_node_leader() const override;
+  void  node_barrier() override;
+
+  std::unique_ptr<detail::ReductionDriverImpl> clone() override;
+
+  struct node_topology;
+
+private:
+
+  std::shared_ptr<node_topology> topology_; ///< Node / leader communicators
+
+};
+
+}
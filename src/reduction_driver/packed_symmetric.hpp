@@ -0,0 +1,108 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/exceptions.hpp>
+#include <cstddef>
+#include <cstring>
+#include <typeindex>
+#include <vector>
+
+namespace GauXC::detail {
+
+/**
+ *  Message of a packed symmetric reduction: the lower triangles (column
+ *  major, including the diagonal) of a set of (n x n) matrices followed by
+ *  a set of scalars.
+ */
+class PackedSymmetricMessage {
+
+  size_t n_;
+  const std::vector<void*>&  matrices_;
+  const std::vector<size_t>& ld_;
+  void*  scalars_;
+  size_t nscalars_;
+  size_t dtype_size_;
+  std::type_index idx_;
+
+  std::vector<std::byte> buffer_;
+
+  template <typename T>
+  void mirror_lower() {
+    for( size_t imat = 0; imat < matrices_.size(); ++imat ) {
+      auto* A = static_cast<T*>(matrices_[imat]);
+      const auto lda = ld_[imat];
+      for( size_t j = 0;   j < n_; ++j )
+      for( size_t i = j+1; i < n_; ++i ) A[j + i*lda] = A[i + j*lda];
+    }
+  }
+
+public:
+
+  PackedSymmetricMessage( size_t n, const std::vector<void*>& matrices, 
+    const std::vector<size_t>& ld, void* scalars, size_t nscalars, 
+    std::type_index idx ) :
+    n_(n), matrices_(matrices), ld_(ld), scalars_(scalars), 
+    nscalars_(nscalars), idx_(idx) {
+
+    if( matrices_.size() != ld_.size() )
+      GAUXC_GENERIC_EXCEPTION("Inconsistent Packed Symmetric Reduction");
+    for( auto ld : ld_ ) if( ld < n_ ) 
+      GAUXC_GENERIC_EXCEPTION("Invalid LD in Packed Symmetric Reduction");
+
+    if( idx_ == std::type_index(typeid(double)) ) dtype_size_ = sizeof(double);
+    else if( idx_ == std::type_index(typeid(float)) ) dtype_size_ = sizeof(float);
+    else GAUXC_GENERIC_EXCEPTION("Unsupported Packed Symmetric Reduction Type");
+
+  }
+
+  /// Number of elements of the message
+  size_t size() const { 
+    return matrices_.size() * n_ * (n_+1) / 2 + nscalars_; 
+  }
+
+  /// Gather the lower triangles and the scalars into the message
+  void* pack() {
+    buffer_.resize( size() * dtype_size_ );
+    auto* buf = buffer_.data();
+    for( size_t imat = 0; imat < matrices_.size(); ++imat ) {
+      const auto* A = static_cast<const std::byte*>(matrices_[imat]);
+      for( size_t j = 0; j < n_; ++j ) {
+        const size_t nbytes = (n_ - j) * dtype_size_;
+        std::memcpy( buf, A + (j + j*ld_[imat]) * dtype_size_, nbytes );
+        buf += nbytes;
+      }
+    }
+    if( nscalars_ ) std::memcpy( buf, scalars_, nscalars_ * dtype_size_ );
+    return buffer_.data();
+  }
+
+  /// Scatter the message into the lower triangles and the scalars, the
+  /// upper triangles are set by symmetry
+  void unpack() {
+    const auto* buf = buffer_.data();
+    for( size_t imat = 0; imat < matrices_.size(); ++imat ) {
+      auto* A = static_cast<std::byte*>(matrices_[imat]);
+      for( size_t j = 0; j < n_; ++j ) {
+        const size_t nbytes = (n_ - j) * dtype_size_;
+        std::memcpy( A + (j + j*ld_[imat]) * dtype_size_, buf, nbytes );
+        buf += nbytes;
+      }
+    }
+    if( nscalars_ ) std::memcpy( scalars_, buf, nscalars_ * dtype_size_ );
+    symmetrize();
+  }
+
+  /// Set the upper triangles by symmetry
+  void symmetrize() {
+    if( dtype_size_ == sizeof(double) ) mirror_lower<double>();
+    else                                mirror_lower<float>();
+  }
+
+};
+
+}
@@ -34,6 +34,14 @@ void ReductionDriver::allreduce_inplace_typeerased( void* data, size_t size, Red
   pimpl_->allreduce_inplace_typeerased(data, size, op, idx, optional_args);
 }
 
+void ReductionDriver::allreduce_packed_symmetric_typeerased( size_t n, 
+  const std::vector<void*>& matrices, const std::vector<size_t>& ld, 
+  void* scalars, size_t nscalars, ReductionOp op, std::type_index idx ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->allreduce_packed_symmetric_typeerased(n, matrices, ld, scalars, 
+    nscalars, op, idx);
+}
+
 bool ReductionDriver::takes_host_memory() const {
   if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
   return pimpl_->takes_host_memory();
@@ -43,6 +51,27 @@ bool ReductionDriver::takes_device_memory() const {
   return pimpl_->takes_device_memory();
 }
 
+void* ReductionDriver::allocate_node_shared_typeerased( size_t size ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->allocate_node_shared_typeerased(size);
+}
+void ReductionDriver::free_node_shared( void* ptr ) {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->free_node_shared(ptr);
+}
+bool ReductionDriver::is_node_shared( const void* ptr ) const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->is_node_shared(ptr);
+}
+bool ReductionDriver::is_node_leader() const {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  return pimpl_->is_node_leader();
+}
+void ReductionDriver::node_barrier() {
+  if( not pimpl_ ) GAUXC_PIMPL_NOT_INITIALIZED();
+  pimpl_->node_barrier();
+}
+
 
 
 
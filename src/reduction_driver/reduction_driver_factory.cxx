@@ -7,6 +7,7 @@
  */
 #include "reduction_driver_impl.hpp"
 #include "host/basic_mpi_reduction_driver.hpp"
+#include "host/node_shared_mpi_reduction_driver.hpp"
 
 #ifdef GAUXC_HAS_NCCL
 #include "device/nccl_reduction_driver.hpp"
@@ -32,6 +33,9 @@ std::shared_ptr<ReductionDriver> ReductionDriverFactory::get_shared_instance(
   if( kernel_name == "BASICMPI" )
     ptr = std::make_unique<BasicMPIReductionDriver>(rt);
 
+  if( kernel_name == "NODESHARED" )
+    ptr = std::make_unique<NodeSharedMPIReductionDriver>(rt);
+
   #ifdef GAUXC_HAS_NCCL
     if( kernel_name == "NCCL" )
       ptr = std::make_unique<NCCLReductionDriver>(rt);
@@ -6,6 +6,8 @@
  * See LICENSE.txt for details
  */
 #include "reduction_driver_impl.hpp"
+#include <gauxc/exceptions.hpp>
+#include "packed_symmetric.hpp"
 
 namespace GauXC::detail {
 
@@ -16,4 +18,37 @@ ReductionDriverImpl::ReductionDriverImpl( const RuntimeEnvironment& rt )
 ReductionDriverImpl::~ReductionDriverImpl() noexcept = default;
 ReductionDriverImpl::ReductionDriverImpl(const ReductionDriverImpl& ) = default;
 
+// Pack the lower triangles and scalars into a single message and reduce it
+// through allreduce_inplace
+void ReductionDriverImpl::allreduce_packed_symmetric_typeerased( size_t n,
+  const std::vector<void*>& matrices, const std::vector<size_t>& ld, 
+  void* scalars, size_t nscalars, ReductionOp op, std::type_index idx ) {
+
+  if( not takes_host_memory() )
+    GAUXC_GENERIC_EXCEPTION("Packed Symmetric Reductions Require Host Memory");
+  for( auto* A : matrices ) if( is_node_shared(A) )
+    GAUXC_GENERIC_EXCEPTION("Node Shared Memory Not Supported By ReductionDriver");
+
+  PackedSymmetricMessage msg( n, matrices, ld, scalars, nscalars, idx );
+  if( runtime_.comm_size() == 1 ) { msg.symmetrize(); return; }
+
+  auto* buffer = msg.pack();
+  allreduce_inplace_typeerased( buffer, msg.size(), op, idx, std::any() );
+  msg.unpack();
+
+}
+
+// Node shared memory is not supported by default, processes do not share
+// any integrands
+void* ReductionDriverImpl::allocate_node_shared_typeerased( size_t ) {
+  GAUXC_GENERIC_EXCEPTION("Node Shared Memory Not Supported By ReductionDriver");
+  return nullptr;
+}
+void ReductionDriverImpl::free_node_shared( void* ) {
+  GAUXC_GENERIC_EXCEPTION("Node Shared Memory Not Supported By ReductionDriver");
+}
+bool ReductionDriverImpl::is_node_shared( const void* ) const { return false; }
+bool ReductionDriverImpl::is_node_leader() const { return true; }
+void ReductionDriverImpl::node_barrier() { }
+
 }
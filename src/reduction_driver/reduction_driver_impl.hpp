@@ -28,9 +28,19 @@ public:
   virtual void allreduce_typeerased( const void*, void*, size_t, ReductionOp, std::type_index, std::any ) = 0;
   virtual void allreduce_inplace_typeerased( void*, size_t, ReductionOp, std::type_index, std::any ) = 0;
 
+  virtual void allreduce_packed_symmetric_typeerased( size_t, 
+    const std::vector<void*>&, const std::vector<size_t>&, void*, size_t, 
+    ReductionOp, std::type_index );
+
   virtual bool takes_host_memory() const = 0;
   virtual bool takes_device_memory() const = 0;
 
+  virtual void* allocate_node_shared_typeerased( size_t );
+  virtual void  free_node_shared( void* );
+  virtual bool  is_node_shared( const void* ) const;
+  virtual bool  is_node_leader() const;
+  virtual void  node_barrier();
+
   virtual std::unique_ptr<ReductionDriverImpl> clone() = 0;
 };
 
@@ -0,0 +1,194 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <gauxc/shell_pair.hpp>
+#include <algorithm>
+#include <cmath>
+
+namespace GauXC {
+
+namespace {
+
+// Screening data of a shell (most diffuse exponent and largest coefficient)
+template <typename F>
+struct shell_screening_data {
+  F alpha_min;
+  F coeff_max;
+};
+
+template <typename F>
+shell_screening_data<F> make_screening_data( const Shell<F>& shell ) {
+  shell_screening_data<F> data{ shell.alpha()[0], std::abs(shell.coeff()[0]) };
+  for( int i = 1; i < shell.nprim(); ++i ) {
+    data.alpha_min = std::min( data.alpha_min, shell.alpha()[i] );
+    data.coeff_max = std::max( data.coeff_max, std::abs(shell.coeff()[i]) );
+  }
+  return data;
+}
+
+/*
+ *  Upper bound of |K_coeff_prod| over all primitive pairs of a shell pair,
+ *
+ *    |K_ab| = 2 pi / (a+b) |c_a c_b| exp(-a b / (a+b) R^2)
+ *          <= 2 pi / (a_min+b_min) c_max c_max exp(-a_min b_min / (a_min+b_min) R^2)
+ *
+ *  as both the prefactor and the exponential decrease with the exponents.
+ */
+template <typename F>
+F shell_pair_bound( const shell_screening_data<F>& A,
+  const shell_screening_data<F>& B, F rAB2 ) {
+  const auto g = A.alpha_min + B.alpha_min;
+  return 2 * M_PI / g * A.coeff_max * B.coeff_max *
+    std::exp( -A.alpha_min * B.alpha_min * rAB2 / g );
+}
+
+template <typename F>
+F distance_squared( const Shell<F>& A, const Shell<F>& B ) {
+  const auto rABx = A.O()[0] - B.O()[0];
+  const auto rABy = A.O()[1] - B.O()[1];
+  const auto rABz = A.O()[2] - B.O()[2];
+  return rABx*rABx + rABy*rABy + rABz*rABz;
+}
+
+/*
+ *  Generate the significant primitive pairs of (bra,ket) expanded about bra,
+ *  returns the number of primitive pairs. If prim_pairs is null, only the
+ *  number of primitive pairs is computed
+ */
+template <typename F>
+size_t generate_prim_pairs( const Shell<F>& bra, const Shell<F>& ket,
+  F prim_screen_tol, PrimitivePair<F>* prim_pairs ) {
+
+  detail::cartesian_point A{ bra.O()[0], bra.O()[1], bra.O()[2] };
+  detail::cartesian_point B{ ket.O()[0], ket.O()[1], ket.O()[2] };
+
+  const auto dAB = distance_squared( bra, ket );
+
+  size_t npp = 0;
+  const auto np_bra = bra.nprim();
+  const auto np_ket = ket.nprim();
+  for( auto i = 0; i < np_bra; ++i )
+  for( auto j = 0; j < np_ket; ++j ) {
+
+    const auto alpha_bra = bra.alpha()[i];
+    const auto alpha_ket = ket.alpha()[j];
+
+    const auto g    = alpha_bra + alpha_ket;
+    const auto oo_g = 1 / g;
+
+    const auto Kab = 2 * M_PI * oo_g *
+      bra.coeff()[i] * ket.coeff()[j] *
+      std::exp( -alpha_bra * alpha_ket * dAB * oo_g );
+
+    if(std::abs(Kab) < prim_screen_tol) continue;
+    if( not prim_pairs ) { npp++; continue; }
+    auto& pair = prim_pairs[npp++];
+
+    pair.P.x = (alpha_bra * A.x + alpha_ket * B.x) * oo_g;
+    pair.P.y = (alpha_bra * A.y + alpha_ket * B.y) * oo_g;
+    pair.P.z = (alpha_bra * A.z + alpha_ket * B.z) * oo_g;
+
+    pair.PA.x = pair.P.x - A.x;
+    pair.PA.y = pair.P.y - A.y;
+    pair.PA.z = pair.P.z - A.z;
+
+    pair.PB.x = pair.P.x - B.x;
+    pair.PB.y = pair.P.y - B.y;
+    pair.PB.z = pair.P.z - B.z;
+
+    pair.K_coeff_prod = Kab;
+    pair.gamma = g;
+    pair.gamma_inv = oo_g;
+  } // loop over prim pairs
+
+  return npp;
+
+}
+
+// Primitive pairs are expanded about the shell of higher angular momentum
+template <typename F>
+size_t generate_shell_pair( const Shell<F>& bra, const Shell<F>& ket,
+  F prim_screen_tol, PrimitivePair<F>* prim_pairs ) {
+  if( bra.l() >= ket.l() )
+    return generate_prim_pairs( bra, ket, prim_screen_tol, prim_pairs );
+  else
+    return generate_prim_pairs( ket, bra, prim_screen_tol, prim_pairs );
+}
+
+}
+
+template <typename F>
+ShellPairCollection<F>::ShellPairCollection( const BasisSet<F>& basis,
+  F prim_screen_tol ) {
+
+  nshells_ = basis.size();
+
+  std::vector<shell_screening_data<F>> screening_data( nshells_ );
+  for( size_t i = 0; i < nshells_; ++i )
+    screening_data[i] = make_screening_data( basis[i] );
+
+  // Significant shell pairs and their number of primitive pairs (row-wise).
+  // Shell pairs are screened on their center distance prior to the
+  // primitive screening
+  std::vector<std::vector<size_t>> row_cols( nshells_ ), row_nprim( nshells_ );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < nshells_; ++i )
+  for( size_t j = 0; j <= i; ++j ) {
+    const auto rAB2 = distance_squared( basis[i], basis[j] );
+    if( shell_pair_bound( screening_data[i], screening_data[j], rAB2 ) <
+        prim_screen_tol ) continue;
+    const auto npp =
+      generate_shell_pair( basis[i], basis[j], prim_screen_tol,
+        (PrimitivePair<F>*)nullptr );
+    if( npp ) {
+      row_cols[i].emplace_back( j );
+      row_nprim[i].emplace_back( npp );
+    }
+  }
+
+  // Sparse Storage
+  row_ptr_.resize( nshells_+1 );
+  row_ptr_[0] = 0;
+  for( size_t i = 0; i < nshells_; ++i )
+    row_ptr_[i+1] = row_ptr_[i] + row_cols[i].size();
+
+  const size_t npairs = row_ptr_.back();
+  col_ind_.resize( npairs );
+  std::vector<size_t> prim_offsets( npairs + 1 );
+  prim_offsets[0] = 0;
+  for( size_t i = 0; i < nshells_; ++i )
+  for( size_t k = 0; k < row_cols[i].size(); ++k ) {
+    const auto ij = row_ptr_[i] + k;
+    col_ind_[ij] = row_cols[i][k];
+    prim_offsets[ij+1] = prim_offsets[ij] + row_nprim[i][k];
+  }
+
+  // Generate the primitive pairs into contiguous storage
+  prim_pairs_.resize( prim_offsets.back() );
+  shell_pairs_.resize( npairs );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < nshells_; ++i )
+  for( size_t ij = row_ptr_[i]; ij < row_ptr_[i+1]; ++ij ) {
+    auto* pp = prim_pairs_.data() + prim_offsets[ij];
+    generate_shell_pair( basis[i], basis[col_ind_[ij]], prim_screen_tol, pp );
+    shell_pairs_[ij] = ShellPair<F>( pp, prim_offsets[ij+1] - prim_offsets[ij] );
+  }
+
+}
+
+template <typename F>
+void ShellPairCollection<F>::rebase_shell_pairs(
+  const PrimitivePair<F>* old_base ) {
+  for( auto& sp : shell_pairs_ ) {
+    const auto off = sp.prim_pairs() - old_base;
+    sp = ShellPair<F>( prim_pairs_.data() + off, sp.nprim_pairs() );
+  }
+}
+
+template class ShellPairCollection<double>;
+
+}
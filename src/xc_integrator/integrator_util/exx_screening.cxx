@@ -6,9 +6,12 @@
  * See LICENSE.txt for details
  */
 #include "exx_screening.hpp"
+#include "integral_bounds.hpp"
 #include "host/blas.hpp"
 #include <gauxc/util/div_ceil.hpp>
 #include <chrono>
+#include <numeric>
+#include <cstring>
 //#include <mpi.h>
 //#include <fstream>
 #ifdef GAUXC_HAS_CUDA
@@ -25,55 +28,39 @@ ostream& operator<<( ostream& out, const vector<T>& v ) {
 
 namespace GauXC {
 
-void exx_ek_screening( 
-  const BasisSet<double>& basis, const BasisSetMap& basis_map,
-  const ShellPairCollection<double>& shpairs,
-  const double* P_abs, size_t ldp, const double* V_shell_max, size_t ldv,
-  double eps_E, double eps_K, LocalHostWorkDriver* lwd, 
-  exx_detail::host_task_iterator task_begin,
-  exx_detail::host_task_iterator task_end ) {
+std::vector<double> exx_shell_pair_vmax( const BasisSet<double>& basis,
+  const ShellPairCollection<double>& shpairs ) {
 
-  //int world_rank; MPI_Comm_rank(MPI_COMM_WORLD, &world_rank);
-  const size_t nbf     = basis.nbf();
   const size_t nshells = basis.nshells();
-  const size_t ntasks  = std::distance(task_begin, task_end);
-
-  std::vector<double> task_max_bf_sum(ntasks);
-  std::vector<double> task_max_bfn(nbf * ntasks);
-
-  //using hrt_t = std::chrono::high_resolution_clock;
-  //using dur_t = std::chrono::duration<double>;
-
-  //auto coll_st = hrt_t::now();
-  #pragma omp parallel
-  { // Scope temp mem
-  std::vector<double> basis_eval;
-  std::vector<double> bfn_max_grid(nbf);
-
-  #pragma omp for schedule(dynamic)
-  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
-    //std::cout << "ITASK = " << i_task << std::endl;
-
-    const auto& task = *(task_begin + i_task);
-    const auto npts = task.points.size();
+  std::vector<double> V_max( nshells * nshells );
 
-    const auto* points      = task.points.data()->data();
-    const auto* weights     = task.weights.data();
+  // Loop over sparse shell pairs
+  const auto sp_row_ptr = shpairs.row_ptr();
+  const auto sp_col_ind = shpairs.col_ind();
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < nshells; ++i ) {
+    const auto j_st = sp_row_ptr[i];
+    const auto j_en = sp_row_ptr[i+1];
+    for( auto _j = j_st; _j < j_en; ++_j ) {
+      const size_t j = sp_col_ind[_j];
+      const auto mv = util::max_coulomb( basis.at(i), basis.at(j) );
+      V_max[i + j*nshells] = mv;
+      if( i != j ) V_max[j + i*nshells] = mv;
+    }
+  }
 
-    // Basis function shell list
-    auto shell_list_bfn_ = task.bfn_screening.shell_list;
-    int32_t* shell_list_bfn = shell_list_bfn_.data();
-    size_t nshells_bfn = shell_list_bfn_.size();
-    size_t nbe_bfn     = 
-      basis.nbf_subset( shell_list_bfn_.begin(), shell_list_bfn_.end() );
+  return V_max;
 
-    // Resize scratch
-    basis_eval.resize( nbe_bfn * npts );
+}
 
+namespace {
 
-    // Evaluate basis functions
-    lwd->eval_collocation( npts, nshells_bfn, nbe_bfn, points, basis,
-      shell_list_bfn, basis_eval.data() );
+  // Basis function statistics of a single task (cf. 
+  // exx_ek_screening_bfn_stats) given the collocation of its bfn shell 
+  // list, returns the max bfn sum and stores the max of each of the nbe_bfn
+  // basis functions of the task in bfn_max
+  double task_bfn_stats( size_t npts, size_t nbe_bfn, const double* weights,
+    const std::vector<double>& basis_eval, double* bfn_max ) {
 
     // Compute max bfn sum
     // MBFS = max_i sqrt(W[i]) * \sum_mu B(mu,i)
@@ -85,10 +72,8 @@ void exx_ek_screening(
       }
       max_bfn_sum = std::max( max_bfn_sum, std::sqrt(weights[ipt])*tmp );
     }
-    task_max_bf_sum[i_task] = max_bfn_sum;
 
     // Compute max value for each bfn over grid
-    bfn_max_grid.resize(nbe_bfn);
     for( auto ibf = 0ul; ibf < nbe_bfn; ++ibf ) {
       double tmp = 0.;
       for( auto ipt = 0ul; ipt < npts; ++ipt ) {
@@ -97,49 +82,71 @@ void exx_ek_screening(
           std::abs(basis_eval[ibf + ipt*nbe_bfn])
         );
       }
-      bfn_max_grid[ibf] = tmp;
+      bfn_max[ibf] = tmp;
     }
 
-    // Place max bfn into larger array
-    auto task_max_bfn_it = task_max_bfn.data() + i_task*nbf;
-    size_t ibf = 0ul;
-    for( auto i = 0ul; i < nshells_bfn; ++i ) {
-      const auto ish = shell_list_bfn[i];
-      const auto sh_sz = basis_map.shell_size(ish);
-      const auto sh_off = basis_map.shell_to_first_ao(ish);
+    return max_bfn_sum;
 
-      for( auto j = 0; j < sh_sz; ++j ) {
-        task_max_bfn_it[j + sh_off] = bfn_max_grid[j + ibf];
-      }
+  }
 
-      ibf += sh_sz;
-    }
+  // Basis function statistics of a single task (AoS points)
+  double task_bfn_stats( const BasisSet<double>& basis, 
+    LocalHostWorkDriver* lwd, const XCTask& task, 
+    std::vector<double>& basis_eval, double* bfn_max ) {
 
-  } // Loop over tasks
-  } // Memory Scope
-  //auto coll_en = hrt_t::now();
-  //std::cout << "... done " << dur_t(coll_en-coll_st).count() << std::endl;
+    const auto npts = task.points.size();
 
-  // Compute approx F_i^(k) = |P_ij| * B_j^(k) 
-  //auto gemm_st = hrt_t::now();
-  std::vector<double> task_approx_f( nbf * ntasks );
-  blas::gemm( 'N', 'N', nbf, ntasks, nbf, 1., P_abs, ldp,
-    task_max_bfn.data(), nbf, 0., task_approx_f.data(), nbf );
-  //auto gemm_en = hrt_t::now();
-  //std::cout << "... done " << dur_t(gemm_en-gemm_st).count() << std::endl;
+    // Basis function shell list
+    const auto& shell_list_bfn = task.bfn_screening.shell_list;
+    size_t nbe_bfn = 
+      basis.nbf_subset( shell_list_bfn.begin(), shell_list_bfn.end() );
 
+    // Evaluate basis functions
+    basis_eval.resize( nbe_bfn * npts );
+    lwd->eval_collocation( npts, shell_list_bfn.size(), nbe_bfn, 
+      task.points.data()->data(), basis, shell_list_bfn.data(), 
+      basis_eval.data() );
 
-  //std::ofstream fmax_file("cpu_fmax." + std::to_string(world_rank) + ".txt");
-  //std::cout << "CPU FMAX SHELLS = ";
-  //auto list_st = hrt_t::now();
-  #pragma omp parallel for schedule(dynamic)
-  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
-    //std::cout << "ITASK = " << i_task << std::endl;
+    return task_bfn_stats( npts, nbe_bfn, task.weights.data(), basis_eval,
+      bfn_max );
+
+  }
+
+  // Basis function statistics of task i of a packed TaskStore (SoA points)
+  double task_bfn_stats( const BasisSet<double>& basis, 
+    LocalHostWorkDriver* lwd, const TaskStore& store, size_t i,
+    std::vector<double>& basis_eval, double* bfn_max ) {
+
+    const auto npts = store.npts(i);
+
+    // Basis function shell list
+    const auto& shell_list_bfn = store.tasks()[i].bfn_screening.shell_list;
+    size_t nbe_bfn = 
+      basis.nbf_subset( shell_list_bfn.begin(), shell_list_bfn.end() );
+
+    // Evaluate basis functions
+    basis_eval.resize( nbe_bfn * npts );
+    lwd->eval_collocation_soa( npts, shell_list_bfn.size(), nbe_bfn, 
+      store.points(i), basis, shell_list_bfn.data(), basis_eval.data() );
+
+    return task_bfn_stats( npts, nbe_bfn, store.weights(i), basis_eval,
+      bfn_max );
+
+  }
+
+  // EK shell pair screening of a single task given max_F_approx_bfn, the
+  // approximate F of each basis function (cf. exx_ek_shellpair_collision)
+  void task_ek_shellpair_collision( const BasisSet<double>& basis, 
+    const ShellPairCollection<double>& shpairs, const double* V_shell_max, 
+    size_t ldv, double eps_E, double eps_K, double max_bf_sum, 
+    const double* max_F_approx_bfn, std::vector<double>& max_F_shells,
+    XCTask& task ) {
+
+    const size_t nshells = basis.nshells();
     std::vector<uint32_t> task_ek_shells(util::div_ceil(nshells,32),0);
-    std::vector<double> max_F_shells(nshells);
+    max_F_shells.resize(nshells);
 
     // Collapse max_F over shells
-    const double* max_F_approx_bfn = task_approx_f.data() + i_task*nbf;
     for( auto ish = 0ul, ibf = 0ul; ish < nshells; ++ish) {
       const auto sh_sz = basis[ish].size();
       double tmp = 0.;
@@ -149,22 +156,9 @@ void exx_ek_screening(
       max_F_shells[ish] = tmp;
       ibf += sh_sz;
     }
-    //for(auto x : max_F_shells) std::cout << x << " ";
-    //#if 1
-    //for( auto x : max_F_shells ) {
-    //  fmax_file << i_task << " " << x << std::endl;
-    //}
-    //#else
-    //for(auto i = 0; i < nbf; ++i) {
-    //  fmax_file << i_task << " " << max_F_approx_bfn[i] << std::endl;
-    //}
-    //#endif
-
-    auto task_it = task_begin + i_task;
+
     // Compute important shell set
-    const double max_bf_sum = task_max_bf_sum[i_task];
     for( auto i = 0ul; i < nshells; ++i ) {
-    //for( auto j = 0ul; j <= i;      ++j ) 
       auto row_st = shpairs.row_ptr()[i];
       auto row_en = shpairs.row_ptr()[i+1];
       for(auto _j = row_st; _j < row_en; ++_j)
@@ -184,8 +178,8 @@ void exx_ek_screening(
 
         task_ek_shells[i_block] |= (1u << i_local); 
         task_ek_shells[j_block] |= (1u << j_local); 
-        task_it->cou_screening.shell_pair_list.emplace_back(i,j);
-        task_it->cou_screening.shell_pair_idx_list.emplace_back(_j);
+        task.cou_screening.shell_pair_list.emplace_back(i,j);
+        task.cou_screening.shell_pair_idx_list.emplace_back(_j);
       }
     }
     }
@@ -203,34 +197,257 @@ void exx_ek_screening(
 
 
     // Append to list
-    task_it->cou_screening.shell_list =
-      decltype(task_it->cou_screening.shell_list)(ek_shells.begin(), ek_shells.end());
-    task_it->cou_screening.nbe = 
+    task.cou_screening.shell_list =
+      decltype(task.cou_screening.shell_list)(ek_shells.begin(), ek_shells.end());
+    task.cou_screening.nbe = 
       basis.nbf_subset( ek_shells.begin(), ek_shells.end() );
 
+  }
+
+}
+
+void exx_ek_screening_bfn_stats( 
+  const BasisSet<double>& basis, const BasisSetMap& basis_map,
+  LocalHostWorkDriver* lwd, 
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end,
+  double* task_max_bf_sum, double* task_max_bfn ) {
+
+  const size_t nbf     = basis.nbf();
+  const size_t ntasks  = std::distance(task_begin, task_end);
+
+  std::fill_n( task_max_bfn, nbf * ntasks, 0. );
+
+  #pragma omp parallel
+  { // Scope temp mem
+  std::vector<double> basis_eval;
+  std::vector<double> bfn_max_grid(nbf);
+
+  #pragma omp for schedule(dynamic)
+  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
+
+    const auto& task = *(task_begin + i_task);
+    task_max_bf_sum[i_task] = 
+      task_bfn_stats( basis, lwd, task, basis_eval, bfn_max_grid.data() );
+
+    // Place max bfn into larger array
+    const auto& shell_list_bfn = task.bfn_screening.shell_list;
+    auto task_max_bfn_it = task_max_bfn + i_task*nbf;
+    size_t ibf = 0ul;
+    for( auto ish : shell_list_bfn ) {
+      const auto sh_sz = basis_map.shell_size(ish);
+      const auto sh_off = basis_map.shell_to_first_ao(ish);
+
+      for( auto j = 0; j < sh_sz; ++j ) {
+        task_max_bfn_it[j + sh_off] = bfn_max_grid[j + ibf];
+      }
+
+      ibf += sh_sz;
+    }
+
+  } // Loop over tasks
+  } // Memory Scope
+
+}
+
+void exx_ek_screening_bfn_stats( 
+  const BasisSet<double>& basis, LocalHostWorkDriver* lwd, 
+  const TaskStore& store,
+  std::vector<double>& task_max_bf_sum, std::vector<double>& task_max_bfn,
+  std::vector<size_t>& task_max_bfn_ptr ) {
+
+  const size_t ntasks = store.ntasks();
+
+  task_max_bfn_ptr.assign( ntasks + 1, 0 );
+  for( size_t i_task = 0; i_task < ntasks; ++i_task ) {
+    const auto& shell_list = store.tasks()[i_task].bfn_screening.shell_list;
+    task_max_bfn_ptr[i_task+1] = task_max_bfn_ptr[i_task] + 
+      basis.nbf_subset( shell_list.begin(), shell_list.end() );
+  }
+
+  task_max_bf_sum.resize( ntasks );
+  task_max_bfn.resize( task_max_bfn_ptr.back() );
+
+  #pragma omp parallel
+  { // Scope temp mem
+  std::vector<double> basis_eval;
+
+  #pragma omp for schedule(dynamic)
+  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
+    task_max_bf_sum[i_task] = task_bfn_stats( basis, lwd, store, i_task, 
+      basis_eval, task_max_bfn.data() + task_max_bfn_ptr[i_task] );
+  }
+  } // Memory Scope
+
+}
+
+void exx_ek_shellpair_collision( 
+  const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs,
+  const double* P_abs, size_t ldp, const double* V_shell_max, size_t ldv,
+  double eps_E, double eps_K, 
+  const double* task_max_bf_sum, const double* task_max_bfn,
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end ) {
+
+  const size_t nbf     = basis.nbf();
+  const size_t ntasks  = std::distance(task_begin, task_end);
+  if( !ntasks ) return;
+
+  // Compute approx F_i^(k) = |P_ij| * B_j^(k) 
+  std::vector<double> task_approx_f( nbf * ntasks );
+  blas::gemm( 'N', 'N', nbf, ntasks, nbf, 1., P_abs, ldp,
+    task_max_bfn, nbf, 0., task_approx_f.data(), nbf );
+
+  #pragma omp parallel
+  {
+  std::vector<double> max_F_shells;
+
+  #pragma omp for schedule(dynamic)
+  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
+    task_ek_shellpair_collision( basis, shpairs, V_shell_max, ldv, eps_E,
+      eps_K, task_max_bf_sum[i_task], task_approx_f.data() + i_task*nbf,
+      max_F_shells, *(task_begin + i_task) );
+  } // Loop over tasks
+  }
+
+}
+
+void exx_ek_shellpair_collision( 
+  const BasisSet<double>& basis, const BasisSetMap& basis_map,
+  const ShellPairCollection<double>& shpairs,
+  const double* P_abs, size_t ldp, const double* V_shell_max, size_t ldv,
+  double eps_E, double eps_K, const std::vector<double>& task_max_bf_sum, 
+  const std::vector<double>& task_max_bfn, 
+  const std::vector<size_t>& task_max_bfn_ptr,
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end ) {
+
+  const size_t nbf     = basis.nbf();
+  const size_t ntasks  = std::distance(task_begin, task_end);
+
+  #pragma omp parallel
+  {
+  std::vector<double> max_F_shells;
+  std::vector<double> approx_f( nbf );
+
+  #pragma omp for schedule(dynamic)
+  for(size_t i_task = 0; i_task < ntasks; ++i_task) {
+
+    // Compute approx F_i^(k) = |P_ij| * B_j^(k) over the basis functions 
+    // of the task
+    auto& task = *(task_begin + i_task);
+    const double* max_bfn = task_max_bfn.data() + task_max_bfn_ptr[i_task];
+    std::fill( approx_f.begin(), approx_f.end(), 0. );
+    size_t ibf = 0ul;
+    for( auto ish : task.bfn_screening.shell_list ) {
+      const auto sh_sz  = basis_map.shell_size(ish);
+      const auto sh_off = basis_map.shell_to_first_ao(ish);
+      for( auto j = 0; j < sh_sz; ++j ) 
+        blas::axpy( nbf, max_bfn[ibf + j], P_abs + (sh_off + j)*ldp, 1, 
+          approx_f.data(), 1 );
+      ibf += sh_sz;
+    }
+
+    task_ek_shellpair_collision( basis, shpairs, V_shell_max, ldv, eps_E,
+      eps_K, task_max_bf_sum[i_task], approx_f.data(), max_F_shells, task );
+
   } // Loop over tasks
-  //auto list_en = hrt_t::now();
-  //std::cout << "... done " << dur_t(list_en-list_st).count() << std::endl;
-
-  //{
-  //std::ofstream ofile("cpu_max_bfn." + std::to_string(world_rank) + ".txt");
-  //for(auto i = 0; i < ntasks; ++i) {
-  //  ofile << i << " " << task_max_bf_sum[i] << std::endl;
-  //}
-  //}
-  //{
-  //std::ofstream ofile("cpu_counts." + std::to_string(world_rank) + ".txt");
-  //for(auto i = 0; i < ntasks; ++i) {
-  //  ofile << i << " " << (task_begin+i)->cou_screening.shell_pair_list.size() << std::endl;
-  //}
-  //}
-  //{
-  //std::ofstream ofile("cpu_rc_counts." + std::to_string(world_rank) + ".txt");
-  //for(auto i = 0; i < ntasks; ++i) {
-  //  ofile << i << " " << (task_begin+i)->cou_screening.shell_list.size() << std::endl;
-  //}
-  //}
+  }
+
+}
+
+void exx_ek_screening( 
+  const BasisSet<double>& basis, const BasisSetMap& basis_map,
+  const ShellPairCollection<double>& shpairs,
+  const double* P_abs, size_t ldp, const double* V_shell_max, size_t ldv,
+  double eps_E, double eps_K, LocalHostWorkDriver* lwd, 
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end ) {
+
+  const size_t nbf     = basis.nbf();
+  const size_t ntasks  = std::distance(task_begin, task_end);
+
+  std::vector<double> task_max_bf_sum(ntasks);
+  std::vector<double> task_max_bfn(nbf * ntasks);
+
+  exx_ek_screening_bfn_stats( basis, basis_map, lwd, task_begin, task_end,
+    task_max_bf_sum.data(), task_max_bfn.data() );
+
+  exx_ek_shellpair_collision( basis, shpairs, P_abs, ldp, V_shell_max, ldv,
+    eps_E, eps_K, task_max_bf_sum.data(), task_max_bfn.data(), task_begin,
+    task_end );
+
+}
+
+namespace {
+  // Number of points and a (task order dependent) FNV-1a signature of the 
+  // task sizes and weights, the plan refers to the tasks by their index
+  auto task_source_summary( const TaskStore& store ) {
+    size_t npts = 0; uint64_t wsig = 0xcbf29ce484222325ull;
+    auto add = [&]( uint64_t x ) { wsig = (wsig ^ x) * 0x100000001b3ull; };
+    for( size_t i = 0; i < store.ntasks(); ++i ) {
+      const size_t  n = store.npts(i);
+      const double* w = store.weights(i);
+      npts += n;
+      add( n );
+      for( size_t j = 0; j < n; ++j ) {
+        uint64_t w_bits; std::memcpy( &w_bits, w + j, sizeof(double) );
+        add( w_bits );
+      }
+    }
+    return std::make_pair( npts, wsig );
+  }
+}
+
+bool EXXScreeningPlan::matches( const void* _key, 
+  const TaskStore& store ) const {
+
+  if( key != _key ) return false;
+  if( ntasks_ref != store.ntasks() ) return false;
+
+  auto [npts, wsig] = task_source_summary( store );
+  return npts == npts_ref and wsig == wsig_ref;
+
+}
 
+EXXScreeningPlan make_exx_screening_plan( 
+  const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+  LocalHostWorkDriver* lwd, const TaskStore& store, const void* key ) {
+
+  const auto& tasks = store.tasks();
+
+  EXXScreeningPlan plan;
+  plan.key        = key;
+  plan.ntasks_ref = store.ntasks();
+  std::tie( plan.npts_ref, plan.wsig_ref ) = task_source_summary( store );
+
+  plan.V_max = exx_shell_pair_vmax( basis, shpairs );
+
+  // Lexicographic ordering of tasks on the bfn shell list (stable to 
+  // ensure a deterministic task order), EXX allows for the merging of tasks
+  // with different iParent
+  const size_t ntasks = plan.ntasks_ref;
+  plan.task_order.resize( ntasks );
+  std::iota( plan.task_order.begin(), plan.task_order.end(), 0 );
+  std::stable_sort( plan.task_order.begin(), plan.task_order.end(), 
+    [&]( size_t a, size_t b ) {
+      return tasks[a].bfn_screening.shell_list < 
+             tasks[b].bfn_screening.shell_list;
+    });
+
+  // Ranges of tasks with equivalent bfn screening
+  plan.bfn_group_ptr.emplace_back(0);
+  for( size_t i = 1; i < ntasks; ++i ) 
+  if( tasks[plan.task_order[i]].bfn_screening.shell_list != 
+      tasks[plan.task_order[i-1]].bfn_screening.shell_list )
+    plan.bfn_group_ptr.emplace_back(i);
+  if( ntasks ) plan.bfn_group_ptr.emplace_back(ntasks);
+
+  // Basis function statistics (in task source order)
+  exx_ek_screening_bfn_stats( basis, lwd, store, plan.task_max_bf_sum, 
+    plan.task_max_bfn, plan.task_max_bfn_ptr );
+
+  return plan;
 
 }
 
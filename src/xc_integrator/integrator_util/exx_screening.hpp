@@ -7,6 +7,7 @@
  */
 #pragma once
 #include <gauxc/xc_task.hpp>
+#include <gauxc/task_store.hpp>
 #include <host/local_host_work_driver.hpp>
 #ifdef GAUXC_HAS_DEVICE
 #include <device/local_device_work_driver.hpp>
@@ -26,6 +27,94 @@ void exx_ek_screening(
   exx_detail::host_task_iterator task_begin,
   exx_detail::host_task_iterator task_end );
 
+/// Upper bounds of the Coulomb integrals over the significant shell pairs,
+/// stored as a dense (nshells x nshells) matrix
+std::vector<double> exx_shell_pair_vmax( const BasisSet<double>& basis,
+  const ShellPairCollection<double>& shpairs );
+
+/// Density independent (collocation) statistics for EK screening
+///   task_max_bf_sum[k]         = max_i sqrt(w_i) * sum_mu |B(mu,i)|
+///   task_max_bfn[mu + k * nbf] = max_i sqrt(w_i) * |B(mu,i)|
+void exx_ek_screening_bfn_stats( 
+  const BasisSet<double>& basis, const BasisSetMap& basis_map,
+  LocalHostWorkDriver* lwd, 
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end,
+  double* task_max_bf_sum, double* task_max_bfn );
+
+/// Density dependent EK screening from precomputed basis statistics,
+/// appends to the cou_screening data of each task
+void exx_ek_shellpair_collision( 
+  const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs,
+  const double* P_abs, size_t ldp, const double* V_shell_max, size_t ldv,
+  double eps_E, double eps_K, 
+  const double* task_max_bf_sum, const double* task_max_bfn,
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end );
+
+/// Compressed basis function statistics for EK screening, the statistics 
+/// of task k only span the basis functions of its bfn shell list
+///   task_max_bf_sum[k]   = max_i sqrt(w_i) * sum_mu |B(mu,i)|
+///   task_max_bfn[ibf]    = max_i sqrt(w_i) * |B(mu,i)| for the ibf-th 
+///                          basis function mu of the shell list of task k,
+///                          ibf in [task_max_bfn_ptr[k], task_max_bfn_ptr[k+1])
+/// for the tasks of a packed TaskStore
+void exx_ek_screening_bfn_stats( 
+  const BasisSet<double>& basis, LocalHostWorkDriver* lwd, 
+  const TaskStore& store,
+  std::vector<double>& task_max_bf_sum, std::vector<double>& task_max_bfn,
+  std::vector<size_t>& task_max_bfn_ptr );
+
+/// Density dependent EK screening from compressed basis statistics,
+/// appends to the cou_screening data of each task
+void exx_ek_shellpair_collision( 
+  const BasisSet<double>& basis, const BasisSetMap& basis_map,
+  const ShellPairCollection<double>& shpairs,
+  const double* P_abs, size_t ldp, const double* V_shell_max, size_t ldv,
+  double eps_E, double eps_K, const std::vector<double>& task_max_bf_sum, 
+  const std::vector<double>& task_max_bfn, 
+  const std::vector<size_t>& task_max_bfn_ptr,
+  exx_detail::host_task_iterator task_begin,
+  exx_detail::host_task_iterator task_end );
+
+/**
+ *  Density independent sn-LinK screening state which may be reused across
+ *  SCF iterations for a fixed molecule, basis and grid.
+ *
+ *  The plan refers to the tasks of its task source by index, only the 
+ *  (compressed) basis function statistics and the order in which tasks 
+ *  with identical basis function screening are contiguous are stored. 
+ *  Only the density dependent shell pair screening (stored on the source 
+ *  tasks) and the subsequent merge of tasks with identical EK shell lists 
+ *  have to be redone for each density.
+ */
+struct EXXScreeningPlan {
+
+  const void* key        = nullptr; ///< Identity of the generating task source
+  size_t      ntasks_ref = 0;       ///< Number of tasks in the task source
+  size_t      npts_ref   = 0;       ///< Number of points in the task source
+  uint64_t    wsig_ref   = 0;       ///< Signature of the weights in the task source
+
+  std::vector<double> V_max;            ///< Max Coulomb bounds per shell pair
+  std::vector<size_t> task_order;       ///< Source task indices, equivalent 
+                                        ///< bfn screening contiguous
+  std::vector<size_t> bfn_group_ptr;    ///< Ranges of task_order with 
+                                        ///< equivalent bfn screening
+  std::vector<double> task_max_bf_sum;  ///< See exx_ek_screening_bfn_stats
+  std::vector<double> task_max_bfn;     ///< See exx_ek_screening_bfn_stats
+  std::vector<size_t> task_max_bfn_ptr; ///< See exx_ek_screening_bfn_stats
+
+  /// Whether the plan was generated from the passed (packed) task source
+  bool matches( const void* _key, const TaskStore& store ) const;
+
+};
+
+/// Generate the density independent sn-LinK screening state for the tasks
+/// of a packed TaskStore
+EXXScreeningPlan make_exx_screening_plan( 
+  const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+  LocalHostWorkDriver* lwd, const TaskStore& store, const void* key );
+
 #ifdef GAUXC_HAS_DEVICE
 void exx_ek_screening( 
   const BasisSet<double>& basis, const BasisSetMap& basis_map,
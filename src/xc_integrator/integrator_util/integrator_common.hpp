@@ -8,6 +8,10 @@
 #pragma once
 
 #include <gauxc/basisset_map.hpp>
+#include <gauxc/xc_task.hpp>
+#include <algorithm>
+#include <chrono>
+#include <numeric>
 
 namespace GauXC      {
 
@@ -16,5 +20,37 @@ std::tuple< std::vector< std::array<int32_t, 3> >, std::vector< int32_t > >
                              const std::vector< int32_t >& shell_mask,
 		             const int32_t LDA, const int32_t block_size ); 
 
+/// Order of the tasks in [task_begin, task_end) by decreasing work (points 
+/// x basis functions). The task list itself is left in place, cached state 
+/// (e.g. the EXX screening plan) refers to the task order
+template <typename TaskIterator>
+std::vector<size_t> task_work_order( TaskIterator task_begin, 
+  TaskIterator task_end ) {
+
+  std::vector<size_t> order( std::distance(task_begin, task_end) );
+  std::iota( order.begin(), order.end(), 0 );
+  auto work = [&]( size_t i ) {
+    const auto& task = task_begin[i];
+    return task.points.size() * task.bfn_screening.nbe;
+  };
+  std::stable_sort( order.begin(), order.end(), 
+    [&]( size_t a, size_t b ) { return work(a) > work(b); } );
+  return order;
+
+}
+
+/// Stores the wall time (s) of its scope on destruction, used to record 
+/// the measured task costs (cf. XCTask::measured_cost)
+class ScopedTaskTimer {
+  using clock_type = std::chrono::steady_clock;
+  double&                slot_;
+  clock_type::time_point start_;
+public:
+  ScopedTaskTimer( double& slot ) : slot_(slot), start_(clock_type::now()) { }
+  ~ScopedTaskTimer() noexcept {
+    slot_ = std::chrono::duration<double>( clock_type::now() - start_ ).count();
+  }
+};
+
 
 }
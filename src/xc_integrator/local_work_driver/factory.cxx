@@ -7,6 +7,7 @@
  */
 #include <gauxc/xc_integrator/local_work_driver.hpp>
 #include "host/reference_local_host_work_driver.hpp"
+#include "host/single_pass_local_host_work_driver.hpp"
 #ifdef GAUXC_HAS_DEVICE
 #include "device/cuda/cuda_aos_scheme1.hpp"
 #include "device/hip/hip_aos_scheme1.hpp"
@@ -30,6 +31,10 @@ LocalWorkDriverFactory::ptr_return_t
       return std::make_unique<LocalHostWorkDriver>(
         std::make_unique<ReferenceLocalHostWorkDriver>()
       );
+    else if( name == "SINGLEPASS" )
+      return std::make_unique<LocalHostWorkDriver>(
+        std::make_unique<SinglePassLocalHostWorkDriver>()
+      );
     else
       GAUXC_GENERIC_EXCEPTION("LWD Not Recognized: " + name);
 
@@ -0,0 +1,92 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/shell.hpp>
+#include <gauxc/shell_pair.hpp>
+#include "cpu/integral_data_types.hpp"
+#include <vector>
+
+namespace GauXC {
+
+/**
+ *  Shell pairs of a host sn-K task grouped by angular momentum type in
+ *  structure-of-arrays layout (host analog of XCDeviceShellPairSoA).
+ *
+ *  Pairs are stored with the higher angular momentum shell as A (consistent
+ *  with the primitive pair expansion in ShellPair), such that each type is
+ *  evaluated by a single call to XCPU::compute_integral_shell_pair_batch.
+ */
+struct XCHostShellPairSoA {
+  using point     = XCPU::point;
+  using prim_pair = XCPU::prim_pair;
+
+  /// Shell pair data of a single (lA,lB) type
+  struct type_data {
+    std::vector<point>      rA, rB;
+    std::vector<int>        nprim_pairs;
+    std::vector<prim_pair*> prim_pairs;
+    std::vector<size_t>     offA, offB;
+
+    inline void clear() {
+      rA.clear(); rB.clear();
+      nprim_pairs.clear();
+      prim_pairs.clear();
+      offA.clear(); offB.clear();
+    }
+  };
+
+  int max_l = -1;
+  std::vector<type_data>              types;   ///< Indexed by type_index
+  std::vector<XCPU::shell_pair_batch> batches; ///< Non-empty types
+
+  inline size_t type_index( int lA, int lB, bool is_diag ) const {
+    return (is_diag * (max_l+1) + lA) * (max_l+1) + lB;
+  }
+
+  /// Clear the pair data for shells up to angular momentum _max_l
+  inline void reset( int _max_l ) {
+    max_l = _max_l;
+    types.resize( 2 * (max_l+1) * (max_l+1) );
+    for( auto& t : types ) t.clear();
+    batches.clear();
+  }
+
+  /// Append the shell pair (A,B), offA / offB are the cartesian row offsets
+  /// of A and B in the X / G matrices
+  inline void add( bool is_diag, const Shell<double>& A, size_t offA,
+    const Shell<double>& B, size_t offB, const ShellPair<double>& pair ) {
+
+    if( A.l() < B.l() ) return add( is_diag, B, offB, A, offA, pair );
+    if( not pair.nprim_pairs() ) return;
+
+    auto& t = types[ type_index( A.l(), B.l(), is_diag ) ];
+    t.rA.push_back( point{ A.O()[0], A.O()[1], A.O()[2] } );
+    t.rB.push_back( point{ B.O()[0], B.O()[1], B.O()[2] } );
+    t.nprim_pairs.push_back( pair.nprim_pairs() );
+    t.prim_pairs.push_back( const_cast<prim_pair*>(pair.prim_pairs()) );
+    t.offA.push_back( offA );
+    t.offB.push_back( offB );
+
+  }
+
+  /// Generate the batch descriptors (invalidated by subsequent add / reset)
+  inline void finalize() {
+    batches.clear();
+    for( int is_diag = 0; is_diag < 2; ++is_diag )
+    for( int lA = 0; lA <= max_l; ++lA )
+    for( int lB = 0; lB <= lA;    ++lB ) {
+      auto& t = types[ type_index( lA, lB, is_diag ) ];
+      if( t.rA.empty() ) continue;
+      batches.push_back( XCPU::shell_pair_batch{ lA, lB, is_diag,
+        int(t.rA.size()), t.rA.data(), t.rB.data(), t.nprim_pairs.data(),
+        t.prim_pairs.data(), t.offA.data(), t.offB.data() } );
+    }
+  }
+};
+
+}
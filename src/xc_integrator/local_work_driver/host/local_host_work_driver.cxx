@@ -37,6 +37,14 @@ void LocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg,
 
 }
 
+void LocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg, 
+  const Molecule& mol, const MolMeta& meta, TaskStore& store ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->partition_weights(weight_alg, mol, meta, store);
+
+}
+
 
 // Collocation
 void LocalHostWorkDriver::eval_collocation( size_t npts, size_t nshells, size_t nbe, 
@@ -48,6 +56,16 @@ void LocalHostWorkDriver::eval_collocation( size_t npts, size_t nshells, size_t
 
 }
 
+void LocalHostWorkDriver::eval_collocation_soa( size_t npts, size_t nshells, 
+  size_t nbe, const double* pts_soa, const BasisSet<double>& basis, 
+  const int32_t* shell_list, double* basis_eval ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_collocation_soa(npts, nshells, nbe, pts_soa, basis, shell_list, 
+    basis_eval);
+
+}
+
 
 // Collocation Gradient
 void LocalHostWorkDriver::eval_collocation_gradient( size_t npts, size_t nshells, 
@@ -77,6 +95,18 @@ void LocalHostWorkDriver::eval_collocation_hessian( size_t npts, size_t nshells,
 
 }
 
+// Collocation Laplacian
+void LocalHostWorkDriver::eval_collocation_laplacian( size_t npts, size_t nshells, 
+    size_t nbe, const double* pts, const BasisSet<double>& basis, 
+    const int32_t* shell_list, double* basis_eval, double* dbasis_x_eval, 
+    double* dbasis_y_eval, double* dbasis_z_eval, double* lbasis_eval ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_collocation_laplacian(npts, nshells, nbe, pts, basis, shell_list, 
+    basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval);
+
+}
+
 // Collocation 3rd
 void LocalHostWorkDriver::eval_collocation_der3( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
@@ -129,22 +159,44 @@ void LocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells,
   const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
   const BasisSetMap& basis_map, const int32_t* shell_list, 
   const std::pair<int32_t,int32_t>* shell_pair_list, 
+  const int32_t* shell_pair_idx_list,
   const double* X, size_t ldx, double* G, size_t ldg ) {;
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->eval_exx_gmat(npts, nshells, nshell_pairs, nbe, points, weights, 
-    basis, shpairs, basis_map, shell_list, shell_pair_list, X, ldx, G, ldg );
+    basis, shpairs, basis_map, shell_list, shell_pair_list, shell_pair_idx_list,
+    X, ldx, G, ldg );
+
+}
+
+void LocalHostWorkDriver::eval_exx_gmat_soa( size_t npts, size_t nshells, 
+  size_t nshell_pairs, size_t nbe, const double* points_soa, 
+  const double* weights, const BasisSet<double>& basis, 
+  const ShellPairCollection<double>& shpairs, const BasisSetMap& basis_map, 
+  const int32_t* shell_list, const std::pair<int32_t,int32_t>* shell_pair_list, 
+  const int32_t* shell_pair_idx_list,
+  const double* X, size_t ldx, double* G, size_t ldg ) {
+
+  throw_if_invalid_pimpl(pimpl_);
+  pimpl_->eval_exx_gmat_soa(npts, nshells, nshell_pairs, nbe, points_soa, 
+    weights, basis, shpairs, basis_map, shell_list, shell_pair_list, 
+    shell_pair_idx_list, X, ldx, G, ldg );
 
 }
 
 void LocalHostWorkDriver::inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, 
   size_t nbe_ket, const double* basis_eval, const submat_map_t& submat_map_bra, 
   const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
-  size_t ldk, double* scr ) {
+  size_t ldk, double* scr, const SubmatAccumulator& acc ) {
 
   throw_if_invalid_pimpl(pimpl_);
   pimpl_->inc_exx_k(npts, nbf, nbe_bra, nbe_ket, basis_eval, submat_map_bra,
-    submat_map_ket, G, ldg, K, ldk, scr );
+    submat_map_ket, G, ldg, K, ldk, scr, acc );
+}
+
+std::string LocalHostWorkDriver::exx_kernel_isa() const {
+  throw_if_invalid_pimpl(pimpl_);
+  return pimpl_->exx_kernel_isa();
 }
 
 
@@ -392,10 +444,12 @@ void LocalHostWorkDriver::eval_mmat_mgga_vxc_uks( size_t npts, size_t nbe,
 // Increment VXC by Z
 void LocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe, 
   const double* basis_eval, const submat_map_t& submat_map, const double* Z, 
-  size_t ldz, double* VXC, size_t ldvxc, double* scr ) {
+  size_t ldz, double* VXC, size_t ldvxc, double* scr, 
+  const SubmatAccumulator& acc ) {
 
   throw_if_invalid_pimpl(pimpl_);
-  pimpl_->inc_vxc(npts, nbf, nbe, basis_eval, submat_map, Z, ldz, VXC, ldvxc, scr);
+  pimpl_->inc_vxc(npts, nbf, nbe, basis_eval, submat_map, Z, ldz, VXC, ldvxc, 
+    scr, acc);
 
 }
 
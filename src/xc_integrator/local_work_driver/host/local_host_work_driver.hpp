@@ -9,11 +9,14 @@
 #include <gauxc/xc_integrator/local_work_driver.hpp>
 
 #include <memory>
+#include <string>
 #include <gauxc/molmeta.hpp>
 #include <gauxc/basisset.hpp>
 #include <gauxc/shell_pair.hpp>
 #include <gauxc/basisset_map.hpp>
 #include <gauxc/xc_task.hpp>
+#include <gauxc/task_store.hpp>
+#include "host/submat_accumulator.hpp"
 
 
 namespace GauXC {
@@ -71,6 +74,21 @@ public:
   void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
     const MolMeta& meta, task_iterator task_begin, task_iterator task_end );
 
+  /** Evaluate the molecular partition weights of the tasks of a TaskStore
+   *
+   *  Same as above, the kernels operate on the packed (SoA) points and
+   *  weights of the store (which is packed if it is not). The order of the
+   *  tasks is not modified.
+   *
+   *  @param[in] weight_alg Molecular partitioning scheme
+   *  @param[in] mol        Molecule being partitioned
+   *  @param[in] molmeta    Metadata associated with mol
+   *
+   *  @param[in/out] store  Tasks to be modified
+   */
+  void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
+    const MolMeta& meta, TaskStore& store );
+
 
   /** Evaluation the collocation matrix
    *
@@ -88,6 +106,11 @@ public:
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
     double* basis_eval );
 
+  /// eval_collocation for points in SoA layout, x(npts), y(npts), z(npts)
+  void eval_collocation_soa( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts_soa, const BasisSet<double>& basis, 
+    const int32_t* shell_list, double* basis_eval );
+
 
   /** Evaluation the collocation matrix + gradient
    *
@@ -136,6 +159,29 @@ public:
     double* d2basis_xz_eval, double* d2basis_yy_eval, double* d2basis_yz_eval,
     double* d2basis_zz_eval );
 
+  /** Evaluation the collocation matrix + gradient + laplacian
+   *
+   *  Equivalent to the trace of `eval_collocation_hessian` without storage
+   *  of the individual second derivatives.
+   *
+   *  @param[in] npts     Same as `eval_collocation`
+   *  @param[in] nshells  Same as `eval_collocation`
+   *  @param[in] nbe      Same as `eval_collocation`
+   *  @param[in] pts      Same as `eval_collocation`
+   *  @param[in] basis    Same as `eval_collocation`
+   *  @param[in] shell_list Same as `eval_collocation`
+   *
+   *  @param[out] basis_eval    Same as `eval_collocation`
+   *  @param[out] dbasis_x_eval Same as `eval_collocation_gradient`
+   *  @param[out] dbasis_y_eval Same as `eval_collocation_gradient`
+   *  @param[out] dbasis_z_eval Same as `eval_collocation_gradient`
+   *  @param[out] lbasis_eval   Laplacian of `basis_eval` (same dimensions)
+   */
+  void eval_collocation_laplacian( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
+    double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
+    double* dbasis_z_eval, double* lbasis_eval );
+
   /** Evaluation the collocation matrix + gradient + hessian + 3rd derivatives
    *
    *  @param[in] npts     Same as `eval_collocation`
@@ -207,12 +253,25 @@ public:
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
+    const int32_t* shell_pair_idx_list,
+    const double* X, size_t ldx, double* G, size_t ldg );
+
+  /// eval_exx_gmat for points in SoA layout, x(npts), y(npts), z(npts)
+  void eval_exx_gmat_soa( size_t npts, size_t nshells, size_t nshell_pairs,
+    size_t nbe, const double* points_soa, const double* weights, 
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, 
+    const int32_t* shell_pair_idx_list,
     const double* X, size_t ldx, double* G, size_t ldg );
 
   void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
-    size_t ldk, double* scr );
+    size_t ldk, double* scr, const SubmatAccumulator& acc = SubmatAccumulator() );
+
+  /// Instruction set used by the EXX integral kernels (eval_exx_gmat)
+  std::string exx_kernel_isa() const;
     
   /** Evaluate the U and V variavles for RKS LDA
    *
@@ -463,11 +522,13 @@ public:
    *  @param[in/out] VXC     VXC integrand ((nbf,nbf), col major)
    *  @param[in]  ldvxc      Leading dimension of VXC
    *  @param[out] scr        Scratch space at least nbe*nbe
+   *  @param[in]  acc        Strategy used to scatter into VXC (default atomic)
    *
    */
   void inc_vxc( size_t npts, size_t nbf, size_t nbe, const double* basis_eval,
     const submat_map_t& submat_map, const double* Z, size_t ldz, 
-    double* VXC, size_t ldvxc, double* scr );
+    double* VXC, size_t ldvxc, double* scr, 
+    const SubmatAccumulator& acc = SubmatAccumulator() );
 
 private: 
 
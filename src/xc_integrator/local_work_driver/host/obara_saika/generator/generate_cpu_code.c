@@ -206,16 +206,20 @@ void initialize_tree_structure(int type, int lA, int lB, int size, struct node *
   free(offset_list);
 }
 
+// Separator of the (level, index) pair in the names of the VRR temporaries.
+// Empty for lA + lB < 10 (t%d%d), "_" otherwise to keep the names unique
+static const char *vrr_sep = "";
+
 void traverse_dfs_vrr(FILE *f, int lA, int lB, struct node *root_node, char *prefix, char *prefix_lsa, char *prefix_lsu) {
   if(root_node != NULL) {
     if(root_node -> level == 0) {
       for(int v = 0; v < root_node -> vars; ++v) {
-	fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(eval)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> level, v);
+	fprintf(f, "            t%d%s%d = %s_MUL(%s_DUPLICATE(&(eval)), t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, prefix, root_node -> level, vrr_sep, v);
       }
     } else if (root_node -> level == 1) {
       for(int v = 0; v < root_node -> vars; ++v) {
-	fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, v);
-	fprintf(f, "            t%d%d = %s_FNMA(%s, t%d%d, t%d%d);\n", root_node -> level, v, prefix, root_node -> var_pc, root_node -> level - 1, v + 1, root_node -> level, v);
+	fprintf(f, "            t%d%s%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, vrr_sep, v);
+	fprintf(f, "            t%d%s%d = %s_FNMA(%s, t%d%s%d, t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, root_node -> var_pc, root_node -> level - 1, vrr_sep, v + 1, root_node -> level, vrr_sep, v);
       }
     } else {
       int iteration = 0;
@@ -229,24 +233,24 @@ void traverse_dfs_vrr(FILE *f, int lA, int lB, struct node *root_node, char *pre
 
       if(iteration == 0) {
 	for(int v = 0; v < root_node -> vars; ++v) {
-	  fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, v);
-	  fprintf(f, "            t%d%d = %s_FNMA(%s, t%d%d, t%d%d);\n", root_node -> level, v, prefix, root_node -> var_pc, root_node -> level - 1, v + 1, root_node -> level, v);
+	  fprintf(f, "            t%d%s%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, vrr_sep, v);
+	  fprintf(f, "            t%d%s%d = %s_FNMA(%s, t%d%s%d, t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, root_node -> var_pc, root_node -> level - 1, vrr_sep, v + 1, root_node -> level, vrr_sep, v);
 	}
       } else {
 	for(int v = 0; v < root_node -> vars; ++v) {
-	  fprintf(f, "            t%d%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%d);\n", root_node -> level, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, v);
-	  fprintf(f, "            t%d%d = %s_FNMA(%s, t%d%d, t%d%d);\n", root_node -> level, v, prefix, root_node -> var_pc, root_node -> level - 1, v + 1, root_node -> level, v);
-	  fprintf(f, "            tx = %s_SUB(t%d%d, t%d%d);\n", prefix, root_node -> level - 2, v, root_node ->level - 2, v + 1);
+	  fprintf(f, "            t%d%s%d = %s_MUL(%s_DUPLICATE(&(%s)), t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, prefix, root_node -> var_pa, root_node -> level - 1, vrr_sep, v);
+	  fprintf(f, "            t%d%s%d = %s_FNMA(%s, t%d%s%d, t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, root_node -> var_pc, root_node -> level - 1, vrr_sep, v + 1, root_node -> level, vrr_sep, v);
+	  fprintf(f, "            tx = %s_SUB(t%d%s%d, t%d%s%d);\n", prefix, root_node -> level - 2, vrr_sep, v, root_node ->level - 2, vrr_sep, v + 1);
 	  fprintf(f, "            ty = %s_SET1(0.5 * %d);\n", prefix, iteration);
 	  fprintf(f, "            ty = %s_MUL(ty, %s_DUPLICATE(&(RHO_INV)));\n", prefix, prefix);
-	  fprintf(f, "            t%d%d = %s_FMA(tx, ty, t%d%d);\n", root_node -> level, v, prefix, root_node -> level, v);
+	  fprintf(f, "            t%d%s%d = %s_FMA(tx, ty, t%d%s%d);\n", root_node -> level, vrr_sep, v, prefix, root_node -> level, vrr_sep, v);
 	}
       }
     }
 
     if(root_node -> valid) {
       fprintf(f, "            tx = %s_LOAD((temp + %d * NPTS_LOCAL + p_inner));\n", prefix_lsa, root_node -> offset);
-      fprintf(f, "            tx = %s_ADD(tx, t%d%d);\n", prefix, root_node -> level, 0);
+      fprintf(f, "            tx = %s_ADD(tx, t%d%s%d);\n", prefix, root_node -> level, vrr_sep, 0);
       fprintf(f, "            %s_STORE((temp + %d * NPTS_LOCAL + p_inner), tx);\n", prefix_lsa, root_node -> offset);
     }
     
@@ -256,6 +260,16 @@ void traverse_dfs_vrr(FILE *f, int lA, int lB, struct node *root_node, char *pre
   }
 }
 
+void generate_license(FILE *f) {
+  fprintf(f, "/**\n");
+  fprintf(f, " * GauXC Copyright (c) 2020-2024, The Regents of the University of California,\n");
+  fprintf(f, " * through Lawrence Berkeley National Laboratory (subject to receipt of\n");
+  fprintf(f, " * any required approvals from the U.S. Dept. of Energy). All rights reserved.\n");
+  fprintf(f, " *\n");
+  fprintf(f, " * See LICENSE.txt for details\n");
+  fprintf(f, " */\n");
+}
+
 int index_calculation(int i, int j, int L) {
   return (L - i) * (L - i + 1) / 2 + j;
 }
@@ -277,6 +291,8 @@ void generate_part_0(FILE *f, char*variable, char *prefix, char *prefix_lsa, cha
 }
 
 void generate_part_1(FILE *f, int lA, int lB, struct node *root_node, char *variable, char *prefix, char *prefix_lsa, char *prefix_lsu) {
+  vrr_sep = ((lA + lB) < 10) ? "" : "_";
+
   if(lA != 0) {
     fprintf(f, "            %s_TYPE xC = %s_LOAD((_point_outer + p_inner + 0 * npts));\n", prefix, prefix_lsu);
     fprintf(f, "            %s_TYPE yC = %s_LOAD((_point_outer + p_inner + 1 * npts));\n", prefix, prefix_lsu);
@@ -300,10 +316,10 @@ void generate_part_1(FILE *f, int lA, int lB, struct node *root_node, char *vari
   }
   for(int l = 0; l < (lA + lB); ++l) {
     for(int k = 0; k < (lA + lB + 1) - l; ++k) {
-      fprintf(f, "t%d%d, ", l, k);
+      fprintf(f, "t%d%s%d, ", l, vrr_sep, k);
     }
   }
-  fprintf(f, "t%d%d;\n", (lA + lB), 0);
+  fprintf(f, "t%d%s%d;\n", (lA + lB), vrr_sep, 0);
   fprintf(f, "\n");
 
   if((lA + lB) != 0) {
@@ -312,10 +328,10 @@ void generate_part_1(FILE *f, int lA, int lB, struct node *root_node, char *vari
     fprintf(f, "\n");
   }
   
-  fprintf(f, "            t0%d = %s_LOAD((FmT + p_inner));\n", lA + lB, prefix_lsa);
+  fprintf(f, "            t0%s%d = %s_LOAD((FmT + p_inner));\n", vrr_sep, lA + lB, prefix_lsa);
   
   for(int l = lA + lB - 1; l >= 0; --l) {
-    fprintf(f, "            t0%d = %s_MUL(%s_ADD(%s_MUL(tval, t0%d), tval_inv_e), %s_SET1(%.20f));\n", l, prefix, prefix, prefix, l + 1, prefix, 2.0 / (1.0 * (2 * l + 1)));
+    fprintf(f, "            t0%s%d = %s_MUL(%s_ADD(%s_MUL(tval, t0%s%d), tval_inv_e), %s_SET1(%.20f));\n", vrr_sep, l, prefix, prefix, prefix, vrr_sep, l + 1, prefix, 2.0 / (1.0 * (2 * l + 1)));
   }
   fprintf(f, "\n");
   
@@ -569,24 +585,20 @@ void generate_off_diagonal_part_2(FILE *f, int lA, int lB, int type, char *prefi
 }
 
 void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node, int type) {
+  generate_license(f);
   fprintf(f, "#include <math.h>\n");
-  fprintf(f, "#include \"../include/chebyshev_boys_computation.hpp\"\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/chebyshev_boys_computation.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
   fprintf(f, "#include \"config_obara_saika.hpp\"\n");
   fprintf(f, "#include \"integral_%d.hpp\"\n", lA);
   fprintf(f, "\n");
   fprintf(f, "#define PI 3.14159265358979323846\n");
   fprintf(f, "\n");
-  fprintf(f, "#define MIN(a,b)			\\\n"); 
-  fprintf(f, "  ({ __typeof__ (a) _a = (a);	        \\\n");
-  fprintf(f, "  __typeof__ (b) _b = (b);		\\\n");
-  fprintf(f, "  _a < _b ? _a : _b; })\n");
-  fprintf(f, "\n");
-  fprintf(f, "namespace XCPU {\n");
+  fprintf(f, "namespace XCPU::XCPU_ISA {\n");
   fprintf(f, "void integral_%d(size_t npts,\n", lA);
   fprintf(f, "               double *_points,\n");
   fprintf(f, "               point rA,\n");
-  fprintf(f, "               point rB,\n");
+  fprintf(f, "               point /*rB*/,\n");
   fprintf(f, "               int nprim_pairs,\n");
   fprintf(f, "               prim_pair *prim_pairs,\n");  
   fprintf(f, "               double *Xi,\n");
@@ -681,7 +693,7 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
 
   fprintf(f, "   // cleanup code\n");
   fprintf(f, "   for(; p_outer < npts; p_outer += NPTS_LOCAL) {\n");
-  fprintf(f, "      size_t npts_inner = MIN((size_t) NPTS_LOCAL, npts - p_outer);\n");
+  fprintf(f, "      size_t npts_inner = std::min((size_t) NPTS_LOCAL, npts - p_outer);\n");
   fprintf(f, "      double *_point_outer = (_points + p_outer);\n\n");
   fprintf(f, "      double xA = rA.x;\n");
   fprintf(f, "      double yA = rA.y;\n");
@@ -783,24 +795,25 @@ void generate_diagonal_files(FILE *f, int lA, int size, struct node *root_node,
 }
 
 void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node *root_node, int type) {
+  generate_license(f);
   fprintf(f, "#include <math.h>\n");
-  fprintf(f, "#include \"../include/chebyshev_boys_computation.hpp\"\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/chebyshev_boys_computation.hpp\"\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
   fprintf(f, "#include \"config_obara_saika.hpp\"\n");
   fprintf(f, "#include \"integral_%d_%d.hpp\"\n", lA, lB);
   fprintf(f, "\n");
   fprintf(f, "#define PI 3.14159265358979323846\n");
   fprintf(f, "\n");
-  fprintf(f, "#define MIN(a,b)			\\\n"); 
-  fprintf(f, "  ({ __typeof__ (a) _a = (a);	        \\\n");
-  fprintf(f, "  __typeof__ (b) _b = (b);		\\\n");
-  fprintf(f, "  _a < _b ? _a : _b; })\n");
-  fprintf(f, "\n");
-  fprintf(f, "namespace XCPU {\n");
+  fprintf(f, "namespace XCPU::XCPU_ISA {\n");
   fprintf(f, "void integral_%d_%d(size_t npts,\n", lA, lB);
   fprintf(f, "                  double *_points,\n");
-  fprintf(f, "                  point rA,\n");
-  fprintf(f, "                  point rB,\n");
+  if(lB != 0) {
+    fprintf(f, "                  point rA,\n");
+    fprintf(f, "                  point rB,\n");
+  } else {
+    fprintf(f, "                  point /*rA*/,\n");
+    fprintf(f, "                  point /*rB*/,\n");
+  }
   fprintf(f, "                  int nprim_pairs,\n");
   fprintf(f, "                  prim_pair *prim_pairs,\n");  
   fprintf(f, "                  double *Xi,\n");
@@ -860,6 +873,7 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "\n");
   //fprintf(f, "         double eval = prim_pairs[ij].coeff_prod * prim_pairs[ij].K;\n");
   fprintf(f, "         double eval = prim_pairs[ij].K_coeff_prod;\n");
+  fprintf(f, "         if(std::abs(eval) < shpair_screen_tol) continue;\n");
   fprintf(f, "\n");
 
   sprintf(prefix, "SIMD");
@@ -903,7 +917,7 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "   }\n\n");
 
   fprintf(f, "   for(; p_outer < npts; p_outer += NPTS_LOCAL) {\n");
-  fprintf(f, "      size_t npts_inner = MIN((size_t) NPTS_LOCAL, npts - p_outer);\n");
+  fprintf(f, "      size_t npts_inner = std::min((size_t) NPTS_LOCAL, npts - p_outer);\n");
   fprintf(f, "      double *_point_outer = (_points + p_outer);\n\n");
   if(lB != 0) {
     fprintf(f, "      double X_AB = rA.x - rB.x;\n");
@@ -930,6 +944,7 @@ void generate_off_diagonal_files(FILE *f, int lA, int lB, int size, struct node
   fprintf(f, "\n");
   //fprintf(f, "         double eval = prim_pairs[ij].coeff_prod * prim_pairs[ij].K;\n");
   fprintf(f, "         double eval = prim_pairs[ij].K_coeff_prod;\n");
+  fprintf(f, "         if(std::abs(eval) < shpair_screen_tol) continue;\n");
   fprintf(f, "\n");
 
   sprintf(prefix, "SIMD");
@@ -1014,11 +1029,13 @@ void generate_diagonal_header_files(int lA) {
       
   FILE *f = fopen(filename, "w");
 
+  generate_license(f);
   fprintf(f, "#ifndef __MY_INTEGRAL_%d\n", lA);
   fprintf(f, "#define __MY_INTEGRAL_%d\n", lA);
   fprintf(f, "\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
-  fprintf(f, "namespace XCPU {\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"config_obara_saika.hpp\"\n");
+  fprintf(f, "namespace XCPU::XCPU_ISA {\n");
   fprintf(f, "void integral_%d(size_t npts,\n", lA);
   fprintf(f, "               double *points,\n");
   fprintf(f, "               point rA,\n");
@@ -1045,11 +1062,13 @@ void generate_off_diagonal_header_files(int lA, int lB) {
       
   FILE *f = fopen(filename, "w");
 
+  generate_license(f);
   fprintf(f, "#ifndef __MY_INTEGRAL_%d_%d\n", lA, lB);
   fprintf(f, "#define __MY_INTEGRAL_%d_%d\n", lA, lB);
   fprintf(f, "\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
-  fprintf(f, "namespace XCPU {\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"config_obara_saika.hpp\"\n");
+  fprintf(f, "namespace XCPU::XCPU_ISA {\n");
   fprintf(f, "void integral_%d_%d(size_t npts,\n", lA, lB);
   fprintf(f, "                  double *points,\n");
   fprintf(f, "                  point rA,\n");
@@ -1076,46 +1095,19 @@ void generate_main_files(int lA) {
 
   FILE *f;
   
-  sprintf(filename, "obara_saika_integrals.hpp");
-      
-  f = fopen(filename, "w");
-
-  fprintf(f, "#ifndef __MY_INTEGRAL_OBARA_SAIKA\n");
-  fprintf(f, "#define __MY_INTEGRAL_OBARA_SAIKA\n");
-  fprintf(f, "\n");
-  fprintf(f, "namespace XCPU {\n");
-  fprintf(f, "void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pairs);\n");
-  fprintf(f, "void compute_integral_shell_pair(int is_diag,\n");
-  fprintf(f, "                  size_t npts,\n");
-  fprintf(f, "                  double *points,\n");
-  fprintf(f, "                  int lA,\n");
-  fprintf(f, "                  int lB,\n");
-  fprintf(f, "                  point rA,\n");
-  fprintf(f, "                  point rB,\n");
-  fprintf(f, "                  int nprim_pairs,\n");
-  fprintf(f, "                  prim_pair *prim_pairs,\n");  
-  fprintf(f, "                  double *Xi,\n");
-  fprintf(f, "                  double *Xj,\n");
-  fprintf(f, "                  int ldX,\n");	 
-  fprintf(f, "                  double *Gi,\n");
-  fprintf(f, "                  double *Gj,\n");
-  fprintf(f, "                  int ldG, \n");
-  fprintf(f, "                  double *weights, \n");
-  fprintf(f, "                  double *boys_table);\n");
-  fprintf(f, "}\n");
-  fprintf(f, "\n");
-  fprintf(f, "#endif\n");
-  
-  fclose(f);  
-
-  sprintf(filename, "obara_saika_integrals.cxx");
+  // Shell pair kernel driver, compiled once per ISA (see config_obara_saika.hpp).
+  // generate_shell_pair and the runtime ISA dispatch are maintained in
+  // obara_saika_integrals.cxx
+  sprintf(filename, "integral_shell_pair.cxx");
       
   f = fopen(filename, "w");
 
+  generate_license(f);
   fprintf(f, "#include <stdio.h>\n");
-  fprintf(f, "#include <stdlib.h>\n");
-  fprintf(f, "#include \"../include/integral_data_types.hpp\"\n");
-  fprintf(f, "#include \"../include/obara_saika_integrals.hpp\"\n");
+  fprintf(f, "#include <algorithm>\n");
+  fprintf(f, "#include \"../include/cpu/integral_data_types.hpp\"\n");
+  fprintf(f, "#include \"config_obara_saika.hpp\"\n");
+  fprintf(f, "#include \"integral_shell_pair.hpp\"\n");
   for(int i = 0; i <= lA; ++i) {
     fprintf(f, "#include \"integral_%d.hpp\"\n", i);
   }
@@ -1126,52 +1118,8 @@ void generate_main_files(int lA) {
     }
   }
 
-  fprintf(f, "namespace XCPU {\n");
-  fprintf(f, "void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pairs) {\n");
-  fprintf(f, "   // L Values\n");
-  fprintf(f, "   const auto xA = A.origin.x;\n");
-  fprintf(f, "   const auto yA = A.origin.y;\n");
-  fprintf(f, "   const auto zA = A.origin.z;\n\n");
-
-  fprintf(f, "   const auto xB = B.origin.x;\n");
-  fprintf(f, "   const auto yB = B.origin.y;\n");
-  fprintf(f, "   const auto zB = B.origin.z;\n\n");
-
-  fprintf(f, "   double rABx = xA - xB;\n");
-  fprintf(f, "   double rABy = yA - yB;\n");
-  fprintf(f, "   double rABz = zA - zB;\n\n");
-
-  fprintf(f, "   const double dAB = rABx*rABx + rABy*rABy + rABz*rABz;\n\n");
-
-  fprintf(f, "   const int nprim_A = A.m;\n");
-  fprintf(f, "   const int nprim_B = B.m;\n");
-
-  fprintf(f, "   for(int i = 0, ij = 0; i < nprim_A; ++i       )\n");
-  fprintf(f, "   for(int j = 0        ; j < nprim_B; ++j, ++ij ) {\n");
-  fprintf(f, "      auto& pair = prim_pairs[ij];\n");
-
-  fprintf(f, "      const auto alpha_A = A.coeff[i].alpha;\n");
-  fprintf(f, "      const auto alpha_B = B.coeff[j].alpha;\n\n");
-
-  fprintf(f, "      pair.gamma = alpha_A + alpha_B;\n");
-  fprintf(f, "      pair.gamma_inv = 1. / pair.gamma;\n\n");
-
-  fprintf(f, "      pair.P.x = (alpha_A * xA + alpha_B * xB) * pair.gamma_inv;\n");
-  fprintf(f, "      pair.P.y = (alpha_A * yA + alpha_B * yB) * pair.gamma_inv;\n");
-  fprintf(f, "      pair.P.z = (alpha_A * zA + alpha_B * zB) * pair.gamma_inv;\n\n");
-
-  fprintf(f, "      pair.PA.x = pair.P.x - xA;\n");
-  fprintf(f, "      pair.PA.y = pair.P.y - yA;\n");
-  fprintf(f, "      pair.PA.z = pair.P.z - zA;\n\n");
-
-  fprintf(f, "      pair.PB.x = pair.P.x - xB;\n");
-  fprintf(f, "      pair.PB.y = pair.P.y - yB;\n");
-  fprintf(f, "      pair.PB.z = pair.P.z - zB;\n\n");
-  fprintf(f, "      pair.K_coeff_prod = 2 * M_PI * pair.gamma_inv * std::exp( - alpha_A * alpha_B * dAB * pair.gamma_inv ) * A.coeff[i].coeff * B.coeff[j].coeff;\n");
-  fprintf(f, "   }\n");
-  fprintf(f, "}\n");
-  
   fprintf(f, "\n");
+  fprintf(f, "namespace XCPU::XCPU_ISA {\n");
   fprintf(f, "void compute_integral_shell_pair(int is_diag,\n");
   fprintf(f, "                  size_t npts,\n");
   fprintf(f, "                  double *points,\n");
@@ -1301,6 +1249,92 @@ void generate_main_files(int lA) {
   fprintf(f, "      }\n");
   fprintf(f, "   }\n");  
   fprintf(f, "}\n");
+  fprintf(f, "\n");
+
+  // Batched driver: the kernel is resolved once for all the pairs of a batch
+  fprintf(f, "namespace {\n");
+  fprintf(f, "using diag_kernel_type = void(size_t, double*, point, point, int, prim_pair*,\n");
+  fprintf(f, "  double*, int, double*, int, double*, double*);\n");
+  fprintf(f, "using off_diag_kernel_type = void(size_t, double*, point, point, int, prim_pair*,\n");
+  fprintf(f, "  double*, double*, int, double*, double*, int, double*, double*);\n");
+  fprintf(f, "}\n");
+  fprintf(f, "\n");
+  fprintf(f, "void compute_integral_shell_pair_batch(const shell_pair_batch &batch,\n");
+  fprintf(f, "                  size_t npts,\n");
+  fprintf(f, "                  double *points,\n");
+  fprintf(f, "                  double *X,\n");
+  fprintf(f, "                  int ldX,\n");
+  fprintf(f, "                  double *G,\n");
+  fprintf(f, "                  int ldG, \n");
+  fprintf(f, "                  double *weights, \n");
+  fprintf(f, "                  double *boys_table) {\n");
+  fprintf(f, "   diag_kernel_type *diag_kernel = nullptr;\n");
+  fprintf(f, "   off_diag_kernel_type *off_diag_kernel = nullptr;\n");
+  fprintf(f, "   if (batch.is_diag) {\n");
+  for(int i = 0; i <= lA; ++i) {
+    fprintf(f, "      %sif(batch.lA == %d) diag_kernel = integral_%d;\n", i ? "else " : "", i, i);
+  }
+  fprintf(f, "   } else {\n");
+  for(int i = 0; i <= lA; ++i) {
+    for(int j = 0; j <= i; ++j) {
+      fprintf(f, "      %sif((batch.lA == %d) && (batch.lB == %d)) off_diag_kernel = integral_%d_%d;\n",
+        (i || j) ? "else " : "", i, j, i, j);
+    }
+  }
+  fprintf(f, "   }\n");
+  fprintf(f, "\n");
+  fprintf(f, "   if(!diag_kernel && !off_diag_kernel) {\n");
+  fprintf(f, "      printf(\"Type not defined!\\n\");\n");
+  fprintf(f, "      return;\n");
+  fprintf(f, "   }\n");
+  fprintf(f, "\n");
+  fprintf(f, "   // All pairs of the batch are evaluated over a block of points before\n");
+  fprintf(f, "   // moving to the next one, such that the point data remains in cache\n");
+  fprintf(f, "   __attribute__((__aligned__(64))) double points_block[3 * NPTS_BATCH];\n");
+  fprintf(f, "   for(size_t p_outer = 0; p_outer < npts; p_outer += NPTS_BATCH) {\n");
+  fprintf(f, "      const size_t npts_block = std::min((size_t) NPTS_BATCH, npts - p_outer);\n");
+  fprintf(f, "      for(int k = 0; k < 3; ++k)\n");
+  fprintf(f, "      for(size_t p = 0; p < npts_block; ++p)\n");
+  fprintf(f, "         points_block[k * npts_block + p] = points[k * npts + p_outer + p];\n");
+  fprintf(f, "\n");
+  fprintf(f, "      double *weights_block = weights + p_outer;\n");
+  fprintf(f, "      for(int ij = 0; ij < batch.npairs; ++ij) {\n");
+  fprintf(f, "         double *Xi = X + batch.offA[ij] * ldX + p_outer;\n");
+  fprintf(f, "         double *Gi = G + batch.offA[ij] * ldG + p_outer;\n");
+  fprintf(f, "         if(diag_kernel) {\n");
+  fprintf(f, "            diag_kernel(npts_block,\n");
+  fprintf(f, "                        points_block,\n");
+  fprintf(f, "                        batch.rA[ij],\n");
+  fprintf(f, "                        batch.rB[ij],\n");
+  fprintf(f, "                        batch.nprim_pairs[ij],\n");
+  fprintf(f, "                        batch.prim_pairs[ij],\n");
+  fprintf(f, "                        Xi,\n");
+  fprintf(f, "                        ldX,\n");
+  fprintf(f, "                        Gi,\n");
+  fprintf(f, "                        ldG, \n");
+  fprintf(f, "                        weights_block, \n");
+  fprintf(f, "                        boys_table);\n");
+  fprintf(f, "         } else {\n");
+  fprintf(f, "            double *Xj = X + batch.offB[ij] * ldX + p_outer;\n");
+  fprintf(f, "            double *Gj = G + batch.offB[ij] * ldG + p_outer;\n");
+  fprintf(f, "            off_diag_kernel(npts_block,\n");
+  fprintf(f, "                            points_block,\n");
+  fprintf(f, "                            batch.rA[ij],\n");
+  fprintf(f, "                            batch.rB[ij],\n");
+  fprintf(f, "                            batch.nprim_pairs[ij],\n");
+  fprintf(f, "                            batch.prim_pairs[ij],\n");
+  fprintf(f, "                            Xi,\n");
+  fprintf(f, "                            Xj,\n");
+  fprintf(f, "                            ldX,\n");
+  fprintf(f, "                            Gi,\n");
+  fprintf(f, "                            Gj,\n");
+  fprintf(f, "                            ldG, \n");
+  fprintf(f, "                            weights_block, \n");
+  fprintf(f, "                            boys_table);\n");
+  fprintf(f, "         }\n");
+  fprintf(f, "      }\n");
+  fprintf(f, "   }\n");
+  fprintf(f, "}\n");
   
   fprintf(f, "}\n");
   
@@ -39,4 +39,15 @@ namespace XCPU {
   using prim_pair = GauXC::PrimitivePair<double>;
 #endif
 
+  /// Shell pairs of a single angular momentum type (lA >= lB) in
+  /// structure-of-arrays layout (see compute_integral_shell_pair_batch)
+  typedef struct {
+    int lA, lB, is_diag;
+    int npairs;
+    point *rA, *rB;
+    int *nprim_pairs;
+    prim_pair **prim_pairs;
+    size_t *offA, *offB; // cartesian row offsets of A / B in X and G
+  } shell_pair_batch;
+
 }
@@ -8,6 +8,22 @@
 #pragma once
 
 namespace XCPU {
+
+/// Instruction sets for which the host kernels may be compiled
+enum class ISA { Scalar, AVX2, AVX512 };
+
+/**
+ *  ISA of the kernels executed by compute_integral_shell_pair.
+ *
+ *  Selected on first use as the highest ISA compiled into the library and 
+ *  supported by the host CPU. The GAUXC_OS_ISA environment variable 
+ *  (scalar, avx2 or avx512) caps the selection.
+ */
+ISA obara_saika_isa();
+
+/// Name of an ISA (as accepted by GAUXC_OS_ISA)
+const char* isa_name( ISA isa );
+
 void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pairs);
 void compute_integral_shell_pair(int is_diag,
                   size_t npts,
@@ -26,4 +42,21 @@ void compute_integral_shell_pair(int is_diag,
                   int ldG, 
                   double *weights, 
                   double *boys_table);
+
+/**
+ *  Evaluate all shell pairs of a batch of the same angular momentum type.
+ *
+ *  Equivalent to calling compute_integral_shell_pair for each pair of the
+ *  batch (with Xi = X + offA * ldX, Xj = X + offB * ldX, etc.), the kernel is
+ *  resolved once per batch and the pairs are traversed over blocks of points.
+ */
+void compute_integral_shell_pair_batch(const shell_pair_batch& batch,
+                  size_t npts,
+                  double *points,
+                  double *X,
+                  int ldX,
+                  double *G,
+                  int ldG,
+                  double *weights,
+                  double *boys_table);
 }
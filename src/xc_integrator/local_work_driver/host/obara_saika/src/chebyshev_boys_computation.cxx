@@ -15,6 +15,7 @@
 #include <limits>
 #include <memory>
 #include <vector>
+#include "config_obara_saika.hpp"
 
 
 namespace XCPU {
@@ -9,16 +9,81 @@
 
 #include <gauxc/util/constexpr_math.hpp>
 
+// Instruction set of the SIMD kernels. Builds with runtime ISA dispatch 
+// compile the kernels once per ISA with GAUXC_OS_ISA_{SCALAR,AVX2,AVX512}
+// defined, otherwise the ISA is deduced from the compiler target. Kernels
+// are placed in the XCPU::XCPU_ISA namespace such that several ISA variants
+// may coexist in the same binary.
+#if defined(GAUXC_OS_ISA_AVX512)
+  #define XCPU_ISA_AVX512
+#elif defined(GAUXC_OS_ISA_AVX2)
+  #define XCPU_ISA_AVX2
+#elif defined(GAUXC_OS_ISA_SCALAR)
+  #define XCPU_ISA_SCALAR
+#elif __AVX512F__ && __has_include(<zmmintrin.h>)
+  #define XCPU_ISA_AVX512
+#elif __AVX__ || __AVX2__
+  #define XCPU_ISA_AVX2
+#else
+  #define XCPU_ISA_SCALAR
+  #define XCPU_ISA_NOT_SPECIFIED
+#endif
+
+#if defined(XCPU_ISA_AVX512)
+  #define XCPU_ISA avx512
+#elif defined(XCPU_ISA_AVX2)
+  #define XCPU_ISA avx2
+#else
+  #define XCPU_ISA scalar
+#endif
+
+#if defined(XCPU_ISA_AVX512)
+  #if __has_include(<zmmintrin.h>)
+  #include <zmmintrin.h>
+  #else
+  #include <immintrin.h>
+  #endif
+#elif defined(XCPU_ISA_AVX2)
+  #include <immintrin.h>
+#endif
+
+// The ISA variants of a dispatch build are not compiled with ISA specific
+// compiler flags. Instead, the target ISA is only enabled for the functions
+// defined past this point (up to config_obara_saika_end.hpp), all of which
+// live in XCPU::XCPU_ISA. Inline functions and templates of shared headers
+// (the standard library, GauXC utilities) may be emitted out-of-line in
+// every ISA variant and are merged by the linker, hence they have to remain
+// baseline code: such headers must be included before this file.
+#if defined(GAUXC_OS_ISA_AVX512) || defined(GAUXC_OS_ISA_AVX2)
+  #define XCPU_ISA_TARGET_REGION
+  #if defined(__clang__)
+    #if defined(GAUXC_OS_ISA_AVX512)
+      #pragma clang attribute push (__attribute__((target("avx512f,avx2,fma"))), apply_to = function)
+    #else
+      #pragma clang attribute push (__attribute__((target("avx2,fma"))), apply_to = function)
+    #endif
+  #elif defined(__GNUC__)
+    #pragma GCC push_options
+    #if defined(GAUXC_OS_ISA_AVX512)
+      #pragma GCC target("avx512f,avx2,fma")
+    #else
+      #pragma GCC target("avx2,fma")
+    #endif
+  #endif
+#endif
+
 #define NPTS_LOCAL 64
+// Point block over which a shell pair batch is traversed
+#define NPTS_BATCH (4 * NPTS_LOCAL)
 
 #define DEFAULT_NCHEB  7
-#define DEFAULT_MAX_M  8
-#define DEFAULT_MAX_T 30
+#define DEFAULT_MAX_M 12
+#define DEFAULT_MAX_T 45
 
 #define DEFAULT_NSEGMENT ((DEFAULT_MAX_T * DEFAULT_NCHEB) / 2)
 #define DEFAULT_LD_TABLE (DEFAULT_NCHEB + 1)
 
-namespace XCPU {
+namespace XCPU::XCPU_ISA {
 
   constexpr double shpair_screen_tol = 1e-12;
 
@@ -183,24 +248,22 @@ namespace XCPU {
 #define SCALAR_SET1(x) (x)
 
 #define SCALAR_LOAD(x) *(x)
-#define SCALAR_STORE(x, y) *(x) = y
+#define SCALAR_STORE(x, y) *(x) = (y)
 
-#define SCALAR_ADD(x, y) (x + y)
-#define SCALAR_SUB(x, y) (x - y)
+#define SCALAR_ADD(x, y) ((x) + (y))
+#define SCALAR_SUB(x, y) ((x) - (y))
 
-#define SCALAR_MUL(x, y) (x * y)
-#define SCALAR_FMA(x, y, z) (z + x * y)
-#define SCALAR_FNMA(x, y, z) (z - x * y)
+#define SCALAR_MUL(x, y) ((x) * (y))
+#define SCALAR_FMA(x, y, z) ((z) + (x) * (y))
+#define SCALAR_FNMA(x, y, z) ((z) - (x) * (y))
 
-#define SCALAR_RECIPROCAL(x) (1.0 / (1.0 * x))
+#define SCALAR_RECIPROCAL(x) (1.0 / (1.0 * (x)))
 
 #define SCALAR_DUPLICATE(x) (*(x))
 
 // AVX-512 SIMD Types
-#if __AVX512F__ && __has_include(<zmmintrin.h>)
+#if defined(XCPU_ISA_AVX512)
 
-  #include <zmmintrin.h>
-  
   #define SIMD_TYPE __m512d
   
   #define SIMD_LENGTH 8
@@ -221,13 +284,11 @@ namespace XCPU {
   #define SIMD_FMA(x, y, z) _mm512_fmadd_pd(x, y, z)
   #define SIMD_FNMA(x, y, z) _mm512_fnmadd_pd(x, y, z)
   
-  #define SIMD_DUPLICATE(x) _mm512_broadcast_f64x4(_mm256_broadcast_sd(x))
+  #define SIMD_DUPLICATE(x) _mm512_set1_pd(*(x))
 
 // AVX-256 SIMD Types
-#elif __AVX__ || __AVX2__
+#elif defined(XCPU_ISA_AVX2)
 
-  #include <immintrin.h>
-  
   #define SIMD_TYPE __m256d
   
   #define SIMD_LENGTH 4
@@ -252,10 +313,12 @@ namespace XCPU {
 
 // Scalar SIMD Emulation
 #else
+#ifdef XCPU_ISA_NOT_SPECIFIED
 #ifdef __GNUC__
   #warning "Warning: ISA Not Specified: Using Scalar Code"
 #else
   #pragma message "Warning: ISA Not Specified: Using Scalar Code"
+#endif
 #endif
   #define SIMD_TYPE double
   
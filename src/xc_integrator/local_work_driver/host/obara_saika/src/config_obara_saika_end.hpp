@@ -0,0 +1,17 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+
+// Closes the ISA target region opened by config_obara_saika.hpp, included
+// at the end of the ISA variants of a dispatch build
+#if defined(XCPU_ISA_TARGET_REGION)
+  #if defined(__clang__)
+    #pragma clang attribute pop
+  #elif defined(__GNUC__)
+    #pragma GCC pop_options
+  #endif
+#endif
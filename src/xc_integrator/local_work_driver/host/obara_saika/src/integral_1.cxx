@@ -13,7 +13,7 @@
 
 #define PI 3.14159265358979323846
 
-namespace XCPU {
+namespace XCPU::XCPU_ISA {
 void integral_1(size_t npts,
                double *_points,
                point rA,
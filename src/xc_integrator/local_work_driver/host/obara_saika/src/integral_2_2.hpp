@@ -9,7 +9,8 @@
 #define __MY_INTEGRAL_2_2
 
 #include "../include/cpu/integral_data_types.hpp"
-namespace XCPU {
+#include "config_obara_saika.hpp"
+namespace XCPU::XCPU_ISA {
 void integral_2_2(size_t npts,
                   double *points,
                   point rA,
@@ -0,0 +1,30 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#ifndef __MY_INTEGRAL_5_1
+#define __MY_INTEGRAL_5_1
+
+#include "../include/cpu/integral_data_types.hpp"
+#include "config_obara_saika.hpp"
+namespace XCPU::XCPU_ISA {
+void integral_5_1(size_t npts,
+                  double *points,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  prim_pair *prim_pairs,
+                  double *Xi,
+                  double *Xj,
+                  int ldX,
+                  double *Gi,
+                  double *Gj,
+                  int ldG, 
+                  double *weights, 
+                  double *boys_table);
+}
+
+#endif
@@ -0,0 +1,12853 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <math.h>
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include "../include/cpu/integral_data_types.hpp"
+#include "config_obara_saika.hpp"
+#include "integral_5_4.hpp"
+
+#define PI 3.14159265358979323846
+
+namespace XCPU::XCPU_ISA {
+void integral_5_4(size_t npts,
+                  double *_points,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  prim_pair *prim_pairs,
+                  double *Xi,
+                  double *Xj,
+                  int ldX,
+                  double *Gi,
+                  double *Gj,
+                  int ldG, 
+                  double *weights,
+                  double *boys_table) {
+   __attribute__((__aligned__(64))) double buffer[185 * NPTS_LOCAL + 3 * NPTS_LOCAL];
+
+   double *temp       = (buffer + 0);
+   double *Tval       = (buffer + 185 * NPTS_LOCAL + 0 * NPTS_LOCAL);
+   double *Tval_inv_e = (buffer + 185 * NPTS_LOCAL + 1 * NPTS_LOCAL);
+   double *FmT        = (buffer + 185 * NPTS_LOCAL + 2 * NPTS_LOCAL);
+
+   size_t npts_upper = NPTS_LOCAL * (npts / NPTS_LOCAL);
+   size_t p_outer = 0;
+   for(p_outer = 0; p_outer < npts_upper; p_outer += NPTS_LOCAL) {
+      double *_point_outer = (_points + p_outer);
+
+      double X_AB = rA.x - rB.x;
+      double Y_AB = rA.y - rB.y;
+      double Z_AB = rA.z - rB.z;
+
+      for(int i = 0; i < 185 * NPTS_LOCAL; i += SIMD_LENGTH) SIMD_ALIGNED_STORE((temp + i), SIMD_ZERO());
+
+      for(int ij = 0; ij < nprim_pairs; ++ij) {
+         double RHO = prim_pairs[ij].gamma;
+         double RHO_INV = prim_pairs[ij].gamma_inv;
+         double X_PA = prim_pairs[ij].PA.x;
+         double Y_PA = prim_pairs[ij].PA.y;
+         double Z_PA = prim_pairs[ij].PA.z;
+
+         double xP = prim_pairs[ij].P.x;
+         double yP = prim_pairs[ij].P.y;
+         double zP = prim_pairs[ij].P.z;
+
+         double eval = prim_pairs[ij].K_coeff_prod;
+         if(std::abs(eval) < shpair_screen_tol) continue;
+
+         // Evaluate T Values
+         for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            X_PC = SIMD_MUL(X_PC, X_PC);
+            X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
+            X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
+         }
+
+         // Evaluate Boys function
+         boys_elements<9>(NPTS_LOCAL, Tval, Tval_inv_e, FmT, boys_table);
+
+         // Evaluate VRR Buffer
+         for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            SIMD_TYPE tval, tval_inv_e, tx, ty, t00, t01, t02, t03, t04, t05, t06, t07, t08, t09, t10, t11, t12, t13, t14, t15, t16, t17, t18, t20, t21, t22, t23, t24, t25, t26, t27, t30, t31, t32, t33, t34, t35, t36, t40, t41, t42, t43, t44, t45, t50, t51, t52, t53, t54, t60, t61, t62, t63, t70, t71, t72, t80, t81, t90;
+
+            tval = SIMD_ALIGNED_LOAD((Tval + p_inner));
+            tval_inv_e = SIMD_ALIGNED_LOAD((Tval_inv_e + p_inner));
+
+            t09 = SIMD_ALIGNED_LOAD((FmT + p_inner));
+            t08 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t09), tval_inv_e), SIMD_SET1(0.11764705882352941013));
+            t07 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t08), tval_inv_e), SIMD_SET1(0.13333333333333333148));
+            t06 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t07), tval_inv_e), SIMD_SET1(0.15384615384615385469));
+            t05 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t06), tval_inv_e), SIMD_SET1(0.18181818181818182323));
+            t04 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t05), tval_inv_e), SIMD_SET1(0.22222222222222220989));
+            t03 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t04), tval_inv_e), SIMD_SET1(0.28571428571428569843));
+            t02 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t03), tval_inv_e), SIMD_SET1(0.40000000000000002220));
+            t01 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t02), tval_inv_e), SIMD_SET1(0.66666666666666662966));
+            t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
+
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
+            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t01);
+            t02 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t02);
+            t03 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t03);
+            t04 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t04);
+            t05 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t05);
+            t06 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t06);
+            t07 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t07);
+            t08 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t08);
+            t09 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t09);
+            t10 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t00);
+            t10 = SIMD_FNMA(X_PC, t01, t10);
+            t11 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t01);
+            t11 = SIMD_FNMA(X_PC, t02, t11);
+            t12 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t02);
+            t12 = SIMD_FNMA(X_PC, t03, t12);
+            t13 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t03);
+            t13 = SIMD_FNMA(X_PC, t04, t13);
+            t14 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t04);
+            t14 = SIMD_FNMA(X_PC, t05, t14);
+            t15 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t05);
+            t15 = SIMD_FNMA(X_PC, t06, t15);
+            t16 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t06);
+            t16 = SIMD_FNMA(X_PC, t07, t16);
+            t17 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t07);
+            t17 = SIMD_FNMA(X_PC, t08, t17);
+            t18 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t08);
+            t18 = SIMD_FNMA(X_PC, t09, t18);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t10);
+            t20 = SIMD_FNMA(X_PC, t11, t20);
+            tx = SIMD_SUB(t00, t01);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t20 = SIMD_FMA(tx, ty, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t11);
+            t21 = SIMD_FNMA(X_PC, t12, t21);
+            tx = SIMD_SUB(t01, t02);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t21 = SIMD_FMA(tx, ty, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t12);
+            t22 = SIMD_FNMA(X_PC, t13, t22);
+            tx = SIMD_SUB(t02, t03);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t22 = SIMD_FMA(tx, ty, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t13);
+            t23 = SIMD_FNMA(X_PC, t14, t23);
+            tx = SIMD_SUB(t03, t04);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t23 = SIMD_FMA(tx, ty, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t14);
+            t24 = SIMD_FNMA(X_PC, t15, t24);
+            tx = SIMD_SUB(t04, t05);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t24 = SIMD_FMA(tx, ty, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t15);
+            t25 = SIMD_FNMA(X_PC, t16, t25);
+            tx = SIMD_SUB(t05, t06);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t25 = SIMD_FMA(tx, ty, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t16);
+            t26 = SIMD_FNMA(X_PC, t17, t26);
+            tx = SIMD_SUB(t06, t07);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t26 = SIMD_FMA(tx, ty, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t17);
+            t27 = SIMD_FNMA(X_PC, t18, t27);
+            tx = SIMD_SUB(t07, t08);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t27 = SIMD_FMA(tx, ty, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t20);
+            t30 = SIMD_FNMA(X_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t21);
+            t31 = SIMD_FNMA(X_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t22);
+            t32 = SIMD_FNMA(X_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t23);
+            t33 = SIMD_FNMA(X_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t24);
+            t34 = SIMD_FNMA(X_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t25);
+            t35 = SIMD_FNMA(X_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t26);
+            t36 = SIMD_FNMA(X_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t30);
+            t40 = SIMD_FNMA(X_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t31);
+            t41 = SIMD_FNMA(X_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t32);
+            t42 = SIMD_FNMA(X_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t33);
+            t43 = SIMD_FNMA(X_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t34);
+            t44 = SIMD_FNMA(X_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t35);
+            t45 = SIMD_FNMA(X_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t40);
+            t50 = SIMD_FNMA(X_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t41);
+            t51 = SIMD_FNMA(X_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t42);
+            t52 = SIMD_FNMA(X_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t43);
+            t53 = SIMD_FNMA(X_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t44);
+            t54 = SIMD_FNMA(X_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t50);
+            t60 = SIMD_FNMA(X_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t51);
+            t61 = SIMD_FNMA(X_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t52);
+            t62 = SIMD_FNMA(X_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t53);
+            t63 = SIMD_FNMA(X_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 21 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 21 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t60);
+            t70 = SIMD_FNMA(X_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t61);
+            t71 = SIMD_FNMA(X_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t62);
+            t72 = SIMD_FNMA(X_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 49 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 49 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t70);
+            t80 = SIMD_FNMA(X_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t71);
+            t81 = SIMD_FNMA(X_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 85 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 85 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t80);
+            t90 = SIMD_FNMA(X_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 130 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 130 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 131 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 131 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 132 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 132 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 86 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 86 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 133 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 133 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 134 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 134 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 87 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 87 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 135 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 135 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 50 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 50 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 88 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 88 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 136 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 136 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 137 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 137 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 89 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 89 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 138 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 138 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 51 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 51 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 90 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 90 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 139 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 139 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 22 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 22 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 52 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 52 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 91 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 91 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 140 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 140 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 141 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 141 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 92 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 92 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 142 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 142 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 53 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 53 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 93 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 93 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 143 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 143 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 23 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 23 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 54 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 54 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 94 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 94 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 144 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 144 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 1 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 1 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 24 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 24 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 55 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 55 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 95 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 95 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 145 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 145 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 146 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 146 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 96 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 96 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 147 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 147 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 56 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 56 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 97 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 97 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 148 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 148 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 25 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 25 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 57 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 57 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 98 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 98 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 149 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 149 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 2 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 2 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 26 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 26 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 58 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 58 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 99 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 99 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 150 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 150 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 3 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 3 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 27 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 27 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 59 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 59 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 100 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 100 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 151 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 151 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 152 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 152 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 101 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 101 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 153 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 153 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 60 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 60 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 102 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 102 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 154 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 154 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 28 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 28 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 61 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 61 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 103 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 103 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 155 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 155 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 4 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 4 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 29 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 29 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 62 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 62 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 104 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 104 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 156 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 156 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 5 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 5 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 30 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 30 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 63 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 63 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 105 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 105 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 157 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 157 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t20);
+            t30 = SIMD_FNMA(Y_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t21);
+            t31 = SIMD_FNMA(Y_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t22);
+            t32 = SIMD_FNMA(Y_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t23);
+            t33 = SIMD_FNMA(Y_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t24);
+            t34 = SIMD_FNMA(Y_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t25);
+            t35 = SIMD_FNMA(Y_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t26);
+            t36 = SIMD_FNMA(Y_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 6 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 6 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 31 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 31 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 64 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 64 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 106 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 106 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 158 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 158 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 159 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 159 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 107 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 107 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 160 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 160 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 65 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 65 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 108 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 108 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 161 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 161 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 32 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 32 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 66 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 66 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 109 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 109 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 162 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 162 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 7 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 7 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 33 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 33 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 67 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 67 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 110 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 110 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 163 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 163 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 8 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 8 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 34 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 34 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 68 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 68 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 111 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 111 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 164 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 164 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 9 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 9 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 35 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 35 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 69 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 69 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 112 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 112 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 165 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 165 * NPTS_LOCAL + p_inner), tx);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t10);
+            t20 = SIMD_FNMA(Y_PC, t11, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t11);
+            t21 = SIMD_FNMA(Y_PC, t12, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t12);
+            t22 = SIMD_FNMA(Y_PC, t13, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t13);
+            t23 = SIMD_FNMA(Y_PC, t14, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t14);
+            t24 = SIMD_FNMA(Y_PC, t15, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t15);
+            t25 = SIMD_FNMA(Y_PC, t16, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t16);
+            t26 = SIMD_FNMA(Y_PC, t17, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t17);
+            t27 = SIMD_FNMA(Y_PC, t18, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t20);
+            t30 = SIMD_FNMA(Y_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t21);
+            t31 = SIMD_FNMA(Y_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t22);
+            t32 = SIMD_FNMA(Y_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t23);
+            t33 = SIMD_FNMA(Y_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t24);
+            t34 = SIMD_FNMA(Y_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t25);
+            t35 = SIMD_FNMA(Y_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t26);
+            t36 = SIMD_FNMA(Y_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 10 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 10 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 36 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 36 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 70 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 70 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 113 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 113 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 166 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 166 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 167 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 167 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 114 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 114 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 168 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 168 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 71 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 71 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 115 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 115 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 169 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 169 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 37 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 37 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 72 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 72 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 116 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 116 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 170 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 170 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 11 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 11 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 38 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 38 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 73 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 73 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 117 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 117 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 171 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 171 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 12 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 12 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 39 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 39 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 74 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 74 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 118 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 118 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 172 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 172 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 13 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 13 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 40 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 40 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 75 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 75 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 119 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 119 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 173 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 173 * NPTS_LOCAL + p_inner), tx);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t10);
+            t20 = SIMD_FNMA(Z_PC, t11, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t11);
+            t21 = SIMD_FNMA(Z_PC, t12, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t12);
+            t22 = SIMD_FNMA(Z_PC, t13, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t13);
+            t23 = SIMD_FNMA(Z_PC, t14, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t14);
+            t24 = SIMD_FNMA(Z_PC, t15, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t15);
+            t25 = SIMD_FNMA(Z_PC, t16, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t16);
+            t26 = SIMD_FNMA(Z_PC, t17, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t17);
+            t27 = SIMD_FNMA(Z_PC, t18, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 14 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 14 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 41 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 41 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 76 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 76 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 120 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 120 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 174 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 174 * NPTS_LOCAL + p_inner), tx);
+            t10 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t00);
+            t10 = SIMD_FNMA(Y_PC, t01, t10);
+            t11 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t01);
+            t11 = SIMD_FNMA(Y_PC, t02, t11);
+            t12 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t02);
+            t12 = SIMD_FNMA(Y_PC, t03, t12);
+            t13 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t03);
+            t13 = SIMD_FNMA(Y_PC, t04, t13);
+            t14 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t04);
+            t14 = SIMD_FNMA(Y_PC, t05, t14);
+            t15 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t05);
+            t15 = SIMD_FNMA(Y_PC, t06, t15);
+            t16 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t06);
+            t16 = SIMD_FNMA(Y_PC, t07, t16);
+            t17 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t07);
+            t17 = SIMD_FNMA(Y_PC, t08, t17);
+            t18 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t08);
+            t18 = SIMD_FNMA(Y_PC, t09, t18);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t10);
+            t20 = SIMD_FNMA(Y_PC, t11, t20);
+            tx = SIMD_SUB(t00, t01);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t20 = SIMD_FMA(tx, ty, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t11);
+            t21 = SIMD_FNMA(Y_PC, t12, t21);
+            tx = SIMD_SUB(t01, t02);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t21 = SIMD_FMA(tx, ty, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t12);
+            t22 = SIMD_FNMA(Y_PC, t13, t22);
+            tx = SIMD_SUB(t02, t03);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t22 = SIMD_FMA(tx, ty, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t13);
+            t23 = SIMD_FNMA(Y_PC, t14, t23);
+            tx = SIMD_SUB(t03, t04);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t23 = SIMD_FMA(tx, ty, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t14);
+            t24 = SIMD_FNMA(Y_PC, t15, t24);
+            tx = SIMD_SUB(t04, t05);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t24 = SIMD_FMA(tx, ty, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t15);
+            t25 = SIMD_FNMA(Y_PC, t16, t25);
+            tx = SIMD_SUB(t05, t06);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t25 = SIMD_FMA(tx, ty, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t16);
+            t26 = SIMD_FNMA(Y_PC, t17, t26);
+            tx = SIMD_SUB(t06, t07);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t26 = SIMD_FMA(tx, ty, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t17);
+            t27 = SIMD_FNMA(Y_PC, t18, t27);
+            tx = SIMD_SUB(t07, t08);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t27 = SIMD_FMA(tx, ty, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t20);
+            t30 = SIMD_FNMA(Y_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t21);
+            t31 = SIMD_FNMA(Y_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t22);
+            t32 = SIMD_FNMA(Y_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t23);
+            t33 = SIMD_FNMA(Y_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t24);
+            t34 = SIMD_FNMA(Y_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t25);
+            t35 = SIMD_FNMA(Y_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t26);
+            t36 = SIMD_FNMA(Y_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 15 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 15 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 42 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 42 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 77 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 77 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 121 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 121 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 175 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 175 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 176 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 176 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 122 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 122 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 177 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 177 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 78 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 78 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 123 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 123 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 178 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 178 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 43 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 43 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 79 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 79 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 124 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 124 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 179 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 179 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 16 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 44 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 44 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 80 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 80 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 125 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 125 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 180 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 180 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 17 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 17 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 45 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 45 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 81 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 81 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 126 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 126 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 181 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 181 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 18 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 18 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 46 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 46 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 82 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 82 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 127 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 127 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 182 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 182 * NPTS_LOCAL + p_inner), tx);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t10);
+            t20 = SIMD_FNMA(Z_PC, t11, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t11);
+            t21 = SIMD_FNMA(Z_PC, t12, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t12);
+            t22 = SIMD_FNMA(Z_PC, t13, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t13);
+            t23 = SIMD_FNMA(Z_PC, t14, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t14);
+            t24 = SIMD_FNMA(Z_PC, t15, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t15);
+            t25 = SIMD_FNMA(Z_PC, t16, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t16);
+            t26 = SIMD_FNMA(Z_PC, t17, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t17);
+            t27 = SIMD_FNMA(Z_PC, t18, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 19 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 19 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 47 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 47 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 83 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 83 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 128 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 128 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 183 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 183 * NPTS_LOCAL + p_inner), tx);
+            t10 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t00);
+            t10 = SIMD_FNMA(Z_PC, t01, t10);
+            t11 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t01);
+            t11 = SIMD_FNMA(Z_PC, t02, t11);
+            t12 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t02);
+            t12 = SIMD_FNMA(Z_PC, t03, t12);
+            t13 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t03);
+            t13 = SIMD_FNMA(Z_PC, t04, t13);
+            t14 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t04);
+            t14 = SIMD_FNMA(Z_PC, t05, t14);
+            t15 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t05);
+            t15 = SIMD_FNMA(Z_PC, t06, t15);
+            t16 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t06);
+            t16 = SIMD_FNMA(Z_PC, t07, t16);
+            t17 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t07);
+            t17 = SIMD_FNMA(Z_PC, t08, t17);
+            t18 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t08);
+            t18 = SIMD_FNMA(Z_PC, t09, t18);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t10);
+            t20 = SIMD_FNMA(Z_PC, t11, t20);
+            tx = SIMD_SUB(t00, t01);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t20 = SIMD_FMA(tx, ty, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t11);
+            t21 = SIMD_FNMA(Z_PC, t12, t21);
+            tx = SIMD_SUB(t01, t02);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t21 = SIMD_FMA(tx, ty, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t12);
+            t22 = SIMD_FNMA(Z_PC, t13, t22);
+            tx = SIMD_SUB(t02, t03);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t22 = SIMD_FMA(tx, ty, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t13);
+            t23 = SIMD_FNMA(Z_PC, t14, t23);
+            tx = SIMD_SUB(t03, t04);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t23 = SIMD_FMA(tx, ty, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t14);
+            t24 = SIMD_FNMA(Z_PC, t15, t24);
+            tx = SIMD_SUB(t04, t05);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t24 = SIMD_FMA(tx, ty, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t15);
+            t25 = SIMD_FNMA(Z_PC, t16, t25);
+            tx = SIMD_SUB(t05, t06);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t25 = SIMD_FMA(tx, ty, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t16);
+            t26 = SIMD_FNMA(Z_PC, t17, t26);
+            tx = SIMD_SUB(t06, t07);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t26 = SIMD_FMA(tx, ty, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t17);
+            t27 = SIMD_FNMA(Z_PC, t18, t27);
+            tx = SIMD_SUB(t07, t08);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t27 = SIMD_FMA(tx, ty, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 20 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 20 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 48 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 48 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 84 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 84 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 129 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 129 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 184 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 184 * NPTS_LOCAL + p_inner), tx);
+         }
+      }
+
+      for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
+         double *Xik = (Xi + p_outer + p_inner);
+         double *Xjk = (Xj + p_outer + p_inner);
+         double *Gik = (Gi + p_outer + p_inner);
+         double *Gjk = (Gj + p_outer + p_inner);
+
+         SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
+
+         for(int c0 = 0; c0 <= 4; ++c0) {
+            for(int c1 = 0; c1 <= c0; ++c1) {
+               int m = 4 - c0;
+               int n = c0 - c1;
+               int p = c1;
+
+               int idxB = (((4 - m) * (4 - m + 1)) >> 1) + p;
+
+               double X_ABp = 1.0, comb_m_i = 1.0;
+               for(int i = 0; i <= m; ++i) {
+                  double rcp_i;
+
+                  double Y_ABp = 1.0, comb_n_j = 1.0;
+                  for(int j = 0; j <= n; ++j) {
+                     double rcp_j;
+
+                     double Z_ABp = 1.0, comb_p_k = 1.0;
+                     for(int k = 0; k <= p; ++k) {
+                        double rcp_k;
+                        int mv, pv, Lv = 9 - i - j - k;
+
+                        int offset = (Lv * (Lv + 1) * (Lv + 2) - 210) / 6;
+                        double const_value = comb_m_i * comb_n_j * comb_p_k * X_ABp * Y_ABp * Z_ABp;
+                        SIMD_TYPE tx, ty, tz, tw;
+                        SIMD_TYPE const_value_w = SIMD_MUL(const_value_v, SIMD_DUPLICATE(&(const_value)));
+
+                        mv = 5 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 0 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 0 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t0 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t0 = SIMD_MUL(t0, const_value_w);
+                        tz = SIMD_FMA(ty, t0, tz);
+                        tw = SIMD_FMA(tx, t0, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 0 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 1 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 1 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t1 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t1 = SIMD_MUL(t1, const_value_w);
+                        tz = SIMD_FMA(ty, t1, tz);
+                        tw = SIMD_FMA(tx, t1, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 1 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 2 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 2 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t2 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t2 = SIMD_MUL(t2, const_value_w);
+                        tz = SIMD_FMA(ty, t2, tz);
+                        tw = SIMD_FMA(tx, t2, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 2 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 3 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 3 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t3 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t3 = SIMD_MUL(t3, const_value_w);
+                        tz = SIMD_FMA(ty, t3, tz);
+                        tw = SIMD_FMA(tx, t3, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 3 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 4 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 4 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t4 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t4 = SIMD_MUL(t4, const_value_w);
+                        tz = SIMD_FMA(ty, t4, tz);
+                        tw = SIMD_FMA(tx, t4, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 4 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 5 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 5 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t5 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t5 = SIMD_MUL(t5, const_value_w);
+                        tz = SIMD_FMA(ty, t5, tz);
+                        tw = SIMD_FMA(tx, t5, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 5 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 6 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 6 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t6 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t6 = SIMD_MUL(t6, const_value_w);
+                        tz = SIMD_FMA(ty, t6, tz);
+                        tw = SIMD_FMA(tx, t6, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 6 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 7 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 7 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t7 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t7 = SIMD_MUL(t7, const_value_w);
+                        tz = SIMD_FMA(ty, t7, tz);
+                        tw = SIMD_FMA(tx, t7, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 7 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 8 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 8 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t8 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t8 = SIMD_MUL(t8, const_value_w);
+                        tz = SIMD_FMA(ty, t8, tz);
+                        tw = SIMD_FMA(tx, t8, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 8 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 9 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 9 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t9 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t9 = SIMD_MUL(t9, const_value_w);
+                        tz = SIMD_FMA(ty, t9, tz);
+                        tw = SIMD_FMA(tx, t9, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 9 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 10 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 10 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t10 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t10 = SIMD_MUL(t10, const_value_w);
+                        tz = SIMD_FMA(ty, t10, tz);
+                        tw = SIMD_FMA(tx, t10, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 10 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 11 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 11 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t11 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t11 = SIMD_MUL(t11, const_value_w);
+                        tz = SIMD_FMA(ty, t11, tz);
+                        tw = SIMD_FMA(tx, t11, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 11 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 12 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 12 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t12 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t12 = SIMD_MUL(t12, const_value_w);
+                        tz = SIMD_FMA(ty, t12, tz);
+                        tw = SIMD_FMA(tx, t12, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 12 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 13 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 13 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t13 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t13 = SIMD_MUL(t13, const_value_w);
+                        tz = SIMD_FMA(ty, t13, tz);
+                        tw = SIMD_FMA(tx, t13, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 13 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 14 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 14 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t14 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t14 = SIMD_MUL(t14, const_value_w);
+                        tz = SIMD_FMA(ty, t14, tz);
+                        tw = SIMD_FMA(tx, t14, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 14 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 15 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 15 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t15 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t15 = SIMD_MUL(t15, const_value_w);
+                        tz = SIMD_FMA(ty, t15, tz);
+                        tw = SIMD_FMA(tx, t15, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 15 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 16 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 16 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t16 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t16 = SIMD_MUL(t16, const_value_w);
+                        tz = SIMD_FMA(ty, t16, tz);
+                        tw = SIMD_FMA(tx, t16, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 16 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 17 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 17 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t17 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t17 = SIMD_MUL(t17, const_value_w);
+                        tz = SIMD_FMA(ty, t17, tz);
+                        tw = SIMD_FMA(tx, t17, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 17 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 18 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 18 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t18 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t18 = SIMD_MUL(t18, const_value_w);
+                        tz = SIMD_FMA(ty, t18, tz);
+                        tw = SIMD_FMA(tx, t18, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 18 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 19 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 19 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t19 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t19 = SIMD_MUL(t19, const_value_w);
+                        tz = SIMD_FMA(ty, t19, tz);
+                        tw = SIMD_FMA(tx, t19, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 19 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 5 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 20 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 20 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t20 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t20 = SIMD_MUL(t20, const_value_w);
+                        tz = SIMD_FMA(ty, t20, tz);
+                        tw = SIMD_FMA(tx, t20, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 20 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+
+                        Z_ABp = SCALAR_MUL(Z_ABp, Z_AB);
+                        rcp_k = SCALAR_RECIPROCAL(k + 1);
+                        comb_p_k = SCALAR_MUL(comb_p_k, p - k);
+                        comb_p_k = SCALAR_MUL(comb_p_k, rcp_k);
+                     }
+
+                     Y_ABp = SCALAR_MUL(Y_ABp, Y_AB);
+                     rcp_j = SCALAR_RECIPROCAL(j + 1);
+                     comb_n_j = SCALAR_MUL(comb_n_j, n - j);
+                     comb_n_j = SCALAR_MUL(comb_n_j, rcp_j);
+                  }
+
+                  X_ABp = SCALAR_MUL(X_ABp, X_AB);
+                  rcp_i = SCALAR_RECIPROCAL(i + 1);
+                  comb_m_i = SCALAR_MUL(comb_m_i, m - i);
+                  comb_m_i = SCALAR_MUL(comb_m_i, rcp_i);
+               }
+            }
+         }
+      }
+   }
+
+   for(; p_outer < npts; p_outer += NPTS_LOCAL) {
+      size_t npts_inner = std::min((size_t) NPTS_LOCAL, npts - p_outer);
+      double *_point_outer = (_points + p_outer);
+
+      double X_AB = rA.x - rB.x;
+      double Y_AB = rA.y - rB.y;
+      double Z_AB = rA.z - rB.z;
+
+      for(int i = 0; i < 185 * NPTS_LOCAL; i += SIMD_LENGTH) SIMD_ALIGNED_STORE((temp + i), SIMD_ZERO());
+
+      for(int ij = 0; ij < nprim_pairs; ++ij) {
+         double RHO = prim_pairs[ij].gamma;
+         double RHO_INV = prim_pairs[ij].gamma_inv;
+         double X_PA = prim_pairs[ij].PA.x;
+         double Y_PA = prim_pairs[ij].PA.y;
+         double Z_PA = prim_pairs[ij].PA.z;
+
+         double xP = prim_pairs[ij].P.x;
+         double yP = prim_pairs[ij].P.y;
+         double zP = prim_pairs[ij].P.z;
+
+         double eval = prim_pairs[ij].K_coeff_prod;
+         if(std::abs(eval) < shpair_screen_tol) continue;
+
+         // Evaluate T Values
+         size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
+         size_t p_inner = 0;
+         for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            X_PC = SIMD_MUL(X_PC, X_PC);
+            X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
+            X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
+         }
+
+         for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
+            SCALAR_TYPE xC = SCALAR_LOAD((_point_outer + p_inner + 0 * npts));
+            SCALAR_TYPE yC = SCALAR_LOAD((_point_outer + p_inner + 1 * npts));
+            SCALAR_TYPE zC = SCALAR_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SCALAR_TYPE X_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(xP)), xC);
+            SCALAR_TYPE Y_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(yP)), yC);
+            SCALAR_TYPE Z_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(zP)), zC);
+
+            X_PC = SCALAR_MUL(X_PC, X_PC);
+            X_PC = SCALAR_FMA(Y_PC, Y_PC, X_PC);
+            X_PC = SCALAR_FMA(Z_PC, Z_PC, X_PC);
+            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO)), X_PC);
+            SCALAR_STORE((Tval + p_inner), X_PC);
+         }
+
+         // Evaluate Boys function
+         boys_elements<9>(npts_inner, Tval, Tval_inv_e, FmT, boys_table);
+
+         // Evaluate VRR Buffer
+         p_inner = 0;
+         for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            SIMD_TYPE tval, tval_inv_e, tx, ty, t00, t01, t02, t03, t04, t05, t06, t07, t08, t09, t10, t11, t12, t13, t14, t15, t16, t17, t18, t20, t21, t22, t23, t24, t25, t26, t27, t30, t31, t32, t33, t34, t35, t36, t40, t41, t42, t43, t44, t45, t50, t51, t52, t53, t54, t60, t61, t62, t63, t70, t71, t72, t80, t81, t90;
+
+            tval = SIMD_ALIGNED_LOAD((Tval + p_inner));
+            tval_inv_e = SIMD_ALIGNED_LOAD((Tval_inv_e + p_inner));
+
+            t09 = SIMD_ALIGNED_LOAD((FmT + p_inner));
+            t08 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t09), tval_inv_e), SIMD_SET1(0.11764705882352941013));
+            t07 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t08), tval_inv_e), SIMD_SET1(0.13333333333333333148));
+            t06 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t07), tval_inv_e), SIMD_SET1(0.15384615384615385469));
+            t05 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t06), tval_inv_e), SIMD_SET1(0.18181818181818182323));
+            t04 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t05), tval_inv_e), SIMD_SET1(0.22222222222222220989));
+            t03 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t04), tval_inv_e), SIMD_SET1(0.28571428571428569843));
+            t02 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t03), tval_inv_e), SIMD_SET1(0.40000000000000002220));
+            t01 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t02), tval_inv_e), SIMD_SET1(0.66666666666666662966));
+            t00 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t01), tval_inv_e), SIMD_SET1(2.00000000000000000000));
+
+            t00 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t00);
+            t01 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t01);
+            t02 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t02);
+            t03 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t03);
+            t04 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t04);
+            t05 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t05);
+            t06 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t06);
+            t07 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t07);
+            t08 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t08);
+            t09 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t09);
+            t10 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t00);
+            t10 = SIMD_FNMA(X_PC, t01, t10);
+            t11 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t01);
+            t11 = SIMD_FNMA(X_PC, t02, t11);
+            t12 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t02);
+            t12 = SIMD_FNMA(X_PC, t03, t12);
+            t13 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t03);
+            t13 = SIMD_FNMA(X_PC, t04, t13);
+            t14 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t04);
+            t14 = SIMD_FNMA(X_PC, t05, t14);
+            t15 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t05);
+            t15 = SIMD_FNMA(X_PC, t06, t15);
+            t16 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t06);
+            t16 = SIMD_FNMA(X_PC, t07, t16);
+            t17 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t07);
+            t17 = SIMD_FNMA(X_PC, t08, t17);
+            t18 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t08);
+            t18 = SIMD_FNMA(X_PC, t09, t18);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t10);
+            t20 = SIMD_FNMA(X_PC, t11, t20);
+            tx = SIMD_SUB(t00, t01);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t20 = SIMD_FMA(tx, ty, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t11);
+            t21 = SIMD_FNMA(X_PC, t12, t21);
+            tx = SIMD_SUB(t01, t02);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t21 = SIMD_FMA(tx, ty, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t12);
+            t22 = SIMD_FNMA(X_PC, t13, t22);
+            tx = SIMD_SUB(t02, t03);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t22 = SIMD_FMA(tx, ty, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t13);
+            t23 = SIMD_FNMA(X_PC, t14, t23);
+            tx = SIMD_SUB(t03, t04);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t23 = SIMD_FMA(tx, ty, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t14);
+            t24 = SIMD_FNMA(X_PC, t15, t24);
+            tx = SIMD_SUB(t04, t05);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t24 = SIMD_FMA(tx, ty, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t15);
+            t25 = SIMD_FNMA(X_PC, t16, t25);
+            tx = SIMD_SUB(t05, t06);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t25 = SIMD_FMA(tx, ty, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t16);
+            t26 = SIMD_FNMA(X_PC, t17, t26);
+            tx = SIMD_SUB(t06, t07);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t26 = SIMD_FMA(tx, ty, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t17);
+            t27 = SIMD_FNMA(X_PC, t18, t27);
+            tx = SIMD_SUB(t07, t08);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t27 = SIMD_FMA(tx, ty, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t20);
+            t30 = SIMD_FNMA(X_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t21);
+            t31 = SIMD_FNMA(X_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t22);
+            t32 = SIMD_FNMA(X_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t23);
+            t33 = SIMD_FNMA(X_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t24);
+            t34 = SIMD_FNMA(X_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t25);
+            t35 = SIMD_FNMA(X_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t26);
+            t36 = SIMD_FNMA(X_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t30);
+            t40 = SIMD_FNMA(X_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t31);
+            t41 = SIMD_FNMA(X_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t32);
+            t42 = SIMD_FNMA(X_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t33);
+            t43 = SIMD_FNMA(X_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t34);
+            t44 = SIMD_FNMA(X_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t35);
+            t45 = SIMD_FNMA(X_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t40);
+            t50 = SIMD_FNMA(X_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t41);
+            t51 = SIMD_FNMA(X_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t42);
+            t52 = SIMD_FNMA(X_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t43);
+            t53 = SIMD_FNMA(X_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t44);
+            t54 = SIMD_FNMA(X_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t50);
+            t60 = SIMD_FNMA(X_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t51);
+            t61 = SIMD_FNMA(X_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t52);
+            t62 = SIMD_FNMA(X_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t53);
+            t63 = SIMD_FNMA(X_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 21 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 21 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t60);
+            t70 = SIMD_FNMA(X_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t61);
+            t71 = SIMD_FNMA(X_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t62);
+            t72 = SIMD_FNMA(X_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 49 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 49 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t70);
+            t80 = SIMD_FNMA(X_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t71);
+            t81 = SIMD_FNMA(X_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 85 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 85 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t80);
+            t90 = SIMD_FNMA(X_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 130 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 130 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 131 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 131 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 132 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 132 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 86 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 86 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 133 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 133 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 134 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 134 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 87 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 87 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 135 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 135 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 50 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 50 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 88 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 88 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 136 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 136 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 137 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 137 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 89 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 89 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 138 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 138 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 51 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 51 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 90 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 90 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 139 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 139 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 22 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 22 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 52 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 52 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 91 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 91 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 140 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 140 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 141 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 141 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 92 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 92 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 142 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 142 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 53 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 53 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 93 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 93 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 143 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 143 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 23 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 23 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 54 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 54 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 94 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 94 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 144 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 144 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 1 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 1 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 24 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 24 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 55 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 55 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 95 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 95 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 145 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 145 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 146 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 146 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 96 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 96 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 147 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 147 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 56 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 56 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 97 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 97 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 148 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 148 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 25 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 25 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 57 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 57 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 98 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 98 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 149 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 149 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 2 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 2 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 26 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 26 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 58 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 58 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 99 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 99 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 150 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 150 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 3 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 3 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 27 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 27 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 59 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 59 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 100 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 100 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 151 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 151 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 152 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 152 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 101 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 101 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 153 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 153 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 60 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 60 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 102 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 102 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 154 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 154 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 28 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 28 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 61 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 61 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 103 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 103 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 155 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 155 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 4 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 4 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 29 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 29 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 62 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 62 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 104 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 104 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 156 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 156 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 5 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 5 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 30 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 30 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 63 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 63 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 105 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 105 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 157 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 157 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t20);
+            t30 = SIMD_FNMA(Y_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t21);
+            t31 = SIMD_FNMA(Y_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t22);
+            t32 = SIMD_FNMA(Y_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t23);
+            t33 = SIMD_FNMA(Y_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t24);
+            t34 = SIMD_FNMA(Y_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t25);
+            t35 = SIMD_FNMA(Y_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t26);
+            t36 = SIMD_FNMA(Y_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 6 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 6 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 31 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 31 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 64 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 64 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 106 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 106 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 158 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 158 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 159 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 159 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 107 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 107 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 160 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 160 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 65 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 65 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 108 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 108 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 161 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 161 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 32 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 32 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 66 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 66 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 109 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 109 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 162 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 162 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 7 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 7 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 33 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 33 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 67 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 67 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 110 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 110 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 163 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 163 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 8 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 8 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 34 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 34 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 68 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 68 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 111 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 111 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 164 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 164 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 9 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 9 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 35 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 35 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 69 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 69 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 112 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 112 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 165 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 165 * NPTS_LOCAL + p_inner), tx);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t10);
+            t20 = SIMD_FNMA(Y_PC, t11, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t11);
+            t21 = SIMD_FNMA(Y_PC, t12, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t12);
+            t22 = SIMD_FNMA(Y_PC, t13, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t13);
+            t23 = SIMD_FNMA(Y_PC, t14, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t14);
+            t24 = SIMD_FNMA(Y_PC, t15, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t15);
+            t25 = SIMD_FNMA(Y_PC, t16, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t16);
+            t26 = SIMD_FNMA(Y_PC, t17, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t17);
+            t27 = SIMD_FNMA(Y_PC, t18, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t20);
+            t30 = SIMD_FNMA(Y_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t21);
+            t31 = SIMD_FNMA(Y_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t22);
+            t32 = SIMD_FNMA(Y_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t23);
+            t33 = SIMD_FNMA(Y_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t24);
+            t34 = SIMD_FNMA(Y_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t25);
+            t35 = SIMD_FNMA(Y_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t26);
+            t36 = SIMD_FNMA(Y_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 10 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 10 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 36 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 36 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 70 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 70 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 113 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 113 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 166 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 166 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 167 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 167 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 114 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 114 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 168 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 168 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 71 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 71 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 115 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 115 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 169 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 169 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 37 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 37 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 72 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 72 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 116 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 116 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 170 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 170 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 11 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 11 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 38 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 38 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 73 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 73 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 117 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 117 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 171 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 171 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 12 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 12 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 39 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 39 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 74 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 74 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 118 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 118 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 172 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 172 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 13 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 13 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 40 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 40 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 75 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 75 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 119 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 119 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 173 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 173 * NPTS_LOCAL + p_inner), tx);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t10);
+            t20 = SIMD_FNMA(Z_PC, t11, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t11);
+            t21 = SIMD_FNMA(Z_PC, t12, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t12);
+            t22 = SIMD_FNMA(Z_PC, t13, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t13);
+            t23 = SIMD_FNMA(Z_PC, t14, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t14);
+            t24 = SIMD_FNMA(Z_PC, t15, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t15);
+            t25 = SIMD_FNMA(Z_PC, t16, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t16);
+            t26 = SIMD_FNMA(Z_PC, t17, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t17);
+            t27 = SIMD_FNMA(Z_PC, t18, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 14 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 14 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 41 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 41 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 76 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 76 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 120 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 120 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 174 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 174 * NPTS_LOCAL + p_inner), tx);
+            t10 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t00);
+            t10 = SIMD_FNMA(Y_PC, t01, t10);
+            t11 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t01);
+            t11 = SIMD_FNMA(Y_PC, t02, t11);
+            t12 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t02);
+            t12 = SIMD_FNMA(Y_PC, t03, t12);
+            t13 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t03);
+            t13 = SIMD_FNMA(Y_PC, t04, t13);
+            t14 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t04);
+            t14 = SIMD_FNMA(Y_PC, t05, t14);
+            t15 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t05);
+            t15 = SIMD_FNMA(Y_PC, t06, t15);
+            t16 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t06);
+            t16 = SIMD_FNMA(Y_PC, t07, t16);
+            t17 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t07);
+            t17 = SIMD_FNMA(Y_PC, t08, t17);
+            t18 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t08);
+            t18 = SIMD_FNMA(Y_PC, t09, t18);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t10);
+            t20 = SIMD_FNMA(Y_PC, t11, t20);
+            tx = SIMD_SUB(t00, t01);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t20 = SIMD_FMA(tx, ty, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t11);
+            t21 = SIMD_FNMA(Y_PC, t12, t21);
+            tx = SIMD_SUB(t01, t02);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t21 = SIMD_FMA(tx, ty, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t12);
+            t22 = SIMD_FNMA(Y_PC, t13, t22);
+            tx = SIMD_SUB(t02, t03);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t22 = SIMD_FMA(tx, ty, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t13);
+            t23 = SIMD_FNMA(Y_PC, t14, t23);
+            tx = SIMD_SUB(t03, t04);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t23 = SIMD_FMA(tx, ty, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t14);
+            t24 = SIMD_FNMA(Y_PC, t15, t24);
+            tx = SIMD_SUB(t04, t05);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t24 = SIMD_FMA(tx, ty, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t15);
+            t25 = SIMD_FNMA(Y_PC, t16, t25);
+            tx = SIMD_SUB(t05, t06);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t25 = SIMD_FMA(tx, ty, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t16);
+            t26 = SIMD_FNMA(Y_PC, t17, t26);
+            tx = SIMD_SUB(t06, t07);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t26 = SIMD_FMA(tx, ty, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t17);
+            t27 = SIMD_FNMA(Y_PC, t18, t27);
+            tx = SIMD_SUB(t07, t08);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t27 = SIMD_FMA(tx, ty, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t20);
+            t30 = SIMD_FNMA(Y_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t21);
+            t31 = SIMD_FNMA(Y_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t22);
+            t32 = SIMD_FNMA(Y_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t23);
+            t33 = SIMD_FNMA(Y_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t24);
+            t34 = SIMD_FNMA(Y_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t25);
+            t35 = SIMD_FNMA(Y_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t26);
+            t36 = SIMD_FNMA(Y_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t30);
+            t40 = SIMD_FNMA(Y_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t31);
+            t41 = SIMD_FNMA(Y_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t32);
+            t42 = SIMD_FNMA(Y_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t33);
+            t43 = SIMD_FNMA(Y_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t34);
+            t44 = SIMD_FNMA(Y_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t35);
+            t45 = SIMD_FNMA(Y_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t40);
+            t50 = SIMD_FNMA(Y_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t41);
+            t51 = SIMD_FNMA(Y_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t42);
+            t52 = SIMD_FNMA(Y_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t43);
+            t53 = SIMD_FNMA(Y_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t44);
+            t54 = SIMD_FNMA(Y_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 15 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 15 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t50);
+            t60 = SIMD_FNMA(Y_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t51);
+            t61 = SIMD_FNMA(Y_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t52);
+            t62 = SIMD_FNMA(Y_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t53);
+            t63 = SIMD_FNMA(Y_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 42 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 42 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t60);
+            t70 = SIMD_FNMA(Y_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t61);
+            t71 = SIMD_FNMA(Y_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t62);
+            t72 = SIMD_FNMA(Y_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 77 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 77 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t70);
+            t80 = SIMD_FNMA(Y_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t71);
+            t81 = SIMD_FNMA(Y_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 121 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 121 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t80);
+            t90 = SIMD_FNMA(Y_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 175 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 175 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 176 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 176 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 122 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 122 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 177 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 177 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 78 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 78 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 123 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 123 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 178 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 178 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 43 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 43 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 79 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 79 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 124 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 124 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 179 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 179 * NPTS_LOCAL + p_inner), tx);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 16 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 44 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 44 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 80 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 80 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 125 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 125 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 180 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 180 * NPTS_LOCAL + p_inner), tx);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 17 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 17 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 45 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 45 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 81 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 81 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 126 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 126 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 181 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 181 * NPTS_LOCAL + p_inner), tx);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 18 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 18 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 46 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 46 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 82 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 82 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 127 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 127 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 182 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 182 * NPTS_LOCAL + p_inner), tx);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t10);
+            t20 = SIMD_FNMA(Z_PC, t11, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t11);
+            t21 = SIMD_FNMA(Z_PC, t12, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t12);
+            t22 = SIMD_FNMA(Z_PC, t13, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t13);
+            t23 = SIMD_FNMA(Z_PC, t14, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t14);
+            t24 = SIMD_FNMA(Z_PC, t15, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t15);
+            t25 = SIMD_FNMA(Z_PC, t16, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t16);
+            t26 = SIMD_FNMA(Z_PC, t17, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t17);
+            t27 = SIMD_FNMA(Z_PC, t18, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 19 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 19 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 47 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 47 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 83 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 83 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 128 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 128 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 183 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 183 * NPTS_LOCAL + p_inner), tx);
+            t10 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t00);
+            t10 = SIMD_FNMA(Z_PC, t01, t10);
+            t11 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t01);
+            t11 = SIMD_FNMA(Z_PC, t02, t11);
+            t12 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t02);
+            t12 = SIMD_FNMA(Z_PC, t03, t12);
+            t13 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t03);
+            t13 = SIMD_FNMA(Z_PC, t04, t13);
+            t14 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t04);
+            t14 = SIMD_FNMA(Z_PC, t05, t14);
+            t15 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t05);
+            t15 = SIMD_FNMA(Z_PC, t06, t15);
+            t16 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t06);
+            t16 = SIMD_FNMA(Z_PC, t07, t16);
+            t17 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t07);
+            t17 = SIMD_FNMA(Z_PC, t08, t17);
+            t18 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t08);
+            t18 = SIMD_FNMA(Z_PC, t09, t18);
+            t20 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t10);
+            t20 = SIMD_FNMA(Z_PC, t11, t20);
+            tx = SIMD_SUB(t00, t01);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t20 = SIMD_FMA(tx, ty, t20);
+            t21 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t11);
+            t21 = SIMD_FNMA(Z_PC, t12, t21);
+            tx = SIMD_SUB(t01, t02);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t21 = SIMD_FMA(tx, ty, t21);
+            t22 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t12);
+            t22 = SIMD_FNMA(Z_PC, t13, t22);
+            tx = SIMD_SUB(t02, t03);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t22 = SIMD_FMA(tx, ty, t22);
+            t23 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t13);
+            t23 = SIMD_FNMA(Z_PC, t14, t23);
+            tx = SIMD_SUB(t03, t04);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t23 = SIMD_FMA(tx, ty, t23);
+            t24 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t14);
+            t24 = SIMD_FNMA(Z_PC, t15, t24);
+            tx = SIMD_SUB(t04, t05);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t24 = SIMD_FMA(tx, ty, t24);
+            t25 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t15);
+            t25 = SIMD_FNMA(Z_PC, t16, t25);
+            tx = SIMD_SUB(t05, t06);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t25 = SIMD_FMA(tx, ty, t25);
+            t26 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t16);
+            t26 = SIMD_FNMA(Z_PC, t17, t26);
+            tx = SIMD_SUB(t06, t07);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t26 = SIMD_FMA(tx, ty, t26);
+            t27 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t17);
+            t27 = SIMD_FNMA(Z_PC, t18, t27);
+            tx = SIMD_SUB(t07, t08);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t27 = SIMD_FMA(tx, ty, t27);
+            t30 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t20);
+            t30 = SIMD_FNMA(Z_PC, t21, t30);
+            tx = SIMD_SUB(t10, t11);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t30 = SIMD_FMA(tx, ty, t30);
+            t31 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t21);
+            t31 = SIMD_FNMA(Z_PC, t22, t31);
+            tx = SIMD_SUB(t11, t12);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t31 = SIMD_FMA(tx, ty, t31);
+            t32 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t22);
+            t32 = SIMD_FNMA(Z_PC, t23, t32);
+            tx = SIMD_SUB(t12, t13);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t32 = SIMD_FMA(tx, ty, t32);
+            t33 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t23);
+            t33 = SIMD_FNMA(Z_PC, t24, t33);
+            tx = SIMD_SUB(t13, t14);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t33 = SIMD_FMA(tx, ty, t33);
+            t34 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t24);
+            t34 = SIMD_FNMA(Z_PC, t25, t34);
+            tx = SIMD_SUB(t14, t15);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t34 = SIMD_FMA(tx, ty, t34);
+            t35 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t25);
+            t35 = SIMD_FNMA(Z_PC, t26, t35);
+            tx = SIMD_SUB(t15, t16);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t35 = SIMD_FMA(tx, ty, t35);
+            t36 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t26);
+            t36 = SIMD_FNMA(Z_PC, t27, t36);
+            tx = SIMD_SUB(t16, t17);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t36 = SIMD_FMA(tx, ty, t36);
+            t40 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t30);
+            t40 = SIMD_FNMA(Z_PC, t31, t40);
+            tx = SIMD_SUB(t20, t21);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t40 = SIMD_FMA(tx, ty, t40);
+            t41 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t31);
+            t41 = SIMD_FNMA(Z_PC, t32, t41);
+            tx = SIMD_SUB(t21, t22);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t41 = SIMD_FMA(tx, ty, t41);
+            t42 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t32);
+            t42 = SIMD_FNMA(Z_PC, t33, t42);
+            tx = SIMD_SUB(t22, t23);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t42 = SIMD_FMA(tx, ty, t42);
+            t43 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t33);
+            t43 = SIMD_FNMA(Z_PC, t34, t43);
+            tx = SIMD_SUB(t23, t24);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t43 = SIMD_FMA(tx, ty, t43);
+            t44 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t34);
+            t44 = SIMD_FNMA(Z_PC, t35, t44);
+            tx = SIMD_SUB(t24, t25);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t44 = SIMD_FMA(tx, ty, t44);
+            t45 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t35);
+            t45 = SIMD_FNMA(Z_PC, t36, t45);
+            tx = SIMD_SUB(t25, t26);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t45 = SIMD_FMA(tx, ty, t45);
+            t50 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t40);
+            t50 = SIMD_FNMA(Z_PC, t41, t50);
+            tx = SIMD_SUB(t30, t31);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t50 = SIMD_FMA(tx, ty, t50);
+            t51 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t41);
+            t51 = SIMD_FNMA(Z_PC, t42, t51);
+            tx = SIMD_SUB(t31, t32);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t51 = SIMD_FMA(tx, ty, t51);
+            t52 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t42);
+            t52 = SIMD_FNMA(Z_PC, t43, t52);
+            tx = SIMD_SUB(t32, t33);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t52 = SIMD_FMA(tx, ty, t52);
+            t53 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t43);
+            t53 = SIMD_FNMA(Z_PC, t44, t53);
+            tx = SIMD_SUB(t33, t34);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t53 = SIMD_FMA(tx, ty, t53);
+            t54 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t44);
+            t54 = SIMD_FNMA(Z_PC, t45, t54);
+            tx = SIMD_SUB(t34, t35);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t54 = SIMD_FMA(tx, ty, t54);
+            tx = SIMD_ALIGNED_LOAD((temp + 20 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t50);
+            SIMD_ALIGNED_STORE((temp + 20 * NPTS_LOCAL + p_inner), tx);
+            t60 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t50);
+            t60 = SIMD_FNMA(Z_PC, t51, t60);
+            tx = SIMD_SUB(t40, t41);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t60 = SIMD_FMA(tx, ty, t60);
+            t61 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t51);
+            t61 = SIMD_FNMA(Z_PC, t52, t61);
+            tx = SIMD_SUB(t41, t42);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t61 = SIMD_FMA(tx, ty, t61);
+            t62 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t52);
+            t62 = SIMD_FNMA(Z_PC, t53, t62);
+            tx = SIMD_SUB(t42, t43);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t62 = SIMD_FMA(tx, ty, t62);
+            t63 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t53);
+            t63 = SIMD_FNMA(Z_PC, t54, t63);
+            tx = SIMD_SUB(t43, t44);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t63 = SIMD_FMA(tx, ty, t63);
+            tx = SIMD_ALIGNED_LOAD((temp + 48 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t60);
+            SIMD_ALIGNED_STORE((temp + 48 * NPTS_LOCAL + p_inner), tx);
+            t70 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t60);
+            t70 = SIMD_FNMA(Z_PC, t61, t70);
+            tx = SIMD_SUB(t50, t51);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t70 = SIMD_FMA(tx, ty, t70);
+            t71 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t61);
+            t71 = SIMD_FNMA(Z_PC, t62, t71);
+            tx = SIMD_SUB(t51, t52);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t71 = SIMD_FMA(tx, ty, t71);
+            t72 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t62);
+            t72 = SIMD_FNMA(Z_PC, t63, t72);
+            tx = SIMD_SUB(t52, t53);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t72 = SIMD_FMA(tx, ty, t72);
+            tx = SIMD_ALIGNED_LOAD((temp + 84 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t70);
+            SIMD_ALIGNED_STORE((temp + 84 * NPTS_LOCAL + p_inner), tx);
+            t80 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t70);
+            t80 = SIMD_FNMA(Z_PC, t71, t80);
+            tx = SIMD_SUB(t60, t61);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t80 = SIMD_FMA(tx, ty, t80);
+            t81 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t71);
+            t81 = SIMD_FNMA(Z_PC, t72, t81);
+            tx = SIMD_SUB(t61, t62);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t81 = SIMD_FMA(tx, ty, t81);
+            tx = SIMD_ALIGNED_LOAD((temp + 129 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t80);
+            SIMD_ALIGNED_STORE((temp + 129 * NPTS_LOCAL + p_inner), tx);
+            t90 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t80);
+            t90 = SIMD_FNMA(Z_PC, t81, t90);
+            tx = SIMD_SUB(t70, t71);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t90 = SIMD_FMA(tx, ty, t90);
+            tx = SIMD_ALIGNED_LOAD((temp + 184 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t90);
+            SIMD_ALIGNED_STORE((temp + 184 * NPTS_LOCAL + p_inner), tx);
+         }
+
+         for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
+            SCALAR_TYPE xC = SCALAR_LOAD((_point_outer + p_inner + 0 * npts));
+            SCALAR_TYPE yC = SCALAR_LOAD((_point_outer + p_inner + 1 * npts));
+            SCALAR_TYPE zC = SCALAR_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SCALAR_TYPE X_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(xP)), xC);
+            SCALAR_TYPE Y_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(yP)), yC);
+            SCALAR_TYPE Z_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(zP)), zC);
+
+            SCALAR_TYPE tval, tval_inv_e, tx, ty, t00, t01, t02, t03, t04, t05, t06, t07, t08, t09, t10, t11, t12, t13, t14, t15, t16, t17, t18, t20, t21, t22, t23, t24, t25, t26, t27, t30, t31, t32, t33, t34, t35, t36, t40, t41, t42, t43, t44, t45, t50, t51, t52, t53, t54, t60, t61, t62, t63, t70, t71, t72, t80, t81, t90;
+
+            tval = SCALAR_LOAD((Tval + p_inner));
+            tval_inv_e = SCALAR_LOAD((Tval_inv_e + p_inner));
+
+            t09 = SCALAR_LOAD((FmT + p_inner));
+            t08 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t09), tval_inv_e), SCALAR_SET1(0.11764705882352941013));
+            t07 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t08), tval_inv_e), SCALAR_SET1(0.13333333333333333148));
+            t06 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t07), tval_inv_e), SCALAR_SET1(0.15384615384615385469));
+            t05 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t06), tval_inv_e), SCALAR_SET1(0.18181818181818182323));
+            t04 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t05), tval_inv_e), SCALAR_SET1(0.22222222222222220989));
+            t03 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t04), tval_inv_e), SCALAR_SET1(0.28571428571428569843));
+            t02 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t03), tval_inv_e), SCALAR_SET1(0.40000000000000002220));
+            t01 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t02), tval_inv_e), SCALAR_SET1(0.66666666666666662966));
+            t00 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t01), tval_inv_e), SCALAR_SET1(2.00000000000000000000));
+
+            t00 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t00);
+            t01 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t01);
+            t02 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t02);
+            t03 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t03);
+            t04 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t04);
+            t05 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t05);
+            t06 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t06);
+            t07 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t07);
+            t08 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t08);
+            t09 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t09);
+            t10 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t00);
+            t10 = SCALAR_FNMA(X_PC, t01, t10);
+            t11 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t01);
+            t11 = SCALAR_FNMA(X_PC, t02, t11);
+            t12 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t02);
+            t12 = SCALAR_FNMA(X_PC, t03, t12);
+            t13 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t03);
+            t13 = SCALAR_FNMA(X_PC, t04, t13);
+            t14 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t04);
+            t14 = SCALAR_FNMA(X_PC, t05, t14);
+            t15 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t05);
+            t15 = SCALAR_FNMA(X_PC, t06, t15);
+            t16 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t06);
+            t16 = SCALAR_FNMA(X_PC, t07, t16);
+            t17 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t07);
+            t17 = SCALAR_FNMA(X_PC, t08, t17);
+            t18 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t08);
+            t18 = SCALAR_FNMA(X_PC, t09, t18);
+            t20 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t10);
+            t20 = SCALAR_FNMA(X_PC, t11, t20);
+            tx = SCALAR_SUB(t00, t01);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t20 = SCALAR_FMA(tx, ty, t20);
+            t21 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t11);
+            t21 = SCALAR_FNMA(X_PC, t12, t21);
+            tx = SCALAR_SUB(t01, t02);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t21 = SCALAR_FMA(tx, ty, t21);
+            t22 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t12);
+            t22 = SCALAR_FNMA(X_PC, t13, t22);
+            tx = SCALAR_SUB(t02, t03);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t22 = SCALAR_FMA(tx, ty, t22);
+            t23 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t13);
+            t23 = SCALAR_FNMA(X_PC, t14, t23);
+            tx = SCALAR_SUB(t03, t04);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t23 = SCALAR_FMA(tx, ty, t23);
+            t24 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t14);
+            t24 = SCALAR_FNMA(X_PC, t15, t24);
+            tx = SCALAR_SUB(t04, t05);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t24 = SCALAR_FMA(tx, ty, t24);
+            t25 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t15);
+            t25 = SCALAR_FNMA(X_PC, t16, t25);
+            tx = SCALAR_SUB(t05, t06);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t25 = SCALAR_FMA(tx, ty, t25);
+            t26 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t16);
+            t26 = SCALAR_FNMA(X_PC, t17, t26);
+            tx = SCALAR_SUB(t06, t07);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t26 = SCALAR_FMA(tx, ty, t26);
+            t27 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t17);
+            t27 = SCALAR_FNMA(X_PC, t18, t27);
+            tx = SCALAR_SUB(t07, t08);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t27 = SCALAR_FMA(tx, ty, t27);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t20);
+            t30 = SCALAR_FNMA(X_PC, t21, t30);
+            tx = SCALAR_SUB(t10, t11);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t30 = SCALAR_FMA(tx, ty, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t21);
+            t31 = SCALAR_FNMA(X_PC, t22, t31);
+            tx = SCALAR_SUB(t11, t12);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t31 = SCALAR_FMA(tx, ty, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t22);
+            t32 = SCALAR_FNMA(X_PC, t23, t32);
+            tx = SCALAR_SUB(t12, t13);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t32 = SCALAR_FMA(tx, ty, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t23);
+            t33 = SCALAR_FNMA(X_PC, t24, t33);
+            tx = SCALAR_SUB(t13, t14);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t33 = SCALAR_FMA(tx, ty, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t24);
+            t34 = SCALAR_FNMA(X_PC, t25, t34);
+            tx = SCALAR_SUB(t14, t15);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t34 = SCALAR_FMA(tx, ty, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t25);
+            t35 = SCALAR_FNMA(X_PC, t26, t35);
+            tx = SCALAR_SUB(t15, t16);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t35 = SCALAR_FMA(tx, ty, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t26);
+            t36 = SCALAR_FNMA(X_PC, t27, t36);
+            tx = SCALAR_SUB(t16, t17);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t36 = SCALAR_FMA(tx, ty, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t30);
+            t40 = SCALAR_FNMA(X_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t31);
+            t41 = SCALAR_FNMA(X_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t32);
+            t42 = SCALAR_FNMA(X_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t33);
+            t43 = SCALAR_FNMA(X_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t34);
+            t44 = SCALAR_FNMA(X_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t35);
+            t45 = SCALAR_FNMA(X_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t40);
+            t50 = SCALAR_FNMA(X_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t41);
+            t51 = SCALAR_FNMA(X_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t42);
+            t52 = SCALAR_FNMA(X_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t43);
+            t53 = SCALAR_FNMA(X_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t44);
+            t54 = SCALAR_FNMA(X_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t50);
+            t60 = SCALAR_FNMA(X_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t51);
+            t61 = SCALAR_FNMA(X_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t52);
+            t62 = SCALAR_FNMA(X_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t53);
+            t63 = SCALAR_FNMA(X_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 21 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 21 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t60);
+            t70 = SCALAR_FNMA(X_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t61);
+            t71 = SCALAR_FNMA(X_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t62);
+            t72 = SCALAR_FNMA(X_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 49 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 49 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t70);
+            t80 = SCALAR_FNMA(X_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t71);
+            t81 = SCALAR_FNMA(X_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 85 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 85 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t80);
+            t90 = SCALAR_FNMA(X_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 130 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 130 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 131 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 131 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 132 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 132 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 86 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 86 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 133 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 133 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 134 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 134 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 87 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 87 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 135 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 135 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 50 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 50 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 88 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 88 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 136 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 136 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 137 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 137 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 89 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 89 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 138 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 138 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 51 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 51 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 90 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 90 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 139 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 139 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t50);
+            t60 = SCALAR_FNMA(Y_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t51);
+            t61 = SCALAR_FNMA(Y_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t52);
+            t62 = SCALAR_FNMA(Y_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t53);
+            t63 = SCALAR_FNMA(Y_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 22 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 22 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 52 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 52 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 91 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 91 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 140 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 140 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 141 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 141 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 92 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 92 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 142 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 142 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 53 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 53 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 93 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 93 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 143 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 143 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 23 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 23 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 54 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 54 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 94 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 94 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 144 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 144 * NPTS_LOCAL + p_inner), tx);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t40);
+            t50 = SCALAR_FNMA(Y_PC, t41, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t41);
+            t51 = SCALAR_FNMA(Y_PC, t42, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t42);
+            t52 = SCALAR_FNMA(Y_PC, t43, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t43);
+            t53 = SCALAR_FNMA(Y_PC, t44, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t44);
+            t54 = SCALAR_FNMA(Y_PC, t45, t54);
+            tx = SCALAR_LOAD((temp + 1 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 1 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t50);
+            t60 = SCALAR_FNMA(Y_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t51);
+            t61 = SCALAR_FNMA(Y_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t52);
+            t62 = SCALAR_FNMA(Y_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t53);
+            t63 = SCALAR_FNMA(Y_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 24 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 24 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 55 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 55 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 95 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 95 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 145 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 145 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 146 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 146 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 96 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 96 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 147 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 147 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 56 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 56 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 97 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 97 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 148 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 148 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 25 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 25 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 57 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 57 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 98 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 98 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 149 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 149 * NPTS_LOCAL + p_inner), tx);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_LOAD((temp + 2 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 2 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 26 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 26 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 58 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 58 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 99 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 99 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 150 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 150 * NPTS_LOCAL + p_inner), tx);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t30);
+            t40 = SCALAR_FNMA(Y_PC, t31, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t31);
+            t41 = SCALAR_FNMA(Y_PC, t32, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t32);
+            t42 = SCALAR_FNMA(Y_PC, t33, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t33);
+            t43 = SCALAR_FNMA(Y_PC, t34, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t34);
+            t44 = SCALAR_FNMA(Y_PC, t35, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t35);
+            t45 = SCALAR_FNMA(Y_PC, t36, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t40);
+            t50 = SCALAR_FNMA(Y_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t41);
+            t51 = SCALAR_FNMA(Y_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t42);
+            t52 = SCALAR_FNMA(Y_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t43);
+            t53 = SCALAR_FNMA(Y_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t44);
+            t54 = SCALAR_FNMA(Y_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 3 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 3 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t50);
+            t60 = SCALAR_FNMA(Y_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t51);
+            t61 = SCALAR_FNMA(Y_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t52);
+            t62 = SCALAR_FNMA(Y_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t53);
+            t63 = SCALAR_FNMA(Y_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 27 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 27 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 59 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 59 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 100 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 100 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 151 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 151 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 152 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 152 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 101 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 101 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 153 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 153 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 60 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 60 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 102 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 102 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 154 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 154 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 28 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 28 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 61 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 61 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 103 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 103 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 155 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 155 * NPTS_LOCAL + p_inner), tx);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_LOAD((temp + 4 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 4 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 29 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 29 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 62 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 62 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 104 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 104 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 156 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 156 * NPTS_LOCAL + p_inner), tx);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 5 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 5 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 30 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 30 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 63 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 63 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 105 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 105 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 157 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 157 * NPTS_LOCAL + p_inner), tx);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t20);
+            t30 = SCALAR_FNMA(Y_PC, t21, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t21);
+            t31 = SCALAR_FNMA(Y_PC, t22, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t22);
+            t32 = SCALAR_FNMA(Y_PC, t23, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t23);
+            t33 = SCALAR_FNMA(Y_PC, t24, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t24);
+            t34 = SCALAR_FNMA(Y_PC, t25, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t25);
+            t35 = SCALAR_FNMA(Y_PC, t26, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t26);
+            t36 = SCALAR_FNMA(Y_PC, t27, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t30);
+            t40 = SCALAR_FNMA(Y_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t31);
+            t41 = SCALAR_FNMA(Y_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t32);
+            t42 = SCALAR_FNMA(Y_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t33);
+            t43 = SCALAR_FNMA(Y_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t34);
+            t44 = SCALAR_FNMA(Y_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t35);
+            t45 = SCALAR_FNMA(Y_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t40);
+            t50 = SCALAR_FNMA(Y_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t41);
+            t51 = SCALAR_FNMA(Y_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t42);
+            t52 = SCALAR_FNMA(Y_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t43);
+            t53 = SCALAR_FNMA(Y_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t44);
+            t54 = SCALAR_FNMA(Y_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 6 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 6 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t50);
+            t60 = SCALAR_FNMA(Y_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t51);
+            t61 = SCALAR_FNMA(Y_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t52);
+            t62 = SCALAR_FNMA(Y_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t53);
+            t63 = SCALAR_FNMA(Y_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 31 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 31 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 64 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 64 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 106 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 106 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 158 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 158 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 159 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 159 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 107 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 107 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 160 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 160 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 65 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 65 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 108 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 108 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 161 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 161 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 32 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 32 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 66 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 66 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 109 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 109 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 162 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 162 * NPTS_LOCAL + p_inner), tx);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_LOAD((temp + 7 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 7 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 33 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 33 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 67 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 67 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 110 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 110 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 163 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 163 * NPTS_LOCAL + p_inner), tx);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 8 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 8 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 34 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 34 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 68 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 68 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 111 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 111 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 164 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 164 * NPTS_LOCAL + p_inner), tx);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t20);
+            t30 = SCALAR_FNMA(Z_PC, t21, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t21);
+            t31 = SCALAR_FNMA(Z_PC, t22, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t22);
+            t32 = SCALAR_FNMA(Z_PC, t23, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t23);
+            t33 = SCALAR_FNMA(Z_PC, t24, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t24);
+            t34 = SCALAR_FNMA(Z_PC, t25, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t25);
+            t35 = SCALAR_FNMA(Z_PC, t26, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t26);
+            t36 = SCALAR_FNMA(Z_PC, t27, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 9 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 9 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 35 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 35 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 69 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 69 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 112 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 112 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 165 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 165 * NPTS_LOCAL + p_inner), tx);
+            t20 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t10);
+            t20 = SCALAR_FNMA(Y_PC, t11, t20);
+            t21 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t11);
+            t21 = SCALAR_FNMA(Y_PC, t12, t21);
+            t22 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t12);
+            t22 = SCALAR_FNMA(Y_PC, t13, t22);
+            t23 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t13);
+            t23 = SCALAR_FNMA(Y_PC, t14, t23);
+            t24 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t14);
+            t24 = SCALAR_FNMA(Y_PC, t15, t24);
+            t25 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t15);
+            t25 = SCALAR_FNMA(Y_PC, t16, t25);
+            t26 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t16);
+            t26 = SCALAR_FNMA(Y_PC, t17, t26);
+            t27 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t17);
+            t27 = SCALAR_FNMA(Y_PC, t18, t27);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t20);
+            t30 = SCALAR_FNMA(Y_PC, t21, t30);
+            tx = SCALAR_SUB(t10, t11);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t30 = SCALAR_FMA(tx, ty, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t21);
+            t31 = SCALAR_FNMA(Y_PC, t22, t31);
+            tx = SCALAR_SUB(t11, t12);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t31 = SCALAR_FMA(tx, ty, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t22);
+            t32 = SCALAR_FNMA(Y_PC, t23, t32);
+            tx = SCALAR_SUB(t12, t13);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t32 = SCALAR_FMA(tx, ty, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t23);
+            t33 = SCALAR_FNMA(Y_PC, t24, t33);
+            tx = SCALAR_SUB(t13, t14);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t33 = SCALAR_FMA(tx, ty, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t24);
+            t34 = SCALAR_FNMA(Y_PC, t25, t34);
+            tx = SCALAR_SUB(t14, t15);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t34 = SCALAR_FMA(tx, ty, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t25);
+            t35 = SCALAR_FNMA(Y_PC, t26, t35);
+            tx = SCALAR_SUB(t15, t16);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t35 = SCALAR_FMA(tx, ty, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t26);
+            t36 = SCALAR_FNMA(Y_PC, t27, t36);
+            tx = SCALAR_SUB(t16, t17);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t36 = SCALAR_FMA(tx, ty, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t30);
+            t40 = SCALAR_FNMA(Y_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t31);
+            t41 = SCALAR_FNMA(Y_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t32);
+            t42 = SCALAR_FNMA(Y_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t33);
+            t43 = SCALAR_FNMA(Y_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t34);
+            t44 = SCALAR_FNMA(Y_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t35);
+            t45 = SCALAR_FNMA(Y_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t40);
+            t50 = SCALAR_FNMA(Y_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t41);
+            t51 = SCALAR_FNMA(Y_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t42);
+            t52 = SCALAR_FNMA(Y_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t43);
+            t53 = SCALAR_FNMA(Y_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t44);
+            t54 = SCALAR_FNMA(Y_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 10 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 10 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t50);
+            t60 = SCALAR_FNMA(Y_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t51);
+            t61 = SCALAR_FNMA(Y_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t52);
+            t62 = SCALAR_FNMA(Y_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t53);
+            t63 = SCALAR_FNMA(Y_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 36 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 36 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 70 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 70 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 113 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 113 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 166 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 166 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 167 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 167 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 114 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 114 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 168 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 168 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 71 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 71 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 115 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 115 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 169 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 169 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 37 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 37 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 72 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 72 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 116 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 116 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 170 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 170 * NPTS_LOCAL + p_inner), tx);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_LOAD((temp + 11 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 11 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 38 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 38 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 73 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 73 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 117 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 117 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 171 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 171 * NPTS_LOCAL + p_inner), tx);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 12 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 12 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 39 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 39 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 74 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 74 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 118 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 118 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 172 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 172 * NPTS_LOCAL + p_inner), tx);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t20);
+            t30 = SCALAR_FNMA(Z_PC, t21, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t21);
+            t31 = SCALAR_FNMA(Z_PC, t22, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t22);
+            t32 = SCALAR_FNMA(Z_PC, t23, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t23);
+            t33 = SCALAR_FNMA(Z_PC, t24, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t24);
+            t34 = SCALAR_FNMA(Z_PC, t25, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t25);
+            t35 = SCALAR_FNMA(Z_PC, t26, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t26);
+            t36 = SCALAR_FNMA(Z_PC, t27, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 13 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 13 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 40 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 40 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 75 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 75 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 119 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 119 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 173 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 173 * NPTS_LOCAL + p_inner), tx);
+            t20 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t10);
+            t20 = SCALAR_FNMA(Z_PC, t11, t20);
+            t21 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t11);
+            t21 = SCALAR_FNMA(Z_PC, t12, t21);
+            t22 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t12);
+            t22 = SCALAR_FNMA(Z_PC, t13, t22);
+            t23 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t13);
+            t23 = SCALAR_FNMA(Z_PC, t14, t23);
+            t24 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t14);
+            t24 = SCALAR_FNMA(Z_PC, t15, t24);
+            t25 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t15);
+            t25 = SCALAR_FNMA(Z_PC, t16, t25);
+            t26 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t16);
+            t26 = SCALAR_FNMA(Z_PC, t17, t26);
+            t27 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t17);
+            t27 = SCALAR_FNMA(Z_PC, t18, t27);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t20);
+            t30 = SCALAR_FNMA(Z_PC, t21, t30);
+            tx = SCALAR_SUB(t10, t11);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t30 = SCALAR_FMA(tx, ty, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t21);
+            t31 = SCALAR_FNMA(Z_PC, t22, t31);
+            tx = SCALAR_SUB(t11, t12);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t31 = SCALAR_FMA(tx, ty, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t22);
+            t32 = SCALAR_FNMA(Z_PC, t23, t32);
+            tx = SCALAR_SUB(t12, t13);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t32 = SCALAR_FMA(tx, ty, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t23);
+            t33 = SCALAR_FNMA(Z_PC, t24, t33);
+            tx = SCALAR_SUB(t13, t14);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t33 = SCALAR_FMA(tx, ty, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t24);
+            t34 = SCALAR_FNMA(Z_PC, t25, t34);
+            tx = SCALAR_SUB(t14, t15);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t34 = SCALAR_FMA(tx, ty, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t25);
+            t35 = SCALAR_FNMA(Z_PC, t26, t35);
+            tx = SCALAR_SUB(t15, t16);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t35 = SCALAR_FMA(tx, ty, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t26);
+            t36 = SCALAR_FNMA(Z_PC, t27, t36);
+            tx = SCALAR_SUB(t16, t17);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t36 = SCALAR_FMA(tx, ty, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 14 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 14 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 41 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 41 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 76 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 76 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 120 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 120 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 174 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 174 * NPTS_LOCAL + p_inner), tx);
+            t10 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t00);
+            t10 = SCALAR_FNMA(Y_PC, t01, t10);
+            t11 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t01);
+            t11 = SCALAR_FNMA(Y_PC, t02, t11);
+            t12 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t02);
+            t12 = SCALAR_FNMA(Y_PC, t03, t12);
+            t13 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t03);
+            t13 = SCALAR_FNMA(Y_PC, t04, t13);
+            t14 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t04);
+            t14 = SCALAR_FNMA(Y_PC, t05, t14);
+            t15 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t05);
+            t15 = SCALAR_FNMA(Y_PC, t06, t15);
+            t16 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t06);
+            t16 = SCALAR_FNMA(Y_PC, t07, t16);
+            t17 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t07);
+            t17 = SCALAR_FNMA(Y_PC, t08, t17);
+            t18 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t08);
+            t18 = SCALAR_FNMA(Y_PC, t09, t18);
+            t20 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t10);
+            t20 = SCALAR_FNMA(Y_PC, t11, t20);
+            tx = SCALAR_SUB(t00, t01);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t20 = SCALAR_FMA(tx, ty, t20);
+            t21 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t11);
+            t21 = SCALAR_FNMA(Y_PC, t12, t21);
+            tx = SCALAR_SUB(t01, t02);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t21 = SCALAR_FMA(tx, ty, t21);
+            t22 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t12);
+            t22 = SCALAR_FNMA(Y_PC, t13, t22);
+            tx = SCALAR_SUB(t02, t03);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t22 = SCALAR_FMA(tx, ty, t22);
+            t23 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t13);
+            t23 = SCALAR_FNMA(Y_PC, t14, t23);
+            tx = SCALAR_SUB(t03, t04);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t23 = SCALAR_FMA(tx, ty, t23);
+            t24 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t14);
+            t24 = SCALAR_FNMA(Y_PC, t15, t24);
+            tx = SCALAR_SUB(t04, t05);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t24 = SCALAR_FMA(tx, ty, t24);
+            t25 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t15);
+            t25 = SCALAR_FNMA(Y_PC, t16, t25);
+            tx = SCALAR_SUB(t05, t06);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t25 = SCALAR_FMA(tx, ty, t25);
+            t26 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t16);
+            t26 = SCALAR_FNMA(Y_PC, t17, t26);
+            tx = SCALAR_SUB(t06, t07);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t26 = SCALAR_FMA(tx, ty, t26);
+            t27 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t17);
+            t27 = SCALAR_FNMA(Y_PC, t18, t27);
+            tx = SCALAR_SUB(t07, t08);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t27 = SCALAR_FMA(tx, ty, t27);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t20);
+            t30 = SCALAR_FNMA(Y_PC, t21, t30);
+            tx = SCALAR_SUB(t10, t11);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t30 = SCALAR_FMA(tx, ty, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t21);
+            t31 = SCALAR_FNMA(Y_PC, t22, t31);
+            tx = SCALAR_SUB(t11, t12);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t31 = SCALAR_FMA(tx, ty, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t22);
+            t32 = SCALAR_FNMA(Y_PC, t23, t32);
+            tx = SCALAR_SUB(t12, t13);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t32 = SCALAR_FMA(tx, ty, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t23);
+            t33 = SCALAR_FNMA(Y_PC, t24, t33);
+            tx = SCALAR_SUB(t13, t14);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t33 = SCALAR_FMA(tx, ty, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t24);
+            t34 = SCALAR_FNMA(Y_PC, t25, t34);
+            tx = SCALAR_SUB(t14, t15);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t34 = SCALAR_FMA(tx, ty, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t25);
+            t35 = SCALAR_FNMA(Y_PC, t26, t35);
+            tx = SCALAR_SUB(t15, t16);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t35 = SCALAR_FMA(tx, ty, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t26);
+            t36 = SCALAR_FNMA(Y_PC, t27, t36);
+            tx = SCALAR_SUB(t16, t17);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t36 = SCALAR_FMA(tx, ty, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t30);
+            t40 = SCALAR_FNMA(Y_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t31);
+            t41 = SCALAR_FNMA(Y_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t32);
+            t42 = SCALAR_FNMA(Y_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t33);
+            t43 = SCALAR_FNMA(Y_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t34);
+            t44 = SCALAR_FNMA(Y_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t35);
+            t45 = SCALAR_FNMA(Y_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t40);
+            t50 = SCALAR_FNMA(Y_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t41);
+            t51 = SCALAR_FNMA(Y_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t42);
+            t52 = SCALAR_FNMA(Y_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t43);
+            t53 = SCALAR_FNMA(Y_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t44);
+            t54 = SCALAR_FNMA(Y_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 15 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 15 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t50);
+            t60 = SCALAR_FNMA(Y_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t51);
+            t61 = SCALAR_FNMA(Y_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t52);
+            t62 = SCALAR_FNMA(Y_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t53);
+            t63 = SCALAR_FNMA(Y_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 42 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 42 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t60);
+            t70 = SCALAR_FNMA(Y_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t61);
+            t71 = SCALAR_FNMA(Y_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t62);
+            t72 = SCALAR_FNMA(Y_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 77 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 77 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t70);
+            t80 = SCALAR_FNMA(Y_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t71);
+            t81 = SCALAR_FNMA(Y_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 121 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 121 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t80);
+            t90 = SCALAR_FNMA(Y_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 175 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 175 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_LOAD((temp + 176 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 176 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_LOAD((temp + 122 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 122 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 177 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 177 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_LOAD((temp + 78 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 78 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 123 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 123 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 178 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 178 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_LOAD((temp + 43 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 43 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 79 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 79 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 124 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 124 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 179 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 179 * NPTS_LOCAL + p_inner), tx);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 16 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 44 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 44 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 80 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 80 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 125 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 125 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 180 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 180 * NPTS_LOCAL + p_inner), tx);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 17 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 17 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 45 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 45 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 81 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 81 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 126 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 126 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 181 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 181 * NPTS_LOCAL + p_inner), tx);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t20);
+            t30 = SCALAR_FNMA(Z_PC, t21, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t21);
+            t31 = SCALAR_FNMA(Z_PC, t22, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t22);
+            t32 = SCALAR_FNMA(Z_PC, t23, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t23);
+            t33 = SCALAR_FNMA(Z_PC, t24, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t24);
+            t34 = SCALAR_FNMA(Z_PC, t25, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t25);
+            t35 = SCALAR_FNMA(Z_PC, t26, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t26);
+            t36 = SCALAR_FNMA(Z_PC, t27, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 18 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 18 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 46 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 46 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 82 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 82 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 127 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 127 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 182 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 182 * NPTS_LOCAL + p_inner), tx);
+            t20 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t10);
+            t20 = SCALAR_FNMA(Z_PC, t11, t20);
+            t21 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t11);
+            t21 = SCALAR_FNMA(Z_PC, t12, t21);
+            t22 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t12);
+            t22 = SCALAR_FNMA(Z_PC, t13, t22);
+            t23 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t13);
+            t23 = SCALAR_FNMA(Z_PC, t14, t23);
+            t24 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t14);
+            t24 = SCALAR_FNMA(Z_PC, t15, t24);
+            t25 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t15);
+            t25 = SCALAR_FNMA(Z_PC, t16, t25);
+            t26 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t16);
+            t26 = SCALAR_FNMA(Z_PC, t17, t26);
+            t27 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t17);
+            t27 = SCALAR_FNMA(Z_PC, t18, t27);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t20);
+            t30 = SCALAR_FNMA(Z_PC, t21, t30);
+            tx = SCALAR_SUB(t10, t11);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t30 = SCALAR_FMA(tx, ty, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t21);
+            t31 = SCALAR_FNMA(Z_PC, t22, t31);
+            tx = SCALAR_SUB(t11, t12);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t31 = SCALAR_FMA(tx, ty, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t22);
+            t32 = SCALAR_FNMA(Z_PC, t23, t32);
+            tx = SCALAR_SUB(t12, t13);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t32 = SCALAR_FMA(tx, ty, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t23);
+            t33 = SCALAR_FNMA(Z_PC, t24, t33);
+            tx = SCALAR_SUB(t13, t14);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t33 = SCALAR_FMA(tx, ty, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t24);
+            t34 = SCALAR_FNMA(Z_PC, t25, t34);
+            tx = SCALAR_SUB(t14, t15);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t34 = SCALAR_FMA(tx, ty, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t25);
+            t35 = SCALAR_FNMA(Z_PC, t26, t35);
+            tx = SCALAR_SUB(t15, t16);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t35 = SCALAR_FMA(tx, ty, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t26);
+            t36 = SCALAR_FNMA(Z_PC, t27, t36);
+            tx = SCALAR_SUB(t16, t17);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t36 = SCALAR_FMA(tx, ty, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 19 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 19 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 47 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 47 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 83 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 83 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 128 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 128 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 183 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 183 * NPTS_LOCAL + p_inner), tx);
+            t10 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t00);
+            t10 = SCALAR_FNMA(Z_PC, t01, t10);
+            t11 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t01);
+            t11 = SCALAR_FNMA(Z_PC, t02, t11);
+            t12 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t02);
+            t12 = SCALAR_FNMA(Z_PC, t03, t12);
+            t13 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t03);
+            t13 = SCALAR_FNMA(Z_PC, t04, t13);
+            t14 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t04);
+            t14 = SCALAR_FNMA(Z_PC, t05, t14);
+            t15 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t05);
+            t15 = SCALAR_FNMA(Z_PC, t06, t15);
+            t16 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t06);
+            t16 = SCALAR_FNMA(Z_PC, t07, t16);
+            t17 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t07);
+            t17 = SCALAR_FNMA(Z_PC, t08, t17);
+            t18 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t08);
+            t18 = SCALAR_FNMA(Z_PC, t09, t18);
+            t20 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t10);
+            t20 = SCALAR_FNMA(Z_PC, t11, t20);
+            tx = SCALAR_SUB(t00, t01);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t20 = SCALAR_FMA(tx, ty, t20);
+            t21 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t11);
+            t21 = SCALAR_FNMA(Z_PC, t12, t21);
+            tx = SCALAR_SUB(t01, t02);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t21 = SCALAR_FMA(tx, ty, t21);
+            t22 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t12);
+            t22 = SCALAR_FNMA(Z_PC, t13, t22);
+            tx = SCALAR_SUB(t02, t03);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t22 = SCALAR_FMA(tx, ty, t22);
+            t23 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t13);
+            t23 = SCALAR_FNMA(Z_PC, t14, t23);
+            tx = SCALAR_SUB(t03, t04);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t23 = SCALAR_FMA(tx, ty, t23);
+            t24 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t14);
+            t24 = SCALAR_FNMA(Z_PC, t15, t24);
+            tx = SCALAR_SUB(t04, t05);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t24 = SCALAR_FMA(tx, ty, t24);
+            t25 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t15);
+            t25 = SCALAR_FNMA(Z_PC, t16, t25);
+            tx = SCALAR_SUB(t05, t06);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t25 = SCALAR_FMA(tx, ty, t25);
+            t26 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t16);
+            t26 = SCALAR_FNMA(Z_PC, t17, t26);
+            tx = SCALAR_SUB(t06, t07);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t26 = SCALAR_FMA(tx, ty, t26);
+            t27 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t17);
+            t27 = SCALAR_FNMA(Z_PC, t18, t27);
+            tx = SCALAR_SUB(t07, t08);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t27 = SCALAR_FMA(tx, ty, t27);
+            t30 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t20);
+            t30 = SCALAR_FNMA(Z_PC, t21, t30);
+            tx = SCALAR_SUB(t10, t11);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t30 = SCALAR_FMA(tx, ty, t30);
+            t31 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t21);
+            t31 = SCALAR_FNMA(Z_PC, t22, t31);
+            tx = SCALAR_SUB(t11, t12);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t31 = SCALAR_FMA(tx, ty, t31);
+            t32 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t22);
+            t32 = SCALAR_FNMA(Z_PC, t23, t32);
+            tx = SCALAR_SUB(t12, t13);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t32 = SCALAR_FMA(tx, ty, t32);
+            t33 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t23);
+            t33 = SCALAR_FNMA(Z_PC, t24, t33);
+            tx = SCALAR_SUB(t13, t14);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t33 = SCALAR_FMA(tx, ty, t33);
+            t34 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t24);
+            t34 = SCALAR_FNMA(Z_PC, t25, t34);
+            tx = SCALAR_SUB(t14, t15);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t34 = SCALAR_FMA(tx, ty, t34);
+            t35 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t25);
+            t35 = SCALAR_FNMA(Z_PC, t26, t35);
+            tx = SCALAR_SUB(t15, t16);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t35 = SCALAR_FMA(tx, ty, t35);
+            t36 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t26);
+            t36 = SCALAR_FNMA(Z_PC, t27, t36);
+            tx = SCALAR_SUB(t16, t17);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t36 = SCALAR_FMA(tx, ty, t36);
+            t40 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t30);
+            t40 = SCALAR_FNMA(Z_PC, t31, t40);
+            tx = SCALAR_SUB(t20, t21);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t40 = SCALAR_FMA(tx, ty, t40);
+            t41 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t31);
+            t41 = SCALAR_FNMA(Z_PC, t32, t41);
+            tx = SCALAR_SUB(t21, t22);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t41 = SCALAR_FMA(tx, ty, t41);
+            t42 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t32);
+            t42 = SCALAR_FNMA(Z_PC, t33, t42);
+            tx = SCALAR_SUB(t22, t23);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t42 = SCALAR_FMA(tx, ty, t42);
+            t43 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t33);
+            t43 = SCALAR_FNMA(Z_PC, t34, t43);
+            tx = SCALAR_SUB(t23, t24);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t43 = SCALAR_FMA(tx, ty, t43);
+            t44 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t34);
+            t44 = SCALAR_FNMA(Z_PC, t35, t44);
+            tx = SCALAR_SUB(t24, t25);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t44 = SCALAR_FMA(tx, ty, t44);
+            t45 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t35);
+            t45 = SCALAR_FNMA(Z_PC, t36, t45);
+            tx = SCALAR_SUB(t25, t26);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t45 = SCALAR_FMA(tx, ty, t45);
+            t50 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t40);
+            t50 = SCALAR_FNMA(Z_PC, t41, t50);
+            tx = SCALAR_SUB(t30, t31);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t50 = SCALAR_FMA(tx, ty, t50);
+            t51 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t41);
+            t51 = SCALAR_FNMA(Z_PC, t42, t51);
+            tx = SCALAR_SUB(t31, t32);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t51 = SCALAR_FMA(tx, ty, t51);
+            t52 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t42);
+            t52 = SCALAR_FNMA(Z_PC, t43, t52);
+            tx = SCALAR_SUB(t32, t33);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t52 = SCALAR_FMA(tx, ty, t52);
+            t53 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t43);
+            t53 = SCALAR_FNMA(Z_PC, t44, t53);
+            tx = SCALAR_SUB(t33, t34);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t53 = SCALAR_FMA(tx, ty, t53);
+            t54 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t44);
+            t54 = SCALAR_FNMA(Z_PC, t45, t54);
+            tx = SCALAR_SUB(t34, t35);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t54 = SCALAR_FMA(tx, ty, t54);
+            tx = SCALAR_LOAD((temp + 20 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t50);
+            SCALAR_STORE((temp + 20 * NPTS_LOCAL + p_inner), tx);
+            t60 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t50);
+            t60 = SCALAR_FNMA(Z_PC, t51, t60);
+            tx = SCALAR_SUB(t40, t41);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t60 = SCALAR_FMA(tx, ty, t60);
+            t61 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t51);
+            t61 = SCALAR_FNMA(Z_PC, t52, t61);
+            tx = SCALAR_SUB(t41, t42);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t61 = SCALAR_FMA(tx, ty, t61);
+            t62 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t52);
+            t62 = SCALAR_FNMA(Z_PC, t53, t62);
+            tx = SCALAR_SUB(t42, t43);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t62 = SCALAR_FMA(tx, ty, t62);
+            t63 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t53);
+            t63 = SCALAR_FNMA(Z_PC, t54, t63);
+            tx = SCALAR_SUB(t43, t44);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t63 = SCALAR_FMA(tx, ty, t63);
+            tx = SCALAR_LOAD((temp + 48 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t60);
+            SCALAR_STORE((temp + 48 * NPTS_LOCAL + p_inner), tx);
+            t70 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t60);
+            t70 = SCALAR_FNMA(Z_PC, t61, t70);
+            tx = SCALAR_SUB(t50, t51);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t70 = SCALAR_FMA(tx, ty, t70);
+            t71 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t61);
+            t71 = SCALAR_FNMA(Z_PC, t62, t71);
+            tx = SCALAR_SUB(t51, t52);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t71 = SCALAR_FMA(tx, ty, t71);
+            t72 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t62);
+            t72 = SCALAR_FNMA(Z_PC, t63, t72);
+            tx = SCALAR_SUB(t52, t53);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t72 = SCALAR_FMA(tx, ty, t72);
+            tx = SCALAR_LOAD((temp + 84 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t70);
+            SCALAR_STORE((temp + 84 * NPTS_LOCAL + p_inner), tx);
+            t80 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t70);
+            t80 = SCALAR_FNMA(Z_PC, t71, t80);
+            tx = SCALAR_SUB(t60, t61);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t80 = SCALAR_FMA(tx, ty, t80);
+            t81 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t71);
+            t81 = SCALAR_FNMA(Z_PC, t72, t81);
+            tx = SCALAR_SUB(t61, t62);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t81 = SCALAR_FMA(tx, ty, t81);
+            tx = SCALAR_LOAD((temp + 129 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t80);
+            SCALAR_STORE((temp + 129 * NPTS_LOCAL + p_inner), tx);
+            t90 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t80);
+            t90 = SCALAR_FNMA(Z_PC, t81, t90);
+            tx = SCALAR_SUB(t70, t71);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t90 = SCALAR_FMA(tx, ty, t90);
+            tx = SCALAR_LOAD((temp + 184 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t90);
+            SCALAR_STORE((temp + 184 * NPTS_LOCAL + p_inner), tx);
+         }
+      }
+
+      size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
+      size_t p_inner = 0;
+      for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
+         double *Xik = (Xi + p_outer + p_inner);
+         double *Xjk = (Xj + p_outer + p_inner);
+         double *Gik = (Gi + p_outer + p_inner);
+         double *Gjk = (Gj + p_outer + p_inner);
+
+         SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
+
+         for(int c0 = 0; c0 <= 4; ++c0) {
+            for(int c1 = 0; c1 <= c0; ++c1) {
+               int m = 4 - c0;
+               int n = c0 - c1;
+               int p = c1;
+
+               int idxB = (((4 - m) * (4 - m + 1)) >> 1) + p;
+
+               double X_ABp = 1.0, comb_m_i = 1.0;
+               for(int i = 0; i <= m; ++i) {
+                  double rcp_i;
+
+                  double Y_ABp = 1.0, comb_n_j = 1.0;
+                  for(int j = 0; j <= n; ++j) {
+                     double rcp_j;
+
+                     double Z_ABp = 1.0, comb_p_k = 1.0;
+                     for(int k = 0; k <= p; ++k) {
+                        double rcp_k;
+                        int mv, pv, Lv = 9 - i - j - k;
+
+                        int offset = (Lv * (Lv + 1) * (Lv + 2) - 210) / 6;
+                        double const_value = comb_m_i * comb_n_j * comb_p_k * X_ABp * Y_ABp * Z_ABp;
+                        SIMD_TYPE tx, ty, tz, tw;
+                        SIMD_TYPE const_value_w = SIMD_MUL(const_value_v, SIMD_DUPLICATE(&(const_value)));
+
+                        mv = 5 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 0 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 0 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t0 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t0 = SIMD_MUL(t0, const_value_w);
+                        tz = SIMD_FMA(ty, t0, tz);
+                        tw = SIMD_FMA(tx, t0, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 0 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 1 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 1 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t1 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t1 = SIMD_MUL(t1, const_value_w);
+                        tz = SIMD_FMA(ty, t1, tz);
+                        tw = SIMD_FMA(tx, t1, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 1 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 2 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 2 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t2 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t2 = SIMD_MUL(t2, const_value_w);
+                        tz = SIMD_FMA(ty, t2, tz);
+                        tw = SIMD_FMA(tx, t2, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 2 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 3 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 3 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t3 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t3 = SIMD_MUL(t3, const_value_w);
+                        tz = SIMD_FMA(ty, t3, tz);
+                        tw = SIMD_FMA(tx, t3, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 3 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 4 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 4 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t4 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t4 = SIMD_MUL(t4, const_value_w);
+                        tz = SIMD_FMA(ty, t4, tz);
+                        tw = SIMD_FMA(tx, t4, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 4 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 5 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 5 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t5 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t5 = SIMD_MUL(t5, const_value_w);
+                        tz = SIMD_FMA(ty, t5, tz);
+                        tw = SIMD_FMA(tx, t5, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 5 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 6 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 6 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t6 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t6 = SIMD_MUL(t6, const_value_w);
+                        tz = SIMD_FMA(ty, t6, tz);
+                        tw = SIMD_FMA(tx, t6, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 6 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 7 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 7 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t7 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t7 = SIMD_MUL(t7, const_value_w);
+                        tz = SIMD_FMA(ty, t7, tz);
+                        tw = SIMD_FMA(tx, t7, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 7 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 8 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 8 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t8 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t8 = SIMD_MUL(t8, const_value_w);
+                        tz = SIMD_FMA(ty, t8, tz);
+                        tw = SIMD_FMA(tx, t8, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 8 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 9 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 9 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t9 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t9 = SIMD_MUL(t9, const_value_w);
+                        tz = SIMD_FMA(ty, t9, tz);
+                        tw = SIMD_FMA(tx, t9, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 9 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 10 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 10 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t10 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t10 = SIMD_MUL(t10, const_value_w);
+                        tz = SIMD_FMA(ty, t10, tz);
+                        tw = SIMD_FMA(tx, t10, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 10 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 11 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 11 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t11 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t11 = SIMD_MUL(t11, const_value_w);
+                        tz = SIMD_FMA(ty, t11, tz);
+                        tw = SIMD_FMA(tx, t11, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 11 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 12 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 12 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t12 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t12 = SIMD_MUL(t12, const_value_w);
+                        tz = SIMD_FMA(ty, t12, tz);
+                        tw = SIMD_FMA(tx, t12, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 12 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 13 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 13 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t13 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t13 = SIMD_MUL(t13, const_value_w);
+                        tz = SIMD_FMA(ty, t13, tz);
+                        tw = SIMD_FMA(tx, t13, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 13 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 14 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 14 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t14 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t14 = SIMD_MUL(t14, const_value_w);
+                        tz = SIMD_FMA(ty, t14, tz);
+                        tw = SIMD_FMA(tx, t14, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 14 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 15 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 15 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t15 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t15 = SIMD_MUL(t15, const_value_w);
+                        tz = SIMD_FMA(ty, t15, tz);
+                        tw = SIMD_FMA(tx, t15, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 15 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 16 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 16 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t16 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t16 = SIMD_MUL(t16, const_value_w);
+                        tz = SIMD_FMA(ty, t16, tz);
+                        tw = SIMD_FMA(tx, t16, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 16 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 17 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 17 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t17 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t17 = SIMD_MUL(t17, const_value_w);
+                        tz = SIMD_FMA(ty, t17, tz);
+                        tw = SIMD_FMA(tx, t17, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 17 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 18 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 18 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t18 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t18 = SIMD_MUL(t18, const_value_w);
+                        tz = SIMD_FMA(ty, t18, tz);
+                        tw = SIMD_FMA(tx, t18, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 18 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 19 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 19 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t19 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t19 = SIMD_MUL(t19, const_value_w);
+                        tz = SIMD_FMA(ty, t19, tz);
+                        tw = SIMD_FMA(tx, t19, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 19 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 5 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 20 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 20 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t20 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t20 = SIMD_MUL(t20, const_value_w);
+                        tz = SIMD_FMA(ty, t20, tz);
+                        tw = SIMD_FMA(tx, t20, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 20 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+
+                        Z_ABp = SCALAR_MUL(Z_ABp, Z_AB);
+                        rcp_k = SCALAR_RECIPROCAL(k + 1);
+                        comb_p_k = SCALAR_MUL(comb_p_k, p - k);
+                        comb_p_k = SCALAR_MUL(comb_p_k, rcp_k);
+                     }
+
+                     Y_ABp = SCALAR_MUL(Y_ABp, Y_AB);
+                     rcp_j = SCALAR_RECIPROCAL(j + 1);
+                     comb_n_j = SCALAR_MUL(comb_n_j, n - j);
+                     comb_n_j = SCALAR_MUL(comb_n_j, rcp_j);
+                  }
+
+                  X_ABp = SCALAR_MUL(X_ABp, X_AB);
+                  rcp_i = SCALAR_RECIPROCAL(i + 1);
+                  comb_m_i = SCALAR_MUL(comb_m_i, m - i);
+                  comb_m_i = SCALAR_MUL(comb_m_i, rcp_i);
+               }
+            }
+         }
+      }
+
+      for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
+         double *Xik = (Xi + p_outer + p_inner);
+         double *Xjk = (Xj + p_outer + p_inner);
+         double *Gik = (Gi + p_outer + p_inner);
+         double *Gjk = (Gj + p_outer + p_inner);
+
+         SCALAR_TYPE const_value_v = SCALAR_LOAD((weights + p_outer + p_inner));
+
+         for(int c0 = 0; c0 <= 4; ++c0) {
+            for(int c1 = 0; c1 <= c0; ++c1) {
+               int m = 4 - c0;
+               int n = c0 - c1;
+               int p = c1;
+
+               int idxB = (((4 - m) * (4 - m + 1)) >> 1) + p;
+
+               double X_ABp = 1.0, comb_m_i = 1.0;
+               for(int i = 0; i <= m; ++i) {
+                  double rcp_i;
+
+                  double Y_ABp = 1.0, comb_n_j = 1.0;
+                  for(int j = 0; j <= n; ++j) {
+                     double rcp_j;
+
+                     double Z_ABp = 1.0, comb_p_k = 1.0;
+                     for(int k = 0; k <= p; ++k) {
+                        double rcp_k;
+                        int mv, pv, Lv = 9 - i - j - k;
+
+                        int offset = (Lv * (Lv + 1) * (Lv + 2) - 210) / 6;
+                        double const_value = comb_m_i * comb_n_j * comb_p_k * X_ABp * Y_ABp * Z_ABp;
+                        SCALAR_TYPE tx, ty, tz, tw;
+                        SCALAR_TYPE const_value_w = SCALAR_MUL(const_value_v, SCALAR_DUPLICATE(&(const_value)));
+
+                        mv = 5 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 0 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 0 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t0 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t0 = SCALAR_MUL(t0, const_value_w);
+                        tz = SCALAR_FMA(ty, t0, tz);
+                        tw = SCALAR_FMA(tx, t0, tw);
+                        SCALAR_STORE((Gik + 0 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 1 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 1 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t1 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t1 = SCALAR_MUL(t1, const_value_w);
+                        tz = SCALAR_FMA(ty, t1, tz);
+                        tw = SCALAR_FMA(tx, t1, tw);
+                        SCALAR_STORE((Gik + 1 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 2 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 2 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t2 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t2 = SCALAR_MUL(t2, const_value_w);
+                        tz = SCALAR_FMA(ty, t2, tz);
+                        tw = SCALAR_FMA(tx, t2, tw);
+                        SCALAR_STORE((Gik + 2 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 3 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 3 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t3 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t3 = SCALAR_MUL(t3, const_value_w);
+                        tz = SCALAR_FMA(ty, t3, tz);
+                        tw = SCALAR_FMA(tx, t3, tw);
+                        SCALAR_STORE((Gik + 3 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 4 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 4 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t4 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t4 = SCALAR_MUL(t4, const_value_w);
+                        tz = SCALAR_FMA(ty, t4, tz);
+                        tw = SCALAR_FMA(tx, t4, tw);
+                        SCALAR_STORE((Gik + 4 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 5 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 5 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t5 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t5 = SCALAR_MUL(t5, const_value_w);
+                        tz = SCALAR_FMA(ty, t5, tz);
+                        tw = SCALAR_FMA(tx, t5, tw);
+                        SCALAR_STORE((Gik + 5 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 6 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 6 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t6 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t6 = SCALAR_MUL(t6, const_value_w);
+                        tz = SCALAR_FMA(ty, t6, tz);
+                        tw = SCALAR_FMA(tx, t6, tw);
+                        SCALAR_STORE((Gik + 6 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 7 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 7 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t7 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t7 = SCALAR_MUL(t7, const_value_w);
+                        tz = SCALAR_FMA(ty, t7, tz);
+                        tw = SCALAR_FMA(tx, t7, tw);
+                        SCALAR_STORE((Gik + 7 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 8 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 8 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t8 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t8 = SCALAR_MUL(t8, const_value_w);
+                        tz = SCALAR_FMA(ty, t8, tz);
+                        tw = SCALAR_FMA(tx, t8, tw);
+                        SCALAR_STORE((Gik + 8 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 3 + p - k;
+                        tx = SCALAR_LOAD((Xik + 9 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 9 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t9 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t9 = SCALAR_MUL(t9, const_value_w);
+                        tz = SCALAR_FMA(ty, t9, tz);
+                        tw = SCALAR_FMA(tx, t9, tw);
+                        SCALAR_STORE((Gik + 9 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 10 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 10 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t10 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t10 = SCALAR_MUL(t10, const_value_w);
+                        tz = SCALAR_FMA(ty, t10, tz);
+                        tw = SCALAR_FMA(tx, t10, tw);
+                        SCALAR_STORE((Gik + 10 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 11 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 11 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t11 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t11 = SCALAR_MUL(t11, const_value_w);
+                        tz = SCALAR_FMA(ty, t11, tz);
+                        tw = SCALAR_FMA(tx, t11, tw);
+                        SCALAR_STORE((Gik + 11 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 12 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 12 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t12 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t12 = SCALAR_MUL(t12, const_value_w);
+                        tz = SCALAR_FMA(ty, t12, tz);
+                        tw = SCALAR_FMA(tx, t12, tw);
+                        SCALAR_STORE((Gik + 12 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 3 + p - k;
+                        tx = SCALAR_LOAD((Xik + 13 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 13 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t13 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t13 = SCALAR_MUL(t13, const_value_w);
+                        tz = SCALAR_FMA(ty, t13, tz);
+                        tw = SCALAR_FMA(tx, t13, tw);
+                        SCALAR_STORE((Gik + 13 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 4 + p - k;
+                        tx = SCALAR_LOAD((Xik + 14 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 14 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t14 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t14 = SCALAR_MUL(t14, const_value_w);
+                        tz = SCALAR_FMA(ty, t14, tz);
+                        tw = SCALAR_FMA(tx, t14, tw);
+                        SCALAR_STORE((Gik + 14 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 15 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 15 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t15 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t15 = SCALAR_MUL(t15, const_value_w);
+                        tz = SCALAR_FMA(ty, t15, tz);
+                        tw = SCALAR_FMA(tx, t15, tw);
+                        SCALAR_STORE((Gik + 15 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 16 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 16 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t16 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t16 = SCALAR_MUL(t16, const_value_w);
+                        tz = SCALAR_FMA(ty, t16, tz);
+                        tw = SCALAR_FMA(tx, t16, tw);
+                        SCALAR_STORE((Gik + 16 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 17 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 17 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t17 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t17 = SCALAR_MUL(t17, const_value_w);
+                        tz = SCALAR_FMA(ty, t17, tz);
+                        tw = SCALAR_FMA(tx, t17, tw);
+                        SCALAR_STORE((Gik + 17 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 3 + p - k;
+                        tx = SCALAR_LOAD((Xik + 18 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 18 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t18 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t18 = SCALAR_MUL(t18, const_value_w);
+                        tz = SCALAR_FMA(ty, t18, tz);
+                        tw = SCALAR_FMA(tx, t18, tw);
+                        SCALAR_STORE((Gik + 18 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 4 + p - k;
+                        tx = SCALAR_LOAD((Xik + 19 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 19 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t19 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t19 = SCALAR_MUL(t19, const_value_w);
+                        tz = SCALAR_FMA(ty, t19, tz);
+                        tw = SCALAR_FMA(tx, t19, tw);
+                        SCALAR_STORE((Gik + 19 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 5 + p - k;
+                        tx = SCALAR_LOAD((Xik + 20 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 20 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t20 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t20 = SCALAR_MUL(t20, const_value_w);
+                        tz = SCALAR_FMA(ty, t20, tz);
+                        tw = SCALAR_FMA(tx, t20, tw);
+                        SCALAR_STORE((Gik + 20 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+
+                        Z_ABp = SCALAR_MUL(Z_ABp, Z_AB);
+                        rcp_k = SCALAR_RECIPROCAL(k + 1);
+                        comb_p_k = SCALAR_MUL(comb_p_k, p - k);
+                        comb_p_k = SCALAR_MUL(comb_p_k, rcp_k);
+                     }
+
+                     Y_ABp = SCALAR_MUL(Y_ABp, Y_AB);
+                     rcp_j = SCALAR_RECIPROCAL(j + 1);
+                     comb_n_j = SCALAR_MUL(comb_n_j, n - j);
+                     comb_n_j = SCALAR_MUL(comb_n_j, rcp_j);
+                  }
+
+                  X_ABp = SCALAR_MUL(X_ABp, X_AB);
+                  rcp_i = SCALAR_RECIPROCAL(i + 1);
+                  comb_m_i = SCALAR_MUL(comb_m_i, m - i);
+                  comb_m_i = SCALAR_MUL(comb_m_i, rcp_i);
+               }
+            }
+         }
+      }
+   }
+}
+}
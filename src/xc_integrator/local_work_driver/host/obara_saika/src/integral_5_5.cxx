@@ -0,0 +1,17791 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <math.h>
+#include "../include/cpu/chebyshev_boys_computation.hpp"
+#include "../include/cpu/integral_data_types.hpp"
+#include "config_obara_saika.hpp"
+#include "integral_5_5.hpp"
+
+#define PI 3.14159265358979323846
+
+namespace XCPU::XCPU_ISA {
+void integral_5_5(size_t npts,
+                  double *_points,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  prim_pair *prim_pairs,
+                  double *Xi,
+                  double *Xj,
+                  int ldX,
+                  double *Gi,
+                  double *Gj,
+                  int ldG, 
+                  double *weights,
+                  double *boys_table) {
+   __attribute__((__aligned__(64))) double buffer[251 * NPTS_LOCAL + 3 * NPTS_LOCAL];
+
+   double *temp       = (buffer + 0);
+   double *Tval       = (buffer + 251 * NPTS_LOCAL + 0 * NPTS_LOCAL);
+   double *Tval_inv_e = (buffer + 251 * NPTS_LOCAL + 1 * NPTS_LOCAL);
+   double *FmT        = (buffer + 251 * NPTS_LOCAL + 2 * NPTS_LOCAL);
+
+   size_t npts_upper = NPTS_LOCAL * (npts / NPTS_LOCAL);
+   size_t p_outer = 0;
+   for(p_outer = 0; p_outer < npts_upper; p_outer += NPTS_LOCAL) {
+      double *_point_outer = (_points + p_outer);
+
+      double X_AB = rA.x - rB.x;
+      double Y_AB = rA.y - rB.y;
+      double Z_AB = rA.z - rB.z;
+
+      for(int i = 0; i < 251 * NPTS_LOCAL; i += SIMD_LENGTH) SIMD_ALIGNED_STORE((temp + i), SIMD_ZERO());
+
+      for(int ij = 0; ij < nprim_pairs; ++ij) {
+         double RHO = prim_pairs[ij].gamma;
+         double RHO_INV = prim_pairs[ij].gamma_inv;
+         double X_PA = prim_pairs[ij].PA.x;
+         double Y_PA = prim_pairs[ij].PA.y;
+         double Z_PA = prim_pairs[ij].PA.z;
+
+         double xP = prim_pairs[ij].P.x;
+         double yP = prim_pairs[ij].P.y;
+         double zP = prim_pairs[ij].P.z;
+
+         double eval = prim_pairs[ij].K_coeff_prod;
+         if(std::abs(eval) < shpair_screen_tol) continue;
+
+         // Evaluate T Values
+         for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            X_PC = SIMD_MUL(X_PC, X_PC);
+            X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
+            X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
+         }
+
+         // Evaluate Boys function
+         boys_elements<10>(NPTS_LOCAL, Tval, Tval_inv_e, FmT, boys_table);
+
+         // Evaluate VRR Buffer
+         for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            SIMD_TYPE tval, tval_inv_e, tx, ty, t0_0, t0_1, t0_2, t0_3, t0_4, t0_5, t0_6, t0_7, t0_8, t0_9, t0_10, t1_0, t1_1, t1_2, t1_3, t1_4, t1_5, t1_6, t1_7, t1_8, t1_9, t2_0, t2_1, t2_2, t2_3, t2_4, t2_5, t2_6, t2_7, t2_8, t3_0, t3_1, t3_2, t3_3, t3_4, t3_5, t3_6, t3_7, t4_0, t4_1, t4_2, t4_3, t4_4, t4_5, t4_6, t5_0, t5_1, t5_2, t5_3, t5_4, t5_5, t6_0, t6_1, t6_2, t6_3, t6_4, t7_0, t7_1, t7_2, t7_3, t8_0, t8_1, t8_2, t9_0, t9_1, t10_0;
+
+            tval = SIMD_ALIGNED_LOAD((Tval + p_inner));
+            tval_inv_e = SIMD_ALIGNED_LOAD((Tval_inv_e + p_inner));
+
+            t0_10 = SIMD_ALIGNED_LOAD((FmT + p_inner));
+            t0_9 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_10), tval_inv_e), SIMD_SET1(0.10526315789473683626));
+            t0_8 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_9), tval_inv_e), SIMD_SET1(0.11764705882352941013));
+            t0_7 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_8), tval_inv_e), SIMD_SET1(0.13333333333333333148));
+            t0_6 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_7), tval_inv_e), SIMD_SET1(0.15384615384615385469));
+            t0_5 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_6), tval_inv_e), SIMD_SET1(0.18181818181818182323));
+            t0_4 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_5), tval_inv_e), SIMD_SET1(0.22222222222222220989));
+            t0_3 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_4), tval_inv_e), SIMD_SET1(0.28571428571428569843));
+            t0_2 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_3), tval_inv_e), SIMD_SET1(0.40000000000000002220));
+            t0_1 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_2), tval_inv_e), SIMD_SET1(0.66666666666666662966));
+            t0_0 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_1), tval_inv_e), SIMD_SET1(2.00000000000000000000));
+
+            t0_0 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_0);
+            t0_1 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_1);
+            t0_2 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_2);
+            t0_3 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_3);
+            t0_4 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_4);
+            t0_5 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_5);
+            t0_6 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_6);
+            t0_7 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_7);
+            t0_8 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_8);
+            t0_9 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_9);
+            t0_10 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_10);
+            t1_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_0);
+            t1_0 = SIMD_FNMA(X_PC, t0_1, t1_0);
+            t1_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_1);
+            t1_1 = SIMD_FNMA(X_PC, t0_2, t1_1);
+            t1_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_2);
+            t1_2 = SIMD_FNMA(X_PC, t0_3, t1_2);
+            t1_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_3);
+            t1_3 = SIMD_FNMA(X_PC, t0_4, t1_3);
+            t1_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_4);
+            t1_4 = SIMD_FNMA(X_PC, t0_5, t1_4);
+            t1_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_5);
+            t1_5 = SIMD_FNMA(X_PC, t0_6, t1_5);
+            t1_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_6);
+            t1_6 = SIMD_FNMA(X_PC, t0_7, t1_6);
+            t1_7 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_7);
+            t1_7 = SIMD_FNMA(X_PC, t0_8, t1_7);
+            t1_8 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_8);
+            t1_8 = SIMD_FNMA(X_PC, t0_9, t1_8);
+            t1_9 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_9);
+            t1_9 = SIMD_FNMA(X_PC, t0_10, t1_9);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_0);
+            t2_0 = SIMD_FNMA(X_PC, t1_1, t2_0);
+            tx = SIMD_SUB(t0_0, t0_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_0 = SIMD_FMA(tx, ty, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_1);
+            t2_1 = SIMD_FNMA(X_PC, t1_2, t2_1);
+            tx = SIMD_SUB(t0_1, t0_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_1 = SIMD_FMA(tx, ty, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_2);
+            t2_2 = SIMD_FNMA(X_PC, t1_3, t2_2);
+            tx = SIMD_SUB(t0_2, t0_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_2 = SIMD_FMA(tx, ty, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_3);
+            t2_3 = SIMD_FNMA(X_PC, t1_4, t2_3);
+            tx = SIMD_SUB(t0_3, t0_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_3 = SIMD_FMA(tx, ty, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_4);
+            t2_4 = SIMD_FNMA(X_PC, t1_5, t2_4);
+            tx = SIMD_SUB(t0_4, t0_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_4 = SIMD_FMA(tx, ty, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_5);
+            t2_5 = SIMD_FNMA(X_PC, t1_6, t2_5);
+            tx = SIMD_SUB(t0_5, t0_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_5 = SIMD_FMA(tx, ty, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_6);
+            t2_6 = SIMD_FNMA(X_PC, t1_7, t2_6);
+            tx = SIMD_SUB(t0_6, t0_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_6 = SIMD_FMA(tx, ty, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_7);
+            t2_7 = SIMD_FNMA(X_PC, t1_8, t2_7);
+            tx = SIMD_SUB(t0_7, t0_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_7 = SIMD_FMA(tx, ty, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_8);
+            t2_8 = SIMD_FNMA(X_PC, t1_9, t2_8);
+            tx = SIMD_SUB(t0_8, t0_9);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_8 = SIMD_FMA(tx, ty, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_0);
+            t3_0 = SIMD_FNMA(X_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_1);
+            t3_1 = SIMD_FNMA(X_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_2);
+            t3_2 = SIMD_FNMA(X_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_3);
+            t3_3 = SIMD_FNMA(X_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_4);
+            t3_4 = SIMD_FNMA(X_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_5);
+            t3_5 = SIMD_FNMA(X_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_6);
+            t3_6 = SIMD_FNMA(X_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_7);
+            t3_7 = SIMD_FNMA(X_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_0);
+            t4_0 = SIMD_FNMA(X_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_1);
+            t4_1 = SIMD_FNMA(X_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_2);
+            t4_2 = SIMD_FNMA(X_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_3);
+            t4_3 = SIMD_FNMA(X_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_4);
+            t4_4 = SIMD_FNMA(X_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_5);
+            t4_5 = SIMD_FNMA(X_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_6);
+            t4_6 = SIMD_FNMA(X_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_0);
+            t5_0 = SIMD_FNMA(X_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_1);
+            t5_1 = SIMD_FNMA(X_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_2);
+            t5_2 = SIMD_FNMA(X_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_3);
+            t5_3 = SIMD_FNMA(X_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_4);
+            t5_4 = SIMD_FNMA(X_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_5);
+            t5_5 = SIMD_FNMA(X_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_0);
+            t6_0 = SIMD_FNMA(X_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_1);
+            t6_1 = SIMD_FNMA(X_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_2);
+            t6_2 = SIMD_FNMA(X_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_3);
+            t6_3 = SIMD_FNMA(X_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_4);
+            t6_4 = SIMD_FNMA(X_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 21 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 21 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_0);
+            t7_0 = SIMD_FNMA(X_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_1);
+            t7_1 = SIMD_FNMA(X_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_2);
+            t7_2 = SIMD_FNMA(X_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_3);
+            t7_3 = SIMD_FNMA(X_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 49 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 49 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t7_0);
+            t8_0 = SIMD_FNMA(X_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t7_1);
+            t8_1 = SIMD_FNMA(X_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t7_2);
+            t8_2 = SIMD_FNMA(X_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 85 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 85 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t8_0);
+            t9_0 = SIMD_FNMA(X_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t8_1);
+            t9_1 = SIMD_FNMA(X_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 130 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 130 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t9_0);
+            t10_0 = SIMD_FNMA(X_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 9);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 185 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 185 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 186 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 186 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 187 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 187 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 131 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 131 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 188 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 188 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 189 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 189 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 132 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 132 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 190 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 190 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 86 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 86 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 133 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 133 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 191 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 191 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 192 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 192 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 134 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 134 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 193 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 193 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 87 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 87 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 135 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 135 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 194 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 194 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 50 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 50 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 88 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 88 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 136 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 136 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 195 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 195 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 196 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 196 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 137 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 137 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 197 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 197 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 89 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 89 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 138 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 138 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 198 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 198 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 51 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 51 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 90 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 90 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 139 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 139 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 199 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 199 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 22 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 22 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 52 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 52 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 91 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 91 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 140 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 140 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 200 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 200 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 201 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 201 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 141 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 141 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 202 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 202 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 92 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 92 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 142 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 142 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 203 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 203 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 53 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 53 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 93 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 93 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 143 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 143 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 204 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 204 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 23 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 23 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 54 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 54 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 94 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 94 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 144 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 144 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 205 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 205 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 1 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 1 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 24 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 24 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 55 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 55 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 95 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 95 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 145 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 145 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 206 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 206 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 207 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 207 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 146 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 146 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 208 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 208 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 96 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 96 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 147 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 147 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 209 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 209 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 56 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 56 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 97 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 97 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 148 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 148 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 210 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 210 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 25 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 25 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 57 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 57 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 98 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 98 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 149 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 149 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 211 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 211 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 2 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 2 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 26 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 26 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 58 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 58 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 99 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 99 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 150 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 150 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 212 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 212 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 3 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 3 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 27 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 27 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 59 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 59 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 100 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 100 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 151 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 151 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 213 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 213 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 214 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 214 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 152 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 152 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 215 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 215 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 101 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 101 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 153 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 153 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 216 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 216 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 60 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 60 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 102 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 102 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 154 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 154 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 217 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 217 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 28 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 28 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 61 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 61 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 103 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 103 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 155 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 155 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 218 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 218 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 4 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 4 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 29 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 29 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 62 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 62 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 104 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 104 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 156 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 156 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 219 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 219 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 5 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 5 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 30 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 30 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 63 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 63 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 105 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 105 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 157 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 157 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 220 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 220 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Y_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Y_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Y_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Y_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Y_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Y_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Y_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Y_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 6 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 6 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 31 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 31 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 64 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 64 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 106 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 106 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 158 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 158 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 221 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 221 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 222 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 222 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 159 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 159 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 223 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 223 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 107 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 107 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 160 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 160 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 224 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 224 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 65 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 65 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 108 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 108 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 161 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 161 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 225 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 225 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 32 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 32 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 66 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 66 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 109 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 109 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 162 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 162 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 226 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 226 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 7 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 7 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 33 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 33 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 67 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 67 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 110 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 110 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 163 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 163 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 227 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 227 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 8 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 8 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 34 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 34 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 68 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 68 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 111 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 111 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 164 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 164 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 228 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 228 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 9 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 9 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 35 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 35 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 69 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 69 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 112 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 112 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 165 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 165 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 229 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 229 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Y_PC, t1_1, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Y_PC, t1_2, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Y_PC, t1_3, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Y_PC, t1_4, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Y_PC, t1_5, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Y_PC, t1_6, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Y_PC, t1_7, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Y_PC, t1_8, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Y_PC, t1_9, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Y_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Y_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Y_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Y_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Y_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Y_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Y_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Y_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 10 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 10 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 36 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 36 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 70 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 70 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 113 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 113 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 166 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 166 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 230 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 230 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 231 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 231 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 167 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 167 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 232 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 232 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 114 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 114 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 168 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 168 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 233 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 233 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 71 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 71 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 115 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 115 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 169 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 169 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 234 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 234 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 37 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 37 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 72 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 72 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 116 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 116 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 170 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 170 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 235 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 235 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 11 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 11 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 38 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 38 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 73 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 73 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 117 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 117 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 171 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 171 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 236 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 236 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 12 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 12 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 39 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 39 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 74 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 74 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 118 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 118 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 172 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 172 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 237 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 237 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 13 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 13 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 40 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 40 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 75 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 75 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 119 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 119 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 173 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 173 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 238 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 238 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Z_PC, t1_1, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Z_PC, t1_2, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Z_PC, t1_3, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Z_PC, t1_4, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Z_PC, t1_5, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Z_PC, t1_6, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Z_PC, t1_7, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Z_PC, t1_8, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Z_PC, t1_9, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 14 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 14 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 41 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 41 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 76 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 76 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 120 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 120 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 174 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 174 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 239 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 239 * NPTS_LOCAL + p_inner), tx);
+            t1_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_0);
+            t1_0 = SIMD_FNMA(Y_PC, t0_1, t1_0);
+            t1_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_1);
+            t1_1 = SIMD_FNMA(Y_PC, t0_2, t1_1);
+            t1_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_2);
+            t1_2 = SIMD_FNMA(Y_PC, t0_3, t1_2);
+            t1_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_3);
+            t1_3 = SIMD_FNMA(Y_PC, t0_4, t1_3);
+            t1_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_4);
+            t1_4 = SIMD_FNMA(Y_PC, t0_5, t1_4);
+            t1_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_5);
+            t1_5 = SIMD_FNMA(Y_PC, t0_6, t1_5);
+            t1_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_6);
+            t1_6 = SIMD_FNMA(Y_PC, t0_7, t1_6);
+            t1_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_7);
+            t1_7 = SIMD_FNMA(Y_PC, t0_8, t1_7);
+            t1_8 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_8);
+            t1_8 = SIMD_FNMA(Y_PC, t0_9, t1_8);
+            t1_9 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_9);
+            t1_9 = SIMD_FNMA(Y_PC, t0_10, t1_9);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Y_PC, t1_1, t2_0);
+            tx = SIMD_SUB(t0_0, t0_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_0 = SIMD_FMA(tx, ty, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Y_PC, t1_2, t2_1);
+            tx = SIMD_SUB(t0_1, t0_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_1 = SIMD_FMA(tx, ty, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Y_PC, t1_3, t2_2);
+            tx = SIMD_SUB(t0_2, t0_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_2 = SIMD_FMA(tx, ty, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Y_PC, t1_4, t2_3);
+            tx = SIMD_SUB(t0_3, t0_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_3 = SIMD_FMA(tx, ty, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Y_PC, t1_5, t2_4);
+            tx = SIMD_SUB(t0_4, t0_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_4 = SIMD_FMA(tx, ty, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Y_PC, t1_6, t2_5);
+            tx = SIMD_SUB(t0_5, t0_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_5 = SIMD_FMA(tx, ty, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Y_PC, t1_7, t2_6);
+            tx = SIMD_SUB(t0_6, t0_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_6 = SIMD_FMA(tx, ty, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Y_PC, t1_8, t2_7);
+            tx = SIMD_SUB(t0_7, t0_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_7 = SIMD_FMA(tx, ty, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Y_PC, t1_9, t2_8);
+            tx = SIMD_SUB(t0_8, t0_9);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_8 = SIMD_FMA(tx, ty, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Y_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Y_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Y_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Y_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Y_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Y_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Y_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Y_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 15 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 15 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 42 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 42 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 77 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 77 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 121 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 121 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 175 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 175 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 9);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 240 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 240 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 241 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 241 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 176 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 176 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 242 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 242 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 122 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 122 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 177 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 177 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 243 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 243 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 78 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 78 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 123 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 123 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 178 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 178 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 244 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 244 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 43 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 43 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 79 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 79 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 124 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 124 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 179 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 179 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 245 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 245 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 16 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 44 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 44 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 80 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 80 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 125 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 125 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 180 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 180 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 246 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 246 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 17 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 17 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 45 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 45 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 81 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 81 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 126 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 126 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 181 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 181 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 247 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 247 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 18 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 18 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 46 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 46 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 82 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 82 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 127 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 127 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 182 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 182 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 248 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 248 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Z_PC, t1_1, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Z_PC, t1_2, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Z_PC, t1_3, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Z_PC, t1_4, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Z_PC, t1_5, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Z_PC, t1_6, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Z_PC, t1_7, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Z_PC, t1_8, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Z_PC, t1_9, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 19 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 19 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 47 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 47 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 83 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 83 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 128 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 128 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 183 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 183 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 249 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 249 * NPTS_LOCAL + p_inner), tx);
+            t1_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_0);
+            t1_0 = SIMD_FNMA(Z_PC, t0_1, t1_0);
+            t1_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_1);
+            t1_1 = SIMD_FNMA(Z_PC, t0_2, t1_1);
+            t1_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_2);
+            t1_2 = SIMD_FNMA(Z_PC, t0_3, t1_2);
+            t1_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_3);
+            t1_3 = SIMD_FNMA(Z_PC, t0_4, t1_3);
+            t1_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_4);
+            t1_4 = SIMD_FNMA(Z_PC, t0_5, t1_4);
+            t1_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_5);
+            t1_5 = SIMD_FNMA(Z_PC, t0_6, t1_5);
+            t1_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_6);
+            t1_6 = SIMD_FNMA(Z_PC, t0_7, t1_6);
+            t1_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_7);
+            t1_7 = SIMD_FNMA(Z_PC, t0_8, t1_7);
+            t1_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_8);
+            t1_8 = SIMD_FNMA(Z_PC, t0_9, t1_8);
+            t1_9 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_9);
+            t1_9 = SIMD_FNMA(Z_PC, t0_10, t1_9);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Z_PC, t1_1, t2_0);
+            tx = SIMD_SUB(t0_0, t0_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_0 = SIMD_FMA(tx, ty, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Z_PC, t1_2, t2_1);
+            tx = SIMD_SUB(t0_1, t0_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_1 = SIMD_FMA(tx, ty, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Z_PC, t1_3, t2_2);
+            tx = SIMD_SUB(t0_2, t0_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_2 = SIMD_FMA(tx, ty, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Z_PC, t1_4, t2_3);
+            tx = SIMD_SUB(t0_3, t0_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_3 = SIMD_FMA(tx, ty, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Z_PC, t1_5, t2_4);
+            tx = SIMD_SUB(t0_4, t0_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_4 = SIMD_FMA(tx, ty, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Z_PC, t1_6, t2_5);
+            tx = SIMD_SUB(t0_5, t0_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_5 = SIMD_FMA(tx, ty, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Z_PC, t1_7, t2_6);
+            tx = SIMD_SUB(t0_6, t0_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_6 = SIMD_FMA(tx, ty, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Z_PC, t1_8, t2_7);
+            tx = SIMD_SUB(t0_7, t0_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_7 = SIMD_FMA(tx, ty, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Z_PC, t1_9, t2_8);
+            tx = SIMD_SUB(t0_8, t0_9);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_8 = SIMD_FMA(tx, ty, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 20 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 20 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 48 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 48 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 84 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 84 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 129 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 129 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 184 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 184 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 9);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 250 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 250 * NPTS_LOCAL + p_inner), tx);
+         }
+      }
+
+      for(size_t p_inner = 0; p_inner < NPTS_LOCAL; p_inner += SIMD_LENGTH) {
+         double *Xik = (Xi + p_outer + p_inner);
+         double *Xjk = (Xj + p_outer + p_inner);
+         double *Gik = (Gi + p_outer + p_inner);
+         double *Gjk = (Gj + p_outer + p_inner);
+
+         SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
+
+         for(int c0 = 0; c0 <= 5; ++c0) {
+            for(int c1 = 0; c1 <= c0; ++c1) {
+               int m = 5 - c0;
+               int n = c0 - c1;
+               int p = c1;
+
+               int idxB = (((5 - m) * (5 - m + 1)) >> 1) + p;
+
+               double X_ABp = 1.0, comb_m_i = 1.0;
+               for(int i = 0; i <= m; ++i) {
+                  double rcp_i;
+
+                  double Y_ABp = 1.0, comb_n_j = 1.0;
+                  for(int j = 0; j <= n; ++j) {
+                     double rcp_j;
+
+                     double Z_ABp = 1.0, comb_p_k = 1.0;
+                     for(int k = 0; k <= p; ++k) {
+                        double rcp_k;
+                        int mv, pv, Lv = 10 - i - j - k;
+
+                        int offset = (Lv * (Lv + 1) * (Lv + 2) - 210) / 6;
+                        double const_value = comb_m_i * comb_n_j * comb_p_k * X_ABp * Y_ABp * Z_ABp;
+                        SIMD_TYPE tx, ty, tz, tw;
+                        SIMD_TYPE const_value_w = SIMD_MUL(const_value_v, SIMD_DUPLICATE(&(const_value)));
+
+                        mv = 5 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 0 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 0 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t0 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t0 = SIMD_MUL(t0, const_value_w);
+                        tz = SIMD_FMA(ty, t0, tz);
+                        tw = SIMD_FMA(tx, t0, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 0 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 1 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 1 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t1 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t1 = SIMD_MUL(t1, const_value_w);
+                        tz = SIMD_FMA(ty, t1, tz);
+                        tw = SIMD_FMA(tx, t1, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 1 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 2 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 2 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t2 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t2 = SIMD_MUL(t2, const_value_w);
+                        tz = SIMD_FMA(ty, t2, tz);
+                        tw = SIMD_FMA(tx, t2, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 2 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 3 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 3 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t3 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t3 = SIMD_MUL(t3, const_value_w);
+                        tz = SIMD_FMA(ty, t3, tz);
+                        tw = SIMD_FMA(tx, t3, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 3 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 4 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 4 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t4 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t4 = SIMD_MUL(t4, const_value_w);
+                        tz = SIMD_FMA(ty, t4, tz);
+                        tw = SIMD_FMA(tx, t4, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 4 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 5 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 5 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t5 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t5 = SIMD_MUL(t5, const_value_w);
+                        tz = SIMD_FMA(ty, t5, tz);
+                        tw = SIMD_FMA(tx, t5, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 5 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 6 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 6 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t6 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t6 = SIMD_MUL(t6, const_value_w);
+                        tz = SIMD_FMA(ty, t6, tz);
+                        tw = SIMD_FMA(tx, t6, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 6 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 7 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 7 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t7 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t7 = SIMD_MUL(t7, const_value_w);
+                        tz = SIMD_FMA(ty, t7, tz);
+                        tw = SIMD_FMA(tx, t7, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 7 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 8 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 8 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t8 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t8 = SIMD_MUL(t8, const_value_w);
+                        tz = SIMD_FMA(ty, t8, tz);
+                        tw = SIMD_FMA(tx, t8, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 8 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 9 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 9 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t9 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t9 = SIMD_MUL(t9, const_value_w);
+                        tz = SIMD_FMA(ty, t9, tz);
+                        tw = SIMD_FMA(tx, t9, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 9 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 10 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 10 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t10 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t10 = SIMD_MUL(t10, const_value_w);
+                        tz = SIMD_FMA(ty, t10, tz);
+                        tw = SIMD_FMA(tx, t10, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 10 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 11 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 11 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t11 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t11 = SIMD_MUL(t11, const_value_w);
+                        tz = SIMD_FMA(ty, t11, tz);
+                        tw = SIMD_FMA(tx, t11, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 11 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 12 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 12 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t12 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t12 = SIMD_MUL(t12, const_value_w);
+                        tz = SIMD_FMA(ty, t12, tz);
+                        tw = SIMD_FMA(tx, t12, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 12 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 13 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 13 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t13 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t13 = SIMD_MUL(t13, const_value_w);
+                        tz = SIMD_FMA(ty, t13, tz);
+                        tw = SIMD_FMA(tx, t13, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 13 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 14 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 14 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t14 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t14 = SIMD_MUL(t14, const_value_w);
+                        tz = SIMD_FMA(ty, t14, tz);
+                        tw = SIMD_FMA(tx, t14, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 14 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 15 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 15 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t15 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t15 = SIMD_MUL(t15, const_value_w);
+                        tz = SIMD_FMA(ty, t15, tz);
+                        tw = SIMD_FMA(tx, t15, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 15 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 16 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 16 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t16 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t16 = SIMD_MUL(t16, const_value_w);
+                        tz = SIMD_FMA(ty, t16, tz);
+                        tw = SIMD_FMA(tx, t16, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 16 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 17 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 17 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t17 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t17 = SIMD_MUL(t17, const_value_w);
+                        tz = SIMD_FMA(ty, t17, tz);
+                        tw = SIMD_FMA(tx, t17, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 17 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 18 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 18 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t18 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t18 = SIMD_MUL(t18, const_value_w);
+                        tz = SIMD_FMA(ty, t18, tz);
+                        tw = SIMD_FMA(tx, t18, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 18 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 19 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 19 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t19 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t19 = SIMD_MUL(t19, const_value_w);
+                        tz = SIMD_FMA(ty, t19, tz);
+                        tw = SIMD_FMA(tx, t19, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 19 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 5 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 20 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 20 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t20 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t20 = SIMD_MUL(t20, const_value_w);
+                        tz = SIMD_FMA(ty, t20, tz);
+                        tw = SIMD_FMA(tx, t20, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 20 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+
+                        Z_ABp = SCALAR_MUL(Z_ABp, Z_AB);
+                        rcp_k = SCALAR_RECIPROCAL(k + 1);
+                        comb_p_k = SCALAR_MUL(comb_p_k, p - k);
+                        comb_p_k = SCALAR_MUL(comb_p_k, rcp_k);
+                     }
+
+                     Y_ABp = SCALAR_MUL(Y_ABp, Y_AB);
+                     rcp_j = SCALAR_RECIPROCAL(j + 1);
+                     comb_n_j = SCALAR_MUL(comb_n_j, n - j);
+                     comb_n_j = SCALAR_MUL(comb_n_j, rcp_j);
+                  }
+
+                  X_ABp = SCALAR_MUL(X_ABp, X_AB);
+                  rcp_i = SCALAR_RECIPROCAL(i + 1);
+                  comb_m_i = SCALAR_MUL(comb_m_i, m - i);
+                  comb_m_i = SCALAR_MUL(comb_m_i, rcp_i);
+               }
+            }
+         }
+      }
+   }
+
+   for(; p_outer < npts; p_outer += NPTS_LOCAL) {
+      size_t npts_inner = std::min((size_t) NPTS_LOCAL, npts - p_outer);
+      double *_point_outer = (_points + p_outer);
+
+      double X_AB = rA.x - rB.x;
+      double Y_AB = rA.y - rB.y;
+      double Z_AB = rA.z - rB.z;
+
+      for(int i = 0; i < 251 * NPTS_LOCAL; i += SIMD_LENGTH) SIMD_ALIGNED_STORE((temp + i), SIMD_ZERO());
+
+      for(int ij = 0; ij < nprim_pairs; ++ij) {
+         double RHO = prim_pairs[ij].gamma;
+         double RHO_INV = prim_pairs[ij].gamma_inv;
+         double X_PA = prim_pairs[ij].PA.x;
+         double Y_PA = prim_pairs[ij].PA.y;
+         double Z_PA = prim_pairs[ij].PA.z;
+
+         double xP = prim_pairs[ij].P.x;
+         double yP = prim_pairs[ij].P.y;
+         double zP = prim_pairs[ij].P.z;
+
+         double eval = prim_pairs[ij].K_coeff_prod;
+         if(std::abs(eval) < shpair_screen_tol) continue;
+
+         // Evaluate T Values
+         size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
+         size_t p_inner = 0;
+         for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            X_PC = SIMD_MUL(X_PC, X_PC);
+            X_PC = SIMD_FMA(Y_PC, Y_PC, X_PC);
+            X_PC = SIMD_FMA(Z_PC, Z_PC, X_PC);
+            X_PC = SIMD_MUL(SIMD_DUPLICATE(&(RHO)), X_PC);
+            SIMD_ALIGNED_STORE((Tval + p_inner), X_PC);
+         }
+
+         for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
+            SCALAR_TYPE xC = SCALAR_LOAD((_point_outer + p_inner + 0 * npts));
+            SCALAR_TYPE yC = SCALAR_LOAD((_point_outer + p_inner + 1 * npts));
+            SCALAR_TYPE zC = SCALAR_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SCALAR_TYPE X_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(xP)), xC);
+            SCALAR_TYPE Y_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(yP)), yC);
+            SCALAR_TYPE Z_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(zP)), zC);
+
+            X_PC = SCALAR_MUL(X_PC, X_PC);
+            X_PC = SCALAR_FMA(Y_PC, Y_PC, X_PC);
+            X_PC = SCALAR_FMA(Z_PC, Z_PC, X_PC);
+            X_PC = SCALAR_MUL(SCALAR_DUPLICATE(&(RHO)), X_PC);
+            SCALAR_STORE((Tval + p_inner), X_PC);
+         }
+
+         // Evaluate Boys function
+         boys_elements<10>(npts_inner, Tval, Tval_inv_e, FmT, boys_table);
+
+         // Evaluate VRR Buffer
+         p_inner = 0;
+         for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
+            SIMD_TYPE xC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 0 * npts));
+            SIMD_TYPE yC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 1 * npts));
+            SIMD_TYPE zC = SIMD_UNALIGNED_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SIMD_TYPE X_PC = SIMD_SUB(SIMD_DUPLICATE(&(xP)), xC);
+            SIMD_TYPE Y_PC = SIMD_SUB(SIMD_DUPLICATE(&(yP)), yC);
+            SIMD_TYPE Z_PC = SIMD_SUB(SIMD_DUPLICATE(&(zP)), zC);
+
+            SIMD_TYPE tval, tval_inv_e, tx, ty, t0_0, t0_1, t0_2, t0_3, t0_4, t0_5, t0_6, t0_7, t0_8, t0_9, t0_10, t1_0, t1_1, t1_2, t1_3, t1_4, t1_5, t1_6, t1_7, t1_8, t1_9, t2_0, t2_1, t2_2, t2_3, t2_4, t2_5, t2_6, t2_7, t2_8, t3_0, t3_1, t3_2, t3_3, t3_4, t3_5, t3_6, t3_7, t4_0, t4_1, t4_2, t4_3, t4_4, t4_5, t4_6, t5_0, t5_1, t5_2, t5_3, t5_4, t5_5, t6_0, t6_1, t6_2, t6_3, t6_4, t7_0, t7_1, t7_2, t7_3, t8_0, t8_1, t8_2, t9_0, t9_1, t10_0;
+
+            tval = SIMD_ALIGNED_LOAD((Tval + p_inner));
+            tval_inv_e = SIMD_ALIGNED_LOAD((Tval_inv_e + p_inner));
+
+            t0_10 = SIMD_ALIGNED_LOAD((FmT + p_inner));
+            t0_9 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_10), tval_inv_e), SIMD_SET1(0.10526315789473683626));
+            t0_8 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_9), tval_inv_e), SIMD_SET1(0.11764705882352941013));
+            t0_7 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_8), tval_inv_e), SIMD_SET1(0.13333333333333333148));
+            t0_6 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_7), tval_inv_e), SIMD_SET1(0.15384615384615385469));
+            t0_5 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_6), tval_inv_e), SIMD_SET1(0.18181818181818182323));
+            t0_4 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_5), tval_inv_e), SIMD_SET1(0.22222222222222220989));
+            t0_3 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_4), tval_inv_e), SIMD_SET1(0.28571428571428569843));
+            t0_2 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_3), tval_inv_e), SIMD_SET1(0.40000000000000002220));
+            t0_1 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_2), tval_inv_e), SIMD_SET1(0.66666666666666662966));
+            t0_0 = SIMD_MUL(SIMD_ADD(SIMD_MUL(tval, t0_1), tval_inv_e), SIMD_SET1(2.00000000000000000000));
+
+            t0_0 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_0);
+            t0_1 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_1);
+            t0_2 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_2);
+            t0_3 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_3);
+            t0_4 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_4);
+            t0_5 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_5);
+            t0_6 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_6);
+            t0_7 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_7);
+            t0_8 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_8);
+            t0_9 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_9);
+            t0_10 = SIMD_MUL(SIMD_DUPLICATE(&(eval)), t0_10);
+            t1_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_0);
+            t1_0 = SIMD_FNMA(X_PC, t0_1, t1_0);
+            t1_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_1);
+            t1_1 = SIMD_FNMA(X_PC, t0_2, t1_1);
+            t1_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_2);
+            t1_2 = SIMD_FNMA(X_PC, t0_3, t1_2);
+            t1_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_3);
+            t1_3 = SIMD_FNMA(X_PC, t0_4, t1_3);
+            t1_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_4);
+            t1_4 = SIMD_FNMA(X_PC, t0_5, t1_4);
+            t1_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_5);
+            t1_5 = SIMD_FNMA(X_PC, t0_6, t1_5);
+            t1_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_6);
+            t1_6 = SIMD_FNMA(X_PC, t0_7, t1_6);
+            t1_7 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_7);
+            t1_7 = SIMD_FNMA(X_PC, t0_8, t1_7);
+            t1_8 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_8);
+            t1_8 = SIMD_FNMA(X_PC, t0_9, t1_8);
+            t1_9 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t0_9);
+            t1_9 = SIMD_FNMA(X_PC, t0_10, t1_9);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_0);
+            t2_0 = SIMD_FNMA(X_PC, t1_1, t2_0);
+            tx = SIMD_SUB(t0_0, t0_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_0 = SIMD_FMA(tx, ty, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_1);
+            t2_1 = SIMD_FNMA(X_PC, t1_2, t2_1);
+            tx = SIMD_SUB(t0_1, t0_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_1 = SIMD_FMA(tx, ty, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_2);
+            t2_2 = SIMD_FNMA(X_PC, t1_3, t2_2);
+            tx = SIMD_SUB(t0_2, t0_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_2 = SIMD_FMA(tx, ty, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_3);
+            t2_3 = SIMD_FNMA(X_PC, t1_4, t2_3);
+            tx = SIMD_SUB(t0_3, t0_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_3 = SIMD_FMA(tx, ty, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_4);
+            t2_4 = SIMD_FNMA(X_PC, t1_5, t2_4);
+            tx = SIMD_SUB(t0_4, t0_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_4 = SIMD_FMA(tx, ty, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_5);
+            t2_5 = SIMD_FNMA(X_PC, t1_6, t2_5);
+            tx = SIMD_SUB(t0_5, t0_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_5 = SIMD_FMA(tx, ty, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_6);
+            t2_6 = SIMD_FNMA(X_PC, t1_7, t2_6);
+            tx = SIMD_SUB(t0_6, t0_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_6 = SIMD_FMA(tx, ty, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_7);
+            t2_7 = SIMD_FNMA(X_PC, t1_8, t2_7);
+            tx = SIMD_SUB(t0_7, t0_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_7 = SIMD_FMA(tx, ty, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t1_8);
+            t2_8 = SIMD_FNMA(X_PC, t1_9, t2_8);
+            tx = SIMD_SUB(t0_8, t0_9);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_8 = SIMD_FMA(tx, ty, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_0);
+            t3_0 = SIMD_FNMA(X_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_1);
+            t3_1 = SIMD_FNMA(X_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_2);
+            t3_2 = SIMD_FNMA(X_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_3);
+            t3_3 = SIMD_FNMA(X_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_4);
+            t3_4 = SIMD_FNMA(X_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_5);
+            t3_5 = SIMD_FNMA(X_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_6);
+            t3_6 = SIMD_FNMA(X_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t2_7);
+            t3_7 = SIMD_FNMA(X_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_0);
+            t4_0 = SIMD_FNMA(X_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_1);
+            t4_1 = SIMD_FNMA(X_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_2);
+            t4_2 = SIMD_FNMA(X_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_3);
+            t4_3 = SIMD_FNMA(X_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_4);
+            t4_4 = SIMD_FNMA(X_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_5);
+            t4_5 = SIMD_FNMA(X_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t3_6);
+            t4_6 = SIMD_FNMA(X_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_0);
+            t5_0 = SIMD_FNMA(X_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_1);
+            t5_1 = SIMD_FNMA(X_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_2);
+            t5_2 = SIMD_FNMA(X_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_3);
+            t5_3 = SIMD_FNMA(X_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_4);
+            t5_4 = SIMD_FNMA(X_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t4_5);
+            t5_5 = SIMD_FNMA(X_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_0);
+            t6_0 = SIMD_FNMA(X_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_1);
+            t6_1 = SIMD_FNMA(X_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_2);
+            t6_2 = SIMD_FNMA(X_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_3);
+            t6_3 = SIMD_FNMA(X_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t5_4);
+            t6_4 = SIMD_FNMA(X_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 21 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 21 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_0);
+            t7_0 = SIMD_FNMA(X_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_1);
+            t7_1 = SIMD_FNMA(X_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_2);
+            t7_2 = SIMD_FNMA(X_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t6_3);
+            t7_3 = SIMD_FNMA(X_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 49 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 49 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t7_0);
+            t8_0 = SIMD_FNMA(X_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t7_1);
+            t8_1 = SIMD_FNMA(X_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t7_2);
+            t8_2 = SIMD_FNMA(X_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 85 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 85 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t8_0);
+            t9_0 = SIMD_FNMA(X_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t8_1);
+            t9_1 = SIMD_FNMA(X_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 130 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 130 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(X_PA)), t9_0);
+            t10_0 = SIMD_FNMA(X_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 9);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 185 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 185 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 186 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 186 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 187 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 187 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 131 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 131 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 188 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 188 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 189 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 189 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 132 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 132 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 190 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 190 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 86 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 86 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 133 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 133 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 191 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 191 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 192 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 192 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 134 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 134 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 193 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 193 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 87 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 87 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 135 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 135 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 194 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 194 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 50 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 50 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 88 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 88 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 136 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 136 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 195 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 195 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 196 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 196 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 137 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 137 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 197 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 197 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 89 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 89 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 138 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 138 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 198 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 198 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 51 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 51 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 90 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 90 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 139 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 139 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 199 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 199 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 22 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 22 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 52 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 52 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 91 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 91 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 140 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 140 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 200 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 200 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 201 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 201 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 141 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 141 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 202 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 202 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 92 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 92 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 142 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 142 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 203 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 203 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 53 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 53 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 93 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 93 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 143 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 143 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 204 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 204 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 23 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 23 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 54 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 54 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 94 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 94 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 144 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 144 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 205 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 205 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 1 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 1 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 24 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 24 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 55 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 55 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 95 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 95 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 145 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 145 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 206 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 206 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 207 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 207 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 146 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 146 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 208 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 208 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 96 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 96 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 147 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 147 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 209 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 209 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 56 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 56 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 97 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 97 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 148 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 148 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 210 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 210 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 25 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 25 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 57 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 57 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 98 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 98 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 149 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 149 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 211 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 211 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 2 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 2 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 26 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 26 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 58 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 58 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 99 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 99 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 150 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 150 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 212 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 212 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 3 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 3 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 27 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 27 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 59 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 59 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 100 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 100 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 151 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 151 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 213 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 213 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 214 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 214 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 152 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 152 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 215 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 215 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 101 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 101 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 153 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 153 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 216 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 216 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 60 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 60 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 102 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 102 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 154 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 154 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 217 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 217 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 28 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 28 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 61 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 61 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 103 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 103 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 155 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 155 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 218 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 218 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 4 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 4 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 29 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 29 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 62 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 62 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 104 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 104 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 156 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 156 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 219 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 219 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 5 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 5 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 30 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 30 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 63 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 63 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 105 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 105 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 157 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 157 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 220 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 220 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Y_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Y_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Y_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Y_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Y_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Y_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Y_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Y_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 6 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 6 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 31 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 31 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 64 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 64 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 106 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 106 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 158 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 158 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 221 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 221 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 222 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 222 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 159 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 159 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 223 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 223 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 107 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 107 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 160 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 160 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 224 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 224 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 65 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 65 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 108 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 108 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 161 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 161 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 225 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 225 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 32 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 32 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 66 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 66 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 109 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 109 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 162 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 162 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 226 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 226 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 7 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 7 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 33 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 33 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 67 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 67 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 110 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 110 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 163 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 163 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 227 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 227 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 8 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 8 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 34 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 34 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 68 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 68 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 111 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 111 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 164 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 164 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 228 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 228 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 9 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 9 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 35 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 35 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 69 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 69 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 112 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 112 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 165 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 165 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 229 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 229 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Y_PC, t1_1, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Y_PC, t1_2, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Y_PC, t1_3, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Y_PC, t1_4, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Y_PC, t1_5, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Y_PC, t1_6, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Y_PC, t1_7, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Y_PC, t1_8, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Y_PC, t1_9, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Y_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Y_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Y_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Y_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Y_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Y_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Y_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Y_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 10 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 10 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 36 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 36 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 70 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 70 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 113 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 113 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 166 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 166 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 230 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 230 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 231 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 231 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 167 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 167 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 232 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 232 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 114 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 114 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 168 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 168 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 233 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 233 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 71 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 71 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 115 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 115 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 169 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 169 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 234 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 234 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 37 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 37 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 72 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 72 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 116 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 116 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 170 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 170 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 235 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 235 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 11 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 11 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 38 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 38 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 73 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 73 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 117 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 117 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 171 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 171 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 236 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 236 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 12 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 12 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 39 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 39 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 74 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 74 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 118 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 118 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 172 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 172 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 237 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 237 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 13 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 13 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 40 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 40 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 75 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 75 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 119 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 119 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 173 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 173 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 238 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 238 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Z_PC, t1_1, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Z_PC, t1_2, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Z_PC, t1_3, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Z_PC, t1_4, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Z_PC, t1_5, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Z_PC, t1_6, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Z_PC, t1_7, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Z_PC, t1_8, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Z_PC, t1_9, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 14 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 14 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 41 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 41 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 76 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 76 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 120 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 120 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 174 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 174 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 239 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 239 * NPTS_LOCAL + p_inner), tx);
+            t1_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_0);
+            t1_0 = SIMD_FNMA(Y_PC, t0_1, t1_0);
+            t1_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_1);
+            t1_1 = SIMD_FNMA(Y_PC, t0_2, t1_1);
+            t1_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_2);
+            t1_2 = SIMD_FNMA(Y_PC, t0_3, t1_2);
+            t1_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_3);
+            t1_3 = SIMD_FNMA(Y_PC, t0_4, t1_3);
+            t1_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_4);
+            t1_4 = SIMD_FNMA(Y_PC, t0_5, t1_4);
+            t1_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_5);
+            t1_5 = SIMD_FNMA(Y_PC, t0_6, t1_5);
+            t1_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_6);
+            t1_6 = SIMD_FNMA(Y_PC, t0_7, t1_6);
+            t1_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_7);
+            t1_7 = SIMD_FNMA(Y_PC, t0_8, t1_7);
+            t1_8 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_8);
+            t1_8 = SIMD_FNMA(Y_PC, t0_9, t1_8);
+            t1_9 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t0_9);
+            t1_9 = SIMD_FNMA(Y_PC, t0_10, t1_9);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Y_PC, t1_1, t2_0);
+            tx = SIMD_SUB(t0_0, t0_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_0 = SIMD_FMA(tx, ty, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Y_PC, t1_2, t2_1);
+            tx = SIMD_SUB(t0_1, t0_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_1 = SIMD_FMA(tx, ty, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Y_PC, t1_3, t2_2);
+            tx = SIMD_SUB(t0_2, t0_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_2 = SIMD_FMA(tx, ty, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Y_PC, t1_4, t2_3);
+            tx = SIMD_SUB(t0_3, t0_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_3 = SIMD_FMA(tx, ty, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Y_PC, t1_5, t2_4);
+            tx = SIMD_SUB(t0_4, t0_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_4 = SIMD_FMA(tx, ty, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Y_PC, t1_6, t2_5);
+            tx = SIMD_SUB(t0_5, t0_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_5 = SIMD_FMA(tx, ty, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Y_PC, t1_7, t2_6);
+            tx = SIMD_SUB(t0_6, t0_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_6 = SIMD_FMA(tx, ty, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Y_PC, t1_8, t2_7);
+            tx = SIMD_SUB(t0_7, t0_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_7 = SIMD_FMA(tx, ty, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Y_PC, t1_9, t2_8);
+            tx = SIMD_SUB(t0_8, t0_9);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_8 = SIMD_FMA(tx, ty, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Y_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Y_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Y_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Y_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Y_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Y_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Y_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Y_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Y_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Y_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Y_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Y_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Y_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Y_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Y_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Y_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Y_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Y_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Y_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Y_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Y_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 15 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 15 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Y_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Y_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Y_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Y_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Y_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 42 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 42 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Y_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Y_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Y_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Y_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 77 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 77 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Y_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Y_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Y_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 121 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 121 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Y_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Y_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 175 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 175 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Y_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 9);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 240 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 240 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 241 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 241 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 176 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 176 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 242 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 242 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 122 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 122 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 177 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 177 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 243 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 243 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 78 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 78 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 123 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 123 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 178 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 178 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 244 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 244 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 43 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 43 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 79 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 79 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 124 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 124 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 179 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 179 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 245 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 245 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 16 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 44 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 44 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 80 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 80 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 125 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 125 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 180 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 180 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 246 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 246 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 17 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 17 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 45 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 45 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 81 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 81 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 126 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 126 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 181 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 181 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 247 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 247 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 18 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 18 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 46 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 46 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 82 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 82 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 127 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 127 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 182 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 182 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 248 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 248 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Z_PC, t1_1, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Z_PC, t1_2, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Z_PC, t1_3, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Z_PC, t1_4, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Z_PC, t1_5, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Z_PC, t1_6, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Z_PC, t1_7, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Z_PC, t1_8, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Z_PC, t1_9, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 19 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 19 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 47 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 47 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 83 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 83 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 128 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 128 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 183 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 183 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 249 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 249 * NPTS_LOCAL + p_inner), tx);
+            t1_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_0);
+            t1_0 = SIMD_FNMA(Z_PC, t0_1, t1_0);
+            t1_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_1);
+            t1_1 = SIMD_FNMA(Z_PC, t0_2, t1_1);
+            t1_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_2);
+            t1_2 = SIMD_FNMA(Z_PC, t0_3, t1_2);
+            t1_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_3);
+            t1_3 = SIMD_FNMA(Z_PC, t0_4, t1_3);
+            t1_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_4);
+            t1_4 = SIMD_FNMA(Z_PC, t0_5, t1_4);
+            t1_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_5);
+            t1_5 = SIMD_FNMA(Z_PC, t0_6, t1_5);
+            t1_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_6);
+            t1_6 = SIMD_FNMA(Z_PC, t0_7, t1_6);
+            t1_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_7);
+            t1_7 = SIMD_FNMA(Z_PC, t0_8, t1_7);
+            t1_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_8);
+            t1_8 = SIMD_FNMA(Z_PC, t0_9, t1_8);
+            t1_9 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t0_9);
+            t1_9 = SIMD_FNMA(Z_PC, t0_10, t1_9);
+            t2_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SIMD_FNMA(Z_PC, t1_1, t2_0);
+            tx = SIMD_SUB(t0_0, t0_1);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_0 = SIMD_FMA(tx, ty, t2_0);
+            t2_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SIMD_FNMA(Z_PC, t1_2, t2_1);
+            tx = SIMD_SUB(t0_1, t0_2);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_1 = SIMD_FMA(tx, ty, t2_1);
+            t2_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SIMD_FNMA(Z_PC, t1_3, t2_2);
+            tx = SIMD_SUB(t0_2, t0_3);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_2 = SIMD_FMA(tx, ty, t2_2);
+            t2_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SIMD_FNMA(Z_PC, t1_4, t2_3);
+            tx = SIMD_SUB(t0_3, t0_4);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_3 = SIMD_FMA(tx, ty, t2_3);
+            t2_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SIMD_FNMA(Z_PC, t1_5, t2_4);
+            tx = SIMD_SUB(t0_4, t0_5);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_4 = SIMD_FMA(tx, ty, t2_4);
+            t2_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SIMD_FNMA(Z_PC, t1_6, t2_5);
+            tx = SIMD_SUB(t0_5, t0_6);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_5 = SIMD_FMA(tx, ty, t2_5);
+            t2_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SIMD_FNMA(Z_PC, t1_7, t2_6);
+            tx = SIMD_SUB(t0_6, t0_7);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_6 = SIMD_FMA(tx, ty, t2_6);
+            t2_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SIMD_FNMA(Z_PC, t1_8, t2_7);
+            tx = SIMD_SUB(t0_7, t0_8);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_7 = SIMD_FMA(tx, ty, t2_7);
+            t2_8 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SIMD_FNMA(Z_PC, t1_9, t2_8);
+            tx = SIMD_SUB(t0_8, t0_9);
+            ty = SIMD_SET1(0.5 * 1);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t2_8 = SIMD_FMA(tx, ty, t2_8);
+            t3_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SIMD_FNMA(Z_PC, t2_1, t3_0);
+            tx = SIMD_SUB(t1_0, t1_1);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_0 = SIMD_FMA(tx, ty, t3_0);
+            t3_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SIMD_FNMA(Z_PC, t2_2, t3_1);
+            tx = SIMD_SUB(t1_1, t1_2);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_1 = SIMD_FMA(tx, ty, t3_1);
+            t3_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SIMD_FNMA(Z_PC, t2_3, t3_2);
+            tx = SIMD_SUB(t1_2, t1_3);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_2 = SIMD_FMA(tx, ty, t3_2);
+            t3_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SIMD_FNMA(Z_PC, t2_4, t3_3);
+            tx = SIMD_SUB(t1_3, t1_4);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_3 = SIMD_FMA(tx, ty, t3_3);
+            t3_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SIMD_FNMA(Z_PC, t2_5, t3_4);
+            tx = SIMD_SUB(t1_4, t1_5);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_4 = SIMD_FMA(tx, ty, t3_4);
+            t3_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SIMD_FNMA(Z_PC, t2_6, t3_5);
+            tx = SIMD_SUB(t1_5, t1_6);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_5 = SIMD_FMA(tx, ty, t3_5);
+            t3_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SIMD_FNMA(Z_PC, t2_7, t3_6);
+            tx = SIMD_SUB(t1_6, t1_7);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_6 = SIMD_FMA(tx, ty, t3_6);
+            t3_7 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SIMD_FNMA(Z_PC, t2_8, t3_7);
+            tx = SIMD_SUB(t1_7, t1_8);
+            ty = SIMD_SET1(0.5 * 2);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t3_7 = SIMD_FMA(tx, ty, t3_7);
+            t4_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SIMD_FNMA(Z_PC, t3_1, t4_0);
+            tx = SIMD_SUB(t2_0, t2_1);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_0 = SIMD_FMA(tx, ty, t4_0);
+            t4_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SIMD_FNMA(Z_PC, t3_2, t4_1);
+            tx = SIMD_SUB(t2_1, t2_2);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_1 = SIMD_FMA(tx, ty, t4_1);
+            t4_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SIMD_FNMA(Z_PC, t3_3, t4_2);
+            tx = SIMD_SUB(t2_2, t2_3);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_2 = SIMD_FMA(tx, ty, t4_2);
+            t4_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SIMD_FNMA(Z_PC, t3_4, t4_3);
+            tx = SIMD_SUB(t2_3, t2_4);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_3 = SIMD_FMA(tx, ty, t4_3);
+            t4_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SIMD_FNMA(Z_PC, t3_5, t4_4);
+            tx = SIMD_SUB(t2_4, t2_5);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_4 = SIMD_FMA(tx, ty, t4_4);
+            t4_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SIMD_FNMA(Z_PC, t3_6, t4_5);
+            tx = SIMD_SUB(t2_5, t2_6);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_5 = SIMD_FMA(tx, ty, t4_5);
+            t4_6 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SIMD_FNMA(Z_PC, t3_7, t4_6);
+            tx = SIMD_SUB(t2_6, t2_7);
+            ty = SIMD_SET1(0.5 * 3);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t4_6 = SIMD_FMA(tx, ty, t4_6);
+            t5_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SIMD_FNMA(Z_PC, t4_1, t5_0);
+            tx = SIMD_SUB(t3_0, t3_1);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_0 = SIMD_FMA(tx, ty, t5_0);
+            t5_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SIMD_FNMA(Z_PC, t4_2, t5_1);
+            tx = SIMD_SUB(t3_1, t3_2);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_1 = SIMD_FMA(tx, ty, t5_1);
+            t5_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SIMD_FNMA(Z_PC, t4_3, t5_2);
+            tx = SIMD_SUB(t3_2, t3_3);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_2 = SIMD_FMA(tx, ty, t5_2);
+            t5_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SIMD_FNMA(Z_PC, t4_4, t5_3);
+            tx = SIMD_SUB(t3_3, t3_4);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_3 = SIMD_FMA(tx, ty, t5_3);
+            t5_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SIMD_FNMA(Z_PC, t4_5, t5_4);
+            tx = SIMD_SUB(t3_4, t3_5);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_4 = SIMD_FMA(tx, ty, t5_4);
+            t5_5 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SIMD_FNMA(Z_PC, t4_6, t5_5);
+            tx = SIMD_SUB(t3_5, t3_6);
+            ty = SIMD_SET1(0.5 * 4);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t5_5 = SIMD_FMA(tx, ty, t5_5);
+            tx = SIMD_ALIGNED_LOAD((temp + 20 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t5_0);
+            SIMD_ALIGNED_STORE((temp + 20 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SIMD_FNMA(Z_PC, t5_1, t6_0);
+            tx = SIMD_SUB(t4_0, t4_1);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_0 = SIMD_FMA(tx, ty, t6_0);
+            t6_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SIMD_FNMA(Z_PC, t5_2, t6_1);
+            tx = SIMD_SUB(t4_1, t4_2);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_1 = SIMD_FMA(tx, ty, t6_1);
+            t6_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SIMD_FNMA(Z_PC, t5_3, t6_2);
+            tx = SIMD_SUB(t4_2, t4_3);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_2 = SIMD_FMA(tx, ty, t6_2);
+            t6_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SIMD_FNMA(Z_PC, t5_4, t6_3);
+            tx = SIMD_SUB(t4_3, t4_4);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_3 = SIMD_FMA(tx, ty, t6_3);
+            t6_4 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SIMD_FNMA(Z_PC, t5_5, t6_4);
+            tx = SIMD_SUB(t4_4, t4_5);
+            ty = SIMD_SET1(0.5 * 5);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t6_4 = SIMD_FMA(tx, ty, t6_4);
+            tx = SIMD_ALIGNED_LOAD((temp + 48 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t6_0);
+            SIMD_ALIGNED_STORE((temp + 48 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SIMD_FNMA(Z_PC, t6_1, t7_0);
+            tx = SIMD_SUB(t5_0, t5_1);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_0 = SIMD_FMA(tx, ty, t7_0);
+            t7_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SIMD_FNMA(Z_PC, t6_2, t7_1);
+            tx = SIMD_SUB(t5_1, t5_2);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_1 = SIMD_FMA(tx, ty, t7_1);
+            t7_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SIMD_FNMA(Z_PC, t6_3, t7_2);
+            tx = SIMD_SUB(t5_2, t5_3);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_2 = SIMD_FMA(tx, ty, t7_2);
+            t7_3 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SIMD_FNMA(Z_PC, t6_4, t7_3);
+            tx = SIMD_SUB(t5_3, t5_4);
+            ty = SIMD_SET1(0.5 * 6);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t7_3 = SIMD_FMA(tx, ty, t7_3);
+            tx = SIMD_ALIGNED_LOAD((temp + 84 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t7_0);
+            SIMD_ALIGNED_STORE((temp + 84 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SIMD_FNMA(Z_PC, t7_1, t8_0);
+            tx = SIMD_SUB(t6_0, t6_1);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_0 = SIMD_FMA(tx, ty, t8_0);
+            t8_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SIMD_FNMA(Z_PC, t7_2, t8_1);
+            tx = SIMD_SUB(t6_1, t6_2);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_1 = SIMD_FMA(tx, ty, t8_1);
+            t8_2 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SIMD_FNMA(Z_PC, t7_3, t8_2);
+            tx = SIMD_SUB(t6_2, t6_3);
+            ty = SIMD_SET1(0.5 * 7);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t8_2 = SIMD_FMA(tx, ty, t8_2);
+            tx = SIMD_ALIGNED_LOAD((temp + 129 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t8_0);
+            SIMD_ALIGNED_STORE((temp + 129 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SIMD_FNMA(Z_PC, t8_1, t9_0);
+            tx = SIMD_SUB(t7_0, t7_1);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_0 = SIMD_FMA(tx, ty, t9_0);
+            t9_1 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SIMD_FNMA(Z_PC, t8_2, t9_1);
+            tx = SIMD_SUB(t7_1, t7_2);
+            ty = SIMD_SET1(0.5 * 8);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t9_1 = SIMD_FMA(tx, ty, t9_1);
+            tx = SIMD_ALIGNED_LOAD((temp + 184 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t9_0);
+            SIMD_ALIGNED_STORE((temp + 184 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SIMD_MUL(SIMD_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SIMD_FNMA(Z_PC, t9_1, t10_0);
+            tx = SIMD_SUB(t8_0, t8_1);
+            ty = SIMD_SET1(0.5 * 9);
+            ty = SIMD_MUL(ty, SIMD_DUPLICATE(&(RHO_INV)));
+            t10_0 = SIMD_FMA(tx, ty, t10_0);
+            tx = SIMD_ALIGNED_LOAD((temp + 250 * NPTS_LOCAL + p_inner));
+            tx = SIMD_ADD(tx, t10_0);
+            SIMD_ALIGNED_STORE((temp + 250 * NPTS_LOCAL + p_inner), tx);
+         }
+
+         for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
+            SCALAR_TYPE xC = SCALAR_LOAD((_point_outer + p_inner + 0 * npts));
+            SCALAR_TYPE yC = SCALAR_LOAD((_point_outer + p_inner + 1 * npts));
+            SCALAR_TYPE zC = SCALAR_LOAD((_point_outer + p_inner + 2 * npts));
+
+            SCALAR_TYPE X_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(xP)), xC);
+            SCALAR_TYPE Y_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(yP)), yC);
+            SCALAR_TYPE Z_PC = SCALAR_SUB(SCALAR_DUPLICATE(&(zP)), zC);
+
+            SCALAR_TYPE tval, tval_inv_e, tx, ty, t0_0, t0_1, t0_2, t0_3, t0_4, t0_5, t0_6, t0_7, t0_8, t0_9, t0_10, t1_0, t1_1, t1_2, t1_3, t1_4, t1_5, t1_6, t1_7, t1_8, t1_9, t2_0, t2_1, t2_2, t2_3, t2_4, t2_5, t2_6, t2_7, t2_8, t3_0, t3_1, t3_2, t3_3, t3_4, t3_5, t3_6, t3_7, t4_0, t4_1, t4_2, t4_3, t4_4, t4_5, t4_6, t5_0, t5_1, t5_2, t5_3, t5_4, t5_5, t6_0, t6_1, t6_2, t6_3, t6_4, t7_0, t7_1, t7_2, t7_3, t8_0, t8_1, t8_2, t9_0, t9_1, t10_0;
+
+            tval = SCALAR_LOAD((Tval + p_inner));
+            tval_inv_e = SCALAR_LOAD((Tval_inv_e + p_inner));
+
+            t0_10 = SCALAR_LOAD((FmT + p_inner));
+            t0_9 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_10), tval_inv_e), SCALAR_SET1(0.10526315789473683626));
+            t0_8 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_9), tval_inv_e), SCALAR_SET1(0.11764705882352941013));
+            t0_7 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_8), tval_inv_e), SCALAR_SET1(0.13333333333333333148));
+            t0_6 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_7), tval_inv_e), SCALAR_SET1(0.15384615384615385469));
+            t0_5 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_6), tval_inv_e), SCALAR_SET1(0.18181818181818182323));
+            t0_4 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_5), tval_inv_e), SCALAR_SET1(0.22222222222222220989));
+            t0_3 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_4), tval_inv_e), SCALAR_SET1(0.28571428571428569843));
+            t0_2 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_3), tval_inv_e), SCALAR_SET1(0.40000000000000002220));
+            t0_1 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_2), tval_inv_e), SCALAR_SET1(0.66666666666666662966));
+            t0_0 = SCALAR_MUL(SCALAR_ADD(SCALAR_MUL(tval, t0_1), tval_inv_e), SCALAR_SET1(2.00000000000000000000));
+
+            t0_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_0);
+            t0_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_1);
+            t0_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_2);
+            t0_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_3);
+            t0_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_4);
+            t0_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_5);
+            t0_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_6);
+            t0_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_7);
+            t0_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_8);
+            t0_9 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_9);
+            t0_10 = SCALAR_MUL(SCALAR_DUPLICATE(&(eval)), t0_10);
+            t1_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_0);
+            t1_0 = SCALAR_FNMA(X_PC, t0_1, t1_0);
+            t1_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_1);
+            t1_1 = SCALAR_FNMA(X_PC, t0_2, t1_1);
+            t1_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_2);
+            t1_2 = SCALAR_FNMA(X_PC, t0_3, t1_2);
+            t1_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_3);
+            t1_3 = SCALAR_FNMA(X_PC, t0_4, t1_3);
+            t1_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_4);
+            t1_4 = SCALAR_FNMA(X_PC, t0_5, t1_4);
+            t1_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_5);
+            t1_5 = SCALAR_FNMA(X_PC, t0_6, t1_5);
+            t1_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_6);
+            t1_6 = SCALAR_FNMA(X_PC, t0_7, t1_6);
+            t1_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_7);
+            t1_7 = SCALAR_FNMA(X_PC, t0_8, t1_7);
+            t1_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_8);
+            t1_8 = SCALAR_FNMA(X_PC, t0_9, t1_8);
+            t1_9 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t0_9);
+            t1_9 = SCALAR_FNMA(X_PC, t0_10, t1_9);
+            t2_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_0);
+            t2_0 = SCALAR_FNMA(X_PC, t1_1, t2_0);
+            tx = SCALAR_SUB(t0_0, t0_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_0 = SCALAR_FMA(tx, ty, t2_0);
+            t2_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_1);
+            t2_1 = SCALAR_FNMA(X_PC, t1_2, t2_1);
+            tx = SCALAR_SUB(t0_1, t0_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_1 = SCALAR_FMA(tx, ty, t2_1);
+            t2_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_2);
+            t2_2 = SCALAR_FNMA(X_PC, t1_3, t2_2);
+            tx = SCALAR_SUB(t0_2, t0_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_2 = SCALAR_FMA(tx, ty, t2_2);
+            t2_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_3);
+            t2_3 = SCALAR_FNMA(X_PC, t1_4, t2_3);
+            tx = SCALAR_SUB(t0_3, t0_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_3 = SCALAR_FMA(tx, ty, t2_3);
+            t2_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_4);
+            t2_4 = SCALAR_FNMA(X_PC, t1_5, t2_4);
+            tx = SCALAR_SUB(t0_4, t0_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_4 = SCALAR_FMA(tx, ty, t2_4);
+            t2_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_5);
+            t2_5 = SCALAR_FNMA(X_PC, t1_6, t2_5);
+            tx = SCALAR_SUB(t0_5, t0_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_5 = SCALAR_FMA(tx, ty, t2_5);
+            t2_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_6);
+            t2_6 = SCALAR_FNMA(X_PC, t1_7, t2_6);
+            tx = SCALAR_SUB(t0_6, t0_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_6 = SCALAR_FMA(tx, ty, t2_6);
+            t2_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_7);
+            t2_7 = SCALAR_FNMA(X_PC, t1_8, t2_7);
+            tx = SCALAR_SUB(t0_7, t0_8);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_7 = SCALAR_FMA(tx, ty, t2_7);
+            t2_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t1_8);
+            t2_8 = SCALAR_FNMA(X_PC, t1_9, t2_8);
+            tx = SCALAR_SUB(t0_8, t0_9);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_8 = SCALAR_FMA(tx, ty, t2_8);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(X_PC, t2_1, t3_0);
+            tx = SCALAR_SUB(t1_0, t1_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_0 = SCALAR_FMA(tx, ty, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(X_PC, t2_2, t3_1);
+            tx = SCALAR_SUB(t1_1, t1_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_1 = SCALAR_FMA(tx, ty, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(X_PC, t2_3, t3_2);
+            tx = SCALAR_SUB(t1_2, t1_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_2 = SCALAR_FMA(tx, ty, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(X_PC, t2_4, t3_3);
+            tx = SCALAR_SUB(t1_3, t1_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_3 = SCALAR_FMA(tx, ty, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(X_PC, t2_5, t3_4);
+            tx = SCALAR_SUB(t1_4, t1_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_4 = SCALAR_FMA(tx, ty, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(X_PC, t2_6, t3_5);
+            tx = SCALAR_SUB(t1_5, t1_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_5 = SCALAR_FMA(tx, ty, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(X_PC, t2_7, t3_6);
+            tx = SCALAR_SUB(t1_6, t1_7);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_6 = SCALAR_FMA(tx, ty, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(X_PC, t2_8, t3_7);
+            tx = SCALAR_SUB(t1_7, t1_8);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_7 = SCALAR_FMA(tx, ty, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(X_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(X_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(X_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(X_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(X_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(X_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(X_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(X_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(X_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(X_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(X_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(X_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(X_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 0 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 0 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(X_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(X_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(X_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(X_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(X_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 21 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 21 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(X_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(X_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(X_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(X_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 49 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 49 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(X_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(X_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(X_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 85 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 85 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(X_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(X_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 130 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 130 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(X_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(X_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 9);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 185 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 185 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 186 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 186 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 187 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 187 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 131 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 131 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 188 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 188 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 189 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 189 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 132 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 132 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 190 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 190 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 86 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 86 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 133 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 133 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 191 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 191 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 192 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 192 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 134 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 134 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 193 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 193 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 87 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 87 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 135 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 135 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 194 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 194 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 50 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 50 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 88 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 88 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 136 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 136 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 195 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 195 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 196 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 196 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 137 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 137 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 197 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 197 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 89 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 89 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 138 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 138 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 198 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 198 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 51 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 51 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 90 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 90 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 139 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 139 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 199 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 199 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Y_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Y_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Y_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Y_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Y_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 22 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 22 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 52 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 52 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 91 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 91 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 140 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 140 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 200 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 200 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 201 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 201 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 141 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 141 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 202 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 202 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 92 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 92 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 142 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 142 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 203 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 203 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 53 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 53 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 93 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 93 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 143 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 143 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 204 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 204 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 23 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 23 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 54 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 54 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 94 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 94 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 144 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 144 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 205 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 205 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Y_PC, t4_1, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Y_PC, t4_2, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Y_PC, t4_3, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Y_PC, t4_4, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Y_PC, t4_5, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Y_PC, t4_6, t5_5);
+            tx = SCALAR_LOAD((temp + 1 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 1 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Y_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Y_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Y_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Y_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Y_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 24 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 24 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 55 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 55 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 95 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 95 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 145 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 145 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 206 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 206 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 207 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 207 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 146 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 146 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 208 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 208 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 96 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 96 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 147 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 147 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 209 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 209 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 56 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 56 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 97 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 97 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 148 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 148 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 210 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 210 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 25 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 25 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 57 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 57 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 98 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 98 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 149 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 149 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 211 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 211 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_LOAD((temp + 2 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 2 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 26 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 26 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 58 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 58 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 99 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 99 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 150 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 150 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 212 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 212 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Y_PC, t3_1, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Y_PC, t3_2, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Y_PC, t3_3, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Y_PC, t3_4, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Y_PC, t3_5, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Y_PC, t3_6, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Y_PC, t3_7, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Y_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Y_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Y_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Y_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Y_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Y_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 3 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 3 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Y_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Y_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Y_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Y_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Y_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 27 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 27 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 59 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 59 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 100 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 100 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 151 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 151 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 213 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 213 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 214 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 214 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 152 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 152 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 215 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 215 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 101 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 101 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 153 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 153 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 216 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 216 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 60 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 60 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 102 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 102 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 154 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 154 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 217 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 217 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 28 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 28 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 61 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 61 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 103 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 103 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 155 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 155 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 218 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 218 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_LOAD((temp + 4 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 4 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 29 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 29 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 62 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 62 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 104 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 104 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 156 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 156 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 219 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 219 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 5 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 5 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 30 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 30 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 63 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 63 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 105 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 105 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 157 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 157 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 220 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 220 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Y_PC, t2_1, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Y_PC, t2_2, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Y_PC, t2_3, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Y_PC, t2_4, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Y_PC, t2_5, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Y_PC, t2_6, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Y_PC, t2_7, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Y_PC, t2_8, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Y_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Y_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Y_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Y_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Y_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Y_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Y_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Y_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Y_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Y_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Y_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Y_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Y_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 6 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 6 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Y_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Y_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Y_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Y_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Y_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 31 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 31 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 64 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 64 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 106 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 106 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 158 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 158 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 221 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 221 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 222 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 222 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 159 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 159 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 223 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 223 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 107 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 107 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 160 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 160 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 224 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 224 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 65 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 65 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 108 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 108 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 161 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 161 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 225 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 225 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 32 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 32 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 66 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 66 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 109 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 109 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 162 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 162 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 226 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 226 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_LOAD((temp + 7 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 7 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 33 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 33 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 67 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 67 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 110 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 110 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 163 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 163 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 227 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 227 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 8 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 8 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 34 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 34 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 68 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 68 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 111 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 111 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 164 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 164 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 228 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 228 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 9 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 9 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 35 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 35 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 69 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 69 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 112 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 112 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 165 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 165 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 229 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 229 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_0);
+            t2_0 = SCALAR_FNMA(Y_PC, t1_1, t2_0);
+            t2_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_1);
+            t2_1 = SCALAR_FNMA(Y_PC, t1_2, t2_1);
+            t2_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_2);
+            t2_2 = SCALAR_FNMA(Y_PC, t1_3, t2_2);
+            t2_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_3);
+            t2_3 = SCALAR_FNMA(Y_PC, t1_4, t2_3);
+            t2_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_4);
+            t2_4 = SCALAR_FNMA(Y_PC, t1_5, t2_4);
+            t2_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_5);
+            t2_5 = SCALAR_FNMA(Y_PC, t1_6, t2_5);
+            t2_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_6);
+            t2_6 = SCALAR_FNMA(Y_PC, t1_7, t2_6);
+            t2_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_7);
+            t2_7 = SCALAR_FNMA(Y_PC, t1_8, t2_7);
+            t2_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_8);
+            t2_8 = SCALAR_FNMA(Y_PC, t1_9, t2_8);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Y_PC, t2_1, t3_0);
+            tx = SCALAR_SUB(t1_0, t1_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_0 = SCALAR_FMA(tx, ty, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Y_PC, t2_2, t3_1);
+            tx = SCALAR_SUB(t1_1, t1_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_1 = SCALAR_FMA(tx, ty, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Y_PC, t2_3, t3_2);
+            tx = SCALAR_SUB(t1_2, t1_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_2 = SCALAR_FMA(tx, ty, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Y_PC, t2_4, t3_3);
+            tx = SCALAR_SUB(t1_3, t1_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_3 = SCALAR_FMA(tx, ty, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Y_PC, t2_5, t3_4);
+            tx = SCALAR_SUB(t1_4, t1_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_4 = SCALAR_FMA(tx, ty, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Y_PC, t2_6, t3_5);
+            tx = SCALAR_SUB(t1_5, t1_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_5 = SCALAR_FMA(tx, ty, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Y_PC, t2_7, t3_6);
+            tx = SCALAR_SUB(t1_6, t1_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_6 = SCALAR_FMA(tx, ty, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Y_PC, t2_8, t3_7);
+            tx = SCALAR_SUB(t1_7, t1_8);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_7 = SCALAR_FMA(tx, ty, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Y_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Y_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Y_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Y_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Y_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Y_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Y_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Y_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Y_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Y_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Y_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Y_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Y_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 10 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 10 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Y_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Y_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Y_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Y_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Y_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 36 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 36 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 70 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 70 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 113 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 113 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 166 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 166 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 230 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 230 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 231 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 231 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 167 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 167 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 232 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 232 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 114 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 114 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 168 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 168 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 233 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 233 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 71 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 71 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 115 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 115 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 169 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 169 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 234 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 234 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 37 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 37 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 72 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 72 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 116 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 116 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 170 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 170 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 235 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 235 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_LOAD((temp + 11 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 11 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 38 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 38 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 73 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 73 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 117 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 117 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 171 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 171 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 236 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 236 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 12 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 12 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 39 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 39 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 74 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 74 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 118 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 118 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 172 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 172 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 237 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 237 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 13 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 13 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 40 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 40 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 75 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 75 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 119 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 119 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 173 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 173 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 238 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 238 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SCALAR_FNMA(Z_PC, t1_1, t2_0);
+            t2_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SCALAR_FNMA(Z_PC, t1_2, t2_1);
+            t2_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SCALAR_FNMA(Z_PC, t1_3, t2_2);
+            t2_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SCALAR_FNMA(Z_PC, t1_4, t2_3);
+            t2_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SCALAR_FNMA(Z_PC, t1_5, t2_4);
+            t2_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SCALAR_FNMA(Z_PC, t1_6, t2_5);
+            t2_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SCALAR_FNMA(Z_PC, t1_7, t2_6);
+            t2_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SCALAR_FNMA(Z_PC, t1_8, t2_7);
+            t2_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SCALAR_FNMA(Z_PC, t1_9, t2_8);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Z_PC, t2_1, t3_0);
+            tx = SCALAR_SUB(t1_0, t1_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_0 = SCALAR_FMA(tx, ty, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Z_PC, t2_2, t3_1);
+            tx = SCALAR_SUB(t1_1, t1_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_1 = SCALAR_FMA(tx, ty, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Z_PC, t2_3, t3_2);
+            tx = SCALAR_SUB(t1_2, t1_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_2 = SCALAR_FMA(tx, ty, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Z_PC, t2_4, t3_3);
+            tx = SCALAR_SUB(t1_3, t1_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_3 = SCALAR_FMA(tx, ty, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Z_PC, t2_5, t3_4);
+            tx = SCALAR_SUB(t1_4, t1_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_4 = SCALAR_FMA(tx, ty, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Z_PC, t2_6, t3_5);
+            tx = SCALAR_SUB(t1_5, t1_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_5 = SCALAR_FMA(tx, ty, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Z_PC, t2_7, t3_6);
+            tx = SCALAR_SUB(t1_6, t1_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_6 = SCALAR_FMA(tx, ty, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Z_PC, t2_8, t3_7);
+            tx = SCALAR_SUB(t1_7, t1_8);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_7 = SCALAR_FMA(tx, ty, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 14 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 14 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 41 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 41 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 76 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 76 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 120 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 120 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 174 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 174 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 239 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 239 * NPTS_LOCAL + p_inner), tx);
+            t1_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_0);
+            t1_0 = SCALAR_FNMA(Y_PC, t0_1, t1_0);
+            t1_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_1);
+            t1_1 = SCALAR_FNMA(Y_PC, t0_2, t1_1);
+            t1_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_2);
+            t1_2 = SCALAR_FNMA(Y_PC, t0_3, t1_2);
+            t1_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_3);
+            t1_3 = SCALAR_FNMA(Y_PC, t0_4, t1_3);
+            t1_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_4);
+            t1_4 = SCALAR_FNMA(Y_PC, t0_5, t1_4);
+            t1_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_5);
+            t1_5 = SCALAR_FNMA(Y_PC, t0_6, t1_5);
+            t1_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_6);
+            t1_6 = SCALAR_FNMA(Y_PC, t0_7, t1_6);
+            t1_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_7);
+            t1_7 = SCALAR_FNMA(Y_PC, t0_8, t1_7);
+            t1_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_8);
+            t1_8 = SCALAR_FNMA(Y_PC, t0_9, t1_8);
+            t1_9 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t0_9);
+            t1_9 = SCALAR_FNMA(Y_PC, t0_10, t1_9);
+            t2_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_0);
+            t2_0 = SCALAR_FNMA(Y_PC, t1_1, t2_0);
+            tx = SCALAR_SUB(t0_0, t0_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_0 = SCALAR_FMA(tx, ty, t2_0);
+            t2_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_1);
+            t2_1 = SCALAR_FNMA(Y_PC, t1_2, t2_1);
+            tx = SCALAR_SUB(t0_1, t0_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_1 = SCALAR_FMA(tx, ty, t2_1);
+            t2_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_2);
+            t2_2 = SCALAR_FNMA(Y_PC, t1_3, t2_2);
+            tx = SCALAR_SUB(t0_2, t0_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_2 = SCALAR_FMA(tx, ty, t2_2);
+            t2_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_3);
+            t2_3 = SCALAR_FNMA(Y_PC, t1_4, t2_3);
+            tx = SCALAR_SUB(t0_3, t0_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_3 = SCALAR_FMA(tx, ty, t2_3);
+            t2_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_4);
+            t2_4 = SCALAR_FNMA(Y_PC, t1_5, t2_4);
+            tx = SCALAR_SUB(t0_4, t0_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_4 = SCALAR_FMA(tx, ty, t2_4);
+            t2_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_5);
+            t2_5 = SCALAR_FNMA(Y_PC, t1_6, t2_5);
+            tx = SCALAR_SUB(t0_5, t0_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_5 = SCALAR_FMA(tx, ty, t2_5);
+            t2_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_6);
+            t2_6 = SCALAR_FNMA(Y_PC, t1_7, t2_6);
+            tx = SCALAR_SUB(t0_6, t0_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_6 = SCALAR_FMA(tx, ty, t2_6);
+            t2_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_7);
+            t2_7 = SCALAR_FNMA(Y_PC, t1_8, t2_7);
+            tx = SCALAR_SUB(t0_7, t0_8);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_7 = SCALAR_FMA(tx, ty, t2_7);
+            t2_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t1_8);
+            t2_8 = SCALAR_FNMA(Y_PC, t1_9, t2_8);
+            tx = SCALAR_SUB(t0_8, t0_9);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_8 = SCALAR_FMA(tx, ty, t2_8);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Y_PC, t2_1, t3_0);
+            tx = SCALAR_SUB(t1_0, t1_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_0 = SCALAR_FMA(tx, ty, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Y_PC, t2_2, t3_1);
+            tx = SCALAR_SUB(t1_1, t1_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_1 = SCALAR_FMA(tx, ty, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Y_PC, t2_3, t3_2);
+            tx = SCALAR_SUB(t1_2, t1_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_2 = SCALAR_FMA(tx, ty, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Y_PC, t2_4, t3_3);
+            tx = SCALAR_SUB(t1_3, t1_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_3 = SCALAR_FMA(tx, ty, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Y_PC, t2_5, t3_4);
+            tx = SCALAR_SUB(t1_4, t1_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_4 = SCALAR_FMA(tx, ty, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Y_PC, t2_6, t3_5);
+            tx = SCALAR_SUB(t1_5, t1_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_5 = SCALAR_FMA(tx, ty, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Y_PC, t2_7, t3_6);
+            tx = SCALAR_SUB(t1_6, t1_7);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_6 = SCALAR_FMA(tx, ty, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Y_PC, t2_8, t3_7);
+            tx = SCALAR_SUB(t1_7, t1_8);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_7 = SCALAR_FMA(tx, ty, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Y_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Y_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Y_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Y_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Y_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Y_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Y_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Y_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Y_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Y_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Y_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Y_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Y_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 15 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 15 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Y_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Y_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Y_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Y_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Y_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 42 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 42 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Y_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Y_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Y_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Y_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 77 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 77 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Y_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Y_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Y_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 121 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 121 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Y_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Y_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 175 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 175 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Y_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Y_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 9);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 240 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 240 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_LOAD((temp + 241 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 241 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_LOAD((temp + 176 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 176 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 242 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 242 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_LOAD((temp + 122 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 122 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 177 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 177 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 243 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 243 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_LOAD((temp + 78 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 78 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 123 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 123 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 178 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 178 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 244 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 244 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_LOAD((temp + 43 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 43 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 79 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 79 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 124 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 124 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 179 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 179 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 245 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 245 * NPTS_LOCAL + p_inner), tx);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_LOAD((temp + 16 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 16 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 44 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 44 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 80 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 80 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 125 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 125 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 180 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 180 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 246 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 246 * NPTS_LOCAL + p_inner), tx);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 17 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 17 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 45 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 45 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 81 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 81 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 126 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 126 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 181 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 181 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 247 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 247 * NPTS_LOCAL + p_inner), tx);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Z_PC, t2_1, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Z_PC, t2_2, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Z_PC, t2_3, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Z_PC, t2_4, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Z_PC, t2_5, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Z_PC, t2_6, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Z_PC, t2_7, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Z_PC, t2_8, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 18 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 18 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 46 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 46 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 82 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 82 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 127 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 127 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 182 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 182 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 248 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 248 * NPTS_LOCAL + p_inner), tx);
+            t2_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SCALAR_FNMA(Z_PC, t1_1, t2_0);
+            t2_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SCALAR_FNMA(Z_PC, t1_2, t2_1);
+            t2_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SCALAR_FNMA(Z_PC, t1_3, t2_2);
+            t2_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SCALAR_FNMA(Z_PC, t1_4, t2_3);
+            t2_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SCALAR_FNMA(Z_PC, t1_5, t2_4);
+            t2_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SCALAR_FNMA(Z_PC, t1_6, t2_5);
+            t2_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SCALAR_FNMA(Z_PC, t1_7, t2_6);
+            t2_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SCALAR_FNMA(Z_PC, t1_8, t2_7);
+            t2_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SCALAR_FNMA(Z_PC, t1_9, t2_8);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Z_PC, t2_1, t3_0);
+            tx = SCALAR_SUB(t1_0, t1_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_0 = SCALAR_FMA(tx, ty, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Z_PC, t2_2, t3_1);
+            tx = SCALAR_SUB(t1_1, t1_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_1 = SCALAR_FMA(tx, ty, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Z_PC, t2_3, t3_2);
+            tx = SCALAR_SUB(t1_2, t1_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_2 = SCALAR_FMA(tx, ty, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Z_PC, t2_4, t3_3);
+            tx = SCALAR_SUB(t1_3, t1_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_3 = SCALAR_FMA(tx, ty, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Z_PC, t2_5, t3_4);
+            tx = SCALAR_SUB(t1_4, t1_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_4 = SCALAR_FMA(tx, ty, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Z_PC, t2_6, t3_5);
+            tx = SCALAR_SUB(t1_5, t1_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_5 = SCALAR_FMA(tx, ty, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Z_PC, t2_7, t3_6);
+            tx = SCALAR_SUB(t1_6, t1_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_6 = SCALAR_FMA(tx, ty, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Z_PC, t2_8, t3_7);
+            tx = SCALAR_SUB(t1_7, t1_8);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_7 = SCALAR_FMA(tx, ty, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 19 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 19 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 47 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 47 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 83 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 83 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 128 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 128 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 183 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 183 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 249 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 249 * NPTS_LOCAL + p_inner), tx);
+            t1_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_0);
+            t1_0 = SCALAR_FNMA(Z_PC, t0_1, t1_0);
+            t1_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_1);
+            t1_1 = SCALAR_FNMA(Z_PC, t0_2, t1_1);
+            t1_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_2);
+            t1_2 = SCALAR_FNMA(Z_PC, t0_3, t1_2);
+            t1_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_3);
+            t1_3 = SCALAR_FNMA(Z_PC, t0_4, t1_3);
+            t1_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_4);
+            t1_4 = SCALAR_FNMA(Z_PC, t0_5, t1_4);
+            t1_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_5);
+            t1_5 = SCALAR_FNMA(Z_PC, t0_6, t1_5);
+            t1_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_6);
+            t1_6 = SCALAR_FNMA(Z_PC, t0_7, t1_6);
+            t1_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_7);
+            t1_7 = SCALAR_FNMA(Z_PC, t0_8, t1_7);
+            t1_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_8);
+            t1_8 = SCALAR_FNMA(Z_PC, t0_9, t1_8);
+            t1_9 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t0_9);
+            t1_9 = SCALAR_FNMA(Z_PC, t0_10, t1_9);
+            t2_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_0);
+            t2_0 = SCALAR_FNMA(Z_PC, t1_1, t2_0);
+            tx = SCALAR_SUB(t0_0, t0_1);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_0 = SCALAR_FMA(tx, ty, t2_0);
+            t2_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_1);
+            t2_1 = SCALAR_FNMA(Z_PC, t1_2, t2_1);
+            tx = SCALAR_SUB(t0_1, t0_2);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_1 = SCALAR_FMA(tx, ty, t2_1);
+            t2_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_2);
+            t2_2 = SCALAR_FNMA(Z_PC, t1_3, t2_2);
+            tx = SCALAR_SUB(t0_2, t0_3);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_2 = SCALAR_FMA(tx, ty, t2_2);
+            t2_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_3);
+            t2_3 = SCALAR_FNMA(Z_PC, t1_4, t2_3);
+            tx = SCALAR_SUB(t0_3, t0_4);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_3 = SCALAR_FMA(tx, ty, t2_3);
+            t2_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_4);
+            t2_4 = SCALAR_FNMA(Z_PC, t1_5, t2_4);
+            tx = SCALAR_SUB(t0_4, t0_5);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_4 = SCALAR_FMA(tx, ty, t2_4);
+            t2_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_5);
+            t2_5 = SCALAR_FNMA(Z_PC, t1_6, t2_5);
+            tx = SCALAR_SUB(t0_5, t0_6);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_5 = SCALAR_FMA(tx, ty, t2_5);
+            t2_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_6);
+            t2_6 = SCALAR_FNMA(Z_PC, t1_7, t2_6);
+            tx = SCALAR_SUB(t0_6, t0_7);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_6 = SCALAR_FMA(tx, ty, t2_6);
+            t2_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_7);
+            t2_7 = SCALAR_FNMA(Z_PC, t1_8, t2_7);
+            tx = SCALAR_SUB(t0_7, t0_8);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_7 = SCALAR_FMA(tx, ty, t2_7);
+            t2_8 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t1_8);
+            t2_8 = SCALAR_FNMA(Z_PC, t1_9, t2_8);
+            tx = SCALAR_SUB(t0_8, t0_9);
+            ty = SCALAR_SET1(0.5 * 1);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t2_8 = SCALAR_FMA(tx, ty, t2_8);
+            t3_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_0);
+            t3_0 = SCALAR_FNMA(Z_PC, t2_1, t3_0);
+            tx = SCALAR_SUB(t1_0, t1_1);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_0 = SCALAR_FMA(tx, ty, t3_0);
+            t3_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_1);
+            t3_1 = SCALAR_FNMA(Z_PC, t2_2, t3_1);
+            tx = SCALAR_SUB(t1_1, t1_2);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_1 = SCALAR_FMA(tx, ty, t3_1);
+            t3_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_2);
+            t3_2 = SCALAR_FNMA(Z_PC, t2_3, t3_2);
+            tx = SCALAR_SUB(t1_2, t1_3);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_2 = SCALAR_FMA(tx, ty, t3_2);
+            t3_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_3);
+            t3_3 = SCALAR_FNMA(Z_PC, t2_4, t3_3);
+            tx = SCALAR_SUB(t1_3, t1_4);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_3 = SCALAR_FMA(tx, ty, t3_3);
+            t3_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_4);
+            t3_4 = SCALAR_FNMA(Z_PC, t2_5, t3_4);
+            tx = SCALAR_SUB(t1_4, t1_5);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_4 = SCALAR_FMA(tx, ty, t3_4);
+            t3_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_5);
+            t3_5 = SCALAR_FNMA(Z_PC, t2_6, t3_5);
+            tx = SCALAR_SUB(t1_5, t1_6);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_5 = SCALAR_FMA(tx, ty, t3_5);
+            t3_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_6);
+            t3_6 = SCALAR_FNMA(Z_PC, t2_7, t3_6);
+            tx = SCALAR_SUB(t1_6, t1_7);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_6 = SCALAR_FMA(tx, ty, t3_6);
+            t3_7 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t2_7);
+            t3_7 = SCALAR_FNMA(Z_PC, t2_8, t3_7);
+            tx = SCALAR_SUB(t1_7, t1_8);
+            ty = SCALAR_SET1(0.5 * 2);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t3_7 = SCALAR_FMA(tx, ty, t3_7);
+            t4_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_0);
+            t4_0 = SCALAR_FNMA(Z_PC, t3_1, t4_0);
+            tx = SCALAR_SUB(t2_0, t2_1);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_0 = SCALAR_FMA(tx, ty, t4_0);
+            t4_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_1);
+            t4_1 = SCALAR_FNMA(Z_PC, t3_2, t4_1);
+            tx = SCALAR_SUB(t2_1, t2_2);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_1 = SCALAR_FMA(tx, ty, t4_1);
+            t4_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_2);
+            t4_2 = SCALAR_FNMA(Z_PC, t3_3, t4_2);
+            tx = SCALAR_SUB(t2_2, t2_3);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_2 = SCALAR_FMA(tx, ty, t4_2);
+            t4_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_3);
+            t4_3 = SCALAR_FNMA(Z_PC, t3_4, t4_3);
+            tx = SCALAR_SUB(t2_3, t2_4);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_3 = SCALAR_FMA(tx, ty, t4_3);
+            t4_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_4);
+            t4_4 = SCALAR_FNMA(Z_PC, t3_5, t4_4);
+            tx = SCALAR_SUB(t2_4, t2_5);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_4 = SCALAR_FMA(tx, ty, t4_4);
+            t4_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_5);
+            t4_5 = SCALAR_FNMA(Z_PC, t3_6, t4_5);
+            tx = SCALAR_SUB(t2_5, t2_6);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_5 = SCALAR_FMA(tx, ty, t4_5);
+            t4_6 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t3_6);
+            t4_6 = SCALAR_FNMA(Z_PC, t3_7, t4_6);
+            tx = SCALAR_SUB(t2_6, t2_7);
+            ty = SCALAR_SET1(0.5 * 3);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t4_6 = SCALAR_FMA(tx, ty, t4_6);
+            t5_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_0);
+            t5_0 = SCALAR_FNMA(Z_PC, t4_1, t5_0);
+            tx = SCALAR_SUB(t3_0, t3_1);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_0 = SCALAR_FMA(tx, ty, t5_0);
+            t5_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_1);
+            t5_1 = SCALAR_FNMA(Z_PC, t4_2, t5_1);
+            tx = SCALAR_SUB(t3_1, t3_2);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_1 = SCALAR_FMA(tx, ty, t5_1);
+            t5_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_2);
+            t5_2 = SCALAR_FNMA(Z_PC, t4_3, t5_2);
+            tx = SCALAR_SUB(t3_2, t3_3);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_2 = SCALAR_FMA(tx, ty, t5_2);
+            t5_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_3);
+            t5_3 = SCALAR_FNMA(Z_PC, t4_4, t5_3);
+            tx = SCALAR_SUB(t3_3, t3_4);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_3 = SCALAR_FMA(tx, ty, t5_3);
+            t5_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_4);
+            t5_4 = SCALAR_FNMA(Z_PC, t4_5, t5_4);
+            tx = SCALAR_SUB(t3_4, t3_5);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_4 = SCALAR_FMA(tx, ty, t5_4);
+            t5_5 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t4_5);
+            t5_5 = SCALAR_FNMA(Z_PC, t4_6, t5_5);
+            tx = SCALAR_SUB(t3_5, t3_6);
+            ty = SCALAR_SET1(0.5 * 4);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t5_5 = SCALAR_FMA(tx, ty, t5_5);
+            tx = SCALAR_LOAD((temp + 20 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t5_0);
+            SCALAR_STORE((temp + 20 * NPTS_LOCAL + p_inner), tx);
+            t6_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_0);
+            t6_0 = SCALAR_FNMA(Z_PC, t5_1, t6_0);
+            tx = SCALAR_SUB(t4_0, t4_1);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_0 = SCALAR_FMA(tx, ty, t6_0);
+            t6_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_1);
+            t6_1 = SCALAR_FNMA(Z_PC, t5_2, t6_1);
+            tx = SCALAR_SUB(t4_1, t4_2);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_1 = SCALAR_FMA(tx, ty, t6_1);
+            t6_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_2);
+            t6_2 = SCALAR_FNMA(Z_PC, t5_3, t6_2);
+            tx = SCALAR_SUB(t4_2, t4_3);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_2 = SCALAR_FMA(tx, ty, t6_2);
+            t6_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_3);
+            t6_3 = SCALAR_FNMA(Z_PC, t5_4, t6_3);
+            tx = SCALAR_SUB(t4_3, t4_4);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_3 = SCALAR_FMA(tx, ty, t6_3);
+            t6_4 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t5_4);
+            t6_4 = SCALAR_FNMA(Z_PC, t5_5, t6_4);
+            tx = SCALAR_SUB(t4_4, t4_5);
+            ty = SCALAR_SET1(0.5 * 5);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t6_4 = SCALAR_FMA(tx, ty, t6_4);
+            tx = SCALAR_LOAD((temp + 48 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t6_0);
+            SCALAR_STORE((temp + 48 * NPTS_LOCAL + p_inner), tx);
+            t7_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_0);
+            t7_0 = SCALAR_FNMA(Z_PC, t6_1, t7_0);
+            tx = SCALAR_SUB(t5_0, t5_1);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_0 = SCALAR_FMA(tx, ty, t7_0);
+            t7_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_1);
+            t7_1 = SCALAR_FNMA(Z_PC, t6_2, t7_1);
+            tx = SCALAR_SUB(t5_1, t5_2);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_1 = SCALAR_FMA(tx, ty, t7_1);
+            t7_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_2);
+            t7_2 = SCALAR_FNMA(Z_PC, t6_3, t7_2);
+            tx = SCALAR_SUB(t5_2, t5_3);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_2 = SCALAR_FMA(tx, ty, t7_2);
+            t7_3 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t6_3);
+            t7_3 = SCALAR_FNMA(Z_PC, t6_4, t7_3);
+            tx = SCALAR_SUB(t5_3, t5_4);
+            ty = SCALAR_SET1(0.5 * 6);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t7_3 = SCALAR_FMA(tx, ty, t7_3);
+            tx = SCALAR_LOAD((temp + 84 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t7_0);
+            SCALAR_STORE((temp + 84 * NPTS_LOCAL + p_inner), tx);
+            t8_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_0);
+            t8_0 = SCALAR_FNMA(Z_PC, t7_1, t8_0);
+            tx = SCALAR_SUB(t6_0, t6_1);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_0 = SCALAR_FMA(tx, ty, t8_0);
+            t8_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_1);
+            t8_1 = SCALAR_FNMA(Z_PC, t7_2, t8_1);
+            tx = SCALAR_SUB(t6_1, t6_2);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_1 = SCALAR_FMA(tx, ty, t8_1);
+            t8_2 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t7_2);
+            t8_2 = SCALAR_FNMA(Z_PC, t7_3, t8_2);
+            tx = SCALAR_SUB(t6_2, t6_3);
+            ty = SCALAR_SET1(0.5 * 7);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t8_2 = SCALAR_FMA(tx, ty, t8_2);
+            tx = SCALAR_LOAD((temp + 129 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t8_0);
+            SCALAR_STORE((temp + 129 * NPTS_LOCAL + p_inner), tx);
+            t9_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_0);
+            t9_0 = SCALAR_FNMA(Z_PC, t8_1, t9_0);
+            tx = SCALAR_SUB(t7_0, t7_1);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_0 = SCALAR_FMA(tx, ty, t9_0);
+            t9_1 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t8_1);
+            t9_1 = SCALAR_FNMA(Z_PC, t8_2, t9_1);
+            tx = SCALAR_SUB(t7_1, t7_2);
+            ty = SCALAR_SET1(0.5 * 8);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t9_1 = SCALAR_FMA(tx, ty, t9_1);
+            tx = SCALAR_LOAD((temp + 184 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t9_0);
+            SCALAR_STORE((temp + 184 * NPTS_LOCAL + p_inner), tx);
+            t10_0 = SCALAR_MUL(SCALAR_DUPLICATE(&(Z_PA)), t9_0);
+            t10_0 = SCALAR_FNMA(Z_PC, t9_1, t10_0);
+            tx = SCALAR_SUB(t8_0, t8_1);
+            ty = SCALAR_SET1(0.5 * 9);
+            ty = SCALAR_MUL(ty, SCALAR_DUPLICATE(&(RHO_INV)));
+            t10_0 = SCALAR_FMA(tx, ty, t10_0);
+            tx = SCALAR_LOAD((temp + 250 * NPTS_LOCAL + p_inner));
+            tx = SCALAR_ADD(tx, t10_0);
+            SCALAR_STORE((temp + 250 * NPTS_LOCAL + p_inner), tx);
+         }
+      }
+
+      size_t npts_inner_upper = SIMD_LENGTH * (npts_inner / SIMD_LENGTH);
+      size_t p_inner = 0;
+      for(p_inner = 0; p_inner < npts_inner_upper; p_inner += SIMD_LENGTH) {
+         double *Xik = (Xi + p_outer + p_inner);
+         double *Xjk = (Xj + p_outer + p_inner);
+         double *Gik = (Gi + p_outer + p_inner);
+         double *Gjk = (Gj + p_outer + p_inner);
+
+         SIMD_TYPE const_value_v = SIMD_UNALIGNED_LOAD((weights + p_outer + p_inner));
+
+         for(int c0 = 0; c0 <= 5; ++c0) {
+            for(int c1 = 0; c1 <= c0; ++c1) {
+               int m = 5 - c0;
+               int n = c0 - c1;
+               int p = c1;
+
+               int idxB = (((5 - m) * (5 - m + 1)) >> 1) + p;
+
+               double X_ABp = 1.0, comb_m_i = 1.0;
+               for(int i = 0; i <= m; ++i) {
+                  double rcp_i;
+
+                  double Y_ABp = 1.0, comb_n_j = 1.0;
+                  for(int j = 0; j <= n; ++j) {
+                     double rcp_j;
+
+                     double Z_ABp = 1.0, comb_p_k = 1.0;
+                     for(int k = 0; k <= p; ++k) {
+                        double rcp_k;
+                        int mv, pv, Lv = 10 - i - j - k;
+
+                        int offset = (Lv * (Lv + 1) * (Lv + 2) - 210) / 6;
+                        double const_value = comb_m_i * comb_n_j * comb_p_k * X_ABp * Y_ABp * Z_ABp;
+                        SIMD_TYPE tx, ty, tz, tw;
+                        SIMD_TYPE const_value_w = SIMD_MUL(const_value_v, SIMD_DUPLICATE(&(const_value)));
+
+                        mv = 5 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 0 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 0 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t0 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t0 = SIMD_MUL(t0, const_value_w);
+                        tz = SIMD_FMA(ty, t0, tz);
+                        tw = SIMD_FMA(tx, t0, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 0 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 1 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 1 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t1 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t1 = SIMD_MUL(t1, const_value_w);
+                        tz = SIMD_FMA(ty, t1, tz);
+                        tw = SIMD_FMA(tx, t1, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 1 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 2 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 2 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t2 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t2 = SIMD_MUL(t2, const_value_w);
+                        tz = SIMD_FMA(ty, t2, tz);
+                        tw = SIMD_FMA(tx, t2, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 2 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 3 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 3 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t3 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t3 = SIMD_MUL(t3, const_value_w);
+                        tz = SIMD_FMA(ty, t3, tz);
+                        tw = SIMD_FMA(tx, t3, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 3 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 4 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 4 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t4 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t4 = SIMD_MUL(t4, const_value_w);
+                        tz = SIMD_FMA(ty, t4, tz);
+                        tw = SIMD_FMA(tx, t4, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 4 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 5 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 5 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t5 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t5 = SIMD_MUL(t5, const_value_w);
+                        tz = SIMD_FMA(ty, t5, tz);
+                        tw = SIMD_FMA(tx, t5, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 5 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 6 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 6 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t6 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t6 = SIMD_MUL(t6, const_value_w);
+                        tz = SIMD_FMA(ty, t6, tz);
+                        tw = SIMD_FMA(tx, t6, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 6 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 7 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 7 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t7 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t7 = SIMD_MUL(t7, const_value_w);
+                        tz = SIMD_FMA(ty, t7, tz);
+                        tw = SIMD_FMA(tx, t7, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 7 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 8 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 8 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t8 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t8 = SIMD_MUL(t8, const_value_w);
+                        tz = SIMD_FMA(ty, t8, tz);
+                        tw = SIMD_FMA(tx, t8, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 8 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 9 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 9 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t9 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t9 = SIMD_MUL(t9, const_value_w);
+                        tz = SIMD_FMA(ty, t9, tz);
+                        tw = SIMD_FMA(tx, t9, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 9 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 10 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 10 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t10 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t10 = SIMD_MUL(t10, const_value_w);
+                        tz = SIMD_FMA(ty, t10, tz);
+                        tw = SIMD_FMA(tx, t10, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 10 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 11 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 11 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t11 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t11 = SIMD_MUL(t11, const_value_w);
+                        tz = SIMD_FMA(ty, t11, tz);
+                        tw = SIMD_FMA(tx, t11, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 11 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 12 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 12 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t12 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t12 = SIMD_MUL(t12, const_value_w);
+                        tz = SIMD_FMA(ty, t12, tz);
+                        tw = SIMD_FMA(tx, t12, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 12 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 13 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 13 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t13 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t13 = SIMD_MUL(t13, const_value_w);
+                        tz = SIMD_FMA(ty, t13, tz);
+                        tw = SIMD_FMA(tx, t13, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 13 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 14 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 14 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t14 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t14 = SIMD_MUL(t14, const_value_w);
+                        tz = SIMD_FMA(ty, t14, tz);
+                        tw = SIMD_FMA(tx, t14, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 14 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 0 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 15 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 15 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t15 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t15 = SIMD_MUL(t15, const_value_w);
+                        tz = SIMD_FMA(ty, t15, tz);
+                        tw = SIMD_FMA(tx, t15, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 15 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 1 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 16 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 16 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t16 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t16 = SIMD_MUL(t16, const_value_w);
+                        tz = SIMD_FMA(ty, t16, tz);
+                        tw = SIMD_FMA(tx, t16, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 16 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 2 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 17 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 17 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t17 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t17 = SIMD_MUL(t17, const_value_w);
+                        tz = SIMD_FMA(ty, t17, tz);
+                        tw = SIMD_FMA(tx, t17, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 17 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 3 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 18 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 18 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t18 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t18 = SIMD_MUL(t18, const_value_w);
+                        tz = SIMD_FMA(ty, t18, tz);
+                        tw = SIMD_FMA(tx, t18, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 18 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 4 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 19 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 19 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t19 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t19 = SIMD_MUL(t19, const_value_w);
+                        tz = SIMD_FMA(ty, t19, tz);
+                        tw = SIMD_FMA(tx, t19, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 19 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 5 + p - k;
+                        tx = SIMD_UNALIGNED_LOAD((Xik + 20 * ldX));
+                        ty = SIMD_UNALIGNED_LOAD((Xjk + idxB * ldX));
+                        tz = SIMD_UNALIGNED_LOAD((Gik + 20 * ldG));
+                        tw = SIMD_UNALIGNED_LOAD((Gjk + idxB * ldG));
+                        SIMD_TYPE t20 = SIMD_ALIGNED_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t20 = SIMD_MUL(t20, const_value_w);
+                        tz = SIMD_FMA(ty, t20, tz);
+                        tw = SIMD_FMA(tx, t20, tw);
+                        SIMD_UNALIGNED_STORE((Gik + 20 * ldG), tz);
+                        SIMD_UNALIGNED_STORE((Gjk + idxB * ldG), tw);
+
+                        Z_ABp = SCALAR_MUL(Z_ABp, Z_AB);
+                        rcp_k = SCALAR_RECIPROCAL(k + 1);
+                        comb_p_k = SCALAR_MUL(comb_p_k, p - k);
+                        comb_p_k = SCALAR_MUL(comb_p_k, rcp_k);
+                     }
+
+                     Y_ABp = SCALAR_MUL(Y_ABp, Y_AB);
+                     rcp_j = SCALAR_RECIPROCAL(j + 1);
+                     comb_n_j = SCALAR_MUL(comb_n_j, n - j);
+                     comb_n_j = SCALAR_MUL(comb_n_j, rcp_j);
+                  }
+
+                  X_ABp = SCALAR_MUL(X_ABp, X_AB);
+                  rcp_i = SCALAR_RECIPROCAL(i + 1);
+                  comb_m_i = SCALAR_MUL(comb_m_i, m - i);
+                  comb_m_i = SCALAR_MUL(comb_m_i, rcp_i);
+               }
+            }
+         }
+      }
+
+      for(; p_inner < npts_inner; p_inner += SCALAR_LENGTH) {
+         double *Xik = (Xi + p_outer + p_inner);
+         double *Xjk = (Xj + p_outer + p_inner);
+         double *Gik = (Gi + p_outer + p_inner);
+         double *Gjk = (Gj + p_outer + p_inner);
+
+         SCALAR_TYPE const_value_v = SCALAR_LOAD((weights + p_outer + p_inner));
+
+         for(int c0 = 0; c0 <= 5; ++c0) {
+            for(int c1 = 0; c1 <= c0; ++c1) {
+               int m = 5 - c0;
+               int n = c0 - c1;
+               int p = c1;
+
+               int idxB = (((5 - m) * (5 - m + 1)) >> 1) + p;
+
+               double X_ABp = 1.0, comb_m_i = 1.0;
+               for(int i = 0; i <= m; ++i) {
+                  double rcp_i;
+
+                  double Y_ABp = 1.0, comb_n_j = 1.0;
+                  for(int j = 0; j <= n; ++j) {
+                     double rcp_j;
+
+                     double Z_ABp = 1.0, comb_p_k = 1.0;
+                     for(int k = 0; k <= p; ++k) {
+                        double rcp_k;
+                        int mv, pv, Lv = 10 - i - j - k;
+
+                        int offset = (Lv * (Lv + 1) * (Lv + 2) - 210) / 6;
+                        double const_value = comb_m_i * comb_n_j * comb_p_k * X_ABp * Y_ABp * Z_ABp;
+                        SCALAR_TYPE tx, ty, tz, tw;
+                        SCALAR_TYPE const_value_w = SCALAR_MUL(const_value_v, SCALAR_DUPLICATE(&(const_value)));
+
+                        mv = 5 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 0 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 0 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t0 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t0 = SCALAR_MUL(t0, const_value_w);
+                        tz = SCALAR_FMA(ty, t0, tz);
+                        tw = SCALAR_FMA(tx, t0, tw);
+                        SCALAR_STORE((Gik + 0 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 1 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 1 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t1 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t1 = SCALAR_MUL(t1, const_value_w);
+                        tz = SCALAR_FMA(ty, t1, tz);
+                        tw = SCALAR_FMA(tx, t1, tw);
+                        SCALAR_STORE((Gik + 1 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 4 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 2 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 2 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t2 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t2 = SCALAR_MUL(t2, const_value_w);
+                        tz = SCALAR_FMA(ty, t2, tz);
+                        tw = SCALAR_FMA(tx, t2, tw);
+                        SCALAR_STORE((Gik + 2 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 3 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 3 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t3 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t3 = SCALAR_MUL(t3, const_value_w);
+                        tz = SCALAR_FMA(ty, t3, tz);
+                        tw = SCALAR_FMA(tx, t3, tw);
+                        SCALAR_STORE((Gik + 3 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 4 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 4 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t4 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t4 = SCALAR_MUL(t4, const_value_w);
+                        tz = SCALAR_FMA(ty, t4, tz);
+                        tw = SCALAR_FMA(tx, t4, tw);
+                        SCALAR_STORE((Gik + 4 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 3 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 5 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 5 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t5 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t5 = SCALAR_MUL(t5, const_value_w);
+                        tz = SCALAR_FMA(ty, t5, tz);
+                        tw = SCALAR_FMA(tx, t5, tw);
+                        SCALAR_STORE((Gik + 5 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 6 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 6 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t6 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t6 = SCALAR_MUL(t6, const_value_w);
+                        tz = SCALAR_FMA(ty, t6, tz);
+                        tw = SCALAR_FMA(tx, t6, tw);
+                        SCALAR_STORE((Gik + 6 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 7 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 7 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t7 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t7 = SCALAR_MUL(t7, const_value_w);
+                        tz = SCALAR_FMA(ty, t7, tz);
+                        tw = SCALAR_FMA(tx, t7, tw);
+                        SCALAR_STORE((Gik + 7 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 8 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 8 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t8 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t8 = SCALAR_MUL(t8, const_value_w);
+                        tz = SCALAR_FMA(ty, t8, tz);
+                        tw = SCALAR_FMA(tx, t8, tw);
+                        SCALAR_STORE((Gik + 8 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 2 + m - i; pv = 3 + p - k;
+                        tx = SCALAR_LOAD((Xik + 9 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 9 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t9 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t9 = SCALAR_MUL(t9, const_value_w);
+                        tz = SCALAR_FMA(ty, t9, tz);
+                        tw = SCALAR_FMA(tx, t9, tw);
+                        SCALAR_STORE((Gik + 9 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 10 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 10 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t10 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t10 = SCALAR_MUL(t10, const_value_w);
+                        tz = SCALAR_FMA(ty, t10, tz);
+                        tw = SCALAR_FMA(tx, t10, tw);
+                        SCALAR_STORE((Gik + 10 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 11 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 11 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t11 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t11 = SCALAR_MUL(t11, const_value_w);
+                        tz = SCALAR_FMA(ty, t11, tz);
+                        tw = SCALAR_FMA(tx, t11, tw);
+                        SCALAR_STORE((Gik + 11 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 12 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 12 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t12 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t12 = SCALAR_MUL(t12, const_value_w);
+                        tz = SCALAR_FMA(ty, t12, tz);
+                        tw = SCALAR_FMA(tx, t12, tw);
+                        SCALAR_STORE((Gik + 12 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 3 + p - k;
+                        tx = SCALAR_LOAD((Xik + 13 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 13 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t13 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t13 = SCALAR_MUL(t13, const_value_w);
+                        tz = SCALAR_FMA(ty, t13, tz);
+                        tw = SCALAR_FMA(tx, t13, tw);
+                        SCALAR_STORE((Gik + 13 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 1 + m - i; pv = 4 + p - k;
+                        tx = SCALAR_LOAD((Xik + 14 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 14 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t14 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t14 = SCALAR_MUL(t14, const_value_w);
+                        tz = SCALAR_FMA(ty, t14, tz);
+                        tw = SCALAR_FMA(tx, t14, tw);
+                        SCALAR_STORE((Gik + 14 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 0 + p - k;
+                        tx = SCALAR_LOAD((Xik + 15 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 15 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t15 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t15 = SCALAR_MUL(t15, const_value_w);
+                        tz = SCALAR_FMA(ty, t15, tz);
+                        tw = SCALAR_FMA(tx, t15, tw);
+                        SCALAR_STORE((Gik + 15 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 1 + p - k;
+                        tx = SCALAR_LOAD((Xik + 16 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 16 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t16 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t16 = SCALAR_MUL(t16, const_value_w);
+                        tz = SCALAR_FMA(ty, t16, tz);
+                        tw = SCALAR_FMA(tx, t16, tw);
+                        SCALAR_STORE((Gik + 16 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 2 + p - k;
+                        tx = SCALAR_LOAD((Xik + 17 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 17 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t17 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t17 = SCALAR_MUL(t17, const_value_w);
+                        tz = SCALAR_FMA(ty, t17, tz);
+                        tw = SCALAR_FMA(tx, t17, tw);
+                        SCALAR_STORE((Gik + 17 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 3 + p - k;
+                        tx = SCALAR_LOAD((Xik + 18 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 18 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t18 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t18 = SCALAR_MUL(t18, const_value_w);
+                        tz = SCALAR_FMA(ty, t18, tz);
+                        tw = SCALAR_FMA(tx, t18, tw);
+                        SCALAR_STORE((Gik + 18 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 4 + p - k;
+                        tx = SCALAR_LOAD((Xik + 19 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 19 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t19 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t19 = SCALAR_MUL(t19, const_value_w);
+                        tz = SCALAR_FMA(ty, t19, tz);
+                        tw = SCALAR_FMA(tx, t19, tw);
+                        SCALAR_STORE((Gik + 19 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+                        mv = 0 + m - i; pv = 5 + p - k;
+                        tx = SCALAR_LOAD((Xik + 20 * ldX));
+                        ty = SCALAR_LOAD((Xjk + idxB * ldX));
+                        tz = SCALAR_LOAD((Gik + 20 * ldG));
+                        tw = SCALAR_LOAD((Gjk + idxB * ldG));
+                        SCALAR_TYPE t20 = SCALAR_LOAD((temp + (offset + (((Lv - mv) * (Lv - mv + 1)) >> 1) + pv) * NPTS_LOCAL + p_inner));
+                        t20 = SCALAR_MUL(t20, const_value_w);
+                        tz = SCALAR_FMA(ty, t20, tz);
+                        tw = SCALAR_FMA(tx, t20, tw);
+                        SCALAR_STORE((Gik + 20 * ldG), tz);
+                        SCALAR_STORE((Gjk + idxB * ldG), tw);
+
+                        Z_ABp = SCALAR_MUL(Z_ABp, Z_AB);
+                        rcp_k = SCALAR_RECIPROCAL(k + 1);
+                        comb_p_k = SCALAR_MUL(comb_p_k, p - k);
+                        comb_p_k = SCALAR_MUL(comb_p_k, rcp_k);
+                     }
+
+                     Y_ABp = SCALAR_MUL(Y_ABp, Y_AB);
+                     rcp_j = SCALAR_RECIPROCAL(j + 1);
+                     comb_n_j = SCALAR_MUL(comb_n_j, n - j);
+                     comb_n_j = SCALAR_MUL(comb_n_j, rcp_j);
+                  }
+
+                  X_ABp = SCALAR_MUL(X_ABp, X_AB);
+                  rcp_i = SCALAR_RECIPROCAL(i + 1);
+                  comb_m_i = SCALAR_MUL(comb_m_i, m - i);
+                  comb_m_i = SCALAR_MUL(comb_m_i, rcp_i);
+               }
+            }
+         }
+      }
+   }
+}
+}
@@ -0,0 +1,28 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#ifndef __MY_INTEGRAL_6
+#define __MY_INTEGRAL_6
+
+#include "../include/cpu/integral_data_types.hpp"
+#include "config_obara_saika.hpp"
+namespace XCPU::XCPU_ISA {
+void integral_6(size_t npts,
+               double *points,
+               point rA,
+               point rB,
+               int nprim_pairs,
+               prim_pair *prim_pairs,
+               double *Xi,
+               int ldX,
+               double *Gi,
+               int ldG, 
+               double *weights, 
+               double *boys_table);
+}
+
+#endif
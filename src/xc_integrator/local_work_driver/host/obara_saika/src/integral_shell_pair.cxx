@@ -0,0 +1,1013 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include <stdio.h>
+#include <algorithm>
+#include "../include/cpu/integral_data_types.hpp"
+#include "config_obara_saika.hpp"
+#include "integral_shell_pair.hpp"
+#include "integral_0.hpp"
+#include "integral_1.hpp"
+#include "integral_2.hpp"
+#include "integral_3.hpp"
+#include "integral_4.hpp"
+#include "integral_5.hpp"
+#include "integral_6.hpp"
+#include "integral_0_0.hpp"
+#include "integral_1_0.hpp"
+#include "integral_1_1.hpp"
+#include "integral_2_0.hpp"
+#include "integral_2_1.hpp"
+#include "integral_2_2.hpp"
+#include "integral_3_0.hpp"
+#include "integral_3_1.hpp"
+#include "integral_3_2.hpp"
+#include "integral_3_3.hpp"
+#include "integral_4_0.hpp"
+#include "integral_4_1.hpp"
+#include "integral_4_2.hpp"
+#include "integral_4_3.hpp"
+#include "integral_4_4.hpp"
+#include "integral_5_0.hpp"
+#include "integral_5_1.hpp"
+#include "integral_5_2.hpp"
+#include "integral_5_3.hpp"
+#include "integral_5_4.hpp"
+#include "integral_5_5.hpp"
+#include "integral_6_0.hpp"
+#include "integral_6_1.hpp"
+#include "integral_6_2.hpp"
+#include "integral_6_3.hpp"
+#include "integral_6_4.hpp"
+#include "integral_6_5.hpp"
+#include "integral_6_6.hpp"
+
+namespace XCPU::XCPU_ISA {
+void compute_integral_shell_pair(int is_diag,
+                  size_t npts,
+                  double *points,
+                  int lA,
+                  int lB,
+                  point rA,
+                  point rB,
+                  int nprim_pairs,
+                  prim_pair *prim_pairs,
+                  double *Xi,
+                  double *Xj,
+                  int ldX,
+                  double *Gi,
+                  double *Gj,
+                  int ldG, 
+                  double *weights, 
+                  double *boys_table) {
+   if (is_diag) {
+      if(lA == 0) {
+         integral_0(npts,
+                    points,
+                    rA,
+                    rB,
+                    nprim_pairs,
+                    prim_pairs,
+                    Xi,
+                    ldX,
+                    Gi,
+                    ldG, 
+                    weights, 
+                    boys_table);
+      } else if(lA == 1) {
+        integral_1(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table);
+      } else if(lA == 2) {
+        integral_2(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table);
+      } else if(lA == 3) {
+        integral_3(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table);
+      } else if(lA == 4) {
+        integral_4(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table);
+      } else if(lA == 5) {
+        integral_5(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table);
+      } else if(lA == 6) {
+        integral_6(npts,
+                    points,
+                   rA,
+                   rB,
+                   nprim_pairs,
+                   prim_pairs,
+                   Xi,
+                   ldX,
+                   Gi,
+                   ldG, 
+                   weights, 
+                   boys_table);
+      } else {
+         printf("Type not defined!\n");
+      }
+   } else {
+      if((lA == 0) && (lB == 0)) {
+         integral_0_0(npts,
+                      points,
+                      rA,
+                      rB,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xi,
+                      Xj,
+                      ldX,
+                      Gi,
+                      Gj,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 1) && (lB == 0)) {
+            integral_1_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 0) && (lB == 1)) {
+         integral_1_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 1) && (lB == 1)) {
+        integral_1_1(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table);
+      } else if((lA == 2) && (lB == 0)) {
+            integral_2_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 0) && (lB == 2)) {
+         integral_2_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 2) && (lB == 1)) {
+            integral_2_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 1) && (lB == 2)) {
+         integral_2_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 2) && (lB == 2)) {
+        integral_2_2(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table);
+      } else if((lA == 3) && (lB == 0)) {
+            integral_3_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 0) && (lB == 3)) {
+         integral_3_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 3) && (lB == 1)) {
+            integral_3_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 1) && (lB == 3)) {
+         integral_3_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 3) && (lB == 2)) {
+            integral_3_2(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 2) && (lB == 3)) {
+         integral_3_2(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 3) && (lB == 3)) {
+        integral_3_3(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table);
+      } else if((lA == 4) && (lB == 0)) {
+            integral_4_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 0) && (lB == 4)) {
+         integral_4_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 4) && (lB == 1)) {
+            integral_4_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 1) && (lB == 4)) {
+         integral_4_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 4) && (lB == 2)) {
+            integral_4_2(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 2) && (lB == 4)) {
+         integral_4_2(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 4) && (lB == 3)) {
+            integral_4_3(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 3) && (lB == 4)) {
+         integral_4_3(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 4) && (lB == 4)) {
+        integral_4_4(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table);
+      } else if((lA == 5) && (lB == 0)) {
+            integral_5_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 0) && (lB == 5)) {
+         integral_5_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 5) && (lB == 1)) {
+            integral_5_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 1) && (lB == 5)) {
+         integral_5_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 5) && (lB == 2)) {
+            integral_5_2(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 2) && (lB == 5)) {
+         integral_5_2(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 5) && (lB == 3)) {
+            integral_5_3(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 3) && (lB == 5)) {
+         integral_5_3(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 5) && (lB == 4)) {
+            integral_5_4(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 4) && (lB == 5)) {
+         integral_5_4(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 5) && (lB == 5)) {
+        integral_5_5(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table);
+      } else if((lA == 6) && (lB == 0)) {
+            integral_6_0(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 0) && (lB == 6)) {
+         integral_6_0(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 6) && (lB == 1)) {
+            integral_6_1(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 1) && (lB == 6)) {
+         integral_6_1(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 6) && (lB == 2)) {
+            integral_6_2(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 2) && (lB == 6)) {
+         integral_6_2(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 6) && (lB == 3)) {
+            integral_6_3(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 3) && (lB == 6)) {
+         integral_6_3(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 6) && (lB == 4)) {
+            integral_6_4(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 4) && (lB == 6)) {
+         integral_6_4(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 6) && (lB == 5)) {
+            integral_6_5(npts,
+                         points,
+                         rA,
+                         rB,
+                         nprim_pairs,
+                         prim_pairs,
+                         Xi,
+                         Xj,
+                         ldX,
+                         Gi,
+                         Gj,
+                         ldG, 
+                         weights, 
+                         boys_table);
+      } else if((lA == 5) && (lB == 6)) {
+         integral_6_5(npts,
+                      points,
+                      rB,
+                      rA,
+                      nprim_pairs,
+                      prim_pairs,
+                      Xj,
+                      Xi,
+                      ldX,
+                      Gj,
+                      Gi,
+                      ldG, 
+                      weights, 
+                      boys_table);
+      } else if((lA == 6) && (lB == 6)) {
+        integral_6_6(npts,
+                     points,
+                     rA,
+                     rB,
+                     nprim_pairs,
+                     prim_pairs,
+                     Xi,
+                     Xj,
+                     ldX,
+                     Gi,
+                     Gj,
+                     ldG, 
+                     weights, 
+                     boys_table);
+      } else {
+         printf("Type not defined!\n");
+      }
+   }
+}
+
+namespace {
+using diag_kernel_type = void(size_t, double*, point, point, int, prim_pair*,
+  double*, int, double*, int, double*, double*);
+using off_diag_kernel_type = void(size_t, double*, point, point, int, prim_pair*,
+  double*, double*, int, double*, double*, int, double*, double*);
+}
+
+void compute_integral_shell_pair_batch(const shell_pair_batch &batch,
+                  size_t npts,
+                  double *points,
+                  double *X,
+                  int ldX,
+                  double *G,
+                  int ldG, 
+                  double *weights, 
+                  double *boys_table) {
+   diag_kernel_type *diag_kernel = nullptr;
+   off_diag_kernel_type *off_diag_kernel = nullptr;
+   if (batch.is_diag) {
+      if(batch.lA == 0) diag_kernel = integral_0;
+      else if(batch.lA == 1) diag_kernel = integral_1;
+      else if(batch.lA == 2) diag_kernel = integral_2;
+      else if(batch.lA == 3) diag_kernel = integral_3;
+      else if(batch.lA == 4) diag_kernel = integral_4;
+      else if(batch.lA == 5) diag_kernel = integral_5;
+      else if(batch.lA == 6) diag_kernel = integral_6;
+   } else {
+      if((batch.lA == 0) && (batch.lB == 0)) off_diag_kernel = integral_0_0;
+      else if((batch.lA == 1) && (batch.lB == 0)) off_diag_kernel = integral_1_0;
+      else if((batch.lA == 1) && (batch.lB == 1)) off_diag_kernel = integral_1_1;
+      else if((batch.lA == 2) && (batch.lB == 0)) off_diag_kernel = integral_2_0;
+      else if((batch.lA == 2) && (batch.lB == 1)) off_diag_kernel = integral_2_1;
+      else if((batch.lA == 2) && (batch.lB == 2)) off_diag_kernel = integral_2_2;
+      else if((batch.lA == 3) && (batch.lB == 0)) off_diag_kernel = integral_3_0;
+      else if((batch.lA == 3) && (batch.lB == 1)) off_diag_kernel = integral_3_1;
+      else if((batch.lA == 3) && (batch.lB == 2)) off_diag_kernel = integral_3_2;
+      else if((batch.lA == 3) && (batch.lB == 3)) off_diag_kernel = integral_3_3;
+      else if((batch.lA == 4) && (batch.lB == 0)) off_diag_kernel = integral_4_0;
+      else if((batch.lA == 4) && (batch.lB == 1)) off_diag_kernel = integral_4_1;
+      else if((batch.lA == 4) && (batch.lB == 2)) off_diag_kernel = integral_4_2;
+      else if((batch.lA == 4) && (batch.lB == 3)) off_diag_kernel = integral_4_3;
+      else if((batch.lA == 4) && (batch.lB == 4)) off_diag_kernel = integral_4_4;
+      else if((batch.lA == 5) && (batch.lB == 0)) off_diag_kernel = integral_5_0;
+      else if((batch.lA == 5) && (batch.lB == 1)) off_diag_kernel = integral_5_1;
+      else if((batch.lA == 5) && (batch.lB == 2)) off_diag_kernel = integral_5_2;
+      else if((batch.lA == 5) && (batch.lB == 3)) off_diag_kernel = integral_5_3;
+      else if((batch.lA == 5) && (batch.lB == 4)) off_diag_kernel = integral_5_4;
+      else if((batch.lA == 5) && (batch.lB == 5)) off_diag_kernel = integral_5_5;
+      else if((batch.lA == 6) && (batch.lB == 0)) off_diag_kernel = integral_6_0;
+      else if((batch.lA == 6) && (batch.lB == 1)) off_diag_kernel = integral_6_1;
+      else if((batch.lA == 6) && (batch.lB == 2)) off_diag_kernel = integral_6_2;
+      else if((batch.lA == 6) && (batch.lB == 3)) off_diag_kernel = integral_6_3;
+      else if((batch.lA == 6) && (batch.lB == 4)) off_diag_kernel = integral_6_4;
+      else if((batch.lA == 6) && (batch.lB == 5)) off_diag_kernel = integral_6_5;
+      else if((batch.lA == 6) && (batch.lB == 6)) off_diag_kernel = integral_6_6;
+   }
+
+   if(!diag_kernel && !off_diag_kernel) {
+      printf("Type not defined!\n");
+      return;
+   }
+
+   // All pairs of the batch are evaluated over a block of points before
+   // moving to the next one, such that the point data remains in cache
+   __attribute__((__aligned__(64))) double points_block[3 * NPTS_BATCH];
+   for(size_t p_outer = 0; p_outer < npts; p_outer += NPTS_BATCH) {
+      const size_t npts_block = std::min((size_t) NPTS_BATCH, npts - p_outer);
+      for(int k = 0; k < 3; ++k)
+      for(size_t p = 0; p < npts_block; ++p)
+         points_block[k * npts_block + p] = points[k * npts + p_outer + p];
+
+      double *weights_block = weights + p_outer;
+      for(int ij = 0; ij < batch.npairs; ++ij) {
+         double *Xi = X + batch.offA[ij] * ldX + p_outer;
+         double *Gi = G + batch.offA[ij] * ldG + p_outer;
+         if(diag_kernel) {
+            diag_kernel(npts_block,
+                        points_block,
+                        batch.rA[ij],
+                        batch.rB[ij],
+                        batch.nprim_pairs[ij],
+                        batch.prim_pairs[ij],
+                        Xi,
+                        ldX,
+                        Gi,
+                        ldG, 
+                        weights_block, 
+                        boys_table);
+         } else {
+            double *Xj = X + batch.offB[ij] * ldX + p_outer;
+            double *Gj = G + batch.offB[ij] * ldG + p_outer;
+            off_diag_kernel(npts_block,
+                            points_block,
+                            batch.rA[ij],
+                            batch.rB[ij],
+                            batch.nprim_pairs[ij],
+                            batch.prim_pairs[ij],
+                            Xi,
+                            Xj,
+                            ldX,
+                            Gi,
+                            Gj,
+                            ldG, 
+                            weights_block, 
+                            boys_table);
+         }
+      }
+   }
+}
+}
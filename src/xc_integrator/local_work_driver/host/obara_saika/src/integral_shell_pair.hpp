@@ -0,0 +1,41 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <cstddef>
+#include "../include/cpu/integral_data_types.hpp"
+
+namespace XCPU {
+
+/// Signature of the shell pair kernel driver (see compute_integral_shell_pair)
+using shell_pair_kernel_type = void( int is_diag, size_t npts, double *points,
+  int lA, int lB, point rA, point rB, int nprim_pairs, prim_pair *prim_pairs,
+  double *Xi, double *Xj, int ldX, double *Gi, double *Gj, int ldG,
+  double *weights, double *boys_table );
+
+/// Signature of the batched shell pair kernel driver 
+/// (see compute_integral_shell_pair_batch)
+using shell_pair_batch_kernel_type = void( const shell_pair_batch& batch,
+  size_t npts, double *points, double *X, int ldX, double *G, int ldG,
+  double *weights, double *boys_table );
+
+// ISA specific variants of the shell pair kernel drivers (integral_shell_pair.cxx
+// compiled for the corresponding ISA)
+namespace scalar {
+  shell_pair_kernel_type       compute_integral_shell_pair;
+  shell_pair_batch_kernel_type compute_integral_shell_pair_batch;
+}
+namespace avx2 {
+  shell_pair_kernel_type       compute_integral_shell_pair;
+  shell_pair_batch_kernel_type compute_integral_shell_pair_batch;
+}
+namespace avx512 {
+  shell_pair_kernel_type       compute_integral_shell_pair;
+  shell_pair_batch_kernel_type compute_integral_shell_pair_batch;
+}
+
+}
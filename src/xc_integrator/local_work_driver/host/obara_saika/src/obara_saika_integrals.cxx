@@ -7,28 +7,17 @@
  */
 #include <stdio.h>
 #include <stdlib.h>
+#include <cmath>
+#include <cctype>
+#include <string>
+#include <algorithm>
+#include <gauxc/exceptions.hpp>
 #include "../include/cpu/integral_data_types.hpp"
 #include "../include/cpu/obara_saika_integrals.hpp"
-#include "integral_0.hpp"
-#include "integral_1.hpp"
-#include "integral_2.hpp"
-#include "integral_3.hpp"
-#include "integral_4.hpp"
-#include "integral_0_0.hpp"
-#include "integral_1_0.hpp"
-#include "integral_1_1.hpp"
-#include "integral_2_0.hpp"
-#include "integral_2_1.hpp"
-#include "integral_2_2.hpp"
-#include "integral_3_0.hpp"
-#include "integral_3_1.hpp"
-#include "integral_3_2.hpp"
-#include "integral_3_3.hpp"
-#include "integral_4_0.hpp"
-#include "integral_4_1.hpp"
-#include "integral_4_2.hpp"
-#include "integral_4_3.hpp"
-#include "integral_4_4.hpp"
+#include "integral_shell_pair.hpp"
+#ifndef GAUXC_OS_ISA_DISPATCH
+#include "config_obara_saika.hpp"
+#endif
 namespace XCPU {
 void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pairs) {
    // L Values
@@ -73,6 +62,119 @@ void generate_shell_pair( const shells& A, const shells& B, prim_pair *prim_pair
    }
 }
 
+namespace {
+
+using GauXC::generic_gauxc_exception;
+
+#ifdef GAUXC_OS_ISA_DISPATCH
+// ISA variants compiled into the library
+constexpr bool isa_compiled( ISA isa ) {
+  switch( isa ) {
+    #ifdef GAUXC_OS_HAS_AVX512
+    case ISA::AVX512: return true;
+    #endif
+    #ifdef GAUXC_OS_HAS_AVX2
+    case ISA::AVX2:   return true;
+    #endif
+    case ISA::Scalar: return true;
+    default:          return false;
+  }
+}
+
+// ISA support of the host CPU (CPUID)
+bool isa_supported( ISA isa ) {
+  #if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+  __builtin_cpu_init();
+  switch( isa ) {
+    case ISA::AVX512: 
+      return __builtin_cpu_supports("avx512f") and __builtin_cpu_supports("fma");
+    case ISA::AVX2:   
+      return __builtin_cpu_supports("avx2") and __builtin_cpu_supports("fma");
+    default: return true;
+  }
+  #else
+  return isa == ISA::Scalar;
+  #endif
+}
+
+ISA select_isa() {
+
+  ISA max_isa = ISA::AVX512;
+  if( const char* env = std::getenv("GAUXC_OS_ISA") ) {
+    std::string req(env);
+    std::transform( req.begin(), req.end(), req.begin(), 
+      [](unsigned char c){ return std::tolower(c); } );
+    if( req == "scalar" )      max_isa = ISA::Scalar;
+    else if( req == "avx2" )   max_isa = ISA::AVX2;
+    else if( req == "avx512" ) max_isa = ISA::AVX512;
+    else GAUXC_GENERIC_EXCEPTION("Unknown GAUXC_OS_ISA: " + req);
+  }
+
+  for( auto isa : {ISA::AVX512, ISA::AVX2} )
+  if( isa <= max_isa and isa_compiled(isa) and isa_supported(isa) ) return isa;
+  return ISA::Scalar;
+
+}
+
+shell_pair_kernel_type* select_shell_pair_kernel( ISA isa ) {
+  switch( isa ) {
+    #ifdef GAUXC_OS_HAS_AVX512
+    case ISA::AVX512: return &avx512::compute_integral_shell_pair;
+    #endif
+    #ifdef GAUXC_OS_HAS_AVX2
+    case ISA::AVX2:   return &avx2::compute_integral_shell_pair;
+    #endif
+    default:          return &scalar::compute_integral_shell_pair;
+  }
+}
+
+shell_pair_batch_kernel_type* select_shell_pair_batch_kernel( ISA isa ) {
+  switch( isa ) {
+    #ifdef GAUXC_OS_HAS_AVX512
+    case ISA::AVX512: return &avx512::compute_integral_shell_pair_batch;
+    #endif
+    #ifdef GAUXC_OS_HAS_AVX2
+    case ISA::AVX2:   return &avx2::compute_integral_shell_pair_batch;
+    #endif
+    default:          return &scalar::compute_integral_shell_pair_batch;
+  }
+}
+#else
+// Single ISA deduced from the compiler target
+ISA select_isa() {
+  #if defined(XCPU_ISA_AVX512)
+  return ISA::AVX512;
+  #elif defined(XCPU_ISA_AVX2)
+  return ISA::AVX2;
+  #else
+  return ISA::Scalar;
+  #endif
+}
+
+shell_pair_kernel_type* select_shell_pair_kernel( ISA ) {
+  return &XCPU_ISA::compute_integral_shell_pair;
+}
+
+shell_pair_batch_kernel_type* select_shell_pair_batch_kernel( ISA ) {
+  return &XCPU_ISA::compute_integral_shell_pair_batch;
+}
+#endif
+
+}
+
+ISA obara_saika_isa() {
+  static const ISA isa = select_isa();
+  return isa;
+}
+
+const char* isa_name( ISA isa ) {
+  switch( isa ) {
+    case ISA::AVX512: return "avx512";
+    case ISA::AVX2:   return "avx2";
+    default:          return "scalar";
+  }
+}
+
 void compute_integral_shell_pair(int is_diag,
                   size_t npts,
                   double *points,
@@ -90,454 +192,23 @@ void compute_integral_shell_pair(int is_diag,
                   int ldG, 
                   double *weights, 
                   double *boys_table) {
-   if (is_diag) {
-      if(lA == 0) {
-         integral_0(npts,
-                    points,
-                    rA,
-                    rB,
-                    nprim_pairs,
-                    prim_pairs,
-                    Xi,
-                    ldX,
-                    Gi,
-                    ldG, 
-                    weights, 
-                    boys_table);
-      } else if(lA == 1) {
-        integral_1(npts,
-                    points,
-                   rA,
-                   rB,
-                   nprim_pairs,
-                   prim_pairs,
-                   Xi,
-                   ldX,
-                   Gi,
-                   ldG, 
-                   weights, 
-                   boys_table);
-      } else if(lA == 2) {
-        integral_2(npts,
-                    points,
-                   rA,
-                   rB,
-                   nprim_pairs,
-                   prim_pairs,
-                   Xi,
-                   ldX,
-                   Gi,
-                   ldG, 
-                   weights, 
-                   boys_table);
-      } else if(lA == 3) {
-        integral_3(npts,
-                    points,
-                   rA,
-                   rB,
-                   nprim_pairs,
-                   prim_pairs,
-                   Xi,
-                   ldX,
-                   Gi,
-                   ldG, 
-                   weights, 
-                   boys_table);
-      } else if(lA == 4) {
-        integral_4(npts,
-                    points,
-                   rA,
-                   rB,
-                   nprim_pairs,
-                   prim_pairs,
-                   Xi,
-                   ldX,
-                   Gi,
-                   ldG, 
-                   weights, 
-                   boys_table);
-      } else {
-         printf("Type not defined!\n");
-      }
-   } else {
-      if((lA == 0) && (lB == 0)) {
-         integral_0_0(npts,
-                      points,
-                      rA,
-                      rB,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xi,
-                      Xj,
-                      ldX,
-                      Gi,
-                      Gj,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 1) && (lB == 0)) {
-            integral_1_0(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 0) && (lB == 1)) {
-         integral_1_0(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 1) && (lB == 1)) {
-        integral_1_1(npts,
-                     points,
-                     rA,
-                     rB,
-                     nprim_pairs,
-                     prim_pairs,
-                     Xi,
-                     Xj,
-                     ldX,
-                     Gi,
-                     Gj,
-                     ldG, 
-                     weights, 
-                     boys_table);
-      } else if((lA == 2) && (lB == 0)) {
-            integral_2_0(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 0) && (lB == 2)) {
-         integral_2_0(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 2) && (lB == 1)) {
-            integral_2_1(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 1) && (lB == 2)) {
-         integral_2_1(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 2) && (lB == 2)) {
-        integral_2_2(npts,
-                     points,
-                     rA,
-                     rB,
-                     nprim_pairs,
-                     prim_pairs,
-                     Xi,
-                     Xj,
-                     ldX,
-                     Gi,
-                     Gj,
-                     ldG, 
-                     weights, 
-                     boys_table);
-      } else if((lA == 3) && (lB == 0)) {
-            integral_3_0(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 0) && (lB == 3)) {
-         integral_3_0(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 3) && (lB == 1)) {
-            integral_3_1(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 1) && (lB == 3)) {
-         integral_3_1(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 3) && (lB == 2)) {
-            integral_3_2(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 2) && (lB == 3)) {
-         integral_3_2(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 3) && (lB == 3)) {
-        integral_3_3(npts,
-                     points,
-                     rA,
-                     rB,
-                     nprim_pairs,
-                     prim_pairs,
-                     Xi,
-                     Xj,
-                     ldX,
-                     Gi,
-                     Gj,
-                     ldG, 
-                     weights, 
-                     boys_table);
-      } else if((lA == 4) && (lB == 0)) {
-            integral_4_0(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 0) && (lB == 4)) {
-         integral_4_0(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 4) && (lB == 1)) {
-            integral_4_1(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 1) && (lB == 4)) {
-         integral_4_1(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 4) && (lB == 2)) {
-            integral_4_2(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 2) && (lB == 4)) {
-         integral_4_2(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 4) && (lB == 3)) {
-            integral_4_3(npts,
-                         points,
-                         rA,
-                         rB,
-                         nprim_pairs,
-                         prim_pairs,
-                         Xi,
-                         Xj,
-                         ldX,
-                         Gi,
-                         Gj,
-                         ldG, 
-                         weights, 
-                         boys_table);
-      } else if((lA == 3) && (lB == 4)) {
-         integral_4_3(npts,
-                      points,
-                      rB,
-                      rA,
-                      nprim_pairs,
-                      prim_pairs,
-                      Xj,
-                      Xi,
-                      ldX,
-                      Gj,
-                      Gi,
-                      ldG, 
-                      weights, 
-                      boys_table);
-      } else if((lA == 4) && (lB == 4)) {
-        integral_4_4(npts,
-                     points,
-                     rA,
-                     rB,
-                     nprim_pairs,
-                     prim_pairs,
-                     Xi,
-                     Xj,
-                     ldX,
-                     Gi,
-                     Gj,
-                     ldG, 
-                     weights, 
-                     boys_table);
-      } else {
-         printf("Type not defined!\n");
-      }
-   }
+   static shell_pair_kernel_type* kernel = 
+     select_shell_pair_kernel( obara_saika_isa() );
+   kernel( is_diag, npts, points, lA, lB, rA, rB, nprim_pairs, prim_pairs,
+     Xi, Xj, ldX, Gi, Gj, ldG, weights, boys_table );
+}
+
+void compute_integral_shell_pair_batch(const shell_pair_batch& batch,
+                  size_t npts,
+                  double *points,
+                  double *X,
+                  int ldX,
+                  double *G,
+                  int ldG,
+                  double *weights,
+                  double *boys_table) {
+   static shell_pair_batch_kernel_type* kernel = 
+     select_shell_pair_batch_kernel( obara_saika_isa() );
+   kernel( batch, npts, points, X, ldX, G, ldG, weights, boys_table );
 }
 }
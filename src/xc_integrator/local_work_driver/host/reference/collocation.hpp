@@ -19,6 +19,15 @@ void gau2grid_collocation( size_t                  npts,
                            const int32_t*          shell_mask,
                            double*                 basis_eval );
 
+/// gau2grid_collocation for points in SoA layout, x(npts), y(npts), z(npts)
+void gau2grid_collocation_soa( size_t                  npts, 
+                               size_t                  nshells,
+                               size_t                  nbe,
+                               const double*           points, 
+                               const BasisSet<double>& basis,
+                               const int32_t*          shell_mask,
+                               double*                 basis_eval );
+
 void gau2grid_collocation_gradient( size_t                  npts, 
                                     size_t                  nshells,
                                     size_t                  nbe,
@@ -48,6 +57,18 @@ void gau2grid_collocation_hessian( size_t                  npts,
                                    double*                 d2basis_yz_eval,
                                    double*                 d2basis_zz_eval);
 
+void gau2grid_collocation_laplacian( size_t                  npts, 
+                                     size_t                  nshells,
+                                     size_t                  nbe,
+                                     const double*           points, 
+                                     const BasisSet<double>& basis,
+                                     const int32_t*          shell_mask,
+                                     double*                 basis_eval, 
+                                     double*                 dbasis_x_eval, 
+                                     double*                 dbasis_y_eval,
+                                     double*                 dbasis_z_eval, 
+                                     double*                 lbasis_eval );
+
 void gau2grid_collocation_der3(    size_t                  npts,
                                    size_t                  nshells,
                                    size_t                  nbe,
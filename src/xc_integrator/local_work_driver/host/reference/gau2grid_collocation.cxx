@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "collocation.hpp"
+#include <algorithm>
 
 
 #ifdef GAUXC_HAS_GAU2GRID
@@ -18,13 +19,18 @@
 
 namespace GauXC {
 
-void gau2grid_collocation( size_t                  npts, 
-                           size_t                  nshells,
-                           size_t                  nbe,
-                           const double*           points, 
-                           const BasisSet<double>& basis,
-                           const int32_t*          shell_mask,
-                           double*                 basis_eval ) {
+namespace {
+
+// Collocation of points with the gau2grid layout given by xyz_stride, i.e.
+// x(npts), y(npts), z(npts) for a stride of 1 and AoS for a stride of 3
+void gau2grid_collocation_strided( size_t                  npts, 
+                                   size_t                  nshells,
+                                   size_t                  nbe,
+                                   const double*           points, 
+                                   size_t                  xyz_stride,
+                                   const BasisSet<double>& basis,
+                                   const int32_t*          shell_mask,
+                                   double*                 basis_eval ) {
 
 #ifdef GAUXC_HAS_GAU2GRID
 
@@ -36,8 +42,9 @@ void gau2grid_collocation( size_t                  npts,
 
     const auto& sh = basis.at(shell_mask[i]);
     int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
-    gg_collocation( sh.l(), npts, points, 3, sh.nprim(), sh.coeff_data(),
-      sh.alpha_data(), sh.O_data(), order, rv + ncomp*npts );
+    gg_collocation( sh.l(), npts, points, xyz_stride, sh.nprim(), 
+      sh.coeff_data(), sh.alpha_data(), sh.O_data(), order, 
+      rv + ncomp*npts );
 
     ncomp += sh.size();
 
@@ -47,6 +54,9 @@ void gau2grid_collocation( size_t                  npts,
   a.deallocate( rv, npts*nbe );
 
 #else
+
+  // Offset of the x, y and z components of a point
+  const size_t ld_xyz = xyz_stride == 3 ? 1 : npts;
   
   for( size_t ipt = 0; ipt < npts;  ++ipt )
   for( size_t i = 0;   i < nshells; ++i   ) {
@@ -55,8 +65,11 @@ void gau2grid_collocation( size_t                  npts,
     const auto& sh = basis.at(ish);
     auto* eval = basis_eval + ipt*nbe + basis.shell_to_first_ao( ish );
 
+    const double* pt_ptr = points + xyz_stride*ipt;
+    const double  pt[3]  = { pt_ptr[0], pt_ptr[ld_xyz], pt_ptr[2*ld_xyz] };
+
     double x,y,z, bf;
-    integrator::cuda::collocation_device_radial_eval( sh, points + 3*ipt, 
+    integrator::cuda::collocation_device_radial_eval( sh, pt, 
                                                       &x, &y, &z, &bf );
 
     if( sh.pure() )
@@ -72,6 +85,34 @@ void gau2grid_collocation( size_t                  npts,
 
 }
 
+}
+
+void gau2grid_collocation( size_t                  npts, 
+                           size_t                  nshells,
+                           size_t                  nbe,
+                           const double*           points, 
+                           const BasisSet<double>& basis,
+                           const int32_t*          shell_mask,
+                           double*                 basis_eval ) {
+
+  gau2grid_collocation_strided( npts, nshells, nbe, points, 3, basis,
+    shell_mask, basis_eval );
+
+}
+
+void gau2grid_collocation_soa( size_t                  npts, 
+                               size_t                  nshells,
+                               size_t                  nbe,
+                               const double*           points, 
+                               const BasisSet<double>& basis,
+                               const int32_t*          shell_mask,
+                               double*                 basis_eval ) {
+
+  gau2grid_collocation_strided( npts, nshells, nbe, points, 1, basis,
+    shell_mask, basis_eval );
+
+}
+
 void gau2grid_collocation_gradient( size_t                  npts, 
                                     size_t                  nshells,
                                     size_t                  nbe,
@@ -203,6 +244,70 @@ void gau2grid_collocation_hessian( size_t                  npts,
 }
 
 
+void gau2grid_collocation_laplacian( size_t                  npts, 
+                                     size_t                  nshells,
+                                     size_t                  nbe,
+                                     const double*           points, 
+                                     const BasisSet<double>& basis,
+                                     const int32_t*          shell_mask,
+                                     double*                 basis_eval, 
+                                     double*                 dbasis_x_eval, 
+                                     double*                 dbasis_y_eval,
+                                     double*                 dbasis_z_eval, 
+                                     double*                 lbasis_eval ) {
+
+  // The hessian is only required for a single shell at a time
+  size_t max_sh_sz = 0;
+  for( size_t i = 0; i < nshells; ++i )
+    max_sh_sz = std::max( max_sh_sz, size_t(basis.at(shell_mask[i]).size()) );
+
+  std::allocator<double> a;
+  auto* rv = a.allocate( 5 * npts * nbe );
+  auto* rv_x = rv   + npts * nbe;
+  auto* rv_y = rv_x + npts * nbe;
+  auto* rv_z = rv_y + npts * nbe;
+  auto* rv_l = rv_z + npts * nbe;
+
+  const size_t hess_sz = npts * max_sh_sz;
+  auto* hess  = a.allocate( 6 * hess_sz );
+  auto* h_xx = hess;
+  auto* h_xy = h_xx + hess_sz;
+  auto* h_xz = h_xy + hess_sz;
+  auto* h_yy = h_xz + hess_sz;
+  auto* h_yz = h_yy + hess_sz;
+  auto* h_zz = h_yz + hess_sz;
+
+  size_t ncomp = 0;
+  for( size_t i = 0; i < nshells; ++i ) {
+
+    const auto& sh = basis.at(shell_mask[i]);
+    int order = sh.pure() ? GG_SPHERICAL_CCA : GG_CARTESIAN_CCA; 
+
+    const auto ioff = ncomp*npts;
+    gg_collocation_deriv2( sh.l(), npts, points, 3, sh.nprim(), sh.coeff_data(),
+      sh.alpha_data(), sh.O_data(), order, rv + ioff, rv_x + ioff, rv_y + ioff, 
+      rv_z + ioff, h_xx, h_xy, h_xz, h_yy, h_yz, h_zz );
+
+    const size_t sh_sz = sh.size() * npts;
+    auto* l_i = rv_l + ioff;
+    for( size_t j = 0; j < sh_sz; ++j ) l_i[j] = h_xx[j] + h_yy[j] + h_zz[j];
+
+    ncomp += sh.size();
+
+  }
+
+  gg_fast_transpose( ncomp, npts, rv,   basis_eval );
+  gg_fast_transpose( ncomp, npts, rv_x, dbasis_x_eval );
+  gg_fast_transpose( ncomp, npts, rv_y, dbasis_y_eval );
+  gg_fast_transpose( ncomp, npts, rv_z, dbasis_z_eval );
+  gg_fast_transpose( ncomp, npts, rv_l, lbasis_eval );
+
+  a.deallocate( hess, 6*hess_sz );
+  a.deallocate( rv, 5*npts*nbe );
+
+}
+
+
 void gau2grid_collocation_der3(    size_t                  npts, 
                                    size_t                  nshells,
                                    size_t                  nbe,
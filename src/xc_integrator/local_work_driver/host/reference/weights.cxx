@@ -6,6 +6,7 @@
  * See LICENSE.txt for details
  */
 #include "host/reference/weights.hpp"
+#include "host/task_range_store.hpp"
 #include "common/integrator_constants.hpp"
 
 #include <gauxc/molgrid/defaults.hpp>
@@ -16,15 +17,15 @@ namespace GauXC {
 void reference_becke_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
-  task_iterator          task_begin,
-  task_iterator          task_end
+  TaskStore&             store
 ) {
 
   // Becke partition functions
   auto hBecke = [](double x) {return 1.5 * x - 0.5 * x * x * x;}; // Eq. 19
   auto gBecke = [&](double x) {return hBecke(hBecke(hBecke(x)));}; // Eq. 20 f_3
 
-  const size_t ntasks = std::distance(task_begin,task_end);
+  store.pack();
+  const size_t ntasks = store.ntasks();
   const size_t natoms = mol.natoms();
 
   const auto&  RAB    = meta.rab();
@@ -57,12 +58,19 @@ void reference_becke_weights_host(
   std::vector<double> atomDist( natoms );
 
   #pragma omp for
-  for( size_t iT = 0; iT < ntasks;                  ++iT )
-  for( size_t i  = 0; i  < (task_begin+iT)->points.size(); ++i  ) {
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    const auto&   task    = store.tasks()[iT];
+    const size_t  npts    = store.npts(iT);
+    const double* x       = store.x(iT);
+    const double* y       = store.y(iT);
+    const double* z       = store.z(iT);
+    double*       weights = store.weights(iT);
 
-    auto&       task   = *(task_begin+iT);
-    auto&       weight = task.weights[i];
-    const auto& point  = task.points[i];
+  for( size_t i = 0; i < npts; ++i ) {
+
+    auto&       weight = weights[i];
+    const std::array<double,3> point = { x[i], y[i], z[i] };
 
     // Compute distances of each center to point
     for(size_t iA = 0; iA < natoms; iA++) {
@@ -101,7 +109,8 @@ void reference_becke_weights_host(
     // Update Weights
     weight *= partitionScratch[task.iParent] / sum;
 
-  } // Collapsed loop over tasks and points
+  } // Loop over points
+  } // Loop over tasks
 
   } // OMP context
 
@@ -111,8 +120,7 @@ void reference_becke_weights_host(
 void reference_ssf_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
-  task_iterator          task_begin,
-  task_iterator          task_end
+  TaskStore&             store
 ) {
 
   auto gFrisch = [&](double x) {
@@ -125,7 +133,8 @@ void reference_ssf_weights_host(
     return (35.*(s_x - s_x3) + 21.*s_x5 - 5.*s_x7) / 16.;
   };
 
-  const size_t ntasks = std::distance(task_begin,task_end);
+  store.pack();
+  const size_t ntasks = store.ntasks();
   const size_t natoms = mol.natoms();
 
   const auto&  RAB    = meta.rab();
@@ -137,12 +146,19 @@ void reference_ssf_weights_host(
   std::vector<double> atomDist( natoms );
 
   #pragma omp for
-  for( size_t iT = 0; iT < ntasks;                  ++iT )
-  for( size_t i  = 0; i  < (task_begin+iT)->points.size(); ++i  ) {
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+
+    const auto&   task    = store.tasks()[iT];
+    const size_t  npts    = store.npts(iT);
+    const double* x       = store.x(iT);
+    const double* y       = store.y(iT);
+    const double* z       = store.z(iT);
+    double*       weights = store.weights(iT);
 
-    auto&       task   = *(task_begin+iT);
-    auto&       weight = task.weights[i];
-    const auto& point  = task.points[i];
+  for( size_t i = 0; i < npts; ++i ) {
+
+    auto&       weight = weights[i];
+    const std::array<double,3> point = { x[i], y[i], z[i] };
 
     const auto dist_cutoff = 0.5 * (1-integrator::magic_ssf_factor<>) * task.dist_nearest;
 
@@ -204,7 +220,8 @@ void reference_ssf_weights_host(
     // Update Weights
     weight *= partitionScratch[task.iParent] / sum;
 
-  } // Collapsed loop over tasks and points
+  } // Loop over points
+  } // Loop over tasks
 
   } // OMP context
 
@@ -214,14 +231,11 @@ void reference_ssf_weights_host(
 void reference_lko_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
-  task_iterator          task_begin,
-  task_iterator          task_end
+  TaskStore&             store
 ) {
 
-
-  // Sort on atom index
-  std::stable_sort( task_begin, task_end, 
-    [](const auto& a, const auto&b ) { return a.iParent < b.iParent; } );
+  store.pack();
+  const auto& tasks = store.tasks();
 
   // Becke partition functions
   auto hBecke = [](double x) {return 1.5 * x - 0.5 * x * x * x;}; // Eq. 19
@@ -229,41 +243,124 @@ void reference_lko_weights_host(
   constexpr double R_cutoff = 5;
 
   const size_t natoms = mol.natoms();
+  const size_t ntasks = store.ntasks();
 
   const auto&  RAB    = meta.rab();
 
+  // Decompose the tasks into blocks of points. The cost of a block is
+  // estimated by the number of atoms within the neighbor cutoff of its
+  // farthest point, blocks are processed in order of decreasing cost
+  constexpr size_t npts_block = 256;
+  struct lko_work_item {
+    size_t iTask, ipt_begin, ipt_end;
+    double r_max, cost;
+  };
+
+  std::vector<lko_work_item> work_items;
+  for( auto iT = 0ul; iT < ntasks; ++iT ) {
+    const auto npts = store.npts(iT);
+    for( auto ipt = 0ul; ipt < npts; ipt += npts_block )
+      work_items.push_back({ iT, ipt, std::min(ipt + npts_block, npts), 0., 0. });
+  }
+
+  // Distance of the farthest point of each block to its parent
+  #pragma omp parallel for schedule(dynamic)
+  for( auto iW = 0ul; iW < work_items.size(); ++iW ) {
+    auto& item = work_items[iW];
+    const auto& parent = mol[tasks[item.iTask].iParent];
+    const double* x = store.x(item.iTask);
+    const double* y = store.y(item.iTask);
+    const double* z = store.z(item.iTask);
+
+    double r_max = 0.;
+    for( auto ipt = item.ipt_begin; ipt < item.ipt_end; ++ipt ) {
+      const double da_x = x[ipt] - parent.x;
+      const double da_y = y[ipt] - parent.y;
+      const double da_z = z[ipt] - parent.z;
+      r_max = std::max( r_max, da_x*da_x + da_y*da_y + da_z*da_z );
+    }
+    item.r_max = std::sqrt(r_max);
+  }
+
+  // Farthest point of each parent atom, negative if the atom owns no tasks
+  std::vector<double> parent_r_max( natoms, -1. );
+  for( const auto& item : work_items ) {
+    auto& r = parent_r_max[tasks[item.iTask].iParent];
+    r = std::max( r, item.r_max );
+  }
+
+  // Neighbors of each parent atom sorted by distance, excluding the parent
+  // (shared by all threads). Atoms beyond 2*(r_max + R_cutoff) of the
+  // parent do not enter the partition of any of its points
+  std::vector<size_t> nbr_ptr( natoms + 1, 0 );
+  for( auto iAtom = 0ul; iAtom < natoms; ++iAtom ) {
+    size_t nnbr = 0;
+    if( parent_r_max[iAtom] >= 0. ) {
+      const auto* RAB_parent = RAB.data() + iAtom*natoms;
+      const double r_nbr = 2*(parent_r_max[iAtom] + R_cutoff);
+      for( auto iA = 0ul; iA < natoms; ++iA ) 
+        nnbr += (iA != iAtom) and (RAB_parent[iA] <= r_nbr);
+    }
+    nbr_ptr[iAtom+1] = nbr_ptr[iAtom] + nnbr;
+  }
+
+  std::vector<int32_t> nbr_idx( nbr_ptr.back() );
+  #pragma omp parallel for schedule(dynamic)
+  for( auto iAtom = 0ul; iAtom < natoms; ++iAtom ) {
+    if( nbr_ptr[iAtom+1] == nbr_ptr[iAtom] ) continue;
+    const auto* RAB_parent = RAB.data() + iAtom*natoms;
+    const double r_nbr = 2*(parent_r_max[iAtom] + R_cutoff);
+    auto* idx_begin = nbr_idx.data() + nbr_ptr[iAtom];
+    auto* idx_it    = idx_begin;
+    for( auto iA = 0ul; iA < natoms; ++iA ) 
+    if( iA != iAtom and RAB_parent[iA] <= r_nbr ) *(idx_it++) = iA;
+    std::sort( idx_begin, idx_it,
+      [&](auto i, auto j){ return RAB_parent[i] < RAB_parent[j]; } );
+  }
+
+  // Block costs: number of neighbors within the cutoff of the farthest point
+  #pragma omp parallel for schedule(dynamic)
+  for( auto iW = 0ul; iW < work_items.size(); ++iW ) {
+    auto& item = work_items[iW];
+    const auto iAtom = tasks[item.iTask].iParent;
+    const auto* RAB_parent = RAB.data() + iAtom*natoms;
+    const double r_nbr = 2*(item.r_max + R_cutoff);
+    const auto* nbr_begin = nbr_idx.data() + nbr_ptr[iAtom];
+    const auto* nbr_end   = nbr_idx.data() + nbr_ptr[iAtom+1];
+    const size_t nnbr = std::distance( nbr_begin, std::partition_point( 
+      nbr_begin, nbr_end, [&](auto i){ return RAB_parent[i] <= r_nbr; } ) );
+    item.cost = double(item.ipt_end - item.ipt_begin) * (nnbr + 1);
+  }
+
+  std::stable_sort( work_items.begin(), work_items.end(),
+    [](const auto& a, const auto& b){ return a.cost > b.cost; } );
+
   #pragma omp parallel 
   {
 
   std::vector<double> partitionScratch( natoms );
   std::vector<double> atomDist( natoms );
-  std::vector<size_t> inter_atom_dist_idx( natoms );
   std::vector<size_t> point_dist_idx( natoms );
 
   #pragma omp for schedule(dynamic)
-  for( auto iAtom = 0ul; iAtom < natoms; ++iAtom ) {
+  for( auto iW = 0ul; iW < work_items.size(); ++iW ) {
 
-    auto atom_begin = std::find_if( task_begin, task_end,
-      [&](const auto& t){ return t.iParent == (int)iAtom; } );
-    auto atom_end = std::find_if( task_begin, task_end,
-      [&](const auto& t){ return t.iParent == (int)(iAtom+1); } );
+    const auto& item  = work_items[iW];
+    const auto iAtom  = size_t(tasks[item.iTask].iParent);
 
-    auto* RAB_parent = RAB.data() + iAtom*natoms;
-
-    std::iota( inter_atom_dist_idx.begin(), inter_atom_dist_idx.end(), 0 );
-    std::sort( inter_atom_dist_idx.begin(), inter_atom_dist_idx.end(),
-      [&](auto i, auto j){ return RAB_parent[i] < RAB_parent[j]; } );
+    const double* x       = store.x(item.iTask);
+    const double* y       = store.y(item.iTask);
+    const double* z       = store.z(item.iTask);
+    double*       weights = store.weights(item.iTask);
 
-  for( auto task_it = atom_begin; task_it != atom_end; ++task_it ) {
-
-    auto& points  = task_it->points;
-    auto& weights = task_it->weights;
-    const auto npts = points.size();
+    auto* RAB_parent = RAB.data() + iAtom*natoms;
+    const auto* nbr_begin = nbr_idx.data() + nbr_ptr[iAtom];
+    const auto* nbr_end   = nbr_idx.data() + nbr_ptr[iAtom+1];
 
-  for( auto ipt = 0ul; ipt < npts; ++ipt ) {
+  for( auto ipt = item.ipt_begin; ipt < item.ipt_end; ++ipt ) {
 
     auto& weight = weights[ipt];
-    const auto point = points[ipt];
+    const std::array<double,3> point = { x[ipt], y[ipt], z[ipt] };
 
     std::fill( atomDist.begin(), atomDist.end(), std::numeric_limits<double>::infinity() );
     // Parent distance
@@ -279,8 +376,8 @@ void reference_lko_weights_host(
     double r_nearest = r_parent;
     size_t natoms_keep = 1;
     // Compute distances of each center to point
-    for(size_t iA = 1; iA < natoms; iA++) {
-      auto idx = inter_atom_dist_idx[iA];
+    for( auto nbr_it = nbr_begin; nbr_it != nbr_end; ++nbr_it ) {
+      auto idx = *nbr_it;
       if( RAB_parent[idx] > (r_parent + r_nearest + 2*R_cutoff) ) break;
 
       const double da_x = point[0] - mol[idx].x;
@@ -353,11 +450,49 @@ void reference_lko_weights_host(
     weight *= partitionScratch[parent_idx] / sum;
 
   } // Loop over points 
-  } // Loop over tasks
-  } // Loop over atoms
+  } // Loop over work items
 
   } // OMP context
 
 }
 
+void reference_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+  apply_to_task_range( task_begin, task_end, [&]( TaskStore& store ) {
+    reference_becke_weights_host( mol, meta, store );
+  });
+}
+
+void reference_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+  apply_to_task_range( task_begin, task_end, [&]( TaskStore& store ) {
+    reference_ssf_weights_host( mol, meta, store );
+  });
+}
+
+void reference_lko_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+
+  // Sort on atom index
+  std::stable_sort( task_begin, task_end, 
+    [](const auto& a, const auto&b ) { return a.iParent < b.iParent; } );
+
+  apply_to_task_range( task_begin, task_end, [&]( TaskStore& store ) {
+    reference_lko_weights_host( mol, meta, store );
+  });
+
+}
+
 }
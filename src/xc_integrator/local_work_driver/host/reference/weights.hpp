@@ -6,11 +6,23 @@
  * See LICENSE.txt for details
  */
 #include "host/local_host_work_driver_pimpl.hpp"
+#include <gauxc/task_store.hpp>
 
 namespace GauXC {
 
 using task_iterator = detail::LocalHostWorkDriverPIMPL::task_iterator;
 
+/**
+ *  Partition weights of the (packed) points of a TaskStore. The overloads
+ *  for a range of tasks pack them into a temporary store, the LKO overload
+ *  additionally sorts the range on the parent atom.
+ */
+void reference_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+);
+
 void reference_ssf_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
@@ -18,6 +30,12 @@ void reference_ssf_weights_host(
   task_iterator          task_end
 );
 
+void reference_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+);
+
 void reference_becke_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
@@ -25,6 +43,12 @@ void reference_becke_weights_host(
   task_iterator          task_end
 );
 
+void reference_lko_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+);
+
 void reference_lko_weights_host(
   const Molecule&        mol,
   const MolMeta&         meta,
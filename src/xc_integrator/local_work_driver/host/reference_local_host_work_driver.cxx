@@ -8,6 +8,7 @@
 
 #include "host/reference_local_host_work_driver.hpp"
 #include "host/reference/weights.hpp"
+#include "host/screened_weights.hpp"
 #include "host/reference/collocation.hpp"
 
 #include "host/util.hpp"
@@ -20,6 +21,7 @@
 #include "cpu/integral_data_types.hpp"
 #include "cpu/obara_saika_integrals.hpp"
 #include "cpu/chebyshev_boys_computation.hpp"
+#include "host/host_shell_pair_soa.hpp"
 #include <gauxc/util/real_solid_harmonics.hpp>
 #include "integrator_util/integral_bounds.hpp"
 
@@ -44,6 +46,12 @@ namespace GauXC {
       case XCWeightAlg::SSF:
         reference_ssf_weights_host( mol, meta, task_begin, task_end );
         break;
+      case XCWeightAlg::ScreenedBecke:
+        screened_becke_weights_host( mol, meta, task_begin, task_end );
+        break;
+      case XCWeightAlg::ScreenedSSF:
+        screened_ssf_weights_host( mol, meta, task_begin, task_end );
+        break;
       case XCWeightAlg::LKO:
         reference_lko_weights_host( mol, meta, task_begin, task_end );
         break;
@@ -52,6 +60,29 @@ namespace GauXC {
     }
   }
 
+  void ReferenceLocalHostWorkDriver::partition_weights( XCWeightAlg weight_alg, 
+							const Molecule& mol, const MolMeta& meta, TaskStore& store ) {
+    switch( weight_alg ) {
+      case XCWeightAlg::Becke:
+        reference_becke_weights_host( mol, meta, store );
+        break;
+      case XCWeightAlg::SSF:
+        reference_ssf_weights_host( mol, meta, store );
+        break;
+      case XCWeightAlg::ScreenedBecke:
+        screened_becke_weights_host( mol, meta, store );
+        break;
+      case XCWeightAlg::ScreenedSSF:
+        screened_ssf_weights_host( mol, meta, store );
+        break;
+      case XCWeightAlg::LKO:
+        reference_lko_weights_host( mol, meta, store );
+        break;
+      default:
+        GAUXC_GENERIC_EXCEPTION("Weight Alg Not Supported");
+    }
+  }
+
 
   // Collocation
   void ReferenceLocalHostWorkDriver::eval_collocation( size_t npts, size_t nshells, 
@@ -60,6 +91,14 @@ namespace GauXC {
     gau2grid_collocation( npts, nshells, nbe, pts, basis, shell_list, basis_eval );
   }
 
+  void ReferenceLocalHostWorkDriver::eval_collocation_soa( size_t npts, 
+						           size_t nshells, size_t nbe, const double* pts_soa, 
+						           const BasisSet<double>& basis, const int32_t* shell_list, 
+						           double* basis_eval ) {
+    gau2grid_collocation_soa( npts, nshells, nbe, pts_soa, basis, shell_list, 
+                              basis_eval );
+  }
+
 
   // Collocation Gradient
   void ReferenceLocalHostWorkDriver::eval_collocation_gradient( size_t npts, 
@@ -82,6 +121,14 @@ namespace GauXC {
 				 d2basis_zz_eval);
   }
 
+  void ReferenceLocalHostWorkDriver::eval_collocation_laplacian( size_t npts, 
+							         size_t nshells, size_t nbe, const double* pts, const BasisSet<double>& basis, 
+							         const int32_t* shell_list, double* basis_eval, double* dbasis_x_eval, 
+							         double* dbasis_y_eval, double* dbasis_z_eval, double* lbasis_eval ) {
+    gau2grid_collocation_laplacian(npts, nshells, nbe, pts, basis, shell_list,
+				   basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval);
+  }
+
   void ReferenceLocalHostWorkDriver::eval_collocation_der3( size_t npts,
 							    size_t nshells, size_t nbe, const double* pts, const BasisSet<double>& basis, 
 							     const int32_t* shell_list, double* basis_eval, double* dbasis_x_eval, 
@@ -1031,11 +1078,13 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
   // Increment VXC by Z
   void ReferenceLocalHostWorkDriver::inc_vxc( size_t npts, size_t nbf, size_t nbe, 
 					      const double* basis_eval, const submat_map_t& submat_map, const double* Z,
-					      size_t ldz, double* VXC, size_t ldvxc, double* scr ) {
+					      size_t ldz, double* VXC, size_t ldvxc, double* scr,
+					      const SubmatAccumulator& acc ) {
 
       blas::syr2k('L', 'N', nbe, npts, 1., basis_eval, nbe, Z, ldz, 0., scr, nbe );
 
-      detail::inc_by_submat_atomic( nbf, nbf, nbe, nbe, VXC, ldvxc, scr, nbe, submat_map );
+      detail::inc_by_submat( nbf, nbf, nbe, nbe, VXC, ldvxc, scr, nbe, submat_map,
+        submat_map, acc );
 
   }
 
@@ -1043,14 +1092,19 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
   void ReferenceLocalHostWorkDriver::inc_exx_k( size_t npts, size_t nbf, 
 						size_t nbe_bra, size_t nbe_ket, const double* basis_eval, 
 						const submat_map_t& submat_map_bra, const submat_map_t& submat_map_ket, 
-						const double* G, size_t ldg, double* K, size_t ldk, double* scr ) {
+						const double* G, size_t ldg, double* K, size_t ldk, double* scr,
+						const SubmatAccumulator& acc ) {
 
       blas::gemm( 'N', 'T', nbe_bra, nbe_ket, npts, 1., basis_eval, nbe_bra,
 		  G, ldg, 0., scr, nbe_bra );
 
-      detail::inc_by_submat_atomic( nbf, nbf, nbe_bra, nbe_ket, K, ldk, scr, nbe_bra, 
-			     submat_map_bra, submat_map_ket );
+      detail::inc_by_submat( nbf, nbf, nbe_bra, nbe_ket, K, ldk, scr, nbe_bra, 
+			     submat_map_bra, submat_map_ket, acc );
+
+  }
 
+  std::string ReferenceLocalHostWorkDriver::exx_kernel_isa() const {
+    return XCPU::isa_name( XCPU::obara_saika_isa() );
   }
 
 
@@ -1078,28 +1132,62 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
   }
 
+  namespace {
+
+  // Scratch of eval_exx_gmat, kept per thread to avoid heap allocations in
+  // the task loop (buffers only grow)
+  struct exx_gmat_scratch {
+    util::SphericalHarmonicTransform sph_trans{6};
+    std::vector<double> points_transposed;
+    std::vector<double> X_cart, G_cart, X_cart_rm, G_cart_rm;
+    std::vector<size_t> cart_offsets;
+    XCHostShellPairSoA  shell_pair_soa;
+  };
+
+  exx_gmat_scratch& get_exx_gmat_scratch() {
+    thread_local exx_gmat_scratch scr;
+    return scr;
+  }
+
+  }
+
   // Construct G(mu,i) = w(i) * A(mu,nu,i) * F(nu, i)
   void ReferenceLocalHostWorkDriver::eval_exx_gmat( size_t npts, size_t nshells, 
     size_t nshell_pairs, size_t nbe, const double* points, const double* weights, 
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
+    const int32_t* shell_pair_idx_list,
     const double* X, size_t ldx, double* G, size_t ldg ) {
 
-    util::unused(basis_map);
-
-    // Cast points to Rys format (binary compatable)
-    XCPU::point* _points = 
-      reinterpret_cast<XCPU::point*>(const_cast<double*>(points));
-    std::vector<double> _points_transposed(3 * npts);
+    // Transpose points into the SoA format of the Rys kernels
+    auto& _points_transposed = get_exx_gmat_scratch().points_transposed;
+    _points_transposed.resize(3 * npts);
 
     for(size_t i = 0; i < npts; ++i) {
-      _points_transposed[i + 0 * npts] = _points[i].x;
-      _points_transposed[i + 1 * npts] = _points[i].y;
-      _points_transposed[i + 2 * npts] = _points[i].z;
+      _points_transposed[i + 0 * npts] = points[3*i + 0];
+      _points_transposed[i + 1 * npts] = points[3*i + 1];
+      _points_transposed[i + 2 * npts] = points[3*i + 2];
     }
 
-  
+    eval_exx_gmat_soa( npts, nshells, nshell_pairs, nbe, 
+      _points_transposed.data(), weights, basis, shpairs, basis_map, 
+      shell_list, shell_pair_list, shell_pair_idx_list, X, ldx, G, ldg );
+
+  }
+
+  void ReferenceLocalHostWorkDriver::eval_exx_gmat_soa( size_t npts, 
+    size_t nshells, size_t nshell_pairs, size_t nbe, const double* points_soa, 
+    const double* weights, const BasisSet<double>& basis, 
+    const ShellPairCollection<double>& shpairs, const BasisSetMap& basis_map, 
+    const int32_t* shell_list, const std::pair<int32_t,int32_t>* shell_pair_list, 
+    const int32_t* shell_pair_idx_list,
+    const double* X, size_t ldx, double* G, size_t ldg ) {
+
+    util::unused(basis_map);
+
+    auto& scr = get_exx_gmat_scratch();
+
     // Set G to zero
     for( size_t j = 0; j < npts; ++j )
     for( size_t i = 0; i < nbe;  ++i ) {
@@ -1108,7 +1196,7 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
 
 
     // Spherical Harmonic Transformer
-    util::SphericalHarmonicTransform sph_trans(5);
+    auto& sph_trans = scr.sph_trans;
 
     const bool any_pure = std::any_of( shell_list, shell_list + nshells,
 				       [&](const auto& i){ return basis.at(i).pure(); } );
@@ -1116,10 +1204,11 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
     const size_t nbe_cart = 
       basis.nbf_cart_subset( shell_list, shell_list + nshells );
 
-    std::vector<double> X_cart, G_cart;
+    auto& X_cart = scr.X_cart;
+    auto& G_cart = scr.G_cart;
     if( any_pure ){
       X_cart.resize( nbe_cart * npts );
-      G_cart.resize( nbe_cart * npts, 0. );
+      G_cart.resize( nbe_cart * npts );
 
       // Transform X into cartesian
       int ioff = 0;
@@ -1148,95 +1237,43 @@ void ReferenceLocalHostWorkDriver::eval_zmat_gga_vxc_gks( size_t npts, size_t nb
     const auto ldx_use = any_pure ? nbe_cart : ldx;
     const auto ldg_use = any_pure ? nbe_cart : ldg;
 
-    std::vector<double> X_cart_rm( nbe_cart*npts,0. ), 
-                        G_cart_rm( nbe_cart*npts,0. );
+    auto& X_cart_rm = scr.X_cart_rm;
+    auto& G_cart_rm = scr.G_cart_rm;
+    X_cart_rm.resize( nbe_cart*npts );
+    G_cart_rm.assign( nbe_cart*npts, 0. );
     for( auto i = 0ul; i < nbe_cart; ++i )
     for( auto j = 0ul; j < npts;     ++j ) {
       X_cart_rm[i*npts + j] = X_use[i + j*ldx_use];
     }
 
 
-    std::map<size_t,size_t> cou_offsets_map;
-    std::vector<size_t> cou_cart_sizes(nshells);
-    cou_cart_sizes[0] = 0;
-    cou_offsets_map[shell_list[0]] = 0;
-    for(size_t i = 1; i < nshells; ++i) {
-      cou_cart_sizes[i] = cou_cart_sizes[i-1] +
-        basis.at(shell_list[i-1]).cart_size();
-      cou_offsets_map[shell_list[i]] = cou_cart_sizes[i];
+    // Cartesian offsets of the task shells in X / G
+    auto& cart_offsets = scr.cart_offsets;
+    cart_offsets.resize( basis.size() );
+    int max_l = 0;
+    for( size_t i = 0, ioff = 0; i < nshells; ++i ) {
+      const auto& shell = basis.at(shell_list[i]);
+      cart_offsets[shell_list[i]] = ioff;
+      ioff += shell.cart_size();
+      max_l = std::max( max_l, shell.l() );
     }
 
-    size_t ndo = 0;
-    {
-#if 0
-    //size_t ioff_cart = 0;
-    for( auto i = 0ul; i < nshells; ++i ) {
-      const auto ish        = shell_list[i];
-      const auto& bra       = basis[ish];
-      const int bra_cart_sz = bra.cart_size();
-      const size_t ioff_cart = cou_cart_sizes[i] * npts;
-      XCPU::point bra_origin{bra.O()[0],bra.O()[1],bra.O()[2]};
-
-      //size_t joff_cart = 0;
-      for( auto j = 0ul; j <= i; ++j ) {
-      //for( auto j = i; j < nshells; ++j ) {
-        const auto jsh        = shell_list[j];
-        const auto& ket       = basis[jsh];
-        const int ket_cart_sz = ket.cart_size();
-        const size_t joff_cart = cou_cart_sizes[j] * npts;
-        XCPU::point ket_origin{ket.O()[0],ket.O()[1],ket.O()[2]};
-        if(!need_sp(ish,jsh)) continue;
-        ++ndo;
-
-        auto sh_pair = shpairs.at(ish,jsh);
-        auto prim_pair_data = sh_pair.prim_pairs();
-        auto nprim_pair     = sh_pair.nprim_pairs();
-        
-        XCPU::compute_integral_shell_pair( ish == jsh,
-        				   npts, _points_transposed.data(),
-        				   bra.l(), ket.l(), bra_origin, ket_origin,
-        				   nprim_pair, prim_pair_data,
-        				   X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
-        				   G_cart_rm.data()+ioff_cart, G_cart_rm.data()+joff_cart, npts,
-        				   const_cast<double*>(weights), this->boys_table );
-        
-        //joff_cart += ket_cart_sz * npts;
-      }
-	
-      //ioff_cart += bra_cart_sz * npts;
-    }
-#else
+    // Group the shell pairs by angular momentum type
+    auto& shell_pair_soa = scr.shell_pair_soa;
+    shell_pair_soa.reset( max_l );
     for( auto ij = 0ul; ij < nshell_pairs; ++ij ) {
       auto [ish,jsh] = shell_pair_list[ij];
-      //std::cout << "SHP " << ij << " " << i << " " << j << " " << nshells << std::endl;
-
-     
-      // Bra
-      const auto& bra      = basis.at(ish);
-      const auto ioff_cart = cou_offsets_map.at(ish) * npts;
-      XCPU::point bra_origin{bra.O()[0],bra.O()[1],bra.O()[2]};
-
-      // Ket
-      const auto& ket      = basis.at(jsh);
-      const auto joff_cart = cou_offsets_map.at(jsh) * npts;
-      XCPU::point ket_origin{ket.O()[0],ket.O()[1],ket.O()[2]};
-
-      auto sh_pair = shpairs.at(ish,jsh);
-      auto prim_pair_data = sh_pair.prim_pairs();
-      auto nprim_pair     = sh_pair.nprim_pairs();
-      
-      ndo++;  
-      XCPU::compute_integral_shell_pair( ish == jsh,
-      				   npts, _points_transposed.data(),
-      				   bra.l(), ket.l(), bra_origin, ket_origin,
-      				   nprim_pair, prim_pair_data,
-      				   X_cart_rm.data()+ioff_cart, X_cart_rm.data()+joff_cart, npts,
-      				   G_cart_rm.data()+ioff_cart, G_cart_rm.data()+joff_cart, npts,
-      				   const_cast<double*>(weights), this->boys_table );
+      shell_pair_soa.add( ish == jsh, basis.at(ish), cart_offsets[ish], 
+        basis.at(jsh), cart_offsets[jsh], 
+        shpairs.shell_pairs()[shell_pair_idx_list[ij]] );
     }
-#endif
+    shell_pair_soa.finalize();
+
+    for( const auto& batch : shell_pair_soa.batches ) {
+      XCPU::compute_integral_shell_pair_batch( batch, npts, 
+        const_cast<double*>(points_soa), X_cart_rm.data(), npts, G_cart_rm.data(), 
+        npts, const_cast<double*>(weights), this->boys_table );
     }
-    //std::cout << "NDO " << ndo << " " << ndo / double(nshells*(nshells+1)/2) << std::endl;
    
     for( auto i = 0ul; i < nbe_cart; ++i )
     for( auto j = 0ul; j < npts;     ++j ) {
@@ -29,10 +29,15 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
 
   void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
     const MolMeta& meta, task_iterator task_begin, task_iterator task_end ) override;
+  void partition_weights( XCWeightAlg weight_alg, const Molecule& mol, 
+    const MolMeta& meta, TaskStore& store ) override;
 
   void eval_collocation( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
     double* basis_eval ) override;
+  void eval_collocation_soa( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts_soa, const BasisSet<double>& basis, 
+    const int32_t* shell_list, double* basis_eval ) override;
   void eval_collocation_gradient( size_t npts, size_t nshells, size_t nbe, 
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
     double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
@@ -43,6 +48,10 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     double* dbasis_z_eval, double* d2basis_xx_eval, double* d2basis_xy_eval,
     double* d2basis_xz_eval, double* d2basis_yy_eval, double* d2basis_yz_eval,
     double* d2basis_zz_eval ) override;
+  void eval_collocation_laplacian( size_t npts, size_t nshells, size_t nbe, 
+    const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
+    double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
+    double* dbasis_z_eval, double* lbasis_eval ) override;
   void eval_collocation_der3( size_t npts, size_t nshells, size_t nbe,
     const double* pts, const BasisSet<double>& basis, const int32_t* shell_list, 
     double* basis_eval, double* dbasis_x_eval, double* dbasis_y_eval, 
@@ -64,6 +73,14 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
     const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
     const BasisSetMap& basis_map, const int32_t* shell_list, 
     const std::pair<int32_t,int32_t>* shell_pair_list, 
+    const int32_t* shell_pair_idx_list,
+    const double* X, size_t ldx, double* G, size_t ldg ) override ;
+  void eval_exx_gmat_soa( size_t npts, size_t nshells, size_t nshell_pairs,
+    size_t nbe, const double* points_soa, const double* weights, 
+    const BasisSet<double>& basis, const ShellPairCollection<double>& shpairs, 
+    const BasisSetMap& basis_map, const int32_t* shell_list, 
+    const std::pair<int32_t,int32_t>* shell_pair_list, 
+    const int32_t* shell_pair_idx_list,
     const double* X, size_t ldx, double* G, size_t ldg ) override ;
 
   void eval_exx_fmat( size_t npts, size_t nbf, size_t nbe_bra,
@@ -75,7 +92,9 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
   void inc_exx_k( size_t npts, size_t nbf, size_t nbe_bra, size_t nbe_ket, 
     const double* basis_eval, const submat_map_t& submat_map_bra, 
     const submat_map_t& submat_map_ket, const double* G, size_t ldg, double* K, 
-    size_t ldk, double* scr ) override;
+    size_t ldk, double* scr, const SubmatAccumulator& acc ) override;
+
+  std::string exx_kernel_isa() const override;
     
   void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
     const double* X, size_t ldx, double* den_eval) override;
@@ -172,7 +191,8 @@ struct ReferenceLocalHostWorkDriver : public detail::LocalHostWorkDriverPIMPL {
 
   void inc_vxc( size_t npts, size_t nbf, size_t nbe, 
     const double* basis_eval, const submat_map_t& submat_map, const double* Z, 
-    size_t ldz, double* VXC, size_t ldvxc, double* scr ) override;
+    size_t ldz, double* VXC, size_t ldvxc, double* scr, 
+    const SubmatAccumulator& acc ) override;
 
 };
 
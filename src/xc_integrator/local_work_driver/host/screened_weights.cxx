@@ -0,0 +1,455 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/screened_weights.hpp"
+#include "host/task_range_store.hpp"
+#include "common/integrator_constants.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+#include <limits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace GauXC {
+
+namespace {
+
+/**
+ *  Atoms sorted by their distance to a parent atom (parent first),
+ *  truncated at a cutoff distance. Coordinates and interatomic distances
+ *  are taken from the molecule / MolMeta through the atom indices.
+ */
+struct neighbor_list {
+  std::vector<int32_t> idx;
+  std::vector<double>  rab;
+
+  void build( size_t iA, const MolMeta& meta, double R_max ) {
+    const size_t natoms  = meta.natoms();
+    const auto*  RAB_row = meta.rab().data() + iA*natoms;
+
+    idx.clear();
+    idx.emplace_back( iA );
+    for( size_t jA = 0; jA < natoms; ++jA )
+    if( jA != iA and RAB_row[jA] < R_max ) idx.emplace_back( jA );
+    std::sort( idx.begin() + 1, idx.end(),
+      [&](auto i, auto j){ return RAB_row[i] < RAB_row[j]; } );
+
+    rab.resize( idx.size() );
+    rab[0] = 0.;
+    for( size_t k = 1; k < idx.size(); ++k ) rab[k] = RAB_row[idx[k]];
+  }
+
+  inline size_t size() const { return idx.size(); }
+
+  /// Number of leading atoms with R_PA < R (R may not exceed the cutoff)
+  inline size_t prefix_size( double R ) const {
+    return std::distance( rab.begin(),
+      std::lower_bound( rab.begin(), rab.end(), R ) );
+  }
+};
+
+/**
+ *  Apply a (per thread) kernel to the tasks (indices) of a TaskStore along
+ *  with the neighbor list of their parent atoms.
+ *
+ *  Tasks are grouped by parent atom and processed in blocks of one parent
+ *  atom per thread, i.e. only a single neighbor list per thread is held at
+ *  any time. The list of a parent atom is truncated at the largest
+ *  cutoff(task) over its tasks.
+ */
+template <typename CutoffFunction, typename KernelFactory>
+void for_each_task_with_neighbors( const MolMeta& meta,
+  const TaskStore& store, CutoffFunction&& cutoff,
+  KernelFactory&& make_kernel ) {
+
+  const auto&  tasks  = store.tasks();
+  const size_t ntasks = store.ntasks();
+  const size_t natoms = meta.natoms();
+
+  // Group tasks by parent atom
+  std::vector<size_t> parent_offsets( natoms + 1, 0 );
+  for( const auto& task : tasks )
+    parent_offsets[task.iParent + 1]++;
+  std::partial_sum( parent_offsets.begin(), parent_offsets.end(),
+    parent_offsets.begin() );
+
+  std::vector<size_t> task_order( ntasks );
+  {
+    auto pos = parent_offsets;
+    for( size_t iT = 0; iT < ntasks; ++iT )
+      task_order[pos[tasks[iT].iParent]++] = iT;
+  }
+
+  std::vector<int32_t> parents, parent_rank( natoms, -1 );
+  for( size_t iA = 0; iA < natoms; ++iA )
+  if( parent_offsets[iA+1] > parent_offsets[iA] ) {
+    parent_rank[iA] = parents.size();
+    parents.emplace_back( iA );
+  }
+
+  #ifdef _OPENMP
+  std::vector<neighbor_list> lists( omp_get_max_threads() );
+  #else
+  std::vector<neighbor_list> lists( 1 );
+  #endif
+
+  #pragma omp parallel
+  {
+
+  #ifdef _OPENMP
+  const size_t nthreads = omp_get_num_threads();
+  const size_t tid      = omp_get_thread_num();
+  #else
+  const size_t nthreads = 1;
+  const size_t tid      = 0;
+  #endif
+
+  auto kernel = make_kernel();
+
+  for( size_t pst = 0; pst < parents.size(); pst += nthreads ) {
+
+    const size_t pen = std::min( pst + nthreads, parents.size() );
+    if( pst + tid < pen ) {
+      const auto iA = parents[pst + tid];
+      double R_max = 0.;
+      for( auto i = parent_offsets[iA]; i < parent_offsets[iA+1]; ++i )
+        R_max = std::max( R_max, cutoff( task_order[i] ) );
+      lists[tid].build( iA, meta, R_max );
+    }
+    #pragma omp barrier
+
+    // The implicit barrier keeps the lists alive until all tasks of the
+    // block are processed
+    const size_t tst = parent_offsets[parents[pst]];
+    const size_t ten = parent_offsets[parents[pen-1] + 1];
+    #pragma omp for schedule(dynamic)
+    for( size_t i = tst; i < ten; ++i ) {
+      const auto iT = task_order[i];
+      kernel( iT, lists[parent_rank[tasks[iT].iParent] - pst] );
+    }
+
+  }
+
+  } // OMP context
+
+}
+
+/// Distances of a point to atoms [begin,end) of a neighbor list
+inline void point_distances( const Molecule& mol,
+  const std::array<double,3>& pt, const int32_t* idx, size_t begin,
+  size_t end, double* dist ) {
+  #pragma omp simd
+  for( size_t k = begin; k < end; ++k ) {
+    const auto& atom = mol[idx[k]];
+    const double dx = pt[0] - atom.x;
+    const double dy = pt[1] - atom.y;
+    const double dz = pt[2] - atom.z;
+    dist[k] = std::sqrt( dx*dx + dy*dy + dz*dz );
+  }
+}
+
+/**
+ *  SSF cell function s(mu_AB) (Eq. 14 of Stratmann, Scuseria, Frisch).
+ *  mu is clamped to [-a,a] for which the polynomial gives exactly
+ *  s = 1 and s = 0, such that the evaluation is branch free.
+ */
+#pragma omp declare simd
+inline double sFrisch( double mu ) {
+  constexpr double oo_a = 1. / integrator::magic_ssf_factor<>;
+  const double s_x  = std::min( 1., std::max( -1., mu * oo_a ) );
+  const double s_x2 = s_x  * s_x;
+  const double s_x3 = s_x  * s_x2;
+  const double s_x5 = s_x3 * s_x2;
+  const double s_x7 = s_x5 * s_x2;
+
+  return 0.5 * ( 1. - (35.*(s_x - s_x3) + 21.*s_x5 - 5.*s_x7) / 16. );
+}
+
+/// Becke cell function s(mu_AB) (Eqs. 19-21 of Becke, JCP 88 2547)
+#pragma omp declare simd
+inline double sBecke( double mu ) {
+  auto hBecke = [](double x) {return 1.5 * x - 0.5 * x * x * x;};
+  return 0.5 * ( 1. - hBecke(hBecke(hBecke(mu))) );
+}
+
+/**
+ *  Unnormalized partition function of atom idx[k] (distance r[k] to the
+ *  point) over the atoms idx[begin,end)
+ */
+template <typename CellFunction>
+inline double partition_function( size_t k, size_t begin, size_t end,
+  const double* r, const int32_t* idx, const MolMeta& meta,
+  CellFunction&& s ) {
+
+  const double  rA    = r[k];
+  const double* RAB_A = meta.rab().data() + idx[k]*meta.natoms();
+
+  double p = 1.;
+  #pragma omp simd reduction(*:p)
+  for( size_t j = begin; j < end; ++j ) p *= s( (rA - r[j]) / RAB_A[idx[j]] );
+  return p;
+
+}
+
+}
+
+void screened_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+) {
+
+  store.pack();
+
+  constexpr double a = integrator::magic_ssf_factor<>;
+
+  const size_t natoms = mol.natoms();
+  const auto&  RAB    = meta.rab();
+
+  auto s_ssf = [](double mu){ return sFrisch(mu); };
+
+  // Atoms visited for a point at r_P satisfy R_PA < r_P + r_lim with
+  // r_lim < r_P (3-a)(1+a)/(1-a)^2 (see below)
+  auto cutoff = [&]( size_t iT ) {
+    const auto& parent = mol[store.tasks()[iT].iParent];
+    const double* x = store.x(iT);
+    const double* y = store.y(iT);
+    const double* z = store.z(iT);
+    double r_max = 0.;
+    for( size_t i = 0; i < store.npts(iT); ++i ) {
+      const double dx = x[i] - parent.x;
+      const double dy = y[i] - parent.y;
+      const double dz = z[i] - parent.z;
+      r_max = std::max( r_max, dx*dx + dy*dy + dz*dz );
+    }
+    return std::sqrt(r_max) * ( 1. + (3-a)*(1+a)/((1-a)*(1-a)) );
+  };
+
+  auto make_kernel = [&]() {
+
+  // Atoms entering the cell functions of the surviving atoms
+  std::vector<double>  atomDist( natoms );
+  std::vector<char>    is_survivor( natoms );
+  std::vector<double>  rel_r( natoms );
+  std::vector<int32_t> rel_idx( natoms );
+  std::vector<size_t>  survivors( natoms );
+
+  return [&, atomDist, is_survivor, rel_r, rel_idx, survivors]
+    ( size_t iT, const neighbor_list& nbr ) mutable {
+
+    const auto&   task    = store.tasks()[iT];
+    const size_t  npts    = store.npts(iT);
+    const double* x       = store.x(iT);
+    const double* y       = store.y(iT);
+    const double* z       = store.z(iT);
+    double*       weights = store.weights(iT);
+    const auto*   nbr_idx = nbr.idx.data();
+    const auto*   nbr_rab = nbr.rab.data();
+
+    const auto dist_cutoff = 0.5 * (1-a) * task.dist_nearest;
+
+  for( size_t i = 0; i < npts; ++i ) {
+
+    auto&       weight = weights[i];
+    const std::array<double,3> point = { x[i], y[i], z[i] };
+
+    // Compute dist to parent atom
+    point_distances( mol, point, nbr_idx, 0, 1, atomDist.data() );
+    const double r_parent = atomDist[0];
+
+    if( r_parent < dist_cutoff ) continue; // Partition weight = 1
+
+    // Atoms with nonzero partition functions satisfy r_A < r_N (1+a)/(1-a)
+    // (N the nearest atom to the point), i.e. R_PA < 2 r_P / (1-a)
+    const size_t n_near = nbr.prefix_size( 2 * r_parent / (1-a) );
+    point_distances( mol, point, nbr_idx, 1, n_near, atomDist.data() );
+
+    const size_t k_nearest = std::distance( atomDist.begin(),
+      std::min_element( atomDist.begin(), atomDist.begin() + n_near ) );
+    const double r_nearest = atomDist[k_nearest];
+
+    // Partition weight is 0
+    if( k_nearest and (r_parent - r_nearest) >= a * nbr_rab[k_nearest] ) {
+      weight = 0.;
+      continue;
+    }
+
+    // Surviving atoms are not cut off by either the parent or the nearest
+    // atom, they satisfy r_A < r_P + R_PA < r_P (3-a)/(1-a)
+    const auto* RAB_nearest = RAB.data() + nbr_idx[k_nearest]*natoms;
+    double r_survivor_max = 0.;
+    for( size_t k = 0; k < n_near; ++k ) {
+      const auto r = atomDist[k];
+      is_survivor[k] =
+        (k == 0         or (r - r_parent ) < a * nbr_rab[k]) and
+        (k == k_nearest or (r - r_nearest) < a * RAB_nearest[nbr_idx[k]]);
+      if( is_survivor[k] ) r_survivor_max = std::max( r_survivor_max, r );
+    }
+
+    // Atoms entering the cell functions of the survivors satisfy
+    // r_B < r_A (1+a)/(1-a), i.e. R_PB < r_P + r_lim
+    const double r_lim  = r_survivor_max * (1+a) / (1-a);
+    const size_t n_lim  = nbr.prefix_size( r_parent + r_lim );
+    const size_t n_dist = std::max( n_near, n_lim );
+    point_distances( mol, point, nbr_idx, n_near, n_dist, atomDist.data() );
+
+    size_t n_rel = 0, n_survivors = 0;
+    for( size_t k = 0; k < n_dist; ++k ) {
+      if( atomDist[k] >= r_lim ) continue;
+      if( k < n_near and is_survivor[k] ) survivors[n_survivors++] = n_rel;
+      rel_r  [n_rel] = atomDist[k];
+      rel_idx[n_rel] = nbr_idx[k];
+      ++n_rel;
+    }
+
+    // Evaluate unnormalized partition functions of the survivors, the
+    // parent is the first survivor
+    double sum = 0., parent_weight = 0.;
+    for( size_t iS = 0; iS < n_survivors; ++iS ) {
+      const auto j = survivors[iS];
+      const double p =
+        partition_function( j, 0, j, rel_r.data(), rel_idx.data(), meta,
+          s_ssf ) *
+        partition_function( j, j+1, n_rel, rel_r.data(), rel_idx.data(), meta,
+          s_ssf );
+
+      if( iS == 0 ) parent_weight = p;
+      sum += p;
+    }
+
+    // Update Weights
+    weight *= parent_weight / sum;
+
+  } // Loop over points
+
+  };
+  };
+
+  for_each_task_with_neighbors( meta, store, cutoff, make_kernel );
+
+}
+
+void screened_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+) {
+
+  store.pack();
+
+  // Length of the blocks between checks of the partition function against
+  // the screening tolerance
+  constexpr size_t block_size = 8;
+
+  const size_t natoms = mol.natoms();
+
+  auto s_becke = [](double mu){ return sBecke(mu); };
+
+  // Partition function of atom k, atoms are processed in blocks and the
+  // evaluation is terminated (returning 0) once the partition function
+  // falls below p_tol
+  auto screened_partition_function = [&]( size_t k, const double* r,
+    const int32_t* idx, double p_tol ) {
+    double p = 1.;
+    for( size_t kb = 0; kb < natoms; kb += block_size ) {
+      const size_t kb_end = std::min( kb + block_size, natoms );
+      if( k >= kb and k < kb_end ) {
+        p *= partition_function( k, kb, k, r, idx, meta, s_becke );
+        p *= partition_function( k, k+1, kb_end, r, idx, meta, s_becke );
+      } else {
+        p *= partition_function( k, kb, kb_end, r, idx, meta, s_becke );
+      }
+      if( p < p_tol ) return 0.;
+    }
+    return p;
+  };
+
+  // Becke partition functions have no finite range
+  auto cutoff = []( size_t ) {
+    return std::numeric_limits<double>::infinity();
+  };
+
+  auto make_kernel = [&]() {
+
+  std::vector<double> atomDist( natoms );
+
+  return [&, atomDist]( size_t iT, const neighbor_list& nbr ) mutable {
+
+    const size_t  npts    = store.npts(iT);
+    const double* x       = store.x(iT);
+    const double* y       = store.y(iT);
+    const double* z       = store.z(iT);
+    double*       weights = store.weights(iT);
+    const auto*   nbr_idx = nbr.idx.data();
+
+  for( size_t i = 0; i < npts; ++i ) {
+
+    auto&       weight = weights[i];
+    const std::array<double,3> point = { x[i], y[i], z[i] };
+
+    point_distances( mol, point, nbr_idx, 0, natoms, atomDist.data() );
+
+    // The partition function of the nearest atom bounds the normalization
+    // from below, the remaining atoms are screened relative to it
+    const size_t k_nearest = std::distance( atomDist.begin(),
+      std::min_element( atomDist.begin(), atomDist.end() ) );
+    const double nearest_weight = screened_partition_function( k_nearest,
+      atomDist.data(), nbr_idx, 0. );
+    const double p_tol = integrator::ssf_weight_tol * nearest_weight;
+
+    // Parent (first in the neighbor list) is evaluated without screening
+    const double parent_weight = k_nearest ?
+      screened_partition_function( 0, atomDist.data(), nbr_idx, 0. ) :
+      nearest_weight;
+
+    double sum = parent_weight;
+    if( k_nearest ) sum += nearest_weight;
+    for( size_t k = 1; k < natoms; ++k )
+    if( k != k_nearest ) {
+      sum += screened_partition_function( k, atomDist.data(), nbr_idx,
+        p_tol );
+    }
+
+    // Update Weights
+    weight *= parent_weight / sum;
+
+  } // Loop over points
+
+  };
+  };
+
+  for_each_task_with_neighbors( meta, store, cutoff, make_kernel );
+
+}
+
+void screened_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+  apply_to_task_range( task_begin, task_end, [&]( TaskStore& store ) {
+    screened_ssf_weights_host( mol, meta, store );
+  });
+}
+
+void screened_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+) {
+  apply_to_task_range( task_begin, task_end, [&]( TaskStore& store ) {
+    screened_becke_weights_host( mol, meta, store );
+  });
+}
+
+}
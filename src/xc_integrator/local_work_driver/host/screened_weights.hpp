@@ -0,0 +1,58 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "host/local_host_work_driver_pimpl.hpp"
+#include <gauxc/task_store.hpp>
+
+namespace GauXC {
+
+using task_iterator = detail::LocalHostWorkDriverPIMPL::task_iterator;
+
+/**
+ *  SSF partition weights restricted to the atoms which may contribute to
+ *  each point.
+ *
+ *  Atoms are traversed in order of increasing distance from the parent
+ *  atom. The SSF cutoffs (magic_ssf_factor) bound the atoms with nonzero
+ *  partition functions at a point and the atoms entering their cell
+ *  functions, such that the result is identical (up to roundoff) to the
+ *  unscreened evaluation.
+ */
+void screened_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+);
+
+/// screened_ssf_weights_host for a range of tasks (temporary TaskStore)
+void screened_ssf_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+);
+
+/**
+ *  Becke partition weights with tolerance screening of the partition
+ *  functions (see integrator::ssf_weight_tol).
+ */
+void screened_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  TaskStore&             store
+);
+
+/// screened_becke_weights_host for a range of tasks (temporary TaskStore)
+void screened_becke_weights_host(
+  const Molecule&        mol,
+  const MolMeta&         meta,
+  task_iterator          task_begin,
+  task_iterator          task_end
+);
+
+}
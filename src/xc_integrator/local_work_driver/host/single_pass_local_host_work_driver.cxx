@@ -0,0 +1,383 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "host/single_pass_local_host_work_driver.hpp"
+#include <gauxc/util/unused.hpp>
+
+namespace GauXC {
+
+  // U/V variables (all components of a point in a single pass)
+
+  void SinglePassLocalHostWorkDriver::eval_uvvar_lda_rks( size_t npts, size_t nbe,
+    const double* basis_eval, const double* X, size_t ldx, double* den_eval) {
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const auto* X_i  = X + i*ldx;
+      const auto* bf_i = basis_eval + i*ldx;
+
+      double rho = 0.;
+      #pragma omp simd reduction(+:rho)
+      for( size_t j = 0; j < nbe; ++j ) rho += bf_i[j] * X_i[j];
+
+      den_eval[i] = rho;
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_uvvar_lda_uks( size_t npts, size_t nbe,
+    const double* basis_eval, const double* Xs, size_t ldxs, const double* Xz,
+    size_t ldxz, double* den_eval) {
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const auto* Xs_i  = Xs + i*ldxs;
+      const auto* Xz_i  = Xz + i*ldxz;
+      const auto* bfs_i = basis_eval + i*ldxs;
+      const auto* bfz_i = basis_eval + i*ldxz;
+
+      double rhos = 0., rhoz = 0.;
+      #pragma omp simd reduction(+:rhos,rhoz)
+      for( size_t j = 0; j < nbe; ++j ) {
+        rhos += bfs_i[j] * Xs_i[j];
+        rhoz += bfz_i[j] * Xz_i[j];
+      }
+
+      den_eval[2*i]   = 0.5*(rhos + rhoz); // rho_+
+      den_eval[2*i+1] = 0.5*(rhos - rhoz); // rho_-
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_uvvar_gga_rks( size_t npts, size_t nbe,
+    const double* basis_eval, const double* dbasis_x_eval,
+    const double *dbasis_y_eval, const double* dbasis_z_eval, const double* X,
+    size_t ldx, double* den_eval, double* dden_x_eval, double* dden_y_eval,
+    double* dden_z_eval, double* gamma ) {
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const size_t ioff = i * ldx;
+      const auto* X_i   = X + ioff;
+      const auto* bf_i  = basis_eval    + ioff;
+      const auto* bfx_i = dbasis_x_eval + ioff;
+      const auto* bfy_i = dbasis_y_eval + ioff;
+      const auto* bfz_i = dbasis_z_eval + ioff;
+
+      double rho = 0., dx = 0., dy = 0., dz = 0.;
+      #pragma omp simd reduction(+:rho,dx,dy,dz)
+      for( size_t j = 0; j < nbe; ++j ) {
+        const auto x = X_i[j];
+        rho += bf_i[j]  * x;
+        dx  += bfx_i[j] * x;
+        dy  += bfy_i[j] * x;
+        dz  += bfz_i[j] * x;
+      }
+      dx *= 2.; dy *= 2.; dz *= 2.;
+
+      den_eval[i]    = rho;
+      dden_x_eval[i] = dx;
+      dden_y_eval[i] = dy;
+      dden_z_eval[i] = dz;
+      gamma[i]       = dx*dx + dy*dy + dz*dz;
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_uvvar_gga_uks( size_t npts, size_t nbe,
+    const double* basis_eval, const double* dbasis_x_eval,
+    const double *dbasis_y_eval, const double* dbasis_z_eval, const double* Xs,
+    size_t ldxs, const double* Xz, size_t ldxz, double* den_eval,
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval,
+    double* gamma ) {
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const size_t ioffs = i * ldxs;
+      const size_t ioffz = i * ldxz;
+
+      const auto* Xs_i = Xs + ioffs;
+      const auto* Xz_i = Xz + ioffz;
+
+      double rhos = 0., dndx = 0., dndy = 0., dndz = 0.;
+      double rhoz = 0., dMzdx = 0., dMzdy = 0., dMzdz = 0.;
+      #pragma omp simd reduction(+:rhos,dndx,dndy,dndz,rhoz,dMzdx,dMzdy,dMzdz)
+      for( size_t j = 0; j < nbe; ++j ) {
+        const auto xs = Xs_i[j];
+        const auto xz = Xz_i[j];
+        rhos  += basis_eval[ioffs + j]    * xs;
+        dndx  += dbasis_x_eval[ioffs + j] * xs;
+        dndy  += dbasis_y_eval[ioffs + j] * xs;
+        dndz  += dbasis_z_eval[ioffs + j] * xs;
+        rhoz  += basis_eval[ioffz + j]    * xz;
+        dMzdx += dbasis_x_eval[ioffz + j] * xz;
+        dMzdy += dbasis_y_eval[ioffz + j] * xz;
+        dMzdz += dbasis_z_eval[ioffz + j] * xz;
+      }
+      dndx  *= 2.; dndy  *= 2.; dndz  *= 2.;
+      dMzdx *= 2.; dMzdy *= 2.; dMzdz *= 2.;
+
+      den_eval[2*i]   = 0.5*(rhos + rhoz); // rho_+
+      den_eval[2*i+1] = 0.5*(rhos - rhoz); // rho_-
+
+      dden_x_eval[2*i] = dndx; // dn / dx
+      dden_y_eval[2*i] = dndy; // dn / dy
+      dden_z_eval[2*i] = dndz; // dn / dz
+
+      dden_x_eval[2*i+1] = dMzdx; // dMz / dx
+      dden_y_eval[2*i+1] = dMzdy; // dMz / dy
+      dden_z_eval[2*i+1] = dMzdz; // dMz / dz
+
+      // (del n).(del n)
+      const auto dn_sq  = dndx*dndx + dndy*dndy + dndz*dndz;
+      // (del Mz).(del Mz)
+      const auto dMz_sq = dMzdx*dMzdx + dMzdy*dMzdy + dMzdz*dMzdz;
+      // (del n).(del Mz)
+      const auto dn_dMz = dndx*dMzdx + dndy*dMzdy + dndz*dMzdz;
+
+      gamma[3*i  ] = 0.25*(dn_sq + dMz_sq) + 0.5*dn_dMz;
+      gamma[3*i+1] = 0.25*(dn_sq - dMz_sq);
+      gamma[3*i+2] = 0.25*(dn_sq + dMz_sq) - 0.5*dn_dMz;
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_uvvar_mgga_rks( size_t npts, size_t nbe,
+    const double* basis_eval, const double* dbasis_x_eval,
+    const double *dbasis_y_eval, const double* dbasis_z_eval,
+    const double* lbasis_eval, const double* X, size_t ldx,
+    const double* mmat_x, const double* mmat_y, const double* mmat_z,
+    size_t ldm, double* den_eval, double* dden_x_eval, double* dden_y_eval,
+    double* dden_z_eval, double* gamma, double* tau, double* lapl ) {
+
+    util::unused(ldm);
+    const bool needs_lapl = lapl != nullptr;
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const size_t ioff = i * ldx;
+      const auto* X_i   = X + ioff;
+      const auto* bf_i  = basis_eval    + ioff;
+      const auto* bfx_i = dbasis_x_eval + ioff;
+      const auto* bfy_i = dbasis_y_eval + ioff;
+      const auto* bfz_i = dbasis_z_eval + ioff;
+      const auto* mx_i  = mmat_x + ioff;
+      const auto* my_i  = mmat_y + ioff;
+      const auto* mz_i  = mmat_z + ioff;
+
+      double rho = 0., dx = 0., dy = 0., dz = 0., t = 0.;
+      #pragma omp simd reduction(+:rho,dx,dy,dz,t)
+      for( size_t j = 0; j < nbe; ++j ) {
+        const auto x = X_i[j];
+        rho += bf_i[j]  * x;
+        dx  += bfx_i[j] * x;
+        dy  += bfy_i[j] * x;
+        dz  += bfz_i[j] * x;
+        t   += bfx_i[j] * mx_i[j] + bfy_i[j] * my_i[j] + bfz_i[j] * mz_i[j];
+      }
+      dx *= 2.; dy *= 2.; dz *= 2.;
+
+      den_eval[i]    = rho;
+      dden_x_eval[i] = dx;
+      dden_y_eval[i] = dy;
+      dden_z_eval[i] = dz;
+      gamma[i]       = dx*dx + dy*dy + dz*dz;
+      tau[i]         = 0.5 * t;
+
+      if( needs_lapl ) {
+        const auto* lbf_i = lbasis_eval + ioff;
+        double l = 0.;
+        #pragma omp simd reduction(+:l)
+        for( size_t j = 0; j < nbe; ++j ) l += lbf_i[j] * X_i[j];
+        lapl[i] = 2. * l + 4. * tau[i];
+      }
+
+    }
+
+  }
+
+
+
+  // Z matrix (formed in a single write per point)
+
+  void SinglePassLocalHostWorkDriver::eval_zmat_lda_vxc_rks( size_t npts, size_t nbf,
+    const double* vrho, const double* basis_eval, double* Z, size_t ldz ) {
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const auto* bf_i = basis_eval + i*nbf;
+      auto*       z_i  = Z + i*ldz;
+
+      const double fact = 0.5 * vrho[i];
+      #pragma omp simd
+      for( size_t j = 0; j < nbf; ++j ) z_i[j] = fact * bf_i[j];
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_zmat_lda_vxc_uks( size_t npts, size_t nbf,
+    const double* vrho, const double* basis_eval, double* Zs, size_t ldzs,
+    double* Zz, size_t ldzz ) {
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const auto* bf_i = basis_eval + i*nbf;
+      auto*       zs_i = Zs + i*ldzs;
+      auto*       zz_i = Zz + i*ldzz;
+
+      const double factp = 0.5 * vrho[2*i];
+      const double factm = 0.5 * vrho[2*i+1];
+
+      //eq. 56 https://doi.org/10.1140/epjb/e2018-90170-1
+      const double fact_s = 0.5*(factp + factm);
+      const double fact_z = 0.5*(factp - factm);
+
+      #pragma omp simd
+      for( size_t j = 0; j < nbf; ++j ) {
+        zs_i[j] = fact_s * bf_i[j];
+        zz_i[j] = fact_z * bf_i[j];
+      }
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_zmat_gga_vxc_rks( size_t npts, size_t nbf,
+    const double* vrho, const double* vgamma, const double* basis_eval,
+    const double* dbasis_x_eval, const double* dbasis_y_eval,
+    const double* dbasis_z_eval, const double* dden_x_eval,
+    const double* dden_y_eval, const double* dden_z_eval, double* Z,
+    size_t ldz ) {
+
+    if( ldz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const size_t ioff = i * nbf;
+      const auto* bf_i  = basis_eval    + ioff;
+      const auto* bfx_i = dbasis_x_eval + ioff;
+      const auto* bfy_i = dbasis_y_eval + ioff;
+      const auto* bfz_i = dbasis_z_eval + ioff;
+      auto*       z_i   = Z + ioff;
+
+      const auto lda_fact = 0.5 * vrho[i];
+      const auto gga_fact = 2. * vgamma[i];
+      const auto x_fact = gga_fact * dden_x_eval[i];
+      const auto y_fact = gga_fact * dden_y_eval[i];
+      const auto z_fact = gga_fact * dden_z_eval[i];
+
+      #pragma omp simd
+      for( size_t j = 0; j < nbf; ++j )
+        z_i[j] = lda_fact * bf_i[j] + x_fact * bfx_i[j] + y_fact * bfy_i[j] +
+                 z_fact * bfz_i[j];
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_zmat_gga_vxc_uks( size_t npts, size_t nbf,
+    const double* vrho, const double* vgamma, const double* basis_eval,
+    const double* dbasis_x_eval, const double* dbasis_y_eval,
+    const double* dbasis_z_eval, const double* dden_x_eval,
+    const double* dden_y_eval, const double* dden_z_eval, double* Zs,
+    size_t ldzs, double* Zz, size_t ldzz ) {
+
+    if( ldzs != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+    if( ldzz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const size_t ioff = i * nbf;
+      const auto* bf_i  = basis_eval    + ioff;
+      const auto* bfx_i = dbasis_x_eval + ioff;
+      const auto* bfy_i = dbasis_y_eval + ioff;
+      const auto* bfz_i = dbasis_z_eval + ioff;
+      auto*       zs_i  = Zs + ioff;
+      auto*       zz_i  = Zz + ioff;
+
+      const double factp = 0.5 * vrho[2*i];
+      const double factm = 0.5 * vrho[2*i+1];
+      const double lda_fact_s = 0.5*(factp + factm);
+      const double lda_fact_z = 0.5*(factp - factm);
+
+      const auto gga_fact_pp = vgamma[3*i];
+      const auto gga_fact_pm = vgamma[3*i+1];
+      const auto gga_fact_mm = vgamma[3*i+2];
+
+      const auto gga_fact_1 = 0.5*(gga_fact_pp + gga_fact_pm + gga_fact_mm);
+      const auto gga_fact_2 = 0.5*(gga_fact_pp - gga_fact_mm);
+      const auto gga_fact_3 = 0.5*(gga_fact_pp - gga_fact_pm + gga_fact_mm);
+
+      const auto x_fact_s = gga_fact_1 * dden_x_eval[2*i] + gga_fact_2 * dden_x_eval[2*i+1];
+      const auto y_fact_s = gga_fact_1 * dden_y_eval[2*i] + gga_fact_2 * dden_y_eval[2*i+1];
+      const auto z_fact_s = gga_fact_1 * dden_z_eval[2*i] + gga_fact_2 * dden_z_eval[2*i+1];
+
+      const auto x_fact_z = gga_fact_3 * dden_x_eval[2*i+1] + gga_fact_2 * dden_x_eval[2*i];
+      const auto y_fact_z = gga_fact_3 * dden_y_eval[2*i+1] + gga_fact_2 * dden_y_eval[2*i];
+      const auto z_fact_z = gga_fact_3 * dden_z_eval[2*i+1] + gga_fact_2 * dden_z_eval[2*i];
+
+      #pragma omp simd
+      for( size_t j = 0; j < nbf; ++j ) {
+        zs_i[j] = lda_fact_s * bf_i[j] + x_fact_s * bfx_i[j] +
+                  y_fact_s * bfy_i[j] + z_fact_s * bfz_i[j];
+        zz_i[j] = lda_fact_z * bf_i[j] + x_fact_z * bfx_i[j] +
+                  y_fact_z * bfy_i[j] + z_fact_z * bfz_i[j];
+      }
+
+    }
+
+  }
+
+  void SinglePassLocalHostWorkDriver::eval_zmat_mgga_vxc_rks( size_t npts,
+    size_t nbf, const double* vrho, const double* vgamma, const double* vlapl,
+    const double* basis_eval, const double* dbasis_x_eval,
+    const double* dbasis_y_eval, const double* dbasis_z_eval,
+    const double* lbasis_eval, const double* dden_x_eval,
+    const double* dden_y_eval, const double* dden_z_eval, double* Z,
+    size_t ldz ) {
+
+    if( ldz != nbf ) GAUXC_GENERIC_EXCEPTION(std::string("Invalid Dims"));
+
+    for( size_t i = 0; i < npts; ++i ) {
+
+      const size_t ioff = i * nbf;
+      const auto* bf_i  = basis_eval    + ioff;
+      const auto* bfx_i = dbasis_x_eval + ioff;
+      const auto* bfy_i = dbasis_y_eval + ioff;
+      const auto* bfz_i = dbasis_z_eval + ioff;
+      auto*       z_i   = Z + ioff;
+
+      const auto lda_fact = 0.5 * vrho[i];
+      const auto gga_fact = 2. * vgamma[i];
+      const auto x_fact = gga_fact * dden_x_eval[i];
+      const auto y_fact = gga_fact * dden_y_eval[i];
+      const auto z_fact = gga_fact * dden_z_eval[i];
+
+      if( vlapl != nullptr ) {
+        const auto* lbf_i = lbasis_eval + ioff;
+        const auto lapl_fact = vlapl[i];
+        #pragma omp simd
+        for( size_t j = 0; j < nbf; ++j )
+          z_i[j] = lda_fact * bf_i[j] + x_fact * bfx_i[j] + y_fact * bfy_i[j] +
+                   z_fact * bfz_i[j] + lapl_fact * lbf_i[j];
+      } else {
+        #pragma omp simd
+        for( size_t j = 0; j < nbf; ++j )
+          z_i[j] = lda_fact * bf_i[j] + x_fact * bfx_i[j] + y_fact * bfy_i[j] +
+                   z_fact * bfz_i[j];
+      }
+
+    }
+
+  }
+
+}
@@ -0,0 +1,82 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "reference_local_host_work_driver.hpp"
+
+namespace GauXC {
+
+/**
+ *  Host LWD with single-pass density (U/V variable) and Z-matrix evaluation.
+ *
+ *  The reference kernels make one BLAS-1 pass over the collocation arrays
+ *  per density component (and a separate copy of the collocation into Z).
+ *  Here all components of a point are accumulated in a single pass over the
+ *  collocation slabs, and Z is formed in a single write. Points are processed
+ *  independently, i.e. the X matrix, Z matrix and VXC updates are not blocked
+ *  over points. Kernels without a single-pass implementation (GKS) are
+ *  inherited from the reference LWD.
+ */
+struct SinglePassLocalHostWorkDriver : public ReferenceLocalHostWorkDriver {
+
+  SinglePassLocalHostWorkDriver() = default;
+  virtual ~SinglePassLocalHostWorkDriver() noexcept = default;
+
+  void eval_uvvar_lda_rks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* X, size_t ldx, double* den_eval) override;
+  void eval_uvvar_lda_uks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* Xs, size_t ldxs, const double* Xz, size_t ldxz,
+    double* den_eval) override;
+
+  void eval_uvvar_gga_rks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* dbasis_x_eval, const double *dbasis_y_eval,
+    const double* dbasis_z_eval, const double* X, size_t ldx, double* den_eval,
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval,
+    double* gamma ) override;
+  void eval_uvvar_gga_uks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* dbasis_x_eval, const double *dbasis_y_eval,
+    const double* dbasis_z_eval, const double* Xs, size_t ldxs,
+    const double* Xz, size_t ldxz, double* den_eval,
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval,
+    double* gamma ) override;
+
+  void eval_uvvar_mgga_rks( size_t npts, size_t nbe, const double* basis_eval,
+    const double* dbasis_x_eval, const double* dbasis_y_eval,
+    const double* dbasis_z_eval, const double* lbasis_eval,
+    const double* X, size_t ldx, const double* mmat_x, const double* mmat_y,
+    const double* mmat_z, size_t ldm, double* den_eval,
+    double* dden_x_eval, double* dden_y_eval, double* dden_z_eval,
+    double* gamma, double* tau, double* lapl ) override;
+
+  void eval_zmat_lda_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* basis_eval, double* Z, size_t ldz ) override;
+  void eval_zmat_lda_vxc_uks( size_t npts, size_t nbe, const double* vrho,
+    const double* basis_eval, double* Zs, size_t ldzs, double* Zz,
+    size_t ldzz ) override;
+
+  void eval_zmat_gga_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const double* basis_eval, const double* dbasis_x_eval,
+    const double* dbasis_y_eval, const double* dbasis_z_eval,
+    const double* dden_x_eval, const double* dden_y_eval,
+    const double* dden_z_eval, double* Z, size_t ldz ) override;
+  void eval_zmat_gga_vxc_uks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const double* basis_eval, const double* dbasis_x_eval,
+    const double* dbasis_y_eval, const double* dbasis_z_eval,
+    const double* dden_x_eval, const double* dden_y_eval,
+    const double* dden_z_eval, double* Zs, size_t ldzs, double* Zz,
+    size_t ldzz ) override;
+
+  void eval_zmat_mgga_vxc_rks( size_t npts, size_t nbe, const double* vrho,
+    const double* vgamma, const double* vlapl, const double* basis_eval,
+    const double* dbasis_x_eval, const double* dbasis_y_eval,
+    const double* dbasis_z_eval, const double* lbasis_eval,
+    const double* dden_x_eval, const double* dden_y_eval,
+    const double* dden_z_eval, double* Z, size_t ldz ) override;
+
+};
+
+}
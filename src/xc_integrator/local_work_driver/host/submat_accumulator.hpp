@@ -0,0 +1,113 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/xc_integrator_settings.hpp>
+#include <gauxc/exceptions.hpp>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <array>
+#include <cstdint>
+
+namespace GauXC  {
+namespace detail {
+
+/// Set of locks which guard square tiles of an (n x n) matrix
+class TileLocks {
+
+  int32_t n_;
+  int32_t tile_size_;
+  int32_t ntiles_;
+  std::unique_ptr<std::mutex[]> locks_;
+
+public:
+
+  TileLocks( int32_t n, int32_t tile_size = 64 ) :
+    n_(n), tile_size_(tile_size),
+    ntiles_( (n + tile_size - 1) / tile_size ),
+    locks_( new std::mutex[ std::max(ntiles_,1) * std::max(ntiles_,1) ] ) {
+
+    if( tile_size <= 0 ) GAUXC_GENERIC_EXCEPTION("Invalid Tile Size");
+
+  }
+
+  inline int32_t n()         const noexcept { return n_;         }
+  inline int32_t tile_size() const noexcept { return tile_size_; }
+  inline int32_t ntiles()    const noexcept { return ntiles_;    }
+
+  inline std::mutex& at( int32_t it, int32_t jt ) noexcept {
+    return locks_[ it + jt * ntiles_ ];
+  }
+
+};
+
+/**
+ *  Increment a submatrix of ABig by ASmall, locking every tile of ABig
+ *  which is touched by a (row cut, col cut) block while it is updated
+ */
+template <typename _F1, typename _F2>
+void inc_by_submat_locked( _F1 *ABig, int32_t LDAB, _F2 *ASmall,
+  int32_t LDAS,
+  const std::vector<std::array<int32_t,3>> &submat_map_row,
+  const std::vector<std::array<int32_t,3>> &submat_map_col,
+  TileLocks& locks ) {
+
+  const int32_t ts = locks.tile_size();
+
+  int32_t j(0);
+  for( auto& jCut : submat_map_col ) {
+    const int32_t deltaJ = jCut[1];
+    int32_t i(0);
+  for( auto& iCut : submat_map_row ) {
+    const int32_t deltaI = iCut[1];
+
+    // Loop over the tiles which overlap this block
+    for( int32_t jb = jCut[0]; jb < jCut[0] + deltaJ; ) {
+      const int32_t jt = jb / ts;
+      const int32_t je = std::min( (jt+1)*ts, jCut[0] + deltaJ );
+    for( int32_t ib = iCut[0]; ib < iCut[0] + deltaI; ) {
+      const int32_t it = ib / ts;
+      const int32_t ie = std::min( (it+1)*ts, iCut[0] + deltaI );
+
+      auto* ABig_use   = ABig   + ib + jb * LDAB;
+      auto* ASmall_use = ASmall + (i + ib - iCut[0]) + (j + jb - jCut[0]) * LDAS;
+
+      std::lock_guard<std::mutex> lock( locks.at(it, jt) );
+      for( int32_t jj = 0; jj < je - jb; ++jj )
+      for( int32_t ii = 0; ii < ie - ib; ++ii ) {
+        ABig_use[ ii + jj * LDAB ] += ASmall_use[ ii + jj * LDAS ];
+      }
+
+      ib = ie;
+    }
+      jb = je;
+    }
+
+    i += deltaI;
+  }
+    j += deltaJ;
+  }
+
+}
+
+}
+
+/**
+ *  Describes how a task-local submatrix is scattered into a target matrix
+ *
+ *  Atomic:        Every element is updated with an atomic operation
+ *  ThreadPrivate: The target is owned by the calling thread, no synchronization
+ *  TileLock:      Tiles of the target are locked while updated (requires locks)
+ */
+struct SubmatAccumulator {
+  HostAccumulationStrategy strategy = HostAccumulationStrategy::Atomic;
+  detail::TileLocks*       locks    = nullptr;
+};
+
+}
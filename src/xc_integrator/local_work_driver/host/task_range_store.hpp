@@ -0,0 +1,35 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include "host/local_host_work_driver_pimpl.hpp"
+#include <gauxc/task_store.hpp>
+#include <iterator>
+
+namespace GauXC {
+
+/**
+ *  Apply a kernel which consumes a (packed) TaskStore to a range of tasks
+ *  in their AoS form. The tasks are moved into a temporary store for the
+ *  duration of the kernel and moved back (in their original order)
+ *  afterwards.
+ */
+template <typename Kernel>
+void apply_to_task_range( detail::LocalHostWorkDriverPIMPL::task_iterator
+  task_begin, detail::LocalHostWorkDriverPIMPL::task_iterator task_end,
+  Kernel&& kernel ) {
+
+  TaskStore store( std::vector<XCTask>( std::make_move_iterator(task_begin),
+    std::make_move_iterator(task_end) ) );
+  store.pack();
+  kernel( store );
+  store.unpack();
+  std::move( store.tasks().begin(), store.tasks().end(), task_begin );
+
+}
+
+}
@@ -7,6 +7,7 @@
  */
 #pragma once
 #include "host/blas.hpp"
+#include "host/submat_accumulator.hpp"
 #include <vector>
 #include <tuple>
 #include <cstdint>
@@ -14,6 +15,86 @@
 namespace GauXC  {
 namespace detail {
 
+/// Mean cut length below which submatrices are traversed by indexed gathers
+inline constexpr int32_t submat_gather_cut_length = 8;
+
+/**
+ *  Flattened gather/scatter plan of a compressed submatrix map, i.e. the
+ *  index in the full matrix of each index of the submatrix. Fragmented maps
+ *  (short cuts) are traversed by indexed gathers/scatters, others cut-wise.
+ */
+struct submat_plan {
+
+  std::vector<int32_t> index;
+  bool                 gather = false;
+
+  inline void build( const std::vector<std::array<int32_t,3>>& submat_map ) {
+    index.clear();
+    for( auto& cut : submat_map )
+    for( int32_t i = 0; i < cut[1]; ++i ) index.emplace_back( cut[0] + i );
+    gather = index.size() < submat_gather_cut_length * submat_map.size();
+  }
+
+};
+
+inline void submat_prefetch( const void* ptr ) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch( ptr );
+#else
+  (void)(ptr);
+#endif
+}
+
+/**
+ *  Apply op( ABig(I,J), ASmall(i,j) ) over a submatrix of ABig described by
+ *  row and column cut maps. Columns are traversed through the flattened
+ *  column index, rows either through the flattened row index or cut-wise.
+ *  The cuts of the next column of ABig are prefetched.
+ */
+template <typename _F1, typename _F2, typename Op>
+void submat_apply( _F1 *ABig, int32_t LDAB, _F2 *ASmall, int32_t LDAS,
+  const std::vector<std::array<int32_t,3>> &submat_map_rows,
+  const std::vector<std::array<int32_t,3>> &submat_map_cols, Op&& op ) {
+
+  thread_local submat_plan row_plan, col_plan;
+  row_plan.build( submat_map_rows );
+  const auto& col_index = (&submat_map_rows == &submat_map_cols) ? 
+    row_plan.index : (col_plan.build(submat_map_cols), col_plan.index);
+
+  const int32_t* row_index = row_plan.index.data();
+  const int32_t  m = row_plan.index.size();
+  const int32_t  n = col_index.size();
+
+  for( int32_t j = 0; j < n; ++j ) {
+
+    auto* ABig_j   = ABig   + size_t(col_index[j]) * LDAB;
+    auto* ASmall_j = ASmall + size_t(j)            * LDAS;
+
+    if( j + 1 < n ) {
+      const auto* ABig_next = ABig + size_t(col_index[j+1]) * LDAB;
+      for( auto& iCut : submat_map_rows ) submat_prefetch( ABig_next + iCut[0] );
+    }
+
+    if( row_plan.gather ) {
+      // Indices are unique, no dependencies between iterations
+      #pragma omp simd
+      for( int32_t i = 0; i < m; ++i ) op( ABig_j[row_index[i]], ASmall_j[i] );
+    } else {
+      int32_t i(0);
+      for( auto& iCut : submat_map_rows ) {
+        auto* ABig_use   = ABig_j   + iCut[0];
+        auto* ASmall_use = ASmall_j + i;
+        const int32_t deltaI = iCut[1];
+        #pragma omp simd
+        for( int32_t ii = 0; ii < deltaI; ++ii ) op( ABig_use[ii], ASmall_use[ii] );
+        i += deltaI;
+      }
+    }
+
+  }
+
+}
+
 template <typename _F1, typename _F2>
 void submat_set(int32_t M, int32_t N, int32_t MSub, 
   int32_t NSub, _F1 *ABig, int32_t LDAB, _F2 *ASmall, 
@@ -26,25 +107,8 @@ void submat_set(int32_t M, int32_t N, int32_t MSub,
   (void)(MSub);
   (void)(NSub);
 
-  int32_t i(0);
-  for( auto& iCut : submat_map_rows ) {
-    int32_t deltaI = iCut[1];
-    int32_t j(0);
-  for( auto& jCut : submat_map_cols ) {
-    int32_t deltaJ = jCut[1];
-  
-    auto* ABig_use   = ABig   + iCut[0] + jCut[0] * LDAB;
-    auto* ASmall_use = ASmall + i       + j       * LDAS;
-
-
-    GauXC::blas::lacpy( 'A', deltaI, deltaJ, ABig_use, LDAB, 
-                         ASmall_use, LDAS );
-
-  
-    j += deltaJ;
-  }
-    i += deltaI;
-  }
+  submat_apply( ABig, LDAB, ASmall, LDAS, submat_map_rows, submat_map_cols,
+    []( const auto& big, auto& small ) { small = big; } );
   
 }
 
@@ -98,28 +162,8 @@ void inc_by_submat(int32_t M, int32_t N, int32_t MSub,
   (void)(MSub);
   (void)(NSub);
 
-  int32_t i(0);
-  for( auto& iCut : submat_map_row ) {
-    int32_t deltaI = iCut[1];
-    int32_t j(0);
-  for( auto& jCut : submat_map_col ) {
-    int32_t deltaJ = jCut[1];
-  
-    auto* ABig_use   = ABig   + iCut[0] + jCut[0] * LDAB;
-    auto* ASmall_use = ASmall + i       + j       * LDAS;
-
-
-    for( int32_t jj = 0; jj < deltaJ; ++jj )
-    for( int32_t ii = 0; ii < deltaI; ++ii ) {
-      ABig_use[ ii + jj * LDAB ] += ASmall_use[ ii + jj * LDAS ];
-    }
-
-  
-    j += deltaJ;
-  }
-    i += deltaI;
-  }
-  
+  submat_apply( ABig, LDAB, ASmall, LDAS, submat_map_row, submat_map_col,
+    []( auto& big, const auto& small ) { big += small; } );
 
 }
 
@@ -186,5 +230,50 @@ void inc_by_submat_atomic(int32_t M, int32_t N, int32_t MSub,
 
 }
 
+/// Copy the lower triangle of A (N x N) into its upper triangle
+template <typename _F>
+void symmetrize_from_lower( int64_t N, _F* A, int64_t LDA ) {
+  for( int64_t j = 0;   j < N; ++j )
+  for( int64_t i = j+1; i < N; ++i ) 
+    A[ j + i*LDA ] = A[ i + j*LDA ];
+}
+
+/// Replace A (N x N) by its symmetric part 0.5 * (A + A**T)
+template <typename _F>
+void symmetrize_average( int64_t N, _F* A, int64_t LDA ) {
+  for( int64_t j = 0; j < N; ++j ) 
+  for( int64_t i = 0; i < j; ++i ) {
+    const auto A_symm = 0.5 * (A[i + j*LDA] + A[j + i*LDA]);
+    A[i + j*LDA] = A_symm;
+    A[j + i*LDA] = A_symm;
+  }
+}
+
+/// Increment ABig by ASmall using the strategy described by acc
+template <typename _F1, typename _F2>
+void inc_by_submat(int32_t M, int32_t N, int32_t MSub, 
+  int32_t NSub, _F1 *ABig, int32_t LDAB, _F2 *ASmall, 
+  int32_t LDAS, 
+  const std::vector<std::array<int32_t,3>> &submat_map_row,
+  const std::vector<std::array<int32_t,3>> &submat_map_col,
+  const SubmatAccumulator& acc ) {
+
+  switch( acc.strategy ) {
+    case HostAccumulationStrategy::ThreadPrivate:
+      inc_by_submat( M, N, MSub, NSub, ABig, LDAB, ASmall, LDAS,
+        submat_map_row, submat_map_col );
+      break;
+    case HostAccumulationStrategy::TileLock:
+      if( not acc.locks ) GAUXC_GENERIC_EXCEPTION("TileLock Requires Locks");
+      inc_by_submat_locked( ABig, LDAB, ASmall, LDAS, submat_map_row,
+        submat_map_col, *acc.locks );
+      break;
+    default:
+      inc_by_submat_atomic( M, N, MSub, NSub, ABig, LDAB, ASmall, LDAS,
+        submat_map_row, submat_map_col );
+  }
+
+}
+
 }
 }
@@ -0,0 +1,216 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/xc_task.hpp>
+#include <gauxc/basisset.hpp>
+#include "host_task_generation.hpp"
+#include <unordered_map>
+#include <algorithm>
+#include <numeric>
+#include <vector>
+#include <array>
+#include <memory>
+
+namespace GauXC::detail {
+
+/**
+ *  Budget limited cache of host collocation data across integrator calls.
+ *
+ *  The collocation of a task is stored as nblocks contiguous (nbe x npts)
+ *  blocks (e.g. basis, gradient, hessian and laplacian) in the layout of
+ *  the producing integrator. Requests for fewer blocks than are stored are
+ *  served from the leading blocks (the basis values are always first).
+ *
+ *  Tasks are identified by their position within a generation of the load
+ *  balancer tasks (see HostTaskGeneration), their sizes are taken from
+ *  XCTask::npts such that their points may be packed into a TaskStore.
+ *  The tasks to be cached are selected prior to each task loop such that 
+ *  the collocation cost avoided per byte is maximized within the budget. 
+ *  Values may optionally be stored in single precision.
+ */
+template <typename F>
+class HostCollocationCache {
+
+  struct entry_type {
+    int32_t npts    = 0;
+    int32_t nbe     = 0;
+    int32_t nblocks = 0; ///< Number of stored blocks (0 if not yet filled)
+    std::vector<F>     data;
+    std::vector<float> data_sp;
+  };
+
+  size_t             max_bytes_;
+  bool               reduced_precision_;
+  HostTaskGeneration generation_; ///< Generation of the cached tasks
+  size_t             nbytes_ = 0;
+
+  std::unordered_map<size_t, entry_type> entries_; ///< Keyed on task position
+
+  inline size_t value_size() const noexcept {
+    return reduced_precision_ ? sizeof(float) : sizeof(F);
+  }
+
+  inline bool matches( const entry_type& e, const XCTask& task ) const {
+    return e.npts == task.npts and e.nbe == task.bfn_screening.nbe;
+  }
+
+public:
+
+  HostCollocationCache( size_t max_bytes, bool reduced_precision = false ) :
+    max_bytes_(max_bytes), reduced_precision_(reduced_precision) { }
+
+  inline size_t max_bytes()         const noexcept { return max_bytes_;         }
+  inline bool   reduced_precision() const noexcept { return reduced_precision_; }
+  inline size_t nbytes()            const noexcept { return nbytes_;            }
+  inline const HostTaskGeneration& generation() const noexcept { 
+    return generation_; 
+  }
+  inline size_t ntasks()            const noexcept { return entries_.size();    }
+
+  /**
+   *  Select the tasks of a generation to be cached for a task loop which 
+   *  requires nblocks collocation blocks per task. Entries which are no 
+   *  longer selected (or belong to a previous generation) are evicted. Must
+   *  be called outside of the task loop.
+   */
+  void reserve( const BasisSet<F>& basis, const HostTaskGeneration& generation,
+    int32_t nblocks ) {
+
+    if( generation != generation_ ) {
+      clear();
+      generation_ = generation;
+    }
+
+    const size_t ntasks = generation.ntasks;
+    const XCTask* task_begin = generation.tasks;
+
+    // Collocation cost (primitive and function evaluations) per byte
+    std::vector<double> priority( ntasks, 0. );
+    std::vector<size_t> bytes( ntasks, 0 );
+    for( size_t i = 0; i < ntasks; ++i ) {
+      const auto& task = *(task_begin + i);
+      const size_t npts = task.npts;
+      bytes[i] = nblocks * npts * task.bfn_screening.nbe * value_size();
+      if( not bytes[i] ) continue;
+
+      double cost = 0.;
+      for( auto ish : task.bfn_screening.shell_list ) {
+        const auto& sh = basis.at(ish);
+        cost += sh.nprim() + nblocks * sh.size();
+      }
+      priority[i] = cost * npts / bytes[i];
+    }
+
+    std::vector<size_t> order( ntasks );
+    std::iota( order.begin(), order.end(), 0 );
+    std::stable_sort( order.begin(), order.end(), [&]( auto a, auto b ) {
+      return priority[a] > priority[b];
+    });
+
+    // Greedy selection within the budget
+    std::unordered_map<size_t, entry_type> selected;
+    size_t nbytes = 0;
+    for( auto i : order ) {
+      if( not bytes[i] ) continue;
+      if( nbytes + bytes[i] > max_bytes_ ) continue;
+
+      const auto& task = *(task_begin + i);
+
+      // Retain compatible data
+      auto it = entries_.find( i );
+      if( it != entries_.end() and matches(it->second, task) and
+          it->second.nblocks >= nblocks ) {
+        nbytes += it->second.nblocks * (bytes[i] / nblocks);
+        if( nbytes > max_bytes_ ) {
+          nbytes -= it->second.nblocks * (bytes[i] / nblocks);
+          continue;
+        }
+        selected.emplace( i, std::move(it->second) );
+        continue;
+      }
+
+      entry_type e;
+      e.npts = task.npts;
+      e.nbe  = task.bfn_screening.nbe;
+      selected.emplace( i, std::move(e) );
+      nbytes += bytes[i];
+    }
+
+    entries_ = std::move( selected );
+    nbytes_  = nbytes;
+
+  }
+
+  /// Evict every cached task
+  void clear() {
+    entries_.clear();
+    nbytes_ = 0;
+  }
+
+  /**
+   *  Copy the first nblocks collocation blocks of task into out
+   *  (nblocks * nbe * npts), returns false if they are not cached.
+   *  Thread safe with respect to load / store of other tasks.
+   */
+  bool load( const XCTask& task, int32_t nblocks, F* out ) const {
+
+    auto it = entries_.find( generation_.index(task) );
+    if( it == entries_.end() ) return false;
+
+    const auto& e = it->second;
+    if( e.nblocks < nblocks or not matches(e, task) ) return false;
+
+    const size_t n = size_t(nblocks) * e.npts * e.nbe;
+    if( reduced_precision_ ) std::copy_n( e.data_sp.data(), n, out );
+    else                     std::copy_n( e.data.data(),    n, out );
+    return true;
+
+  }
+
+  /**
+   *  Store nblocks collocation blocks of task if it has been selected for
+   *  caching. Thread safe with respect to load / store of other tasks.
+   */
+  void store( const XCTask& task, int32_t nblocks, const F* data ) {
+
+    auto it = entries_.find( generation_.index(task) );
+    if( it == entries_.end() ) return;
+
+    auto& e = it->second;
+    if( e.nblocks >= nblocks or not matches(e, task) ) return;
+
+    const size_t n = size_t(nblocks) * e.npts * e.nbe;
+    if( reduced_precision_ ) e.data_sp.assign( data, data + n );
+    else                     e.data   .assign( data, data + n );
+    e.nblocks = nblocks;
+
+  }
+
+};
+
+/**
+ *  Return the collocation cache to be used by an integrator call, (re)creating
+ *  it if the budget or precision has changed. A zero budget disables caching
+ *  for the call without discarding the cached data.
+ */
+template <typename F>
+HostCollocationCache<F>* select_collocation_cache( 
+  std::unique_ptr<HostCollocationCache<F>>& cache, size_t max_bytes,
+  bool reduced_precision ) {
+
+  if( not max_bytes ) return nullptr;
+  if( not cache or cache->max_bytes() != max_bytes or 
+      cache->reduced_precision() != reduced_precision ) {
+    cache = std::make_unique<HostCollocationCache<F>>( max_bytes, 
+      reduced_precision );
+  }
+  return cache.get();
+
+}
+
+}
@@ -0,0 +1,189 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <initializer_list>
+
+#include <gauxc/reduction_driver.hpp>
+#include "host/submat_accumulator.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace GauXC::detail {
+
+/// Number of threads which will execute host task loops
+inline int host_max_threads() {
+  #ifdef _OPENMP
+  return omp_get_max_threads();
+  #else
+  return 1;
+  #endif
+}
+
+/// Index of the calling thread within the current host parallel region
+inline int host_thread_id() {
+  #ifdef _OPENMP
+  return omp_get_thread_num();
+  #else
+  return 0;
+  #endif
+}
+
+/**
+ *  Resolve the accumulation strategy used to increment nmat (nbf x nbf)
+ *  host matrices from nthreads threads.
+ *
+ *  Auto selects thread-private replicas when they fit within
+ *  max_private_bytes and tile locking otherwise. Serial execution always
+ *  accumulates directly into the target without synchronization.
+ */
+inline HostAccumulationStrategy select_host_accumulation(
+  HostAccumulationStrategy requested, int64_t nbf, int64_t nmat, int nthreads,
+  size_t max_private_bytes = (1ul << 31) ) {
+
+  if( nthreads <= 1 ) return HostAccumulationStrategy::ThreadPrivate;
+  if( requested != HostAccumulationStrategy::Auto ) return requested;
+
+  // Thread 0 accumulates directly into the target matrices
+  const size_t replica_bytes =
+    size_t(nthreads-1) * nmat * nbf * nbf * sizeof(double);
+
+  return (replica_bytes <= max_private_bytes) ?
+    HostAccumulationStrategy::ThreadPrivate :
+    HostAccumulationStrategy::TileLock;
+
+}
+
+/**
+ *  Whether the (non-null) integrands reside in node shared memory (cf.
+ *  ReductionDriver::allocate_node_shared). Node shared integrands are
+ *  zeroed by the node leader and updated atomically by every process of
+ *  the node, such that they must be either all shared or all private.
+ */
+inline bool node_shared_targets( const ReductionDriver& rd,
+  std::initializer_list<const void*> targets ) {
+
+  int nshared = 0, ntargets = 0;
+  for( auto* ptr : targets ) if( ptr ) {
+    ntargets++;
+    nshared += rd.is_node_shared(ptr);
+  }
+  if( nshared and nshared != ntargets )
+    GAUXC_GENERIC_EXCEPTION("Integrands Must Be Either All Node Shared or Private");
+
+  #ifndef _OPENMP
+  if( nshared ) 
+    GAUXC_GENERIC_EXCEPTION("Node Shared Integrands Require OpenMP Atomics");
+  #endif
+
+  return nshared > 0;
+
+}
+
+/**
+ *  Manages the accumulation of task-local contributions into a set of
+ *  shared (nbf x nbf) host matrices.
+ *
+ *  For ThreadPrivate, thread 0 accumulates directly into the targets while
+ *  every other thread accumulates into a replica which is allocated (and
+ *  first touched) by the owning thread. Replicas are summed into the
+ *  targets in reduce().
+ */
+template <typename F>
+class HostMatrixAccumulator {
+
+  HostAccumulationStrategy strategy_;
+  int64_t nbf_;
+  std::vector<F*>      targets_;
+  std::vector<int64_t> ld_;
+
+  std::vector<std::vector<F>> replicas_; ///< Per-thread private replicas
+  std::unique_ptr<TileLocks>  locks_;
+
+public:
+
+  HostMatrixAccumulator( HostAccumulationStrategy strategy, int64_t nbf,
+    int nthreads, std::vector<F*> targets, std::vector<int64_t> ld ) :
+    strategy_(strategy), nbf_(nbf), targets_(std::move(targets)),
+    ld_(std::move(ld)) {
+
+    if( targets_.size() != ld_.size() )
+      GAUXC_GENERIC_EXCEPTION("Inconsistent Accumulation Targets");
+
+    if( strategy_ == HostAccumulationStrategy::Auto )
+      GAUXC_GENERIC_EXCEPTION("Accumulation Strategy Must Be Resolved");
+
+    if( strategy_ == HostAccumulationStrategy::ThreadPrivate )
+      replicas_.resize( nthreads );
+    if( strategy_ == HostAccumulationStrategy::TileLock )
+      locks_ = std::make_unique<TileLocks>( nbf );
+
+  }
+
+  inline HostAccumulationStrategy strategy() const noexcept {
+    return strategy_;
+  }
+
+  /// Accumulator description to be passed to the LWD increments
+  inline SubmatAccumulator submat_accumulator() const noexcept {
+    return SubmatAccumulator{ strategy_, locks_.get() };
+  }
+
+  /// Allocate the replica owned by thread tid (call from within the region)
+  void init_thread( int tid ) {
+    if( strategy_ != HostAccumulationStrategy::ThreadPrivate or tid == 0 )
+      return;
+    replicas_.at(tid).assign( targets_.size() * nbf_ * nbf_, F(0.) );
+  }
+
+  /// Matrix into which thread tid accumulates the imat-th target
+  inline F* target( size_t imat, int tid ) {
+    if( strategy_ != HostAccumulationStrategy::ThreadPrivate or tid == 0 )
+      return targets_[imat];
+    return replicas_[tid].data() + imat * nbf_ * nbf_;
+  }
+
+  /// Leading dimension of the matrix returned by target( imat, tid )
+  inline int64_t ld( size_t imat, int tid ) const noexcept {
+    if( strategy_ != HostAccumulationStrategy::ThreadPrivate or tid == 0 )
+      return ld_[imat];
+    return nbf_;
+  }
+
+  /// Sum the thread-private replicas into the targets
+  void reduce() {
+
+    if( strategy_ != HostAccumulationStrategy::ThreadPrivate ) return;
+
+    const int nrep = replicas_.size();
+    const size_t nmat = targets_.size();
+    const int64_t nbf = nbf_;
+
+    // Parallelize over columns, the thread order of the sum is fixed
+    #pragma omp parallel for schedule(static)
+    for( int64_t j = 0; j < nbf; ++j )
+    for( size_t imat = 0; imat < nmat; ++imat ) {
+      auto* T = targets_[imat] + j * ld_[imat];
+      for( int t = 1; t < nrep; ++t )
+      if( replicas_[t].size() ) {
+        const auto* R = replicas_[t].data() + imat * nbf * nbf + j * nbf;
+        for( int64_t i = 0; i < nbf; ++i ) T[i] += R[i];
+      }
+    }
+
+    replicas_.clear();
+
+  }
+
+};
+
+}
@@ -0,0 +1,86 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/xc_task.hpp>
+#include <gauxc/basisset_map.hpp>
+#include "integrator_util/integrator_common.hpp"
+#include "host_task_generation.hpp"
+#include <vector>
+#include <array>
+#include <tuple>
+
+namespace GauXC::detail {
+
+/**
+ *  Compressed submatrix maps (cut-wise, LDA = nbf) of the basis function
+ *  screening of host tasks, reused across integrator calls.
+ *
+ *  The maps are owned by the integrator rather than stored in the tasks of
+ *  the load balancer, whose bfn_screening.submat_map holds the (chunked)
+ *  maps of the device integrators. Tasks are identified by their position
+ *  within a generation of the load balancer tasks (see HostTaskGeneration)
+ *  and a cached map is only reused if it was generated for the same shell 
+ *  list.
+ */
+class HostSubmatCache {
+
+public:
+
+  using submat_map_type = std::vector< std::array<int32_t,3> >;
+
+private:
+
+  struct entry_type {
+    std::vector<int32_t> shell_list;
+    submat_map_type      submat_map;
+  };
+
+  int64_t                 nbf_ = 0;
+  HostTaskGeneration      generation_;
+  std::vector<entry_type> entries_; ///< Indexed by task position
+
+public:
+
+  inline size_t ntasks() const noexcept { return entries_.size(); }
+
+  /**
+   *  Generate the maps of the tasks of a generation which are not (or no 
+   *  longer) cached. Must be called prior to the task loop, which only 
+   *  performs lookups.
+   */
+  void prepare( const BasisSetMap& basis_map, 
+    const HostTaskGeneration& generation, int64_t nbf ) {
+
+    if( nbf != nbf_ or generation != generation_ ) { 
+      entries_.clear(); 
+      nbf_ = nbf; 
+      generation_ = generation;
+    }
+    entries_.resize( generation.ntasks );
+
+    #pragma omp parallel for schedule(dynamic)
+    for( size_t i = 0; i < generation.ntasks; ++i ) {
+      const auto& shell_list = generation.tasks[i].bfn_screening.shell_list;
+      auto& e = entries_[i];
+      if( e.shell_list == shell_list ) continue;
+      e.shell_list = shell_list;
+      e.submat_map.clear();
+      if( shell_list.size() ) std::tie( e.submat_map, std::ignore ) =
+        gen_compressed_submat_map( basis_map, shell_list, nbf, nbf );
+    }
+
+  }
+
+  /// Cached map of a task of the prepared generation
+  inline const submat_map_type& at( const XCTask& task ) const {
+    return entries_.at( generation_.index(task) ).submat_map;
+  }
+
+};
+
+}
@@ -0,0 +1,50 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/xc_task.hpp>
+#include <functional>
+#include <cstdint>
+
+namespace GauXC::detail {
+
+/**
+ *  Identity of a generation of load balancer tasks.
+ *
+ *  Host caches of per-task data key their entries on the position of a task
+ *  within a generation. Unlike the address of its point storage, a position
+ *  cannot be taken over by a different task: every modification of the tasks
+ *  by the load balancer increments LoadBalancerState::task_version, which
+ *  starts a new generation.
+ */
+struct HostTaskGeneration {
+
+  const void*   source  = nullptr; ///< Task source (load balancer)
+  uint64_t      version = 0;       ///< LoadBalancerState::task_version
+  const XCTask* tasks   = nullptr; ///< First task of the generation
+  size_t        ntasks  = 0;       ///< Number of tasks of the generation
+
+  inline bool operator==( const HostTaskGeneration& other ) const noexcept {
+    return source == other.source and version == other.version and
+           tasks  == other.tasks  and ntasks  == other.ntasks;
+  }
+
+  inline bool operator!=( const HostTaskGeneration& other ) const noexcept {
+    return not (*this == other);
+  }
+
+  /// Position of task within the generation, ntasks if it is not part of it
+  inline size_t index( const XCTask& task ) const noexcept {
+    std::less<const XCTask*> lt;
+    if( not ntasks or lt(&task, tasks) or not lt(&task, tasks + ntasks) )
+      return ntasks;
+    return &task - tasks;
+  }
+
+};
+
+}
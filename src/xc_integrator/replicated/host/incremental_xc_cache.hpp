@@ -0,0 +1,86 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#pragma once
+#include <gauxc/xc_task.hpp>
+#include "host_task_generation.hpp"
+#include <vector>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace GauXC::detail {
+
+/**
+ *  Cached state of incremental (difference density) EXC/VXC evaluation
+ *
+ *  Holds the local (un-reduced) EXC / N_EL / VXC at the reference density
+ *  along with the contribution of each task at the density it was last
+ *  evaluated at. Tasks are identified by their position within the 
+ *  generation of load balancer tasks the cache was created for (see 
+ *  HostTaskGeneration), the cache has to be discarded for any other.
+ *
+ *  Only RKS densities are supported (cf. eval_exc_vxc_incremental).
+ */
+template <typename F>
+struct IncrementalXCCache {
+
+  struct task_entry {
+    int32_t npts = 0;
+    int32_t nbe  = 0;
+    F exc   = 0.;
+    F nel   = 0.;
+    F drift = std::numeric_limits<F>::infinity(); ///< Bound on |P - P_eval| 
+                                                  ///< over the task submatrix
+    std::vector<F> vxc; ///< Task VXC contribution (nbe x nbe, lower triangle)
+  };
+
+  HostTaskGeneration generation; ///< Generation of the cached tasks
+  int64_t            nbf = 0;
+  F                  EXC = 0.;
+  F                  NEL = 0.;
+  std::vector<F>     VXC;        ///< Local VXC at the reference density
+
+  std::vector<task_entry> tasks; ///< Indexed by task position
+
+  IncrementalXCCache() = default;
+
+  /// Empty cache for the tasks of a generation, tasks without points are
+  /// not cached
+  IncrementalXCCache( const HostTaskGeneration& gen, int64_t _nbf ) :
+    generation(gen), nbf(_nbf), VXC(_nbf*_nbf, 0.), tasks(gen.ntasks) {
+    for( size_t i = 0; i < gen.ntasks; ++i ) {
+      tasks[i].npts = gen.tasks[i].points.size();
+      tasks[i].nbe  = gen.tasks[i].bfn_screening.nbe;
+    }
+  }
+
+  inline task_entry* find( const XCTask& task ) {
+    const auto i = generation.index( task );
+    if( i >= tasks.size() or not tasks[i].npts ) return nullptr;
+    return &tasks[i];
+  }
+
+};
+
+/// Max |A(i,j)| over the rows / cols selected by a compressed submatrix map
+template <typename F>
+F max_abs_submat( const F* A, int64_t LDA,
+  const std::vector<std::array<int32_t,3>>& submat_map ) {
+
+  F mx = 0.;
+  for( auto& jCut : submat_map )
+  for( int32_t j = jCut[0]; j < jCut[0] + jCut[1]; ++j )
+  for( auto& iCut : submat_map )
+  for( int32_t i = iCut[0]; i < iCut[0] + iCut[1]; ++i )
+    mx = std::max( mx, std::abs(A[i + j*LDA]) );
+
+  return mx;
+
+}
+
+}
@@ -8,6 +8,10 @@
 #pragma once
 #include <gauxc/xc_integrator/replicated/replicated_xc_host_integrator.hpp>
 #include "xc_host_data.hpp"
+#include "integrator_util/exx_screening.hpp"
+#include "incremental_xc_cache.hpp"
+#include "host_collocation_cache.hpp"
+#include "host_submat_cache.hpp"
 
 namespace GauXC::detail {
 
@@ -80,6 +84,13 @@ protected:
                   int64_t ldp, value_type* K, int64_t ldk,
                   const IntegratorSettingsEXX& settings ) override;
 
+  /// Incremental RKS EXC/VXC
+  void eval_exc_vxc_incremental_( int64_t m, int64_t n, const value_type* dP,
+                                  int64_t lddp, value_type* VXC, int64_t ldvxc,
+                                  value_type* EXC, 
+                                  const IntegratorSettingsXC& ks_settings ) override;
+  void reset_incremental_() override;
+
 
 
   // Implementation details of integrate_den
@@ -96,7 +107,14 @@ protected:
                             value_type* VXCy, int64_t ldvxcy,
                             value_type* VXCx, int64_t ldvxcx,
                             value_type* EXC, value_type *N_EL, const IntegratorSettingsXC& ks_settings,
-                            task_iterator task_begin, task_iterator task_end );
+                            task_iterator task_begin, task_iterator task_end,
+                            IncrementalXCCache<value_type>* inc_cache = nullptr,
+                            HostCollocationCache<value_type>* col_cache = nullptr );
+                            
+  // Select the collocation cache for the load balancer tasks and the 
+  // collocation requirements of the functional (nullptr if disabled)
+  HostCollocationCache<value_type>* 
+    prepare_collocation_cache_( const IntegratorSettingsXC& ks_settings );
                             
   // Implemetation details of exc_grad
   void exc_grad_local_work_( const value_type* P, int64_t ldp, value_type* EXC_GRAD );
@@ -105,6 +123,35 @@ protected:
   void exx_local_work_( const value_type* P, int64_t ldp, value_type* K, int64_t ldk,
     const IntegratorSettingsEXX& settings );
 
+  // Density independent sn-LinK screening state, reused across calls
+  std::unique_ptr<EXXScreeningPlan> exx_plan_;
+
+  // Per-task contributions of incremental EXC/VXC
+  std::unique_ptr<IncrementalXCCache<value_type>> xc_inc_cache_;
+
+  // Collocation of the load balancer tasks (XC / density integration and
+  // sn-LinK), reused across calls
+  std::unique_ptr<HostCollocationCache<value_type>> collocation_cache_;
+  std::unique_ptr<HostCollocationCache<value_type>> exx_collocation_cache_;
+
+  // Submatrix maps of the tasks, reused across calls
+  HostSubmatCache submat_cache_;
+
+  // Geometry version of the load balancer the cached state refers to
+  uint64_t cached_geometry_version_ = 0;
+
+  // Discard the cached state if the geometry of the load balancer has been
+  // updated since it was generated (see LoadBalancer::update_geometry)
+  void check_geometry_version_();
+
+  // Current generation of the load balancer tasks, which keys the per-task 
+  // caches
+  HostTaskGeneration task_generation_();
+
+  // Generation of the (created) load balancer tasks in their current 
+  // layout, e.g. those of the packed task store
+  HostTaskGeneration task_generation_( const std::vector<XCTask>& tasks );
+
 public:
 
   template <typename... Args>
@@ -44,6 +44,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   // Get Tasks
   auto& tasks = this->load_balancer_->get_tasks();
+  auto* col_cache = prepare_collocation_cache_( ks_settings );
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
@@ -53,7 +54,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     //exc_vxc_local_work_( P, ldp, VXC, ldvxc, EXC, &N_EL );
     exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx,
                          nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0, 
-                         EXC, &N_EL, ks_settings, tasks.begin(), tasks.end() );
+                         EXC, &N_EL, ks_settings, tasks.begin(), tasks.end(),
+                         nullptr, col_cache );
   });
 
 
@@ -76,13 +76,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   const int32_t nbf = basis.nbf();
   const int32_t natoms = mol.natoms();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
+  // Process tasks on size
   auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  const auto task_order = task_work_order( tasks.begin(), tasks.end() );
+  submat_cache_.prepare( basis_map, task_generation_(), nbf );
 
 
   // Check that Partition Weights have been calculated
@@ -96,18 +93,34 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     EXC_GRAD[i] = 0.;
   }
 
+  // Upper bound of the per-task scratch (cf. the allocations in the task
+  // loop), used to size the thread local arenas up front
+  const size_t host_scr_size = [&]() {
+    const size_t P  = this->load_balancer_->max_npts();
+    const size_t N  = this->load_balancer_->max_nbe();
+    const size_t PN = this->load_balancer_->max_npts_x_nbe();
+    size_t sz = N*N + 6*P;
+    if( func.is_lda() ) sz += 5*PN;
+    if( func.is_gga() ) sz += 14*PN + 2*P;
+    return sz;
+  }();
+
   // Loop over tasks
   const size_t ntasks = tasks.size();
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
+  host_data.reserve( host_scr_size, 16 );
+
+  // Thread-private gradient, reduced after the task loop
+  std::vector<value_type> EXC_GRAD_local( 3*natoms, 0. );
 
   #pragma omp for schedule(dynamic)
   for( size_t iT = 0; iT < ntasks; ++iT ) {
 
     // Alias current task
-    const auto& task = tasks[iT];
+    auto& task = tasks[task_order[iT]];
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
@@ -119,62 +132,63 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const int32_t* shell_list = task.bfn_screening.shell_list.data();
 
     // Allocate enough memory for batch
+    host_data.reset();
 
     // Things that every calc needs
-    host_data.nbe_scr .resize( nbe * nbe  );
-    host_data.eps     .resize( npts );
-    host_data.vrho    .resize( npts );
-    host_data.den_scr .resize( 4 * npts );
+    host_data.nbe_scr = host_data.alloc( nbe * nbe );
+    host_data.eps     = host_data.alloc( npts );
+    host_data.vrho    = host_data.alloc( npts );
+    host_data.den_scr = host_data.alloc( 4 * npts );
 
     if( func.is_lda() ) {
-      host_data.basis_eval .resize( 4 * npts * nbe );
-      host_data.zmat       .resize( npts * nbe );
+      host_data.basis_eval = host_data.alloc( 4 * npts * nbe );
+      host_data.zmat       = host_data.alloc( npts * nbe );
     }
 
     if( func.is_gga() ){
-      host_data.basis_eval .resize( 10 * npts * nbe );
-      host_data.zmat       .resize( 4  * npts * nbe );
-      host_data.gamma      .resize( npts );
-      host_data.vgamma     .resize( npts );
+      host_data.basis_eval = host_data.alloc( 10 * npts * nbe );
+      host_data.zmat       = host_data.alloc( 4  * npts * nbe );
+      host_data.gamma      = host_data.alloc( npts );
+      host_data.vgamma     = host_data.alloc( npts );
     }
 
 #if 0
     if( func.is_mgga() ) {
-      host_data.basis_eval .resize( 11 * npts * nbe ); // basis + grad(3) + hess(6) + lapl
-      host_data.zmat       .resize(  7 * npts * nbe ); // basis + grad(3) + grad(3)
-      host_data.mmat       .resize( npts * nbe );
-      host_data.gamma      .resize( npts );
-      host_data.vgamma     .resize( npts );
-      host_data.tau        .resize( npts );
-      host_data.vtau       .resize( npts );
+      host_data.basis_eval = host_data.alloc( 11 * npts * nbe ); // basis + grad(3) + hess(6) + lapl
+      host_data.zmat       = host_data.alloc( 7 * npts * nbe ); // basis + grad(3) + grad(3)
+      host_data.mmat       = host_data.alloc( npts * nbe );
+      host_data.gamma      = host_data.alloc( npts );
+      host_data.vgamma     = host_data.alloc( npts );
+      host_data.tau        = host_data.alloc( npts );
+      host_data.vtau       = host_data.alloc( npts );
       if ( needs_laplacian ) {
-	host_data.basis_eval.resize( 24 * npts * nbe );
-	host_data.lapl      .resize( npts );
-	host_data.vlapl     .resize( npts );
+	host_data.basis_eval = host_data.alloc( 24 * npts * nbe );
+	host_data.lapl      = host_data.alloc( npts );
+	host_data.vlapl     = host_data.alloc( npts );
       }
     }
 #endif
 
     // Alias/Partition out scratch memory
-    auto* basis_eval = host_data.basis_eval.data();
-    auto* den_eval   = host_data.den_scr.data();
-    auto* nbe_scr    = host_data.nbe_scr.data();
-    auto* zmat       = host_data.zmat.data();
+    auto* basis_eval = host_data.basis_eval;
+    auto* den_eval   = host_data.den_scr;
+    auto* nbe_scr    = host_data.nbe_scr;
+    auto* zmat       = host_data.zmat;
 
     auto* zmat_x = zmat   + npts*nbe;
     auto* zmat_y = zmat_x + npts*nbe;
     auto* zmat_z = zmat_y + npts*nbe;
 
-    auto* eps        = host_data.eps.data();
-    auto* gamma      = host_data.gamma.data();
-    auto* vrho       = host_data.vrho.data();
-    auto* vgamma     = host_data.vgamma.data();
+    auto* eps        = host_data.eps;
+    auto* gamma      = host_data.gamma;
+    auto* vrho       = host_data.vrho;
+    auto* vgamma     = host_data.vgamma;
 
 #if 0
-    auto* tau        = host_data.tau.data();
-    auto* lapl       = host_data.lapl.data();
-    auto* vtau       = host_data.vtau.data();
-    auto* vlapl      = host_data.vlapl.data();
+    auto* tau        = host_data.tau;
+    auto* lapl       = host_data.lapl;
+    auto* vtau       = host_data.vtau;
+    auto* vlapl      = host_data.vlapl;
     auto* mmat_x      = mmat;
     auto* mmat_y      = mmat_x + npts * nbe;
     auto* mmat_z      = mmat_y + npts * nbe;
@@ -248,8 +262,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
     // Get the submatrix map for batch
-    auto [submat_map, foo] = 
-      gen_compressed_submat_map( basis_map, task.bfn_screening.shell_list, nbf, nbf );
+    const auto& submat_map = submat_cache_.at( task );
 
     // Evaluate Collocation Gradient (+ Hessian)
 #if 0
@@ -430,12 +443,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
       } // loop over bfns + grid points
 
-      #pragma omp atomic
-      EXC_GRAD[3*iAt + 0] += -2 * g_acc_x;
-      #pragma omp atomic
-      EXC_GRAD[3*iAt + 1] += -2 * g_acc_y;
-      #pragma omp atomic
-      EXC_GRAD[3*iAt + 2] += -2 * g_acc_z;
+      EXC_GRAD_local[3*iAt + 0] += -2 * g_acc_x;
+      EXC_GRAD_local[3*iAt + 1] += -2 * g_acc_y;
+      EXC_GRAD_local[3*iAt + 2] += -2 * g_acc_z;
 
       bf_off += sh_sz; // Increment basis offset
 
@@ -443,6 +453,11 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
         
   } // End loop over tasks
 
+  #pragma omp critical
+  {
+    for( auto i = 0; i < 3*natoms; ++i ) EXC_GRAD[i] += EXC_GRAD_local[i];
+  }
+
   } // OpenMP Region
 
   
@@ -8,9 +8,11 @@
 #pragma once
 
 #include "reference_replicated_xc_host_integrator.hpp"
+#include "host_matrix_accumulator.hpp"
 #include "integrator_util/integrator_common.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
+#include "host/util.hpp"
 #include <stdexcept>
 
 namespace GauXC::detail {
@@ -64,6 +66,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   // Get Tasks
   auto& tasks = this->load_balancer_->get_tasks();
+  auto* col_cache = prepare_collocation_cache_( ks_settings );
 
   // Temporary electron count to judge integrator accuracy
   value_type N_EL;
@@ -73,7 +76,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     exc_vxc_local_work_( basis, Ps, ldps, Pz, ldpz, Py, ldpy, Px, ldpx, 
                          VXCs, ldvxcs, VXCz, ldvxcz,
                          VXCy, ldvxcy, VXCx, ldvxcx, EXC, &N_EL, ks_settings,
-                         tasks.begin(), tasks.end() );
+                         tasks.begin(), tasks.end(), nullptr, col_cache );
   });
 
 
@@ -83,19 +86,89 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( VXCs, nbf*nbf, ReductionOp::Sum );
-    if(VXCz) this->reduction_driver_->allreduce_inplace( VXCz, nbf*nbf, ReductionOp::Sum );
-    if(VXCy) this->reduction_driver_->allreduce_inplace( VXCy, nbf*nbf, ReductionOp::Sum ); 
-    if(VXCx) this->reduction_driver_->allreduce_inplace( VXCx, nbf*nbf, ReductionOp::Sum );
+    // Lower triangles of all VXC components and EXC / N_EL in a single
+    // message, the upper triangles are set by symmetry
+    std::vector<value_type*> VXC_list = {VXCs};
+    std::vector<size_t>      ld_list  = {size_t(ldvxcs)};
+    if(VXCz) { VXC_list.push_back(VXCz); ld_list.push_back(ldvxcz); }
+    if(VXCy) { VXC_list.push_back(VXCy); ld_list.push_back(ldvxcy); }
+    if(VXCx) { VXC_list.push_back(VXCx); ld_list.push_back(ldvxcx); }
 
-    this->reduction_driver_->allreduce_inplace( EXC,   1    , ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( &N_EL, 1    , ReductionOp::Sum );
+    value_type scalars[2] = { *EXC, N_EL };
+    this->reduction_driver_->allreduce_packed_symmetric( nbf, VXC_list, 
+      ld_list, scalars, 2, ReductionOp::Sum );
+    *EXC = scalars[0]; N_EL = scalars[1];
 
   });
 
+}
+
+
+/// Number of (nbe x npts) collocation blocks required by the functional
+template <typename FuncType>
+int32_t collocation_nblocks( const FuncType& func ) {
+  if( func.is_mgga() ) return func.needs_laplacian() ? 5 : 4;
+  return func.is_gga() ? 4 : 1;
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::check_geometry_version_() {
+
+  const auto version = this->load_balancer_->state().geometry_version;
+  if( version == cached_geometry_version_ ) return;
+
+  // The incremental references (P, K) belong to the previous geometry
+  this->reset_incremental_();
+  exx_plan_.reset();
+  collocation_cache_.reset();
+  exx_collocation_cache_.reset();
+  cached_geometry_version_ = version;
+
+}
+
+template <typename ValueType>
+HostTaskGeneration 
+  ReferenceReplicatedXCHostIntegrator<ValueType>::task_generation_() {
+
+  // Task creation increments the task version, query it afterwards
+  return task_generation_( this->load_balancer_->get_tasks() );
 
 }
 
+template <typename ValueType>
+HostTaskGeneration 
+  ReferenceReplicatedXCHostIntegrator<ValueType>::task_generation_( 
+    const std::vector<XCTask>& tasks ) {
+
+  return HostTaskGeneration{ this->load_balancer_.get(), 
+    this->load_balancer_->state().task_version, tasks.data(), tasks.size() };
+
+}
+
+template <typename ValueType>
+auto ReferenceReplicatedXCHostIntegrator<ValueType>::
+  prepare_collocation_cache_( const IntegratorSettingsXC& settings ) ->
+  HostCollocationCache<value_type>* {
+
+  check_geometry_version_();
+
+  IntegratorSettingsKS ks_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&settings) ) {
+    ks_settings = *tmp;
+  }
+
+  auto* cache = select_collocation_cache( collocation_cache_, 
+    ks_settings.collocation_cache_bytes, ks_settings.collocation_cache_fp32 );
+  if( not cache ) return nullptr;
+
+  // Select the tasks to cache given the current collocation requirements
+  this->timer_.time_op("XCIntegrator.CollocationCache", [&](){
+    cache->reserve( this->load_balancer_->basis(), task_generation_(),
+      collocation_nblocks(*this->func_) );
+  });
+  return cache;
+
+}
 
 /// Generic implementation details of EXC/VXC local work - deduces RKS/UKS/GKS
 /// based on null-y / zero parameters
@@ -111,7 +184,9 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
                        value_type* VXCx, int64_t ldvxcx,
                        value_type* EXC, value_type *N_EL, 
                        const IntegratorSettingsXC& settings,
-                       task_iterator task_begin, task_iterator task_end) {
+                       task_iterator task_begin, task_iterator task_end,
+                       IncrementalXCCache<value_type>* inc_cache,
+                       HostCollocationCache<value_type>* col_cache ) {
 
   const bool is_gks = (Pz != nullptr) and (Py != nullptr) and (Px != nullptr);
   const bool is_uks = (Pz != nullptr) and (Py == nullptr) and (Px == nullptr);
@@ -121,6 +196,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   }
 
   const bool is_exc_only = (!VXCs) and (!VXCz) and (!VXCy) and (!VXCx);
+  if( inc_cache and (not is_rks or is_exc_only) )
+    GAUXC_GENERIC_EXCEPTION("Incremental EXC/VXC Only Implemented for RKS");
   //if(is_exc_only) std::cout << "EXC ONLY" << std::endl;
 
 
@@ -150,13 +227,19 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
+  // Process tasks on size, incremental evaluations only evaluate the tasks 
+  // whose density changed beyond the tolerance
+  auto task_order = task_work_order( task_begin, task_end );
+  if( inc_cache ) {
+    const double dtol = ks_settings.incremental_dtol;
+    task_order.erase( std::remove_if( task_order.begin(), task_order.end(),
+      [&]( size_t i ) {
+        auto* e = inc_cache->find( task_begin[i] );
+        return not (e and e->drift >= dtol);
+      }), task_order.end() );
+  }
 
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( task_begin, task_end, task_comparator );
+  submat_cache_.prepare( basis_map, task_generation_(), nbf );
 
 
   // Check that Partition Weights have been calculated
@@ -165,7 +248,11 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified");
   }
 
-  // Zero out integrands
+  // Zero out integrands (node shared integrands are zeroed by the node 
+  // leader and accumulated atomically)
+  auto& rd = *this->reduction_driver_;
+  const bool node_shared = node_shared_targets( rd, {VXCs, VXCz, VXCy, VXCx} );
+  if( not node_shared or rd.is_node_leader() ) {
   
   if(VXCs)
   for( auto j = 0; j < nbf; ++j ) {
@@ -190,17 +277,66 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       }
     }
   }
+
+  }
+  if( node_shared ) rd.node_barrier();
  
   double EXC_WORK = 0.0;
   double NEL_WORK = 0.0;
+
+  // Setup VXC accumulation
+  std::vector<value_type*> vxc_targets;
+  std::vector<int64_t>     vxc_ld;
+  if( not is_exc_only ) {
+    vxc_targets.push_back(VXCs); vxc_ld.push_back(ldvxcs);
+    if(not is_rks) { vxc_targets.push_back(VXCz); vxc_ld.push_back(ldvxcz); }
+    if(is_gks) {
+      vxc_targets.push_back(VXCy); vxc_ld.push_back(ldvxcy);
+      vxc_targets.push_back(VXCx); vxc_ld.push_back(ldvxcx);
+    }
+  }
+
+  const int nthreads = host_max_threads();
+  HostMatrixAccumulator<value_type> vxc_acc( node_shared ? 
+    HostAccumulationStrategy::Atomic :
+    select_host_accumulation( ks_settings.accumulation, nbf, vxc_targets.size(),
+      nthreads ), nbf, nthreads, vxc_targets, vxc_ld );
+  const auto submat_acc = vxc_acc.submat_accumulator();
     
   // Loop over tasks
-  const size_t ntasks = std::distance(task_begin, task_end);
+  const size_t ntasks = task_order.size();
+
+  // Upper bound of the per-task scratch (cf. the allocations in the task
+  // loop), used to size the thread local arenas up front
+  const size_t host_scr_size = [&]() {
+    const size_t P  = this->load_balancer_->max_npts();
+    const size_t N  = this->load_balancer_->max_nbe();
+    const size_t PN = this->load_balancer_->max_npts_x_nbe();
+    const size_t spin_dim_scal = is_rks ? 1 : is_uks ? 2 : 4;
+    const size_t gga_dim_scal  = is_rks ? 1 : 3;
+    const size_t mgga_dim_scal = func.is_mgga() ? 4 : 1;
+
+    size_t sz = N*N + PN * spin_dim_scal * mgga_dim_scal + (is_gks ? 6*P : 0) +
+      P + P * spin_dim_scal;
+    if( func.is_lda() ) sz += PN + P * spin_dim_scal;
+    if( func.is_gga() ) sz += 4*PN + 4*P*spin_dim_scal + 2*P*gga_dim_scal;
+    if( func.is_mgga() ) {
+      sz += (needs_laplacian ? 5 : 4) * PN + 6*P*spin_dim_scal + 
+        2*P*gga_dim_scal;
+      if( needs_laplacian ) sz += 2*P*spin_dim_scal;
+    }
+    return sz;
+  }();
 
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
+  std::vector<value_type> inc_scr;  // Thread local incremental VXC scratch
+  host_data.reserve( host_scr_size, 16 );
+
+  const int tid = host_thread_id();
+  vxc_acc.init_thread(tid);
 
   #pragma omp for schedule(dynamic)
   for( size_t iT = 0; iT < ntasks; ++iT ) {
@@ -208,7 +344,11 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     //std::cout << iT << "/" << ntasks << std::endl;
     //if(is_exc_only) printf("%lu / %lu\n", iT, ntasks);
     // Alias current task
-    const auto& task = *(task_begin + iT);
+    auto& task = *(task_begin + task_order[iT]);
+    // Record the task cost (EXC-only evaluations are not representative)
+    double exc_only_cost;
+    ScopedTaskTimer task_timer( is_exc_only ? exc_only_cost : 
+                                              task.measured_cost.exc_vxc );
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
@@ -220,6 +360,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const int32_t* shell_list = task.bfn_screening.shell_list.data();
 
     // Allocate enough memory for batch
+    host_data.reset();
    
     const size_t spin_dim_scal = is_rks ? 1 : is_uks ? 2 : 4; // last case is_gks
     const size_t sds          = is_rks ? 1 : 2;
@@ -227,47 +368,47 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const size_t mgga_dim_scal = func.is_mgga() ? 4 : 1; // basis + d1basis
 
     // Things that every calc needs
-    host_data.nbe_scr .resize(nbe  * nbe);
-    host_data.zmat    .resize(npts * nbe * spin_dim_scal * mgga_dim_scal + gks_mod_KH); 
-    host_data.eps     .resize(npts);
-    host_data.vrho    .resize(npts * spin_dim_scal);
+    host_data.nbe_scr = host_data.alloc( nbe  * nbe );
+    host_data.zmat    = host_data.alloc( npts * nbe * spin_dim_scal * mgga_dim_scal + gks_mod_KH ); 
+    host_data.eps     = host_data.alloc( npts );
+    host_data.vrho    = host_data.alloc( npts * spin_dim_scal );
 
     // LDA data requirements
     if( func.is_lda() ){
-      host_data.basis_eval .resize( npts * nbe );
-      host_data.den_scr    .resize( npts * spin_dim_scal);
+      host_data.basis_eval = host_data.alloc( npts * nbe );
+      host_data.den_scr    = host_data.alloc( npts * spin_dim_scal );
     }
      
     // GGA data requirements
     const size_t gga_dim_scal = is_rks ? 1 : 3;
     if( func.is_gga() ){
-      host_data.basis_eval .resize( 4 * npts * nbe );
-      host_data.den_scr    .resize( spin_dim_scal * 4 * npts );
-      host_data.gamma      .resize( gga_dim_scal * npts );
-      host_data.vgamma     .resize( gga_dim_scal * npts );
+      host_data.basis_eval = host_data.alloc( 4 * npts * nbe );
+      host_data.den_scr    = host_data.alloc( spin_dim_scal * 4 * npts );
+      host_data.gamma      = host_data.alloc( gga_dim_scal * npts );
+      host_data.vgamma     = host_data.alloc( gga_dim_scal * npts );
     }
 
     if( func.is_mgga() ){
       if ( needs_laplacian ) {
-        host_data.basis_eval .resize( 11 * npts * nbe ); // basis + grad (3) + hess (6) + lapl 
-        host_data.lapl       .resize( spin_dim_scal * npts );
-        host_data.vlapl      .resize( spin_dim_scal * npts );
+        host_data.basis_eval = host_data.alloc( 5 * npts * nbe ); // basis + grad (3) + lapl
+        host_data.lapl       = host_data.alloc( spin_dim_scal * npts );
+        host_data.vlapl      = host_data.alloc( spin_dim_scal * npts );
       } else {
-        host_data.basis_eval .resize( 4 * npts * nbe ); // basis + grad (3)
+        host_data.basis_eval = host_data.alloc( 4 * npts * nbe ); // basis + grad (3)
       }
 
-      host_data.den_scr    .resize( spin_dim_scal * 4 * npts );
-      host_data.gamma      .resize( gga_dim_scal * npts );
-      host_data.vgamma     .resize( gga_dim_scal * npts );
-      host_data.tau        .resize( npts * spin_dim_scal );
-      host_data.vtau       .resize( npts * spin_dim_scal );
+      host_data.den_scr    = host_data.alloc( spin_dim_scal * 4 * npts );
+      host_data.gamma      = host_data.alloc( gga_dim_scal * npts );
+      host_data.vgamma     = host_data.alloc( gga_dim_scal * npts );
+      host_data.tau        = host_data.alloc( npts * spin_dim_scal );
+      host_data.vtau       = host_data.alloc( npts * spin_dim_scal );
     }
 
     // Alias/Partition out scratch memory
-    auto* basis_eval = host_data.basis_eval.data();
-    auto* den_eval   = host_data.den_scr.data();
-    auto* nbe_scr    = host_data.nbe_scr.data();
-    auto* zmat       = host_data.zmat.data();
+    auto* basis_eval = host_data.basis_eval;
+    auto* den_eval   = host_data.den_scr;
+    auto* nbe_scr    = host_data.nbe_scr;
+    auto* zmat       = host_data.zmat;
 
     decltype(zmat) zmat_z = nullptr;
     decltype(zmat) zmat_x = nullptr;
@@ -280,25 +421,19 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       zmat_y = zmat_x + nbe * npts;
     }
      
-    auto* eps        = host_data.eps.data();
-    auto* gamma      = host_data.gamma.data();
-    auto* tau        = host_data.tau.data();
-    auto* lapl       = host_data.lapl.data();
-    auto* vrho       = host_data.vrho.data();
-    auto* vgamma     = host_data.vgamma.data();
-    auto* vtau       = host_data.vtau.data();
-    auto* vlapl      = host_data.vlapl.data();
+    auto* eps        = host_data.eps;
+    auto* gamma      = host_data.gamma;
+    auto* tau        = host_data.tau;
+    auto* lapl       = host_data.lapl;
+    auto* vrho       = host_data.vrho;
+    auto* vgamma     = host_data.vgamma;
+    auto* vtau       = host_data.vtau;
+    auto* vlapl      = host_data.vlapl;
 
 
     value_type* dbasis_x_eval = nullptr;
     value_type* dbasis_y_eval = nullptr;
     value_type* dbasis_z_eval = nullptr;
-    value_type* d2basis_xx_eval = nullptr;
-    value_type* d2basis_xy_eval = nullptr;
-    value_type* d2basis_xz_eval = nullptr;
-    value_type* d2basis_yy_eval = nullptr;
-    value_type* d2basis_yz_eval = nullptr;
-    value_type* d2basis_zz_eval = nullptr;
     value_type* lbasis_eval = nullptr;
     value_type* dden_x_eval = nullptr;
     value_type* dden_y_eval = nullptr;
@@ -334,13 +469,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       mmat_y        = mmat_x + npts * nbe;
       mmat_z        = mmat_y + npts * nbe;
       if ( needs_laplacian ) {
-        d2basis_xx_eval = dbasis_z_eval + npts * nbe;
-        d2basis_xy_eval = d2basis_xx_eval + npts * nbe;
-        d2basis_xz_eval = d2basis_xy_eval + npts * nbe;
-        d2basis_yy_eval = d2basis_xz_eval + npts * nbe;
-        d2basis_yz_eval = d2basis_yy_eval + npts * nbe;
-        d2basis_zz_eval = d2basis_yz_eval + npts * nbe;
-        lbasis_eval     = d2basis_zz_eval + npts * nbe;
+        lbasis_eval = dbasis_z_eval + npts * nbe;
       }
       if(is_uks) {
         mmat_x_z = zmat_z + npts * nbe;
@@ -351,21 +480,16 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
     // Get the submatrix map for batch
-    std::vector< std::array<int32_t, 3> > submat_map;
-    std::tie(submat_map, std::ignore) =
-          gen_compressed_submat_map(basis_map, task.bfn_screening.shell_list, nbf, nbf);
+    const auto& submat_map = submat_cache_.at( task );
 
-    // Evaluate Collocation (+ Grad and Hessian)
-    if( func.is_mgga() ) {
+    // Evaluate Collocation (+ Grad and Laplacian)
+    const auto ncol_blocks = collocation_nblocks(func);
+    if( col_cache and col_cache->load( task, ncol_blocks, basis_eval ) ) {
+      // Collocation retrieved from cache
+    } else if( func.is_mgga() ) {
       if ( needs_laplacian ) {
-        // TODO: Modify gau2grid to compute Laplacian instead of full hessian
-        lwd->eval_collocation_hessian( npts, nshells, nbe, points, basis, shell_list,
-          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, d2basis_xx_eval,
-          d2basis_xy_eval, d2basis_xz_eval, d2basis_yy_eval, d2basis_yz_eval,
-          d2basis_zz_eval);
-        blas::lacpy( 'A', nbe, npts, d2basis_xx_eval, nbe, lbasis_eval, nbe );
-        blas::axpy( nbe * npts, 1., d2basis_yy_eval, 1, lbasis_eval, 1);
-        blas::axpy( nbe * npts, 1., d2basis_zz_eval, 1, lbasis_eval, 1);
+        lwd->eval_collocation_laplacian( npts, nshells, nbe, points, basis, shell_list,
+          basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval, lbasis_eval );
       } else {
         lwd->eval_collocation_gradient( npts, nshells, nbe, points, basis, shell_list,
           basis_eval, dbasis_x_eval, dbasis_y_eval, dbasis_z_eval );
@@ -379,6 +503,8 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list,
         basis_eval );
 
+    if( col_cache ) col_cache->store( task, ncol_blocks, basis_eval );
+
      
     // Evaluate X matrix (fac * P * B) -> store in Z
     const auto xmat_fac = is_rks ? 2.0 : 1.0; // TODO Fix for spinor RKS input
@@ -492,6 +618,19 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
       EXC_local += eps[i]     * den;
     }
 
+    // Incremental evaluation: only the change of the task contribution 
+    // is accumulated
+    auto* inc_entry = inc_cache ? inc_cache->find(task) : nullptr;
+    if( inc_entry ) {
+      const auto exc_old = inc_entry->exc;
+      const auto nel_old = inc_entry->nel;
+      inc_entry->exc   = EXC_local;
+      inc_entry->nel   = NEL_local;
+      inc_entry->drift = 0.;
+      EXC_local -= exc_old;
+      NEL_local -= nel_old;
+    }
+
     // Atomic updates
     #pragma omp atomic
     EXC_WORK += EXC_local;
@@ -549,15 +688,38 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     {
 
       // Increment VXC
-      lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat, nbe, VXCs, ldvxcs, nbe_scr );
+      if( inc_entry ) {
+        // Task contribution at the current density
+        const std::vector< std::array<int32_t,3> > task_submat = {{0, nbe, 0}};
+        inc_scr.assign( nbe * nbe, 0. );
+        lwd->inc_vxc( mgga_dim_scal * npts, nbe, nbe, basis_eval, task_submat, 
+          zmat, nbe, inc_scr.data(), nbe, nbe_scr, 
+          SubmatAccumulator{ HostAccumulationStrategy::ThreadPrivate } );
+
+        // Replace the cached contribution, increment VXC by the change
+        auto& vxc_task = inc_entry->vxc;
+        vxc_task.resize( nbe * nbe, 0. );
+        for( int32_t i = 0; i < nbe*nbe; ++i ) {
+          const auto v_new = inc_scr[i];
+          inc_scr[i] -= vxc_task[i];
+          vxc_task[i] = v_new;
+        }
+        detail::inc_by_submat( nbf, nbf, nbe, nbe, vxc_acc.target(0,tid), 
+          vxc_acc.ld(0,tid), inc_scr.data(), nbe, submat_map, submat_map, 
+          submat_acc );
+      } else {
+        lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat, nbe, 
+          vxc_acc.target(0,tid), vxc_acc.ld(0,tid), nbe_scr, submat_acc );
+      }
       if(not is_rks) {
-        lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat_z, nbe,VXCz, ldvxcz, nbe_scr);
+        lwd->inc_vxc( mgga_dim_scal * npts, nbf, nbe, basis_eval, submat_map, zmat_z, nbe,
+          vxc_acc.target(1,tid), vxc_acc.ld(1,tid), nbe_scr, submat_acc );
       }
       if(is_gks) {
-        lwd->inc_vxc( npts, nbf, nbe, basis_eval, submat_map, zmat_x, nbe, VXCy, ldvxcy,
-          nbe_scr);
-        lwd->inc_vxc( npts, nbf, nbe, basis_eval, submat_map, zmat_y, nbe, VXCx, ldvxcx,
-          nbe_scr);
+        lwd->inc_vxc( npts, nbf, nbe, basis_eval, submat_map, zmat_x, nbe, 
+          vxc_acc.target(2,tid), vxc_acc.ld(2,tid), nbe_scr, submat_acc );
+        lwd->inc_vxc( npts, nbf, nbe, basis_eval, submat_map, zmat_y, nbe, 
+          vxc_acc.target(3,tid), vxc_acc.ld(3,tid), nbe_scr, submat_acc );
       }
        
     }
@@ -566,32 +728,20 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   } // End OpenMP region
 
+  // Reduce thread-private VXC contributions
+  vxc_acc.reduce();
 
   // Set scalar return values
   *EXC  = EXC_WORK;
   *N_EL = NEL_WORK;
 
-  if(not is_exc_only) {
-    // Symmetrize VXC
-    for( int32_t j = 0;   j < nbf; ++j ) {
-      for( int32_t i = j+1; i < nbf; ++i ) {
-        VXCs[ j + i*ldvxcs ] = VXCs[ i + j*ldvxcs ];
-      }
-    }
-    if(not is_rks) {
-      for( int32_t j = 0;   j < nbf; ++j ) {
-        for( int32_t i = j+1; i < nbf; ++i ) {
-          VXCz[ j + i*ldvxcz ] = VXCz[ i + j*ldvxcz ];
-        }
-      }
-    }
-    if( is_gks) {
-      for( int32_t j = 0;   j < nbf; ++j ) {
-        for( int32_t i = j+1; i < nbf; ++i ) {
-          VXCy[ j + i*ldvxcy ] = VXCy[ i + j*ldvxcy ];
-          VXCx[ j + i*ldvxcx ] = VXCx[ i + j*ldvxcx ];
-        }
-      }
+  // Symmetrize VXC (node shared integrands once the reduction is complete)
+  if(not is_exc_only and not node_shared) {
+    symmetrize_from_lower( nbf, VXCs, ldvxcs );
+    if(not is_rks) symmetrize_from_lower( nbf, VXCz, ldvxcz );
+    if(is_gks) {
+      symmetrize_from_lower( nbf, VXCy, ldvxcy );
+      symmetrize_from_lower( nbf, VXCx, ldvxcx );
     }
   }
 
@@ -613,6 +763,130 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 }
 
 
+/// Incremental RKS EXC/VXC driver
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::
+  eval_exc_vxc_incremental_( int64_t m, int64_t n, 
+                             const value_type* dP, int64_t lddp,
+                             value_type* VXC, int64_t ldvxc,
+                             value_type* EXC, const IntegratorSettingsXC& settings) {
+
+  const auto& basis = this->load_balancer_->basis();
+  const auto& mol   = this->load_balancer_->molecule();
+
+  // Check that dP / VXC are sane
+  const int64_t nbf = basis.nbf();
+  if( m != n )
+    GAUXC_GENERIC_EXCEPTION("dP/VXC Must Be Square");
+  if( m != nbf )
+    GAUXC_GENERIC_EXCEPTION("dP/VXC Must Have Same Dimension as Basis");
+  if( lddp < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDDP");
+  if( ldvxc < nbf )
+    GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
+
+  IntegratorSettingsKS ks_settings;
+  if( auto* tmp = dynamic_cast<const IntegratorSettingsKS*>(&settings) ) {
+    ks_settings = *tmp;
+  }
+  const double dtol = ks_settings.incremental_dtol;
+
+  // Get Tasks
+  auto& tasks = this->load_balancer_->get_tasks();
+  const size_t ntasks = tasks.size();
+
+  // Update the reference density (after discarding that of a previous
+  // geometry)
+  check_geometry_version_();
+  this->accumulate_incremental( m, n, dP, lddp, this->xc_incremental_P_ );
+
+  // The cached contributions are discarded (i.e. every task is evaluated at 
+  // the reference density) if the tasks have been modified since they were
+  // evaluated, e.g. by a rebalance
+  const auto generation = task_generation_();
+  if( not xc_inc_cache_ or xc_inc_cache_->generation != generation or
+      xc_inc_cache_->nbf != nbf ) {
+    xc_inc_cache_ = 
+      std::make_unique<IncrementalXCCache<value_type>>( generation, nbf );
+  }
+  auto& cache = *xc_inc_cache_;
+
+  // Bound the density change on the submatrix of each cached task
+  BasisSetMap basis_map(basis,mol);
+  submat_cache_.prepare( basis_map, generation, nbf );
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t i = 0; i < ntasks; ++i ) {
+    auto* e = cache.find( tasks[i] );
+    if( not e or e->drift >= dtol ) continue;
+    const auto& submat_map = submat_cache_.at( tasks[i] );
+    e->drift += max_abs_submat( dP, lddp, submat_map );
+  }
+
+  // Collocation is cached for the full task list, not only the dirty tasks
+  auto* col_cache = prepare_collocation_cache_( settings );
+
+  // Compute the change of the local contributions to EXC / VXC (of the
+  // tasks which require evaluation)
+  std::vector<value_type> dVXC( nbf*nbf );
+  value_type dEXC, dNEL;
+  this->timer_.time_op("XCIntegrator.LocalWork", [&](){
+    exc_vxc_local_work_( basis, this->xc_incremental_P_.data(), nbf, 
+                         nullptr, 0, nullptr, 0, nullptr, 0,
+                         dVXC.data(), nbf, nullptr, 0, nullptr, 0, nullptr, 0, 
+                         &dEXC, &dNEL, settings, tasks.begin(), tasks.end(),
+                         &cache, col_cache );
+  });
+
+  cache.EXC += dEXC;
+  cache.NEL += dNEL;
+  for( int64_t i = 0; i < nbf*nbf; ++i ) cache.VXC[i] += dVXC[i];
+
+  // Local results at the reference density (accumulated by the processes 
+  // of a node for node shared VXC)
+  auto& rd = *this->reduction_driver_;
+  if( node_shared_targets( rd, {VXC} ) ) {
+    if( rd.is_node_leader() ) 
+    for( int64_t j = 0; j < nbf; ++j )
+    for( int64_t i = 0; i < nbf; ++i ) 
+      VXC[i + j*ldvxc] = 0.;
+    rd.node_barrier();
+
+    #pragma omp parallel for schedule(static)
+    for( int64_t j = 0; j < nbf; ++j )
+    for( int64_t i = 0; i < nbf; ++i ) {
+      #pragma omp atomic
+      VXC[i + j*ldvxc] += cache.VXC[i + j*nbf];
+    }
+  } else {
+    for( int64_t j = 0; j < nbf; ++j )
+    for( int64_t i = 0; i < nbf; ++i ) 
+      VXC[i + j*ldvxc] = cache.VXC[i + j*nbf];
+  }
+  *EXC = cache.EXC;
+  value_type N_EL = cache.NEL;
+
+  // Reduce Results
+  this->timer_.time_op("XCIntegrator.Allreduce", [&](){
+
+    if( not this->reduction_driver_->takes_host_memory() )
+      GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
+
+    value_type scalars[2] = { *EXC, N_EL };
+    this->reduction_driver_->allreduce_packed_symmetric( nbf, {VXC}, 
+      {size_t(ldvxc)}, scalars, 2, ReductionOp::Sum );
+    *EXC = scalars[0]; N_EL = scalars[1];
+
+  });
+
+}
+
+template <typename ValueType>
+void ReferenceReplicatedXCHostIntegrator<ValueType>::reset_incremental_() {
+  xc_inc_cache_.reset();
+  base_type::reset_incremental_();
+}
+
+
 /// UKS EXC/VXC driver - delegates to generic GKS impl
 template <typename ValueType>
 void ReferenceReplicatedXCHostIntegrator<ValueType>::
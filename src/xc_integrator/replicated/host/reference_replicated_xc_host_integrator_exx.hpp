@@ -8,11 +8,13 @@
 #pragma once
 
 #include "reference_replicated_xc_host_integrator.hpp"
+#include "host_matrix_accumulator.hpp"
 #include "integrator_util/integrator_common.hpp"
 #include "integrator_util/integral_bounds.hpp"
 #include "integrator_util/exx_screening.hpp"
 #include "host/local_host_work_driver.hpp"
 #include "host/blas.hpp"
+#include "host/util.hpp"
 #include <stdexcept>
 #include <set>
 
@@ -49,8 +51,12 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Invalid LDVXC");
 
 
-  // Get Tasks
-  this->load_balancer_->get_tasks();
+  // Get Tasks (packed)
+  this->load_balancer_->task_store();
+
+  // Report the ISA of the EXX integral kernels
+  auto* lwd = dynamic_cast<LocalHostWorkDriver*>(this->local_work_driver_.get());
+  this->timer_.add_annotation("XCIntegrator.EXX.KernelISA", lwd->exx_kernel_isa());
 
   // Compute Local contributions to EXC / VXC
   this->timer_.time_op("XCIntegrator.LocalWork", [&](){
@@ -63,13 +69,22 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   });
   #endif
 
+  // Node shared K is symmetrized once per node, such that its lower
+  // triangle is complete prior to the reduction
+  auto& rd = *this->reduction_driver_;
+  if( node_shared_targets( rd, {K} ) ) {
+    rd.node_barrier();
+    if( rd.is_node_leader() ) symmetrize_average( nbf, K, ldk );
+  }
+
   // Reduce Results
   this->timer_.time_op("XCIntegrator.Allreduce", [&](){
 
-    if( not this->reduction_driver_->takes_host_memory() )
+    if( not rd.takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( K, nbf*nbf, ReductionOp::Sum );
+    rd.template allreduce_packed_symmetric<value_type>( nbf, {K}, {size_t(ldk)}, 
+      nullptr, 0, ReductionOp::Sum );
 
   });
 
@@ -284,14 +299,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
-  auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
-
+  // Tasks with packed (SoA) points and weights, consumed by the screening
+  // plan, the collocation and the G matrix without any transposition
+  auto& store    = this->load_balancer_->task_store();
+  auto& lb_tasks = store.tasks();
 
   // Check that Partition Weights have been calculated
   auto& lb_state = this->load_balancer_->state();
@@ -299,37 +310,18 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     GAUXC_GENERIC_EXCEPTION("Weights Have Not Been Modified"); 
   }
 
-  // Zero out integrands
+  // Zero out integrands (node shared integrands are zeroed by the node 
+  // leader and accumulated atomically)
+  auto& rd = *this->reduction_driver_;
+  const bool node_shared = node_shared_targets( rd, {K} );
+  if( not node_shared or rd.is_node_leader() )
   for( auto j = 0; j < nbf; ++j )
   for( auto i = 0; i < nbf; ++i ) 
     K[i + j*ldk] = 0.;
+  if( node_shared ) rd.node_barrier();
 
-   
-  // Compute V upper bounds per shell pair
-  const size_t nshells_bf = basis.size();
-  std::vector<double> V_max( nshells_bf * nshells_bf );
-  // Loop over sparse shell pairs
-  const auto sp_row_ptr = shpairs.row_ptr();
-  const auto sp_col_ind = shpairs.col_ind();
-  for( auto i = 0; i < nshells_bf; ++i ) {
-    const auto j_st = sp_row_ptr[i];
-    const auto j_en = sp_row_ptr[i+1];
-    for( auto _j = j_st; _j < j_en; ++_j ) {
-      const auto j = sp_col_ind[_j];
-      const auto mv = util::max_coulomb( basis.at(i), basis.at(j) );
-      V_max[i + j*nshells_bf] = mv;
-      if( i != j ) V_max[j + i*nshells_bf] = mv;
-    }
-  }
-
-  // Absolute value of P
-  std::vector<double> P_abs(nbf*nbf);
-  for( auto i = 0; i < nbf*nbf; ++i ) P_abs[i] = std::abs(P[i]);
-
-  // Full shell list
-  std::vector<int32_t> full_shell_list_( basis.nshells() );
-  std::iota( full_shell_list_.begin(), full_shell_list_.end(), 0 );
-  std::vector< std::array<int32_t,3> > full_submat_map = { {0, nbf, 0} };
+  // Discard cached state of a previous geometry
+  check_geometry_version_();
 
   // Screening settings
   IntegratorSettingsSNLinK sn_link_settings;
@@ -337,114 +329,141 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     sn_link_settings = *tmp;
   }
 
-  const bool screen_ek = sn_link_settings.screen_ek;
   const double eps_K   = sn_link_settings.k_tol;
   const double eps_E   = sn_link_settings.energy_tol;
 
-  int world_rank = 0;
-  #ifdef GAUXC_HAS_MPI
-  auto comm = this->load_balancer_->runtime().comm();
-  MPI_Comm_rank( comm, &world_rank );
-  #endif
-  //if( !world_rank ) {
-  //  std::cout << "sn-LinK Settings:" << std::endl
-  //            << "  SCREEN_EK     = " << std::boolalpha << screen_ek << std::endl
-  //            << "  EPS_E         = " << eps_E << std::endl
-  //            << "  EPS_K         = " << eps_K << std::endl
-  //            << std::endl;
-  //}
-
-  // Reset the coulomb screening data
-  for(auto& task : tasks) task.cou_screening = XCTask::screening_data();
-
-  // Precompute EK shell screening
-  exx_ek_screening( basis, basis_map, shpairs, P_abs.data(), nbf, V_max.data(), 
-    nshells_bf, eps_E, eps_K, lwd, tasks.begin(), tasks.end() );
-
-  // Allow for merging of tasks with different iParent
-  for(auto& task : tasks) task.iParent = 0;
-
-#if 1
-  // Lexicographic ordering of tasks
-  auto task_order = []( const auto& a, const auto& b ) {
-
-    // Sort by iParent first
-    if( a.iParent < b.iParent )      return true;
-    else if( a.iParent > b.iParent ) return false;
-
-    // Equal iParent: lex sort on bfn shell list
-    else if(a.bfn_screening.shell_list < b.bfn_screening.shell_list) return true;
-    else if(a.bfn_screening.shell_list > b.bfn_screening.shell_list) return false;
-    
-    // Equal iParent and bfn shell list: lex sort on cou shell list
-    else return a.cou_screening.shell_list < b.cou_screening.shell_list;
+  // Generate (or reuse) the density independent screening state:
+  // V upper bounds per shell pair, basis function statistics per task
+  // and the task layout
+  const void* plan_key = this->load_balancer_.get();
+  if( not sn_link_settings.reuse_screening_plan or not exx_plan_ or 
+      not exx_plan_->matches( plan_key, store ) ) {
+    this->timer_.time_op("XCIntegrator.EXXScreeningPlan", [&](){
+      exx_plan_ = std::make_unique<EXXScreeningPlan>(
+        make_exx_screening_plan( basis, shpairs, lwd, store, plan_key )
+      );
+    });
+  }
 
+  // Tasks in plan order (tasks with equivalent bfn screening contiguous)
+  const auto& plan = *exx_plan_;
+  const size_t nplan_tasks = plan.task_order.size();
+  auto plan_task = [&]( size_t i ) -> XCTask& { 
+    return lb_tasks[plan.task_order[i]]; 
   };
-
-  std::sort( tasks.begin(), tasks.end(), task_order ); 
-  auto task_equiv = []( const auto& a, const auto& b ) {
-    return a.equiv_with(b) and 
-      a.cou_screening.equiv_with(b.cou_screening);
+  auto plan_npts = [&]( size_t i ) { 
+    return store.npts( plan.task_order[i] ); 
   };
-  std::vector<XCTask> local_work_unique(tasks.begin(), tasks.end());
-  auto last_unique =
-    std::unique( local_work_unique.begin(),
-                 local_work_unique.end(),
-                 task_equiv );
-  local_work_unique.erase( last_unique, local_work_unique.end() );
-
-  // Merge tasks
-  for( auto&& t : local_work_unique ) {
-    t.points.clear();
-    t.weights.clear();
-    t.npts = 0;
-  }
-
-  auto cur_lw_begin = tasks.begin();
-  auto cur_uniq_it  = local_work_unique.begin();
+  const size_t nshells_bf = basis.size();
 
-  for( auto lw_it = tasks.begin(); lw_it != tasks.end(); ++lw_it ) 
-  if( not task_equiv( *lw_it, *cur_uniq_it ) ) {
+  // Absolute value of P
+  std::vector<double> P_abs(nbf*nbf);
+  for( auto j = 0; j < nbf; ++j )
+  for( auto i = 0; i < nbf; ++i ) P_abs[i + j*nbf] = std::abs(P[i + j*ldp]);
 
-    if( cur_uniq_it == local_work_unique.end() )
-      GAUXC_GENERIC_EXCEPTION("Messed up in unique");
+  // Reset the coulomb screening data
+  for(auto& task : lb_tasks) task.cou_screening = XCTask::screening_data();
+
+  // Density dependent EK shell screening (stored on the load balancer tasks,
+  // cf. LoadBalancer::rebalance_exx)
+  exx_ek_shellpair_collision( basis, basis_map, shpairs, P_abs.data(), nbf, 
+    plan.V_max.data(), nshells_bf, eps_E, eps_K, plan.task_max_bf_sum,
+    plan.task_max_bfn, plan.task_max_bfn_ptr, lb_tasks.begin(), 
+    lb_tasks.end() );
+
+  // Group tasks with equivalent bfn and cou screening. Tasks with equivalent
+  // bfn screening are contiguous in the plan, only the groups have to be
+  // ordered on the cou shell lists
+  auto cou_order = [&]( size_t a, size_t b ) {
+    const auto& sa = plan_task(a).cou_screening;
+    const auto& sb = plan_task(b).cou_screening;
+    if( sa.shell_list < sb.shell_list ) return true;
+    else if( sa.shell_list > sb.shell_list ) return false;
+    return sa.shell_pair_list < sb.shell_pair_list;
+  };
 
-    cur_uniq_it->merge_with( cur_lw_begin, lw_it );
+  const size_t nbfn_groups = plan.bfn_group_ptr.size() ? 
+    plan.bfn_group_ptr.size() - 1 : 0;
+  std::vector<size_t> task_perm( nplan_tasks );
+  std::iota( task_perm.begin(), task_perm.end(), 0 );
 
-    cur_lw_begin = lw_it;
-    cur_uniq_it++;
+  #pragma omp parallel for schedule(dynamic)
+  for( size_t ig = 0; ig < nbfn_groups; ++ig ) {
+    std::stable_sort( task_perm.begin() + plan.bfn_group_ptr[ig],
+      task_perm.begin() + plan.bfn_group_ptr[ig+1], cou_order );
+  }
 
+  // Merged task layout: task_perm[merged_ptr[i]:merged_ptr[i+1]]
+  std::vector<size_t> merged_ptr;
+  for( size_t ig = 0; ig < nbfn_groups; ++ig ) {
+    const auto g_st = plan.bfn_group_ptr[ig];
+    const auto g_en = plan.bfn_group_ptr[ig+1];
+    merged_ptr.emplace_back(g_st);
+    for( auto i = g_st + 1; i < g_en; ++i ) 
+    if( not plan_task(task_perm[i]).cou_screening.equiv_with(
+              plan_task(task_perm[i-1]).cou_screening ) )
+      merged_ptr.emplace_back(i);
   }
+  const size_t ntasks = merged_ptr.size();
+  merged_ptr.emplace_back( nplan_tasks );
 
-  // Merge the last set of batches
-  for( ; cur_lw_begin != tasks.end(); ++cur_lw_begin )
-    cur_uniq_it->merge_with( *cur_lw_begin );
-  cur_uniq_it++;
+  // Process merged tasks in order of decreasing number of shell pairs
+  auto npairs = [&]( size_t iT ) {
+    return plan_task(task_perm[merged_ptr[iT]]).cou_screening.shell_pair_list.size();
+  };
+  std::vector<size_t> merged_order( ntasks );
+  std::iota( merged_order.begin(), merged_order.end(), 0 );
+  std::stable_sort( merged_order.begin(), merged_order.end(),
+    [&]( size_t a, size_t b ){ return npairs(a) > npairs(b); } );
+
+  // Collocation of the plan tasks reused across calls
+  auto* col_cache = select_collocation_cache( exx_collocation_cache_,
+    sn_link_settings.collocation_cache_bytes, 
+    sn_link_settings.collocation_cache_fp32 );
+  if( col_cache ) {
+    this->timer_.time_op("XCIntegrator.CollocationCache", [&](){
+      col_cache->reserve( basis, task_generation_(lb_tasks), 1 );
+    });
+  }
 
-  tasks = std::move(local_work_unique);
-#endif
+  // Setup K accumulation
+  const int nthreads = host_max_threads();
+  HostMatrixAccumulator<value_type> k_acc( node_shared ?
+    HostAccumulationStrategy::Atomic :
+    select_host_accumulation( sn_link_settings.accumulation, nbf, 1, nthreads ),
+    nbf, nthreads, {K}, {ldk} );
+  const auto submat_acc = k_acc.submat_accumulator();
 
-  std::sort(tasks.begin(),tasks.end(),
-    [](auto& a, auto& b){ return a.cou_screening.shell_pair_list.size() >
-      b.cou_screening.shell_pair_list.size(); });
+  // Per-task scratch bound for the collocation and the bfn x nbf scratch, the
+  // arenas grow to accommodate the (screening dependent) EK data as needed
+  const size_t host_scr_size = this->load_balancer_->max_npts_x_nbe() +
+    this->load_balancer_->max_nbe() * nbf;
 
+  // Measured cost of the merged tasks
+  std::vector<double> merged_cost( ntasks, 0. );
 
-  // Loop over tasks
-  const size_t ntasks = tasks.size();
-  //std::cout << "NTASKS = " << ntasks << std::endl;
-  //std::cout << "NTASKS NNZ = " << std::count_if(tasks.begin(),tasks.end(),[](const auto& t){ return t.cou_screening.shell_pair_list.size(); }) << std::endl;
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
-  std::vector<double> K_local(nbf*nbf,0.0);
+  host_data.reserve( host_scr_size, 4 );
+
+  // Thread local storage for the points / weights of merged tasks (SoA)
+  std::vector< double > merged_points;
+  std::vector< double > merged_weights;
+
+  const int tid = host_thread_id();
+  k_acc.init_thread(tid);
 
   #pragma omp for schedule(dynamic)
-  for( size_t iT = 0; iT < ntasks; ++iT ) {
+  for( size_t iM = 0; iM < ntasks; ++iM ) {
 
-    //std::cout << iT << "/" << ntasks << std::endl;
-    // Alias current task
-    const auto& task = tasks[iT];
+    // Alias current task (representative of the merged task)
+    const size_t iT   = merged_order[iM];
+    const auto   m_st = merged_ptr[iT];
+    const auto   m_en = merged_ptr[iT+1];
+    const auto& task  = plan_task(task_perm[m_st]);
+    ScopedTaskTimer task_timer( merged_cost[iT] );
 
     // Early exit
     auto ek_shell_list = task.cou_screening.shell_list;
@@ -455,11 +474,32 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     std::tie( ek_submat_map, std::ignore ) =
       gen_compressed_submat_map( basis_map, ek_shell_list, nbf, nbf );
 
-    // Get tasks constants
-    const int32_t  npts    = task.points.size();
-
-    const auto* points      = task.points.data()->data();
-    const auto* weights     = task.weights.data();
+    // Points / weights of the merged task, read from the store for single
+    // tasks and concatenated from the (SoA) blocks of the constituents
+    // otherwise
+    size_t npts = 0;
+    for( auto i = m_st; i < m_en; ++i ) npts += plan_npts(task_perm[i]);
+    const double* points  = nullptr;
+    const double* weights = nullptr;
+    if( m_en - m_st == 1 ) {
+      const auto iS = plan.task_order[task_perm[m_st]];
+      points  = store.points(iS);
+      weights = store.weights(iS);
+    } else {
+      merged_points.resize( 3 * npts );
+      merged_weights.resize( npts );
+      for( auto i = m_st, ipt = 0ul; i < m_en; ++i ) {
+        const auto iS = plan.task_order[task_perm[i]];
+        const auto n  = store.npts(iS);
+        std::copy_n( store.x(iS), n, merged_points.data() + ipt );
+        std::copy_n( store.y(iS), n, merged_points.data() + ipt + npts );
+        std::copy_n( store.z(iS), n, merged_points.data() + ipt + 2*npts );
+        std::copy_n( store.weights(iS), n, merged_weights.data() + ipt );
+        ipt += n;
+      }
+      points  = merged_points.data();
+      weights = merged_weights.data();
+    }
 
     // Basis function shell list
     auto shell_list_bfn_ = task.bfn_screening.shell_list;
@@ -475,27 +515,39 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
 
     // Allocate data screening independent data
-    host_data.basis_eval.resize( npts * nbe_bfn );
-    host_data.nbe_scr   .resize( nbe_bfn * nbf );
-    auto* basis_eval = host_data.basis_eval.data();
-    auto* nbe_scr    = host_data.nbe_scr.data();
+    host_data.reset();
+    host_data.basis_eval = host_data.alloc( npts * nbe_bfn );
+    host_data.nbe_scr   = host_data.alloc( nbe_bfn * nbf );
+    auto* basis_eval = host_data.basis_eval;
+    auto* nbe_scr    = host_data.nbe_scr;
 
 
 
     // Evaluate collocation B(mu,i)
     // mu ranges over the bfn shell list and i runs over all points
-    lwd->eval_collocation( npts, nshells_bfn, nbe_bfn, points, basis, 
-      shell_list_bfn, basis_eval );
+    // (evaluated / retrieved per constituent of the merged task)
+    for( auto i = m_st, ipt = 0ul; i < m_en; ++i ) {
+      const auto& t = plan_task(task_perm[i]);
+      const auto iS = plan.task_order[task_perm[i]];
+      const size_t t_npts = store.npts(iS);
+      auto* t_basis_eval = basis_eval + ipt * nbe_bfn;
+      if( not (col_cache and col_cache->load( t, 1, t_basis_eval )) ) {
+        lwd->eval_collocation_soa( t_npts, nshells_bfn, nbe_bfn, 
+          store.points(iS), basis, shell_list_bfn, t_basis_eval );
+        if( col_cache ) col_cache->store( t, 1, t_basis_eval );
+      }
+      ipt += t_npts;
+    }
 
     const auto nbe_ek = basis.nbf_subset( ek_shell_list.begin(), ek_shell_list.end() );
     const auto nshells_ek = ek_shell_list.size();
 
 
     // Allocate Screening Dependent Data
-    host_data.zmat.resize( npts * nbe_ek );
-    host_data.gmat.resize( npts * nbe_ek );
-    auto* zmat = host_data.zmat.data();
-    auto* gmat = host_data.gmat.data();
+    host_data.zmat = host_data.alloc( npts * nbe_ek );
+    host_data.gmat = host_data.alloc( npts * nbe_ek );
+    auto* zmat = host_data.zmat;
+    auto* gmat = host_data.gmat;
 
     // Evaluate F(mu,i) = P(mu,nu) * B(nu,i)
     // mu runs over significant ek shells
@@ -504,40 +556,55 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     lwd->eval_exx_fmat( npts, nbf, nbe_ek, nbe_bfn, ek_submat_map,
       submat_map_bfn, P, ldp, basis_eval, nbe_bfn, zmat, nbe_ek, nbe_scr );
 
-    // Get True Max F for shell pairs
-    //auto max_F = compute_true_f_max( npts, nshells_ek, nbe_ek, basis_map,
-    //  ek_shell_list, weights, zmat, nbe_ek );
-
-
     // Compute G(mu,i) = w(i) * A(mu,nu,i) * F(nu,i)
     // mu/nu run over significant ek shells
     // i runs over all points
     const size_t nshell_pairs = task.cou_screening.shell_pair_list.size();
     const auto*  shell_pair_list = task.cou_screening.shell_pair_list.data();
-    lwd->eval_exx_gmat( npts, nshells_ek, nshell_pairs, nbe_ek, points, weights, 
-      basis, shpairs,basis_map, ek_shell_list.data(), shell_pair_list, zmat, 
-      nbe_ek, gmat, nbe_ek );
+    const auto*  shell_pair_idx_list = task.cou_screening.shell_pair_idx_list.data();
+    lwd->eval_exx_gmat_soa( npts, nshells_ek, nshell_pairs, nbe_ek, points, 
+      weights, basis, shpairs,basis_map, ek_shell_list.data(), shell_pair_list, 
+      shell_pair_idx_list, zmat, nbe_ek, gmat, nbe_ek );
 
     // Increment K(mu,nu) += B(mu,i) * G(nu,i)
     // mu runs over bfn shell list
     // nu runs over ek shells
     // i runs over all points
     lwd->inc_exx_k( npts, nbf, nbe_bfn, nbe_ek, basis_eval, submat_map_bfn,
-      ek_submat_map, gmat, nbe_ek, K, ldk, nbe_scr );
+      ek_submat_map, gmat, nbe_ek, k_acc.target(0,tid), k_acc.ld(0,tid), nbe_scr,
+      submat_acc );
 
   } // Loop over tasks 
 
 
   } // End OpenMP region
 
-  // Symmetrize K
-  for( auto j = 0; j < nbf; ++j ) 
-  for( auto i = 0; i < j;   ++i ) {
-    const auto K_ij = K[i + j*ldk];
-    const auto K_ji = K[j + i*ldk];
-    const auto K_symm = 0.5 * (K_ij + K_ji);
-    K[i + j*ldk] = K_symm;
-    K[j + i*ldk] = K_symm;
+  // Reduce thread-private K contributions
+  k_acc.reduce();
+
+  // Record the measured costs on the load balancer tasks (cf. 
+  // LoadBalancer::rebalance_exx). The cost of a merged task is attributed 
+  // to its constituents by number of points
+  for( size_t iT = 0; iT < ntasks; ++iT ) {
+    const auto m_st = merged_ptr[iT];
+    const auto m_en = merged_ptr[iT+1];
+    size_t npts = 0;
+    for( auto i = m_st; i < m_en; ++i ) npts += plan_npts(task_perm[i]);
+    for( auto i = m_st; i < m_en; ++i ) {
+      auto& t = plan_task(task_perm[i]);
+      t.measured_cost.exx = npts ? 
+        merged_cost[iT] * plan_npts(task_perm[i]) / npts : 0.;
+    }
+  }
+
+  // Symmetrize K (node shared K once the reduction is complete)
+  if( not node_shared ) symmetrize_average( nbf, K, ldk );
+
+  // Only keep the screening state (and the collocation of its tasks) when 
+  // it will be reused
+  if( not sn_link_settings.reuse_screening_plan ) {
+    exx_plan_.reset();
+    exx_collocation_cache_.reset();
   }
 
 }
@@ -70,13 +70,10 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
   const int32_t nbf = basis.nbf();
 
-  // Sort tasks on size (XXX: maybe doesnt matter?)
-  auto task_comparator = []( const XCTask& a, const XCTask& b ) {
-    return (a.points.size() * a.bfn_screening.nbe) > (b.points.size() * b.bfn_screening.nbe);
-  };
-
+  // Process tasks on size
   auto& tasks = this->load_balancer_->get_tasks();
-  std::sort( tasks.begin(), tasks.end(), task_comparator );
+  const auto task_order = task_work_order( tasks.begin(), tasks.end() );
+  submat_cache_.prepare( basis_map, task_generation_(), nbf );
 
 
   // Compute Partition Weights
@@ -86,14 +83,29 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
   }
 
 
+  // Discard cached state of a previous geometry
+  check_geometry_version_();
+
+  // Collocation cached by previous XC evaluations (if any)
+  auto* col_cache = 
+    (collocation_cache_ and collocation_cache_->generation() == task_generation_()) ?
+    collocation_cache_.get() : nullptr;
+
   // Loop over tasks
   const size_t ntasks = tasks.size();
   double N_EL_WORK = 0.0;
 
+  // Upper bound of the per-task scratch
+  const size_t host_scr_size = 
+    this->load_balancer_->max_nbe() * this->load_balancer_->max_nbe() + 
+    2 * this->load_balancer_->max_npts_x_nbe() + 
+    this->load_balancer_->max_npts();
+
   #pragma omp parallel
   {
 
   XCHostData<value_type> host_data; // Thread local host data
+  host_data.reserve( host_scr_size, 4 );
   double N_EL_LOCAL = 0.;
 
   #pragma omp for schedule(dynamic)
@@ -101,7 +113,7 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
 
     //std::cout << iT << "/" << ntasks << std::endl;
     // Alias current task
-    const auto& task = tasks[iT];
+    auto& task = tasks[task_order[iT]];
 
     // Get tasks constants
     const int32_t  npts    = task.points.size();
@@ -113,29 +125,31 @@ void ReferenceReplicatedXCHostIntegrator<ValueType>::
     const int32_t* shell_list = task.bfn_screening.shell_list.data();
 
     // Allocate enough memory for batch
+    host_data.reset();
 
-    host_data.nbe_scr .resize( nbe * nbe  );
-    host_data.zmat    .resize( npts * nbe );
+    host_data.nbe_scr = host_data.alloc( nbe * nbe );
+    host_data.zmat    = host_data.alloc( npts * nbe );
 
-    host_data.basis_eval .resize( npts * nbe );
-    host_data.den_scr    .resize( npts );
+    host_data.basis_eval = host_data.alloc( npts * nbe );
+    host_data.den_scr    = host_data.alloc( npts );
 
 
     // Alias/Partition out scratch memory
-    auto* basis_eval = host_data.basis_eval.data();
-    auto* den_eval   = host_data.den_scr.data();
-    auto* nbe_scr    = host_data.nbe_scr.data();
-    auto* zmat       = host_data.zmat.data();
+    auto* basis_eval = host_data.basis_eval;
+    auto* den_eval   = host_data.den_scr;
+    auto* nbe_scr    = host_data.nbe_scr;
+    auto* zmat       = host_data.zmat;
 
 
     // Get the submatrix map for batch
-    std::vector< std::array<int32_t, 3> > submat_map;
-    std::tie(submat_map, std::ignore) =
-          gen_compressed_submat_map(basis_map, task.bfn_screening.shell_list, nbf, nbf);
+    const auto& submat_map = submat_cache_.at( task );
 
-    // Evaluate Collocation (+ Grad)
-    lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list, 
-      basis_eval );
+    // Evaluate Collocation
+    if( not (col_cache and col_cache->load( task, 1, basis_eval )) ) {
+      lwd->eval_collocation( npts, nshells, nbe, points, basis, shell_list, 
+        basis_eval );
+      if( col_cache ) col_cache->store( task, 1, basis_eval );
+    }
 
 
     // Evaluate X matrix (P * B) -> store in Z
@@ -8,31 +8,130 @@
 #pragma once
 #include <vector>
 #include <cstdint>
+#include <cstdlib>
+#include <memory>
 
 #include <gauxc/gauxc_config.hpp>
+#include <gauxc/exceptions.hpp>
 
 namespace GauXC {
 
+/**
+ *  Bump allocator for per-task host scratch (host analog of buffer_adaptor).
+ *
+ *  All allocations are 64-byte aligned and are released collectively by
+ *  reset(). Allocations exceeding the current capacity are served from
+ *  separate blocks which are merged into the arena on the next reset, such
+ *  that once the arena has reached the high-water mark of the task loop, no
+ *  further heap allocations take place.
+ */
+class HostScratchArena {
+
+  struct free_deleter {
+    void operator()( void* ptr ) const { std::free(ptr); }
+  };
+  using block_type = std::unique_ptr<char, free_deleter>;
+
+  block_type              buffer_;
+  size_t                  capacity_ = 0;
+  size_t                  used_     = 0;
+  size_t                  demand_   = 0; ///< Bytes requested since reset
+  std::vector<block_type> overflow_;
+
+  static block_type allocate_block( size_t nbytes ) {
+    block_type block( static_cast<char*>(std::aligned_alloc(alignment, nbytes)) );
+    if( not block )
+      GAUXC_GENERIC_EXCEPTION("HostScratchArena std::bad_alloc nalloc = " +
+        std::to_string(nbytes));
+    return block;
+  }
+
+public:
+
+  static constexpr size_t alignment = 64;
+
+  /// Size of an allocation of n elements of type T within the arena
+  template <typename T>
+  static constexpr size_t aligned_size( size_t n ) {
+    return ((n * sizeof(T) + alignment - 1) / alignment) * alignment;
+  }
+
+  /// Ensure a capacity of at least nbytes (releases all allocations)
+  inline void reserve( size_t nbytes ) {
+    nbytes = aligned_size<char>(nbytes);
+    overflow_.clear();
+    if( nbytes > capacity_ ) {
+      buffer_   = allocate_block( nbytes );
+      capacity_ = nbytes;
+    }
+    used_ = 0; demand_ = 0;
+  }
+
+  /// Release all allocations, grows the arena to the demand since the
+  /// last reset
+  inline void reset() { reserve( demand_ ); }
+
+  /// Allocate n elements of type T (uninitialized)
+  template <typename T>
+  T* aligned_alloc( size_t n ) {
+    if( n == 0ul ) return nullptr;
+    const auto nbytes = aligned_size<T>(n);
+    demand_ += nbytes;
+    if( used_ + nbytes <= capacity_ ) {
+      auto* ptr = buffer_.get() + used_;
+      used_ += nbytes;
+      return reinterpret_cast<T*>(ptr);
+    }
+    overflow_.emplace_back( allocate_block(nbytes) );
+    return reinterpret_cast<T*>(overflow_.back().get());
+  }
+
+  inline size_t capacity() const { return capacity_; }
+
+};
+
+/**
+ *  Thread local scratch of the host integrators. The per-task arrays are
+ *  carved from the arena, i.e. they are valid until the next arena.reset()
+ */
 template <typename F>
 struct XCHostData {
 
-  std::vector<F> eps;
-  std::vector<F> gamma;
-  std::vector<F> tau;
-  std::vector<F> lapl;
-  std::vector<F> vrho;
-  std::vector<F> vgamma;
-  std::vector<F> vtau;
-  std::vector<F> vlapl;
- 
-  std::vector<F> zmat;
-  std::vector<F> gmat;
-  std::vector<F> nbe_scr;
-  std::vector<F> den_scr;
-  std::vector<F> basis_eval;
-   
+  F* eps    = nullptr;
+  F* gamma  = nullptr;
+  F* tau    = nullptr;
+  F* lapl   = nullptr;
+  F* vrho   = nullptr;
+  F* vgamma = nullptr;
+  F* vtau   = nullptr;
+  F* vlapl  = nullptr;
+
+  F* zmat       = nullptr;
+  F* gmat       = nullptr;
+  F* mmat       = nullptr;
+  F* nbe_scr    = nullptr;
+  F* den_scr    = nullptr;
+  F* basis_eval = nullptr;
+
+  HostScratchArena arena;
+
   inline XCHostData() {}
 
+  /// Reserve the arena for nelem elements in up to nalloc allocations
+  inline void reserve( size_t nelem, size_t nalloc ) {
+    arena.reserve( nelem * sizeof(F) + nalloc * HostScratchArena::alignment );
+  }
+
+  /// Release the arrays of the previous task
+  inline void reset() {
+    eps = gamma = tau = lapl = vrho = vgamma = vtau = vlapl = nullptr;
+    zmat = gmat = mmat = nbe_scr = den_scr = basis_eval = nullptr;
+    arena.reset();
+  }
+
+  /// Allocate n elements from the arena
+  inline F* alloc( size_t n ) { return arena.aligned_alloc<F>(n); }
+
 };
 
 }
@@ -136,6 +136,93 @@ void ReplicatedXCIntegratorImpl<ValueType>::
 
 }
 
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exc_vxc_incremental( int64_t m, int64_t n, const value_type* dP,
+                            int64_t lddp, value_type* VXC, int64_t ldvxc,
+                            value_type* EXC, const IntegratorSettingsXC& ks_settings ) {
+
+    eval_exc_vxc_incremental_(m,n,dP,lddp,VXC,ldvxc,EXC,ks_settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_incremental( int64_t m, int64_t n, const value_type* dP,
+                        int64_t lddp, value_type* K, int64_t ldk,
+                        const IntegratorSettingsEXX& settings ) {
+
+    eval_exx_incremental_(m,n,dP,lddp,K,ldk,settings);
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::reset_incremental() {
+
+    reset_incremental_();
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  accumulate_incremental( int64_t m, int64_t n, const value_type* dP,
+                          int64_t lddp, std::vector<value_type>& P_ref ) {
+
+  if( lddp < m ) GAUXC_GENERIC_EXCEPTION("Invalid LDDP");
+  if( P_ref.size() != size_t(m*n) ) P_ref.assign( m*n, 0. );
+
+  for( int64_t j = 0; j < n; ++j )
+  for( int64_t i = 0; i < m; ++i ) 
+    P_ref[i + j*m] += dP[i + j*lddp];
+
+}
+
+/// Default incremental XC: full evaluation at the updated reference density
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exc_vxc_incremental_( int64_t m, int64_t n, const value_type* dP,
+                             int64_t lddp, value_type* VXC, int64_t ldvxc,
+                             value_type* EXC, const IntegratorSettingsXC& ks_settings ) {
+
+  accumulate_incremental( m, n, dP, lddp, xc_incremental_P_ );
+  eval_exc_vxc_( m, n, xc_incremental_P_.data(), m, VXC, ldvxc, EXC, 
+    ks_settings );
+
+}
+
+/// Incremental EXX: K is linear in P, only K[dP] is integrated (and 
+/// screened on |dP|)
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::
+  eval_exx_incremental_( int64_t m, int64_t n, const value_type* dP,
+                         int64_t lddp, value_type* K, int64_t ldk,
+                         const IntegratorSettingsEXX& settings ) {
+
+  if( ldk < m ) GAUXC_GENERIC_EXCEPTION("Invalid LDK");
+
+  eval_exx_( m, n, dP, lddp, K, ldk, settings );
+  accumulate_incremental( m, n, K, ldk, exx_incremental_K_ );
+
+  // Node shared K is updated by the node leader once every process has
+  // accumulated K[dP]
+  const bool node_shared = reduction_driver_->is_node_shared(K);
+  if( node_shared ) reduction_driver_->node_barrier();
+  if( not node_shared or reduction_driver_->is_node_leader() )
+  for( int64_t j = 0; j < n; ++j )
+  for( int64_t i = 0; i < m; ++i ) 
+    K[i + j*ldk] = exx_incremental_K_[i + j*m];
+  if( node_shared ) reduction_driver_->node_barrier();
+
+}
+
+template <typename ValueType>
+void ReplicatedXCIntegratorImpl<ValueType>::reset_incremental_() {
+
+  xc_incremental_P_.clear();
+  exx_incremental_K_.clear();
+
+}
+
 template class ReplicatedXCIntegratorImpl<double>;
 
 }
@@ -106,12 +106,17 @@ void ShellBatchedReplicatedXCIntegrator<BaseIntegratorType, IncoreIntegratorType
     if( not this->reduction_driver_->takes_host_memory() )
       GAUXC_GENERIC_EXCEPTION("This Module Only Works With Host Reductions");
 
-    this->reduction_driver_->allreduce_inplace( VXCs, nbf*nbf, ReductionOp::Sum );
-    if(VXCz) this->reduction_driver_->allreduce_inplace( VXCz, nbf*nbf, ReductionOp::Sum );
-    if(VXCy) this->reduction_driver_->allreduce_inplace( VXCy, nbf*nbf, ReductionOp::Sum ); 
-    if(VXCx) this->reduction_driver_->allreduce_inplace( VXCx, nbf*nbf, ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( EXC,   1    , ReductionOp::Sum );
-    this->reduction_driver_->allreduce_inplace( &N_EL, 1    , ReductionOp::Sum );
+
+    std::vector<value_type*> VXC_list = {VXCs};
+    std::vector<size_t>      ld_list  = {size_t(ldvxcs)};
+    if(VXCz) { VXC_list.push_back(VXCz); ld_list.push_back(ldvxcz); }
+    if(VXCy) { VXC_list.push_back(VXCy); ld_list.push_back(ldvxcy); }
+    if(VXCx) { VXC_list.push_back(VXCx); ld_list.push_back(ldvxcx); }
+
+    value_type scalars[2] = { *EXC, N_EL };
+    this->reduction_driver_->allreduce_packed_symmetric( nbf, VXC_list, 
+      ld_list, scalars, 2, ReductionOp::Sum );
+    *EXC = scalars[0]; N_EL = scalars[1];
   });
 
   #ifdef GAUXC_HAS_DEVICE
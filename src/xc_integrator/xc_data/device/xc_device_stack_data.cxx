@@ -340,12 +340,8 @@ void XCDeviceStackData::send_static_data_shell_pairs(
 
   if( not device_backend_ ) GAUXC_GENERIC_EXCEPTION("Invalid Device Backend");
 
-  // Copy primitive pairs
-  std::vector<GauXC::PrimitivePair<double>> pp_host;
-  for(const auto& sp : shell_pairs) {
-    pp_host.insert( pp_host.end(), sp.prim_pairs(), sp.prim_pairs() + sp.nprim_pairs());
-  }
-  device_backend_->copy_async( global_dims.nprim_pairs, pp_host.data(),
+  // Copy primitive pairs (contiguous in CSR order)
+  device_backend_->copy_async( global_dims.nprim_pairs, shell_pairs.prim_pairs(),
     static_stack.prim_pairs_device, "PrimPairs H2D" );
 
   // Create SoA
@@ -9,6 +9,7 @@
 #include "catch2/catch.hpp"
 #include <gauxc/basisset.hpp>
 #include <gauxc/basisset_map.hpp>
+#include <gauxc/shell_pair.hpp>
 #include <gauxc/molecule.hpp>
 #include <gauxc/external/hdf5.hpp>
 
@@ -218,6 +219,71 @@ TEST_CASE("BasisSet", "[basisset]") {
 
 
 
+TEST_CASE("ShellPairCollection", "[basisset]") {
+
+  // Stretched water such that some shell pairs are screened
+  Molecule mol = make_water();
+  for( auto& atom : mol ) { atom.x *= 8; atom.y *= 8; atom.z *= 8; }
+  BasisSet<double> basis = make_631Gd(mol, SphericalType(false));
+  const size_t nshells = basis.size();
+
+  for( double tol : {1e-12, 1e-6} ) {
+
+    ShellPairCollection<double> shpairs( basis, tol );
+    CHECK( shpairs.nshells() == nshells );
+
+    // Brute force reference on the significant primitive pairs
+    size_t npairs = 0, nprim_total = 0;
+    for( size_t i = 0; i < nshells; ++i )
+    for( size_t j = 0; j <= i; ++j ) {
+      const auto& A = basis[i].l() >= basis[j].l() ? basis[i] : basis[j];
+      const auto& B = basis[i].l() >= basis[j].l() ? basis[j] : basis[i];
+      double rAB2 = 0.;
+      for( int k = 0; k < 3; ++k ) rAB2 += std::pow( A.O()[k] - B.O()[k], 2 );
+
+      std::vector<double> K_ref;
+      for( int a = 0; a < A.nprim(); ++a )
+      for( int b = 0; b < B.nprim(); ++b ) {
+        const double g = A.alpha()[a] + B.alpha()[b];
+        const double K = 2 * M_PI / g * A.coeff()[a] * B.coeff()[b] *
+          std::exp( -A.alpha()[a] * B.alpha()[b] * rAB2 / g );
+        if( std::abs(K) >= tol ) K_ref.push_back(K);
+      }
+
+      const auto idx = shpairs.get_linear_shell_pair_index(i,j);
+      if( K_ref.empty() ) { CHECK( idx < 0 ); continue; }
+      REQUIRE( idx >= 0 );
+      npairs++; nprim_total += K_ref.size();
+
+      const auto& sp = shpairs.shell_pairs()[idx];
+      REQUIRE( sp.nprim_pairs() == K_ref.size() );
+      for( size_t k = 0; k < K_ref.size(); ++k )
+        CHECK( sp.prim_pairs()[k].K_coeff_prod == Approx(K_ref[k]) );
+    }
+
+    CHECK( shpairs.npairs() == npairs );
+    CHECK( shpairs.nprim_pair_total() == nprim_total );
+    if( tol > 1e-12 ) CHECK( npairs < nshells * (nshells+1) / 2 );
+
+    // Primitive pairs are stored contiguously in CSR order
+    size_t off = 0;
+    for( const auto& sp : shpairs ) {
+      CHECK( sp.prim_pairs() == shpairs.prim_pairs() + off );
+      off += sp.nprim_pairs();
+    }
+
+    // Copies refer to their own primitive pair storage
+    auto shpairs_copy = shpairs;
+    for( size_t ij = 0; ij < shpairs.npairs(); ++ij ) {
+      const auto& sp = shpairs_copy.shell_pairs()[ij];
+      CHECK( sp.prim_pairs() == shpairs_copy.prim_pairs() + 
+        (shpairs.shell_pairs()[ij].prim_pairs() - shpairs.prim_pairs()) );
+    }
+
+  }
+
+}
+
 TEST_CASE("HDF5-BASISSET", "[basisset]") {
 
 #ifdef GAUXC_HAS_MPI
@@ -53,6 +53,10 @@ TEST_CASE( "Water / cc-pVDZ", "[collocation]" ) {
   SECTION( "Host Eval Hessian" ) {
     test_host_collocation_deriv2( basis, ref_data );
   }
+
+  SECTION( "Host Eval Laplacian" ) {
+    test_host_collocation_laplacian( basis, ref_data );
+  }
 #endif
 
 #ifdef GAUXC_HAS_CUDA
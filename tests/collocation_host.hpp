@@ -213,5 +213,51 @@ void test_host_collocation_deriv2( const BasisSet<double>& basis, std::ifstream&
       CHECK( d2eval_zz[i] == Approx( d.d2eval_zz[i] ) );
   }
 
+}
+
+void test_host_collocation_laplacian( const BasisSet<double>& basis, std::ifstream& in_file) {
+
+
+
+  std::vector<ref_collocation_data> ref_data;
+
+  {
+    cereal::BinaryInputArchive ar( in_file );
+    ar( ref_data );
+  }
+
+  for( auto& d : ref_data ) {
+
+    const auto npts = d.pts.size();
+    const auto nbf  = d.eval.size() / npts;
+
+    const auto& mask = d.mask;
+    const auto& pts  = d.pts;
+
+    std::vector<double> eval   ( nbf * npts ),
+                        deval_x( nbf * npts ),
+                        deval_y( nbf * npts ),
+                        deval_z( nbf * npts ),
+                        leval  ( nbf * npts );
+
+
+    gau2grid_collocation_laplacian( npts, mask.size(), nbf,
+      pts.data()->data(), basis, mask.data(), eval.data(), 
+      deval_x.data(), deval_y.data(), deval_z.data(), leval.data() );
+
+    for( auto i = 0; i < npts * nbf; ++i )
+      CHECK( eval[i] == Approx( d.eval[i] ) );
+    for( auto i = 0; i < npts * nbf; ++i )
+      CHECK( deval_x[i] == Approx( d.deval_x[i] ) );
+    for( auto i = 0; i < npts * nbf; ++i )
+      CHECK( deval_y[i] == Approx( d.deval_y[i] ) );
+    for( auto i = 0; i < npts * nbf; ++i )
+      CHECK( deval_z[i] == Approx( d.deval_z[i] ) );
+
+    for( auto i = 0; i < npts * nbf; ++i )
+      CHECK( leval[i] == 
+        Approx( d.d2eval_xx[i] + d.d2eval_yy[i] + d.d2eval_zz[i] ) );
+  }
+
 }
 #endif
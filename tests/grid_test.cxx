@@ -59,6 +59,65 @@ TEST_CASE("Grid", "[grid]") {
 
   }
 
+  SECTION("Translated Batches") {
+
+    Grid grid( mk_sphere, BatchSize(batch_sz) );
+    REQUIRE( grid.nbatches() == mk_batch.nbatches() );
+
+    const std::array<double,3> center = { 1.5, -2., 0.25 };
+    std::vector<GridBatch> batches( grid.nbatches() );
+    #pragma omp parallel for
+    for( size_t i = 0; i < batches.size(); ++i )
+      batches[i] = grid.batch( i, center );
+
+    // The center of the underlying quadrature is untouched
+    CHECK( grid.batcher().quadrature().center() == mk_sphere->center() );
+
+    for( size_t i = 0; i < batches.size(); ++i ) {
+
+      auto&& [box_lo_ref, box_up_ref, points_ref, weights_ref] = mk_batch.at(i);
+      const auto& b = batches[i];
+
+      REQUIRE( b.points.size() == points_ref.size() );
+      CHECK( b.weights == weights_ref );
+      for( int k = 0; k < 3; ++k ) {
+        CHECK( b.lo[k] == Approx( box_lo_ref[k] + center[k] ).margin(1e-12) );
+        CHECK( b.up[k] == Approx( box_up_ref[k] + center[k] ).margin(1e-12) );
+      }
+      for( size_t j = 0; j < b.points.size(); ++j )
+      for( int k = 0; k < 3; ++k )
+        CHECK( b.points[j][k] == 
+               Approx( points_ref[j][k] + center[k] ).margin(1e-12) );
+
+    }
+
+  }
+
+  SECTION("Batch Template From Displaced Quadrature") {
+
+    std::shared_ptr<quadrature_type> quad = mk_sphere->clone();
+    Grid grid( quad, BatchSize(batch_sz) );
+
+    // Templates are centered at the origin irrespective of the current 
+    // center of the shared quadrature, which is left untouched
+    const std::array<double,3> shift = { -0.5, 3., 1.25 };
+    grid.batcher().quadrature().recenter( shift );
+    const auto& batches = grid.batch_template();
+    CHECK( grid.batcher().quadrature().center() == shift );
+
+    REQUIRE( batches.size() == mk_batch.nbatches() );
+    for( size_t i = 0; i < batches.size(); ++i ) {
+      auto&& [box_lo_ref, box_up_ref, points_ref, weights_ref] = mk_batch.at(i);
+      REQUIRE( batches[i].points.size() == points_ref.size() );
+      CHECK( batches[i].weights == weights_ref );
+      for( size_t j = 0; j < points_ref.size(); ++j )
+      for( int k = 0; k < 3; ++k )
+        CHECK( batches[i].points[j][k] == 
+               Approx( points_ref[j][k] ).margin(1e-12) );
+    }
+
+  }
+
 #if 0
     SECTION("Default Batch Size") {
       Grid grid( rquad, RadialSize(n_rad), AngularSize(n_ang), 
@@ -7,7 +7,13 @@
  */
 #include "ut_common.hpp"
 #include <gauxc/load_balancer.hpp>
+#include <gauxc/molecular_weights.hpp>
 #include <gauxc/molgrid/defaults.hpp>
+#include <gauxc/util/sphere_cell_list.hpp>
+#include <gauxc/util/space_filling_curve.hpp>
+#include <gauxc/task_store.hpp>
+#include <cstdio>
+#include <sstream>
 
 using namespace GauXC;
 
@@ -117,6 +123,363 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
   }
 
+  SECTION("Distributed Host") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Distributed" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto& tasks = lb.get_tasks();
+
+    // Single rank generation is identical to the replicated generation
+    if( world.comm_size() == 1 ) check_lb_data( tasks );
+
+    // Distributed generation must cover the entire grid
+    auto global_npts = [&]( const std::vector<XCTask>& ts ) {
+      uint64_t npts = 0;
+      for( const auto& t : ts ) npts += t.npts;
+#ifdef GAUXC_HAS_MPI
+      MPI_Allreduce( MPI_IN_PLACE, &npts, 1, MPI_UINT64_T, MPI_SUM, 
+        world.comm() );
+#endif
+      return npts;
+    };
+
+    LoadBalancerFactory ref_factory( ExecutionSpace::Host, "Default" );
+    auto ref_lb = ref_factory.get_instance( world, mol, mg, basis);
+    CHECK( global_npts(tasks) == global_npts(ref_lb.get_tasks()) );
+
+  }
+
+  SECTION("Spatially Reordered Host") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default-SFC" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto& tasks = lb.get_tasks();
+
+    LoadBalancerFactory ref_factory( ExecutionSpace::Host, "Default" );
+    auto ref_lb = ref_factory.get_instance( world, mol, mg, basis);
+    auto& ref_tasks = ref_lb.get_tasks();
+
+    // Same quadrature (up to the ordering of points)
+    using point_weight = std::pair<std::array<double,3>, double>;
+    auto collect = []( const std::vector<XCTask>& ts ) {
+      std::vector<point_weight> pw;
+      for( const auto& t : ts ) 
+      for( size_t i = 0; i < t.points.size(); ++i )
+        pw.emplace_back( t.points[i], t.weights[i] );
+      std::sort( pw.begin(), pw.end() );
+      return pw;
+    };
+    CHECK( collect(tasks) == collect(ref_tasks) );
+
+    // Split tasks are bounded in size and never screen in more functions
+    // than the parent's (largest) unsplit task
+    size_t max_ref_nbe = 0;
+    for( const auto& t : ref_tasks ) 
+      max_ref_nbe = std::max<size_t>( max_ref_nbe, t.bfn_screening.nbe );
+    for( const auto& t : tasks ) {
+      CHECK( t.points.size() == t.weights.size() );
+      CHECK( t.npts == (int32_t)t.points.size() );
+      CHECK( (size_t)t.bfn_screening.nbe <= max_ref_nbe );
+    }
+
+  }
+
+  SECTION("Plan Round Trip") {
+
+    const std::string fname = "test_lb_plan.bin";
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto& tasks = lb.get_tasks();
+    tasks[0].measured_cost.exc_vxc = 1.5;
+    lb.state().modified_weights_are_stored = true;
+    lb.save_plan( fname );
+
+    auto plan_lb = lb_factory.get_instance_from_plan( world, mol, mg, basis,
+      fname );
+    auto& plan_tasks = plan_lb.get_tasks();
+    CHECK( plan_lb.state().modified_weights_are_stored );
+    CHECK( plan_lb.state().geometry_version == 1 );
+    CHECK( not plan_lb.get_timings().all_timings().count(
+      "LoadBalancer.CreateTasks") );
+    CHECK( plan_lb.molmeta().dist_nearest() == meta->dist_nearest() );
+    REQUIRE( plan_tasks.size() == tasks.size() );
+    for( size_t i = 0; i < tasks.size(); ++i ) {
+      CHECK( plan_tasks[i].iParent == tasks[i].iParent );
+      CHECK( plan_tasks[i].npts    == tasks[i].npts );
+      CHECK( plan_tasks[i].points  == tasks[i].points );
+      CHECK( plan_tasks[i].weights == tasks[i].weights );
+      CHECK( plan_tasks[i].bfn_screening.shell_list ==
+             tasks[i].bfn_screening.shell_list );
+      CHECK( plan_tasks[i].bfn_screening.nbe == tasks[i].bfn_screening.nbe );
+      CHECK( plan_tasks[i].measured_cost.exc_vxc ==
+             tasks[i].measured_cost.exc_vxc );
+    }
+
+    // Plans are rejected for settings which generate different tasks
+    for( std::string kernel : { "Replicated-FillIn", "Distributed", 
+      "Default-SFC" } ) {
+      LoadBalancerFactory other_factory( ExecutionSpace::Host, kernel );
+      CHECK_THROWS( other_factory.get_instance_from_plan( world, mol, mg, 
+        basis, fname ) );
+    }
+
+    // Stored weights are kept for the scheme they were partitioned with
+    auto plan_weights = plan_tasks[0].weights;
+    MolecularWeightsSettings becke_settings{ XCWeightAlg::Becke, false };
+    MolecularWeightsFactory ssf_factory( ExecutionSpace::Host, "Default",
+      MolecularWeightsSettings{} );
+    MolecularWeightsFactory becke_factory( ExecutionSpace::Host, "Default",
+      becke_settings );
+    ssf_factory.get_instance().modify_weights( plan_lb );
+    CHECK( plan_lb.get_tasks()[0].weights == plan_weights );
+    CHECK_THROWS( becke_factory.get_instance().modify_weights( plan_lb ) );
+
+    // A rank without tasks keeps its (empty) partition
+    tasks.clear();
+    lb.save_plan( fname );
+    auto empty_lb = lb_factory.get_instance_from_plan( world, mol, mg, basis,
+      fname );
+    CHECK( empty_lb.get_tasks().empty() );
+
+    // Plans are rejected for a different basis
+    auto basis_mod = basis;
+    basis_mod[0].alpha()[0] *= 1.01;
+    CHECK_THROWS( lb_factory.get_instance_from_plan( world, mol, mg, basis_mod,
+      fname ) );
+
+#ifdef GAUXC_HAS_MPI
+    MPI_Barrier( world.comm() );
+#endif
+    if( not world.comm_rank() ) std::remove( fname.c_str() );
+
+  }
+
+  SECTION("Geometry Update") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    auto ref_tasks = lb.get_tasks();
+
+    // Rigid translation: only the points and the basis move
+    const std::array<double,3> t = { 0.1, -0.2, 0.3 };
+    Molecule mol_t = mol;
+    for( auto& at : mol_t ) { at.x += t[0]; at.y += t[1]; at.z += t[2]; }
+    lb.update_geometry( mol_t );
+    CHECK( lb.state().geometry_version == 1 );
+    auto& tasks = lb.get_tasks();
+    REQUIRE( tasks.size() == ref_tasks.size() );
+    for( size_t i = 0; i < tasks.size(); ++i ) {
+      CHECK( tasks[i].weights == ref_tasks[i].weights );
+      CHECK( tasks[i].bfn_screening.shell_list ==
+             ref_tasks[i].bfn_screening.shell_list );
+      for( size_t j = 0; j < tasks[i].points.size(); ++j )
+      for( int k = 0; k < 3; ++k )
+        CHECK( tasks[i].points[j][k] ==
+               Approx(ref_tasks[i].points[j][k] + t[k]) );
+    }
+    for( size_t ish = 0; ish < basis.size(); ++ish )
+    for( int k = 0; k < 3; ++k )
+      CHECK( lb.basis()[ish].O()[k] == Approx(basis[ish].O()[k] + t[k]) );
+
+    // Displacement of a single atom
+    Molecule mol_d = mol_t;
+    mol_d[0].x += 0.05; mol_d[0].z -= 0.02;
+    lb.update_geometry( mol_d );
+    MolMeta meta_d( mol_d );
+    for( size_t i = 0; i < meta_d.rab().size(); ++i )
+      CHECK( lb.molmeta().rab()[i] == Approx(meta_d.rab()[i]) );
+    CHECK( lb.molmeta().dist_nearest() == meta_d.dist_nearest() );
+    CHECK( lb.basis_map().shell_to_center() ==
+           BasisSetMap(basis,mol).shell_to_center() );
+
+    // Every shell which is non-negligible at a point of a task has to be
+    // screened in for the task
+    const auto& basis_d = lb.basis();
+    for( const auto& task : lb.get_tasks() ) {
+      CHECK( task.dist_nearest == meta_d.dist_nearest()[task.iParent] );
+      const auto& sl = task.bfn_screening.shell_list;
+      for( size_t ish = 0; ish < basis_d.size(); ++ish ) {
+        const auto& O = basis_d[ish].O();
+        const double r = basis_d[ish].cutoff_radius();
+        bool needed = false;
+        for( size_t j = 0; j < task.points.size() and not needed; j += 7 ) {
+          const auto& p = task.points[j];
+          const double dx = p[0]-O[0], dy = p[1]-O[1], dz = p[2]-O[2];
+          needed = dx*dx + dy*dy + dz*dz < r*r;
+        }
+        if( needed ) CHECK( std::binary_search( sl.begin(), sl.end(),
+          (int32_t)ish ) );
+      }
+    }
+
+    // Modified weights are restored to the quadrature weights and
+    // repartitioned at the new geometry
+    MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default",
+      MolecularWeightsSettings{} );
+    auto mw = mw_factory.get_instance();
+    auto lb_mw = lb_factory.get_instance( world, mol, mg, basis);
+    auto lb_um = lb_factory.get_instance( world, mol, mg, basis);
+    lb_mw.state().retain_quadrature_weights = true;
+    mw.modify_weights( lb_mw );
+    for( const auto& task : lb_mw.get_tasks() )
+      CHECK( task.quadrature_weights.size() == task.weights.size() );
+    lb_mw.update_geometry( mol_d );
+    lb_um.update_geometry( mol_d );
+    CHECK( not lb_mw.state().modified_weights_are_stored );
+    REQUIRE( lb_mw.get_tasks().size() == lb_um.get_tasks().size() );
+    for( size_t i = 0; i < lb_um.get_tasks().size(); ++i )
+      CHECK( lb_mw.get_tasks()[i].weights == lb_um.get_tasks()[i].weights );
+
+    mw.modify_weights( lb_mw );
+    mw.modify_weights( lb_um );
+    for( size_t i = 0; i < lb_um.get_tasks().size(); ++i )
+      CHECK( lb_mw.get_tasks()[i].weights == lb_um.get_tasks()[i].weights );
+
+    // Modified weights can only be repartitioned if they were retained,
+    // which is opt-in
+    auto lb_nr = lb_factory.get_instance( world, mol, mg, basis);
+    mw.modify_weights( lb_nr );
+    for( const auto& task : lb_nr.get_tasks() )
+      CHECK( task.quadrature_weights.empty() );
+    CHECK_THROWS( lb_nr.update_geometry( mol_d ) );
+
+  }
+
+  SECTION("Task Merge") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    const auto& tasks = lb.get_tasks();
+    REQUIRE( tasks.size() > 2 );
+
+    // Synthetic equivalent tasks with retained quadrature weights
+    std::vector<XCTask> merge_tasks( 3, tasks[0] );
+    for( size_t i = 0; i < merge_tasks.size(); ++i ) {
+      auto& t = merge_tasks[i];
+      t.points  = tasks[i].points;
+      t.weights = tasks[i].weights;
+      t.quadrature_weights.resize( t.weights.size() );
+      std::iota( t.quadrature_weights.begin(), t.quadrature_weights.end(), 
+        double(i) );
+    }
+
+    auto check_merged = []( const XCTask& m, const std::vector<XCTask>& ts ) {
+      std::vector<double> w, qw;
+      for( const auto& t : ts ) {
+        w.insert( w.end(), t.weights.begin(), t.weights.end() );
+        qw.insert( qw.end(), t.quadrature_weights.begin(), 
+          t.quadrature_weights.end() );
+      }
+      CHECK( m.npts == int32_t(w.size()) );
+      CHECK( m.weights == w );
+      CHECK( m.quadrature_weights == qw );
+    };
+
+    // Pairwise merge
+    auto m_pair = merge_tasks[0];
+    m_pair.merge_with( merge_tasks[1] );
+    check_merged( m_pair, { merge_tasks[0], merge_tasks[1] } );
+
+    // Range merge
+    auto m_range = merge_tasks[0];
+    m_range.merge_with( merge_tasks.begin() + 1, merge_tasks.end() );
+    check_merged( m_range, merge_tasks );
+
+    // Tasks without quadrature weights merge as before
+    auto no_qw = merge_tasks;
+    for( auto& t : no_qw ) t.quadrature_weights.clear();
+    auto m_no_qw = no_qw[0];
+    m_no_qw.merge_with( no_qw.begin() + 1, no_qw.end() );
+    check_merged( m_no_qw, no_qw );
+
+    // Tasks with and without quadrature weights cannot be merged
+    auto m_mixed = merge_tasks[0];
+    CHECK_THROWS( m_mixed.merge_with( no_qw[1] ) );
+    CHECK_THROWS( m_mixed.merge_with( no_qw.begin() + 1, no_qw.end() ) );
+    CHECK_THROWS( no_qw[0].merge_with( merge_tasks[1] ) );
+
+  }
+
+  SECTION("Load Statistics") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+
+    // Measured costs which are exactly described by the model
+    double local_load = 0.;
+    for( auto& task : lb.get_tasks() ) {
+      task.measured_cost.exc_vxc = 1e-7 * task.npts;
+      local_load += task.measured_cost.exc_vxc;
+    }
+    lb.calibrate_cost_models();
+
+    auto stats = lb.exc_vxc_load_statistics();
+    double max_load = local_load, sum_load = local_load;
+#ifdef GAUXC_HAS_MPI
+    MPI_Allreduce( MPI_IN_PLACE, &max_load, 1, MPI_DOUBLE, MPI_MAX, 
+      world.comm() );
+    MPI_Allreduce( MPI_IN_PLACE, &sum_load, 1, MPI_DOUBLE, MPI_SUM, 
+      world.comm() );
+#endif
+    CHECK( stats.measured_max == Approx(max_load) );
+    CHECK( stats.measured_avg == Approx(sum_load / world.comm_size()) );
+    CHECK( stats.predicted_max == Approx(stats.measured_max) );
+    CHECK( stats.predicted_avg == Approx(stats.measured_avg) );
+    CHECK( stats.measured_imbalance() >= 1. );
+
+    // Nothing measured for exx
+    auto exx_stats = lb.exx_load_statistics();
+    CHECK( exx_stats.measured_avg == 0. );
+    CHECK( exx_stats.measured_imbalance() == 1. );
+
+  }
+
+  SECTION("Task Store") {
+
+    LoadBalancerFactory lb_factory( ExecutionSpace::Host, "Default" );
+    auto lb = lb_factory.get_instance( world, mol, mg, basis);
+    const auto ref_tasks = lb.get_tasks();
+    const auto max_npts  = lb.max_npts();
+    const auto version   = lb.state().task_version;
+
+    // Packed (SoA) tasks
+    auto& store = lb.task_store();
+    REQUIRE( store.packed() );
+    REQUIRE( store.ntasks() == ref_tasks.size() );
+    CHECK( store.tasks().data() == lb.get_tasks().data() );
+    store.pack();
+    CHECK( lb.max_npts() == max_npts );
+    for( size_t iT = 0; iT < store.ntasks(); ++iT ) {
+      const auto& task = store.tasks()[iT];
+      const auto& ref  = ref_tasks[iT];
+      REQUIRE( store.npts(iT) == ref.points.size() );
+      CHECK( task.npts == (int32_t)ref.points.size() );
+      CHECK( task.points.empty() );
+      CHECK( task.weights.empty() );
+      CHECK( task.bfn_screening.shell_list == ref.bfn_screening.shell_list );
+      for( size_t i = 0; i < store.npts(iT); ++i ) {
+        CHECK( store.x(iT)[i] == ref.points[i][0] );
+        CHECK( store.y(iT)[i] == ref.points[i][1] );
+        CHECK( store.z(iT)[i] == ref.points[i][2] );
+        CHECK( store.weights(iT)[i] == ref.weights[i] );
+      }
+    }
+
+    // AoS adapter
+    auto& tasks = lb.get_tasks();
+    CHECK( not store.packed() );
+    REQUIRE( tasks.size() == ref_tasks.size() );
+    for( size_t iT = 0; iT < tasks.size(); ++iT ) {
+      CHECK( tasks[iT].points  == ref_tasks[iT].points );
+      CHECK( tasks[iT].weights == ref_tasks[iT].weights );
+    }
+
+    // Changes of the layout do not start a new task generation
+    CHECK( lb.state().task_version == version );
+
+  }
+
 #ifdef GAUXC_HAS_DEVICE
   SECTION("Default Device") {
 
@@ -156,3 +519,193 @@ TEST_CASE( "DefaultLoadBalancer", "[load_balancer]" ) {
 
 
 }
+
+
+TEST_CASE( "SphereCellList", "[load_balancer]" ) {
+
+  Molecule mol           = make_benzene();
+  BasisSet<double> basis = make_ccpvdz( mol, SphericalType(true) );
+
+  std::vector<std::array<double,3>> centers;
+  std::vector<double>               radii;
+  for( const auto& sh : basis ) {
+    centers.emplace_back( sh.O() );
+    radii.emplace_back( sh.cutoff_radius() );
+  }
+
+  std::default_random_engine gen(1234);
+  std::uniform_real_distribution<double> pos_dist(-15., 15.), len_dist(0.1, 4.);
+
+  auto check_index = [&]( double cell_size ) {
+    geometry::SphereCellList<double> index( centers, radii, cell_size );
+    for( int ibox = 0; ibox < 1000; ++ibox ) {
+      std::array<double,3> lo, up;
+      for( int k = 0; k < 3; ++k ) {
+        lo[k] = pos_dist(gen);
+        up[k] = lo[k] + len_dist(gen);
+      }
+
+      std::vector<int32_t> ref;
+      for( size_t i = 0; i < centers.size(); ++i )
+      if( geometry::cube_sphere_intersect( lo, up, centers[i], radii[i] ) )
+        ref.emplace_back(i);
+
+      CHECK( index.query( lo, up ) == ref );
+    }
+  };
+
+  SECTION("Default Cells") { check_index( 0. ); }
+  SECTION("Small Cells")   { check_index( 0.5 ); }
+  SECTION("Large Cells")   { check_index( 100. ); }
+
+}
+
+
+TEST_CASE( "SpaceFillingCurve", "[load_balancer]" ) {
+
+  const int nbits = 3, n = 1 << nbits;
+
+  // Hilbert keys enumerate the grid and are adjacent for consecutive keys
+  std::vector<std::array<uint32_t,3>> by_key( n*n*n );
+  std::vector<bool> seen( n*n*n, false );
+  for( uint32_t i = 0; i < n; ++i )
+  for( uint32_t j = 0; j < n; ++j )
+  for( uint32_t k = 0; k < n; ++k ) {
+    auto key = geometry::hilbert_key( {i,j,k}, nbits );
+    REQUIRE( key < seen.size() );
+    CHECK( not seen[key] );
+    seen[key] = true;
+    by_key[key] = {i,j,k};
+  }
+
+  for( size_t key = 1; key < by_key.size(); ++key ) {
+    int dist = 0;
+    for( int l = 0; l < 3; ++l ) 
+      dist += std::abs( int(by_key[key][l]) - int(by_key[key-1][l]) );
+    CHECK( dist == 1 );
+  }
+
+  // Curve ordering is a permutation which follows the keys
+  std::default_random_engine gen(1234);
+  std::uniform_real_distribution<double> pos_dist(-5., 5.);
+  std::vector<std::array<double,3>> points( 1000 );
+  for( auto& p : points ) p = { pos_dist(gen), pos_dist(gen), pos_dist(gen) };
+
+  for( auto curve : { geometry::SpaceFillingCurve::Hilbert, 
+                      geometry::SpaceFillingCurve::Morton } ) {
+    auto order = geometry::space_filling_curve_order( points, curve );
+    auto sorted = order;
+    std::sort( sorted.begin(), sorted.end() );
+    std::vector<size_t> iota( points.size() );
+    std::iota( iota.begin(), iota.end(), 0 );
+    CHECK( sorted == iota );
+  }
+
+}
+
+
+TEST_CASE( "TaskCostModel", "[load_balancer]" ) {
+
+  std::default_random_engine gen(1234);
+  std::uniform_int_distribution<int> npts_dist(1, 512), nbe_dist(1, 400);
+
+  std::vector<XCTask> tasks( 200 );
+  for( auto& task : tasks ) {
+    task.npts = npts_dist(gen);
+    task.bfn_screening.nbe = nbe_dist(gen);
+  }
+
+  TaskCostModel model( TaskCostModel::Kind::ExcVXC );
+  CHECK( not model.calibrated() );
+  CHECK( not model.fit( model.normal_equations( tasks.cbegin(), tasks.cend() ) ) );
+  for( const auto& task : tasks ) CHECK( model.cost(task) == task.cost_exc_vxc(1) );
+
+  auto set_measured = [&]( TaskCostModel::term_type c ) {
+    for( auto& task : tasks ) {
+      const auto f = model.terms(task);
+      task.measured_cost.exc_vxc = c[0]*f[0] + c[1]*f[1] + c[2]*f[2];
+    }
+  };
+
+  SECTION("Exact Fit") {
+    TaskCostModel::term_type c_ref = { 1e-7, 2e-9, 5e-12 };
+    set_measured( c_ref );
+    REQUIRE( model.fit( model.normal_equations( tasks.cbegin(), tasks.cend() ) ) );
+    CHECK( model.nsamples() == tasks.size() );
+    for( int i = 0; i < 3; ++i ) 
+      CHECK( model.coeff()[i] == Approx(c_ref[i]).epsilon(1e-6) );
+    for( const auto& task : tasks ) 
+      CHECK( model.predict(task) == Approx(task.measured_cost.exc_vxc) );
+
+    // Round trip through text
+    std::stringstream ss;
+    model.write( ss );
+    TaskCostModel model_read( TaskCostModel::Kind::ExcVXC );
+    model_read.read( ss );
+    CHECK( model_read.nsamples() == model.nsamples() );
+    CHECK( model_read.coeff() == model.coeff() );
+
+    ss.clear(); ss.seekg(0);
+    TaskCostModel model_exx( TaskCostModel::Kind::EXX );
+    CHECK_THROWS( model_exx.read( ss ) );
+  }
+
+  SECTION("Non-Negative Fit") {
+    set_measured( { 1e-7, 2e-9, -1e-12 } );
+    REQUIRE( model.fit( model.normal_equations( tasks.cbegin(), tasks.cend() ) ) );
+    for( auto c : model.coeff() ) CHECK( c >= 0. );
+  }
+
+}
+
+
+TEST_CASE( "TaskStore", "[load_balancer]" ) {
+
+  std::vector<XCTask> tasks(3);
+  for( int it = 0; it < 3; ++it ) {
+    auto& t = tasks[it];
+    t.iParent = it;
+    for( int i = 0; i < it + 2; ++i ) {
+      t.points.push_back( {1.*i, 10.*it, -1.*i} );
+      t.weights.push_back( 0.1 * (i+1) );
+    }
+  }
+  const auto ref_tasks = tasks;
+
+  TaskStore store( std::move(tasks) );
+  CHECK( not store.packed() );
+  store.pack();
+  REQUIRE( store.packed() );
+  REQUIRE( store.ntasks() == 3 );
+  CHECK( store.npts() == 9 );
+
+  for( size_t it = 0; it < 3; ++it ) {
+    const auto& ref = ref_tasks[it];
+    REQUIRE( store.npts(it) == ref.points.size() );
+    CHECK( store.tasks()[it].npts == (int32_t)ref.points.size() );
+    CHECK( store.tasks()[it].iParent == ref.iParent );
+    CHECK( store.y(it) == store.x(it) + store.npts(it) );
+    CHECK( store.z(it) == store.y(it) + store.npts(it) );
+    for( size_t i = 0; i < store.npts(it); ++i ) {
+      CHECK( store.x(it)[i] == ref.points[i][0] );
+      CHECK( store.y(it)[i] == ref.points[i][1] );
+      CHECK( store.z(it)[i] == ref.points[i][2] );
+      CHECK( store.weights(it)[i] == ref.weights[i] );
+    }
+  }
+
+  // Round trip
+  store.weights(1)[0] = 2.;
+  store.unpack();
+  CHECK( not store.packed() );
+  for( size_t it = 0; it < 3; ++it ) {
+    CHECK( store.tasks()[it].points == ref_tasks[it].points );
+    if( it != 1 ) CHECK( store.tasks()[it].weights == ref_tasks[it].weights );
+  }
+  CHECK( store.tasks()[1].weights[0] == 2. );
+
+  // Inconsistent tasks
+  store.tasks()[2].weights.pop_back();
+  CHECK_THROWS( store.pack() );
+
+}
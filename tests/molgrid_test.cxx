@@ -8,6 +8,7 @@
 #include "catch2/catch.hpp"
 #include <gauxc/molgrid.hpp>
 #include <gauxc/molgrid/defaults.hpp>
+#include "standards.hpp"
 
 
 #include <random>
@@ -298,6 +299,145 @@ TEST_CASE("Grid Specification", "[molgrid]") {
 
 
 
+TEST_CASE("Adaptive Pruning", "[molgrid]") {
+
+  auto mol   = make_water();
+  auto basis = make_ccpvdz( mol, SphericalType(true) );
+
+  auto rq  = RadialQuad::MuraKnowles;
+  auto gsz = AtomicGridSizeDefault::UltraFineGrid;
+  AtomicNumber O(8), H(1);
+
+  auto npts = []( const PrunedAtomicGridSpecification& gs ) {
+    size_t n = 0;
+    for( const auto& r : gs.pruning_regions ) 
+      n += (r.idx_en - r.idx_st) * r.angular_size.get();
+    return n;
+  };
+
+  SECTION("Specification") {
+    auto spec_O = MolGridFactory::create_adaptive_pruning_spec(mol, basis, O);
+    auto spec_H = MolGridFactory::create_adaptive_pruning_spec(mol, basis, H);
+    CHECK( spec_O.max_l == 2 );
+    CHECK( spec_H.max_l == 1 );
+
+    auto dist = [&]( int i, int j ) {
+      return std::hypot( mol[i].x - mol[j].x, mol[i].y - mol[j].y,
+        mol[i].z - mol[j].z );
+    };
+    const auto d_OH = dist(0,1);
+    const auto d_HH = dist(0,2);
+
+    auto exponents = [&]( AtomicNumber Z ) {
+      std::vector<double> alpha;
+      for( const auto& shell : basis ) 
+      for( const auto& atom : mol ) 
+      if( atom.Z == Z and shell.O()[0] == atom.x and shell.O()[1] == atom.y and
+          shell.O()[2] == atom.z )
+        alpha.insert( alpha.end(), shell.alpha_data(), 
+          shell.alpha_data() + shell.nprim() );
+      std::sort( alpha.begin(), alpha.end() );
+      alpha.erase( std::unique( alpha.begin(), alpha.end() ), alpha.end() );
+      return alpha;
+    };
+
+    // Both (equivalent) H enter the density proxy of O
+    REQUIRE( spec_O.neighbors.size() == 1 );
+    CHECK( spec_O.neighbors[0].distance == Approx(d_OH) );
+    CHECK( spec_O.neighbors[0].weight   == Approx(2.) );
+    CHECK( spec_O.neighbors[0].exponents == exponents(H) );
+
+    // O (nearest neighbor) and the other H (weighted by distance) enter 
+    // the density proxy of H
+    REQUIRE( spec_H.neighbors.size() == 2 );
+    CHECK( spec_H.neighbors[0].distance == Approx(d_OH) );
+    CHECK( spec_H.neighbors[0].weight   == Approx(1.) );
+    CHECK( spec_H.neighbors[0].exponents == exponents(O) );
+    CHECK( spec_H.neighbors[1].distance == Approx(d_HH) );
+    CHECK( spec_H.neighbors[1].weight   == Approx(d_OH*d_OH / (d_HH*d_HH)) );
+    CHECK( spec_H.neighbors[1].exponents == exponents(H) );
+  }
+
+  SECTION("Partition Range") {
+    // Atoms outside of the partition range do not enter the density proxy
+    auto far_mol = mol;
+    far_mol.push_back( Atom( AtomicNumber(1), mol[0].x + 50., mol[0].y, 
+      mol[0].z ) );
+    auto far_basis = make_ccpvdz( far_mol, SphericalType(true) );
+    auto spec_O = MolGridFactory::create_adaptive_pruning_spec(mol, basis, O);
+    auto far_spec_O = MolGridFactory::create_adaptive_pruning_spec(far_mol, 
+      far_basis, O);
+    REQUIRE( far_spec_O.neighbors.size() == spec_O.neighbors.size() );
+    CHECK( far_spec_O.neighbors[0].distance == Approx(
+      spec_O.neighbors[0].distance) );
+    CHECK( far_spec_O.neighbors[0].weight   == Approx(
+      spec_O.neighbors[0].weight) );
+  }
+
+  SECTION("Pruning Regions") {
+    auto unp  = MolGridFactory::create_default_unpruned_grid_spec(O, rq, gsz);
+    auto spec = MolGridFactory::create_adaptive_pruning_spec(mol, basis, O);
+    auto gs   = create_pruned_spec( PruningScheme::Adaptive, unp, spec );
+
+    REQUIRE( gs.radial_size == unp.radial_size );
+    size_t idx = 0;
+    for( const auto& r : gs.pruning_regions ) {
+      CHECK( r.idx_st == idx );
+      CHECK( r.idx_en >  r.idx_st );
+      CHECK( r.angular_size.get() <= unp.angular_size.get() );
+      idx = r.idx_en;
+    }
+    CHECK( idx == (size_t)unp.radial_size.get() );
+
+    // Core and asymptotic regions are pruned
+    const size_t unp_npts = unp.radial_size.get() * unp.angular_size.get();
+    CHECK( gs.pruning_regions.front().angular_size == AngularSize(26) );
+    CHECK( npts(gs) < unp_npts / 2 );
+
+    // Tighter tolerances never reduce the angular sizes
+    spec.tolerance *= 1e-4;
+    auto gs_tight = adaptive_pruning_scheme( unp, spec );
+    CHECK( npts(gs_tight) >= npts(gs) );
+    CHECK( npts(gs_tight) <= unp_npts );
+  }
+
+  SECTION("Isolated Atom") {
+    auto unp  = MolGridFactory::create_default_unpruned_grid_spec(O, rq, gsz);
+    auto spec = MolGridFactory::create_adaptive_pruning_spec(mol, basis, O);
+    spec.neighbors.clear();
+    auto gs = adaptive_pruning_scheme( unp, spec );
+    std::vector<PruningRegion> ref_pruning_regions = {
+      {0ul, (size_t)unp.radial_size.get(), AngularSize(26)}
+    };
+    CHECK( gs.pruning_regions == ref_pruning_regions );
+  }
+
+  SECTION("Single Atom") {
+    Molecule atom_mol;
+    atom_mol.push_back( mol[1] );
+    auto atom_basis = make_ccpvdz( atom_mol, SphericalType(true) );
+    auto unp  = MolGridFactory::create_default_unpruned_grid_spec(O, rq, gsz);
+    auto spec = MolGridFactory::create_adaptive_pruning_spec(atom_mol, 
+      atom_basis, O);
+    CHECK( spec.neighbors.empty() );
+    auto gs = adaptive_pruning_scheme( unp, spec );
+    REQUIRE( gs.pruning_regions.size() == 1 );
+    CHECK( gs.pruning_regions[0].angular_size == AngularSize(26) );
+  }
+
+  SECTION("Grid Map") {
+    auto molmap = MolGridFactory::create_default_grid_spec_map( mol, basis,
+      PruningScheme::Adaptive, rq, gsz );
+    REQUIRE( molmap.size() == 2 );
+    for( const auto& [Z, gs] : molmap ) 
+      CHECK( std::holds_alternative<PrunedAtomicGridSpecification>(gs) );
+
+    auto unp = MolGridFactory::create_default_unpruned_grid_spec(O, rq, gsz);
+    CHECK_THROWS( create_pruned_spec( PruningScheme::Adaptive, unp ) );
+  }
+
+}
+
 #if 0
 
 TEST_CASE("MolGrid", "[molgrid]") {
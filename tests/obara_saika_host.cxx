@@ -0,0 +1,273 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "ut_common.hpp"
+
+#ifdef GAUXC_HAS_HOST
+#include "cpu/integral_data_types.hpp"
+#include "cpu/obara_saika_integrals.hpp"
+#include "cpu/chebyshev_boys_computation.hpp"
+#include <array>
+#include <vector>
+#include <cmath>
+
+namespace {
+
+// Boys function through its series representation
+double ref_boys( int m, double T ) {
+  double denom = m + 0.5;
+  double term  = std::exp(-T) / (2 * denom);
+  double sum   = term;
+  while( term > sum * 1e-17 ) {
+    denom += 1;
+    term  *= T / denom;
+    sum   += term;
+  }
+  return sum;
+}
+
+// McMurchie-Davidson Hermite expansion coefficients E[i][j][t] for one
+// cartesian direction (Qx = A - B)
+using ref_hermite_table = std::vector<std::vector<std::vector<double>>>;
+ref_hermite_table ref_hermite_E( int lA, int lB, double Qx, double a, double b ) {
+  const double p = a + b;
+  const double q = a * b / p;
+  ref_hermite_table E( lA+1, std::vector<std::vector<double>>( lB+1,
+    std::vector<double>( lA+lB+2, 0. ) ) );
+  auto get = [&]( int i, int j, int t ) {
+    return (t < 0 or t > i + j) ? 0. : E[i][j][t];
+  };
+  E[0][0][0] = std::exp(-q * Qx * Qx);
+  for( int i = 0; i <= lA; ++i )
+  for( int j = 0; j <= lB; ++j )
+  for( int t = 0; t <= i + j; ++t ) {
+    if( i == 0 and j == 0 ) continue;
+    if( j == 0 )
+      E[i][j][t] = get(i-1, j, t-1) / (2 * p) - q * Qx / a * get(i-1, j, t) +
+                   (t + 1) * get(i-1, j, t+1);
+    else
+      E[i][j][t] = get(i, j-1, t-1) / (2 * p) + q * Qx / b * get(i, j-1, t) +
+                   (t + 1) * get(i, j-1, t+1);
+  }
+  return E;
+}
+
+// McMurchie-Davidson Hermite Coulomb integrals R^0_{tuv}, t + u + v <= L
+struct ref_hermite_R {
+  int L;
+  std::vector<double> R;
+  ref_hermite_R( int _L, double p, double X, double Y, double Z ) :
+    L(_L), R( (L+1)*(L+1)*(L+1)*(L+1), 0. ) {
+    const double T = p * (X*X + Y*Y + Z*Z);
+    for( int n = 0; n <= L; ++n ) at(0,0,0,n) = std::pow(-2*p, n) * ref_boys(n, T);
+    for( int n = L-1; n >= 0; --n )
+    for( int t = 0; t <= L-n; ++t )
+    for( int u = 0; u <= L-n-t; ++u )
+    for( int v = 0; v <= L-n-t-u; ++v ) {
+      if( t ) 
+        at(t,u,v,n) = (t > 1 ? (t-1) * at(t-2,u,v,n+1) : 0.) + X * at(t-1,u,v,n+1);
+      else if( u )
+        at(t,u,v,n) = (u > 1 ? (u-1) * at(t,u-2,v,n+1) : 0.) + Y * at(t,u-1,v,n+1);
+      else if( v )
+        at(t,u,v,n) = (v > 1 ? (v-1) * at(t,u,v-2,n+1) : 0.) + Z * at(t,u,v-1,n+1);
+    }
+  }
+  double& at( int t, int u, int v, int n ) {
+    return R[((t*(L+1) + u)*(L+1) + v)*(L+1) + n];
+  }
+};
+
+// Cartesian powers in the ordering of the host kernels
+std::vector<std::array<int,3>> ref_cart_powers( int l ) {
+  std::vector<std::array<int,3>> pw;
+  for( int ix = l; ix >= 0; --ix )
+  for( int iz = 0; iz <= l - ix; ++iz ) pw.push_back({ix, l - ix - iz, iz});
+  return pw;
+}
+
+// Reference V(i,j) = (A_i B_j | 1/|r-C|) over contracted cartesian shells
+std::vector<double> ref_shell_pair_coulomb( const XCPU::shells& A,
+  const XCPU::shells& B, XCPU::point C ) {
+
+  const auto pA = ref_cart_powers(A.L);
+  const auto pB = ref_cart_powers(B.L);
+  std::vector<double> V( pA.size() * pB.size(), 0. );
+
+  const double AB[3] = { A.origin.x - B.origin.x, A.origin.y - B.origin.y,
+                         A.origin.z - B.origin.z };
+  for( int ia = 0; ia < A.m; ++ia )
+  for( int ib = 0; ib < B.m; ++ib ) {
+    const double a = A.coeff[ia].alpha, b = B.coeff[ib].alpha;
+    const double p = a + b;
+    const double P[3] = { (a*A.origin.x + b*B.origin.x)/p,
+      (a*A.origin.y + b*B.origin.y)/p, (a*A.origin.z + b*B.origin.z)/p };
+    const double fact = 2 * M_PI / p * A.coeff[ia].coeff * B.coeff[ib].coeff;
+
+    auto Ex = ref_hermite_E( A.L, B.L, AB[0], a, b );
+    auto Ey = ref_hermite_E( A.L, B.L, AB[1], a, b );
+    auto Ez = ref_hermite_E( A.L, B.L, AB[2], a, b );
+    ref_hermite_R R( A.L + B.L, p, P[0] - C.x, P[1] - C.y, P[2] - C.z );
+
+    for( size_t i = 0; i < pA.size(); ++i )
+    for( size_t j = 0; j < pB.size(); ++j ) {
+      const auto [ix, iy, iz] = pA[i];
+      const auto [jx, jy, jz] = pB[j];
+      double val = 0.;
+      for( int t = 0; t <= ix + jx; ++t )
+      for( int u = 0; u <= iy + jy; ++u )
+      for( int v = 0; v <= iz + jz; ++v ) {
+        val += Ex[ix][jx][t] * Ey[iy][jy][u] * Ez[iz][jz][v] * R.at(t,u,v,0);
+      }
+      V[i * pB.size() + j] += fact * val;
+    }
+  }
+
+  return V;
+}
+
+}
+
+TEST_CASE("Host Obara-Saika Kernels", "[obara_saika]") {
+
+  double* boys_table = XCPU::boys_init();
+
+  // Points span both the Chebyshev and the asymptotic Boys regimes
+  const size_t npts = 11;
+  std::vector<double> points(3 * npts), weights(npts);
+  for( size_t p = 0; p < npts; ++p ) {
+    points[p + 0*npts] = 0.3 * std::sin(1.3 * p) + 0.35 * p;
+    points[p + 1*npts] = 0.5 * std::cos(0.7 * p) - 0.1 * p;
+    points[p + 2*npts] = 0.2 * p;
+    weights[p] = 0.5 + 0.1 * p;
+  }
+
+  XCPU::coefficients coeff_A[2] = {{1.7, 0.6}, {0.45, 0.8}};
+  XCPU::coefficients coeff_B[2] = {{1.1, 0.7}, {0.3,  0.5}};
+
+  auto check_pair = [&]( int lA, int lB, bool is_diag ) {
+    XCPU::shells A{ {0.1, -0.2, 0.3}, coeff_A, 2, lA };
+    XCPU::shells B = is_diag ? A : XCPU::shells{ {-0.4, 0.5, 0.6}, coeff_B, 2, lB };
+
+    std::vector<XCPU::prim_pair> prim_pairs( A.m * B.m );
+    // Primitive pairs are expanded about the higher angular momentum shell
+    // (see GauXC::ShellPair)
+    if( lA >= lB ) XCPU::generate_shell_pair( A, B, prim_pairs.data() );
+    else           XCPU::generate_shell_pair( B, A, prim_pairs.data() );
+
+    const int nA = (lA+1)*(lA+2)/2, nB = (lB+1)*(lB+2)/2;
+    std::vector<double> Xi(nA * npts), Xj(nB * npts), Gi(nA * npts, 0.),
+      Gj(nB * npts, 0.);
+    for( size_t i = 0; i < Xi.size(); ++i ) Xi[i] = std::sin(0.37 * i + 0.1);
+    for( size_t i = 0; i < Xj.size(); ++i ) Xj[i] = std::cos(0.23 * i + 0.2);
+    if( is_diag ) Xj = Xi;
+
+    XCPU::compute_integral_shell_pair( is_diag, npts, points.data(), lA, lB,
+      A.origin, B.origin, A.m * B.m, prim_pairs.data(), Xi.data(), Xj.data(),
+      npts, Gi.data(), Gj.data(), npts, weights.data(), boys_table );
+
+    std::vector<double> Gi_ref(nA * npts, 0.), Gj_ref(nB * npts, 0.);
+    for( size_t p = 0; p < npts; ++p ) {
+      XCPU::point C{ points[p], points[p + npts], points[p + 2*npts] };
+      auto V = ref_shell_pair_coulomb( A, B, C );
+      for( int i = 0; i < nA; ++i )
+      for( int j = 0; j < nB; ++j ) {
+        Gi_ref[i*npts + p] += weights[p] * V[i*nB + j] * Xj[j*npts + p];
+        Gj_ref[j*npts + p] += weights[p] * V[i*nB + j] * Xi[i*npts + p];
+      }
+    }
+
+    for( size_t i = 0; i < Gi.size(); ++i )
+      CHECK( Gi[i] == Approx(Gi_ref[i]).margin(1e-12) );
+    if( not is_diag )
+    for( size_t i = 0; i < Gj.size(); ++i )
+      CHECK( Gj[i] == Approx(Gj_ref[i]).margin(1e-12) );
+  };
+
+  const int max_l = GAUXC_CPU_SNLINK_MAX_AM;
+  SECTION("Diagonal") {
+    for( int l = 0; l <= max_l; ++l ) check_pair( l, l, true );
+  }
+
+  SECTION("Off-Diagonal") {
+    for( int lA = 0; lA <= max_l; ++lA )
+    for( int lB = 0; lB <= max_l; ++lB ) check_pair( lA, lB, false );
+  }
+
+  SECTION("Batched") {
+
+    // Spans several point blocks of the batched driver
+    const size_t npts_b = 300;
+    std::vector<double> points_b(3 * npts_b), weights_b(npts_b);
+    for( size_t p = 0; p < npts_b; ++p ) {
+      points_b[p + 0*npts_b] = 0.3 * std::sin(1.3 * p) + 0.01 * p;
+      points_b[p + 1*npts_b] = 0.5 * std::cos(0.7 * p);
+      points_b[p + 2*npts_b] = 0.4 * std::sin(0.3 * p + 0.5);
+      weights_b[p] = 0.5 + 0.001 * p;
+    }
+
+    for( int lA = 0; lA <= max_l; ++lA )
+    for( int lB = 0; lB <= lA;    ++lB ) {
+
+      // Pairs (0,1) and (0,2) of type (lA,lB) and the diagonal pair (0,0)
+      XCPU::shells sh[3] = { { {0.1, -0.2, 0.3}, coeff_A, 2, lA },
+                             { {-0.4, 0.5, 0.6}, coeff_B, 2, lB },
+                             { {0.3, 0.2, -0.5}, coeff_A, 2, lB } };
+      const size_t nA = (lA+1)*(lA+2)/2, nB = (lB+1)*(lB+2)/2;
+      size_t off[3] = { 0, nA, nA + nB };
+      const size_t nrows = nA + 2*nB;
+
+      std::vector<XCPU::prim_pair> pp00(4), pp01(4), pp02(4);
+      XCPU::generate_shell_pair( sh[0], sh[0], pp00.data() );
+      XCPU::generate_shell_pair( sh[0], sh[1], pp01.data() );
+      XCPU::generate_shell_pair( sh[0], sh[2], pp02.data() );
+
+      std::vector<double> X(nrows * npts_b), G(nrows * npts_b, 0.),
+        G_ref(nrows * npts_b, 0.);
+      for( size_t i = 0; i < X.size(); ++i ) X[i] = std::sin(0.37 * i + 0.1);
+
+      // Reference through the per pair driver
+      XCPU::compute_integral_shell_pair( 1, npts_b, points_b.data(), lA, lA,
+        sh[0].origin, sh[0].origin, 4, pp00.data(), X.data(), X.data(), npts_b,
+        G_ref.data(), G_ref.data(), npts_b, weights_b.data(), boys_table );
+      XCPU::prim_pair* pp_off[2] = { pp01.data(), pp02.data() };
+      for( int k = 1; k < 3; ++k ) {
+        XCPU::compute_integral_shell_pair( 0, npts_b, points_b.data(), lA, lB,
+          sh[0].origin, sh[k].origin, 4, pp_off[k-1], X.data(),
+          X.data() + off[k] * npts_b, npts_b, G_ref.data(),
+          G_ref.data() + off[k] * npts_b, npts_b, weights_b.data(), boys_table );
+      }
+
+      // Batched
+      XCPU::point rA_diag[1] = { sh[0].origin };
+      int nprim_diag[1] = { 4 };
+      XCPU::prim_pair* pp_diag[1] = { pp00.data() };
+      size_t off_diag[1] = { 0 };
+      XCPU::shell_pair_batch diag_batch{ lA, lA, 1, 1, rA_diag, rA_diag,
+        nprim_diag, pp_diag, off_diag, off_diag };
+
+      XCPU::point rA[2] = { sh[0].origin, sh[0].origin };
+      XCPU::point rB[2] = { sh[1].origin, sh[2].origin };
+      int nprim[2] = { 4, 4 };
+      size_t offA[2] = { 0, 0 }, offB[2] = { off[1], off[2] };
+      XCPU::shell_pair_batch off_diag_batch{ lA, lB, 0, 2, rA, rB, nprim,
+        pp_off, offA, offB };
+
+      for( auto* batch : { &diag_batch, &off_diag_batch } )
+        XCPU::compute_integral_shell_pair_batch( *batch, npts_b,
+          points_b.data(), X.data(), npts_b, G.data(), npts_b,
+          weights_b.data(), boys_table );
+
+      for( size_t i = 0; i < G.size(); ++i )
+        CHECK( G[i] == Approx(G_ref[i]).margin(1e-12) );
+    }
+
+  }
+
+  XCPU::boys_finalize( boys_table );
+
+}
+#endif
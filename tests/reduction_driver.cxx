@@ -0,0 +1,163 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "ut_common.hpp"
+#include <gauxc/reduction_driver.hpp>
+#include "packed_symmetric.hpp"
+#include <vector>
+
+using namespace GauXC;
+
+namespace {
+
+// Lower triangles set from (seed,i,j), upper triangles and padding set to
+// sentinel values
+template <typename T>
+void fill_lower( T* A, size_t n, size_t lda, int seed ) {
+  for( size_t j = 0; j < n; ++j )
+  for( size_t i = 0; i < lda; ++i )
+    A[i + j*lda] = i >= n ? T(-1) : i >= j ? T(seed + i + 0.5*j) : T(-2);
+}
+
+}
+
+TEST_CASE( "Packed Symmetric Message", "[reduction]" ) {
+
+  const size_t n = 7;
+  const std::vector<size_t> ld = { 7, 10, 9 };
+
+  auto check = [&]( auto type_tag ) {
+
+    using T = decltype(type_tag);
+    std::vector<std::vector<T>> mats;
+    std::vector<void*> ptrs;
+    for( size_t i = 0; i < ld.size(); ++i ) {
+      mats.emplace_back( ld[i] * n );
+      fill_lower( mats.back().data(), n, ld[i], 10*i );
+      ptrs.push_back( mats.back().data() );
+    }
+    std::vector<T> scalars = { 1., 2., 3. };
+
+    detail::PackedSymmetricMessage msg( n, ptrs, ld, scalars.data(),
+      scalars.size(), std::type_index(typeid(T)) );
+    REQUIRE( msg.size() == ld.size() * n*(n+1)/2 + scalars.size() );
+
+    // Lower triangles (column major) followed by the scalars
+    auto* buf = static_cast<T*>( msg.pack() );
+    size_t k = 0;
+    for( size_t imat = 0; imat < ld.size(); ++imat )
+    for( size_t j = 0; j < n; ++j )
+    for( size_t i = j; i < n; ++i )
+      CHECK( buf[k++] == mats[imat][i + j*ld[imat]] );
+    for( auto s : scalars ) CHECK( buf[k++] == s );
+
+    // Round trip of a modified message
+    for( size_t i = 0; i < msg.size(); ++i ) buf[i] *= 2;
+    msg.unpack();
+    for( size_t imat = 0; imat < ld.size(); ++imat ) {
+      std::vector<T> ref( ld[imat] * n );
+      fill_lower( ref.data(), n, ld[imat], 10*imat );
+      const auto& A = mats[imat];
+      for( size_t j = 0; j < n; ++j )
+      for( size_t i = 0; i < ld[imat]; ++i ) {
+        const T expected = i >= n ? ref[i + j*ld[imat]] :
+          2 * ( i >= j ? ref[i + j*ld[imat]] : ref[j + i*ld[imat]] );
+        CHECK( A[i + j*ld[imat]] == expected );
+      }
+    }
+    CHECK( scalars == std::vector<T>{ 2., 4., 6. } );
+
+  };
+
+  SECTION("Double") { check( double() ); }
+  SECTION("Float")  { check( float()  ); }
+
+  SECTION("Invalid LD") {
+    std::vector<double> A( n*n );
+    std::vector<void*> ptrs = { A.data() };
+    std::vector<size_t> bad_ld = { n - 1 };
+    CHECK_THROWS( detail::PackedSymmetricMessage( n, ptrs, bad_ld, nullptr,
+      0, std::type_index(typeid(double)) ) );
+  }
+
+}
+
+TEST_CASE( "Packed Symmetric Reduction", "[reduction]" ) {
+
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+  const int rank = rt.comm_rank();
+
+  const size_t n = 11;
+  const std::vector<size_t> ld = { 11, 14, 12 };
+  const size_t nscalars = 2;
+
+  // The packed reduction has to match the reduction of the full matrices
+  // (symmetrized prior to the reduction) through allreduce_inplace
+  auto check = [&]( ReductionDriver& rd, bool node_shared ) {
+
+    auto alloc = [&]( size_t sz ) {
+      return node_shared ? rd.allocate_node_shared<double>( sz ) :
+                           new double[sz];
+    };
+    auto release = [&]( double* ptr ) {
+      if( node_shared ) rd.free_node_shared( ptr ); else delete[] ptr;
+    };
+
+    // Node shared matrices are written by the node leader
+    const bool writer = not node_shared or rd.is_node_leader();
+    std::vector<double*> mats, refs;
+    for( size_t i = 0; i < ld.size(); ++i ) {
+      mats.push_back( alloc( ld[i] * n ) );
+      refs.push_back( alloc( ld[i] * n ) );
+      if( writer ) {
+        fill_lower( mats[i], n, ld[i], 10*i + rank );
+        std::copy_n( mats[i], ld[i] * n, refs[i] );
+        for( size_t j = 0; j < n; ++j )
+        for( size_t k = 0; k < j; ++k )
+          refs[i][k + j*ld[i]] = refs[i][j + k*ld[i]];
+      }
+    }
+    if( node_shared ) rd.node_barrier();
+
+    std::vector<double> scalars = { 1. + rank, 2. * rank };
+    auto scalars_ref = scalars;
+
+    rd.allreduce_packed_symmetric( n, mats, ld, scalars.data(), nscalars,
+      ReductionOp::Sum );
+    for( size_t i = 0; i < ld.size(); ++i )
+      rd.allreduce_inplace( refs[i], ld[i] * n, ReductionOp::Sum );
+    rd.allreduce_inplace( scalars_ref.data(), nscalars, ReductionOp::Sum );
+
+    for( size_t i = 0; i < ld.size(); ++i ) {
+      // Padding is not reduced
+      for( size_t j = 0; j < n; ++j )
+      for( size_t k = 0; k < ld[i]; ++k ) {
+        if( k < n ) CHECK( mats[i][k + j*ld[i]] == Approx(refs[i][k + j*ld[i]]) );
+        else        CHECK( mats[i][k + j*ld[i]] == -1. );
+      }
+    }
+    CHECK( scalars[0] == Approx(scalars_ref[0]) );
+    CHECK( scalars[1] == Approx(scalars_ref[1]) );
+
+    if( node_shared ) rd.node_barrier();
+    for( auto* A : mats ) release(A);
+    for( auto* A : refs ) release(A);
+
+  };
+
+  SECTION("Default") {
+    auto rd = ReductionDriverFactory::get_shared_instance( rt, "Default" );
+    check( *rd, false );
+  }
+
+  SECTION("NodeShared") {
+    auto rd = ReductionDriverFactory::get_shared_instance( rt, "NodeShared" );
+    SECTION("Private")     { check( *rd, false ); }
+    SECTION("Node Shared") { check( *rd, true  ); }
+  }
+
+}
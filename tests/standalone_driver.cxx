@@ -167,13 +167,10 @@ int main(int argc, char** argv) {
     std::map< std::string, PruningScheme > prune_map = {
       {"UNPRUNED", PruningScheme::Unpruned},
       {"ROBUST",   PruningScheme::Robust},
-      {"TREUTLER", PruningScheme::Treutler}
+      {"TREUTLER", PruningScheme::Treutler},
+      {"ADAPTIVE", PruningScheme::Adaptive}
     };
 
-    auto mg = MolGridFactory::create_default_molgrid(mol, 
-     prune_map.at(prune_spec), BatchSize(batch_size), 
-     RadialQuad::MuraKnowles, mg_map.at(grid_spec));
-
     // Read BasisSet
     BasisSet<double> basis; 
     read_hdf5_record( basis, ref_file, "/BASIS" );
@@ -182,6 +179,10 @@ int main(int argc, char** argv) {
       sh.set_shell_tolerance( basis_tol );
     }
 
+    auto mg = MolGridFactory::create_default_molgrid(mol, basis,
+     prune_map.at(prune_spec), BatchSize(batch_size), 
+     RadialQuad::MuraKnowles, mg_map.at(grid_spec));
+
     // Setup load balancer
     LoadBalancerFactory lb_factory( lb_exec_space, "Replicated");
     auto lb = lb_factory.get_shared_instance( rt, mol, mg, basis);
@@ -495,6 +496,9 @@ int main(int argc, char** argv) {
                   << std::setw(12) << dur.count() << " ms" << std::endl;
         #endif
       }
+      for( const auto& [name, val] : integrator.get_timings().all_annotations() ) {
+        std::cout << "  " << std::setw(40) << name << ": " << val << std::endl;
+      }
 
       std::cout << std::scientific << std::setprecision(14);
 
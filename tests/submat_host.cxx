@@ -0,0 +1,124 @@
+/**
+ * GauXC Copyright (c) 2020-2024, The Regents of the University of California,
+ * through Lawrence Berkeley National Laboratory (subject to receipt of
+ * any required approvals from the U.S. Dept. of Energy). All rights reserved.
+ *
+ * See LICENSE.txt for details
+ */
+#include "ut_common.hpp"
+
+#ifdef GAUXC_HAS_HOST
+#include "host/util.hpp"
+#include <random>
+#include <vector>
+#include <array>
+
+namespace {
+
+using submat_map_type = std::vector<std::array<int32_t,3>>;
+
+// Disjoint ascending cuts in [0,n) with lengths in [min_len,max_len] and
+// gaps in [1,max_gap]
+submat_map_type random_submat_map( int32_t n, int32_t min_len,
+  int32_t max_len, int32_t max_gap, std::mt19937& gen ) {
+
+  std::uniform_int_distribution<int32_t> len_dist( min_len, max_len );
+  std::uniform_int_distribution<int32_t> gap_dist( 1, max_gap );
+
+  submat_map_type map;
+  int32_t st = gap_dist(gen) - 1, small = 0;
+  while( st < n ) {
+    const int32_t len = std::min( len_dist(gen), n - st );
+    map.push_back( {st, len, small} );
+    small += len;
+    st    += len + gap_dist(gen);
+  }
+  return map;
+
+}
+
+std::vector<int32_t> flatten( const submat_map_type& map ) {
+  std::vector<int32_t> idx;
+  for( auto& cut : map )
+  for( int32_t i = 0; i < cut[1]; ++i ) idx.push_back( cut[0] + i );
+  return idx;
+}
+
+}
+
+using namespace GauXC;
+
+TEST_CASE( "Host Submatrix Operations", "[submat]" ) {
+
+  std::mt19937 gen(17);
+  std::uniform_real_distribution<double> dist(-1., 1.);
+
+  const int32_t M = 157, N = 143;
+  const int32_t LDAB = M + 5;
+
+  std::vector<double> ABig( LDAB * N );
+  for( auto& x : ABig ) x = dist(gen);
+
+  // Fragmented (indexed gather) and contiguous (cut-wise) maps
+  const auto frag_rows = random_submat_map( M, 1, 2, 3, gen );
+  const auto cont_rows = random_submat_map( M, 15, 30, 4, gen );
+  const auto frag_cols = random_submat_map( N, 1, 3, 2, gen );
+  const auto cont_cols = random_submat_map( N, 10, 25, 6, gen );
+
+  detail::submat_plan plan;
+  plan.build( frag_rows ); REQUIRE( plan.gather );
+  plan.build( cont_rows ); REQUIRE( not plan.gather );
+
+  auto check = [&]( const submat_map_type& rows, const submat_map_type& cols ) {
+
+    const auto I = flatten(rows);
+    const auto J = flatten(cols);
+    const int32_t m = I.size(), n = J.size();
+    const int32_t LDAS = m + 3;
+
+    // Extraction
+    std::vector<double> ASmall( LDAS * n, 0. );
+    detail::submat_set( M, N, m, n, ABig.data(), LDAB, ASmall.data(), LDAS,
+      rows, cols );
+    for( int32_t j = 0; j < n; ++j )
+    for( int32_t i = 0; i < m; ++i )
+      CHECK( ASmall[i + j*LDAS] == ABig[I[i] + J[j]*LDAB] );
+
+    // Padding of either matrix is left untouched
+    for( int32_t j = 0; j < n; ++j )
+    for( int32_t i = m; i < LDAS; ++i )
+      CHECK( ASmall[i + j*LDAS] == 0. );
+
+    // Accumulation
+    for( auto& x : ASmall ) x = dist(gen);
+    auto ABig_ref = ABig;
+    for( int32_t j = 0; j < n; ++j )
+    for( int32_t i = 0; i < m; ++i )
+      ABig_ref[I[i] + J[j]*LDAB] += ASmall[i + j*LDAS];
+
+    auto ABig_inc = ABig;
+    detail::inc_by_submat( M, N, m, n, ABig_inc.data(), LDAB, ASmall.data(),
+      LDAS, rows, cols );
+    CHECK( ABig_inc == ABig_ref );
+
+  };
+
+  SECTION("Gather Rows")    { check( frag_rows, cont_cols ); }
+  SECTION("Cut-Wise Rows")  { check( cont_rows, frag_cols ); }
+  SECTION("Fragmented")     { check( frag_rows, frag_cols ); }
+  SECTION("Contiguous")     { check( cont_rows, cont_cols ); }
+
+  // Shared row / column map (square submatrix of a square matrix)
+  SECTION("Symmetric") {
+    const auto map = random_submat_map( N, 1, 4, 3, gen );
+    const auto I = flatten(map);
+    const int32_t n = I.size();
+    std::vector<double> ASmall( n * n );
+    detail::submat_set( N, N, n, n, ABig.data(), LDAB, ASmall.data(), n, map );
+    for( int32_t j = 0; j < n; ++j )
+    for( int32_t i = 0; i < n; ++i )
+      CHECK( ASmall[i + j*n] == ABig[I[i] + I[j]*LDAB] );
+  }
+
+}
+#endif
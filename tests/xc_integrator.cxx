@@ -10,6 +10,7 @@
 #include <gauxc/xc_integrator/impl.hpp>
 #include <gauxc/xc_integrator/integrator_factory.hpp>
 #include <gauxc/molecular_weights.hpp>
+#include <gauxc/basisset_map.hpp>
 
 #include <gauxc/molgrid/defaults.hpp>
 
@@ -20,6 +21,13 @@
 using namespace GauXC;
 const double tol = 1e-6;
 
+// Host accumulation strategies of VXC / K (only distinguished for more than
+// one OpenMP thread, a single thread always accumulates privately)
+const std::array<HostAccumulationStrategy,4> host_accumulation_strategies = {
+  HostAccumulationStrategy::Auto, HostAccumulationStrategy::Atomic,
+  HostAccumulationStrategy::ThreadPrivate, HostAccumulationStrategy::TileLock
+};
+
 void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
   std::string reference_file, 
   functional_type& func, 
@@ -182,6 +190,98 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     auto EXC2 = integrator.eval_exc( P );
     CHECK(EXC2 == Approx(EXC));
 
+    // Check collocation cache (populated on the first call, reused after)
+    {
+      IntegratorSettingsKS ks_settings;
+      ks_settings.collocation_cache_bytes = 1ul << 30;
+      for( int i = 0; i < 2; ++i ) {
+        auto [ EXC_c, VXC_c ] = integrator.eval_exc_vxc( P, ks_settings );
+        CHECK( EXC_c == Approx( EXC_ref ) );
+        CHECK( (VXC_c - VXC_ref).norm() / basis.nbf() < 1e-10 );
+      }
+    }
+
+    // Check every host accumulation strategy
+    if( ex == ExecutionSpace::Host )
+    for( auto strategy : host_accumulation_strategies ) {
+      IntegratorSettingsKS ks_settings;
+      ks_settings.accumulation = strategy;
+      auto [ EXC_a, VXC_a ] = integrator.eval_exc_vxc( P, ks_settings );
+      CHECK( EXC_a == Approx( EXC_ref ) );
+      CHECK( (VXC_a - VXC_ref).norm() / basis.nbf() < 1e-10 );
+    }
+
+    // Check incremental path (P accumulated from two increments)
+    {
+      integrator.reset_incremental();
+      matrix_type dP = 0.5 * P;
+      integrator.eval_exc_vxc_incremental( dP );
+      auto [ EXC3, VXC3 ] = integrator.eval_exc_vxc_incremental( dP );
+      CHECK( EXC3 == Approx( EXC_ref ) );
+      CHECK( (VXC3 - VXC_ref).norm() / basis.nbf() < 1e-10 );
+
+      // Vanishing density change
+      dP.setZero();
+      auto [ EXC4, VXC4 ] = integrator.eval_exc_vxc_incremental( dP );
+      CHECK( EXC4 == Approx( EXC3 ) );
+      CHECK( (VXC4 - VXC3).norm() / basis.nbf() < 1e-12 );
+
+      // Density change localized on the most compact shell: tasks outside
+      // of its extent are skipped, the remaining tasks are re-evaluated
+      const auto ish = std::distance( basis.begin(),
+        std::min_element( basis.begin(), basis.end(),
+          []( const auto& a, const auto& b ) {
+            return a.cutoff_radius() < b.cutoff_radius();
+          }) );
+      BasisSetMap basis_map( basis, mol );
+      const auto ibf_st = basis_map.shell_to_first_ao()[ish];
+      const auto ibf_en = ibf_st + basis[ish].size();
+
+      size_t ntouched = 0;
+      const auto& tasks = lb.get_tasks();
+      for( const auto& task : tasks ) {
+        const auto& sl = task.bfn_screening.shell_list;
+        if( std::find( sl.begin(), sl.end(), ish ) != sl.end() ) ntouched++;
+      }
+      CHECK( ntouched > 0 );
+      CHECK( ntouched < tasks.size() );
+
+      dP.setZero();
+      for( auto j = ibf_st; j < ibf_en; ++j )
+      for( auto i = ibf_st; i < ibf_en; ++i )
+        dP(i,j) = 0.05 * P(i,j);
+      auto [ EXC5, VXC5 ] = integrator.eval_exc_vxc_incremental( dP );
+
+      matrix_type P5 = P + dP;
+      auto [ EXC5_ref, VXC5_ref ] = integrator.eval_exc_vxc( P5 );
+      CHECK( EXC5 == Approx( EXC5_ref ) );
+      CHECK( (VXC5 - VXC5_ref).norm() / basis.nbf() < 1e-10 );
+
+      // Tasks modified in place (same point storage) belong to a new task
+      // generation, the cached contributions must not be reused
+      if( ex == ExecutionSpace::Host ) {
+        auto& lb_int = integrator.load_balancer();
+        auto scale_weights = [&]( double s ) {
+          for( auto& task : lb_int.get_tasks() )
+          for( auto& w : task.weights ) w *= s;
+          lb_int.state().task_version++;
+        };
+
+        scale_weights( 2. );
+        dP.setZero();
+        auto [ EXC6, VXC6 ] = integrator.eval_exc_vxc_incremental( dP );
+        auto [ EXC6_ref, VXC6_ref ] = integrator.eval_exc_vxc( P5 );
+        CHECK( EXC6_ref == Approx( 2. * EXC5_ref ) );
+        CHECK( EXC6 == Approx( EXC6_ref ) );
+        CHECK( (VXC6 - VXC6_ref).norm() / basis.nbf() < 1e-10 );
+
+        scale_weights( 0.5 );
+        auto [ EXC7, VXC7 ] = integrator.eval_exc_vxc_incremental( dP );
+        CHECK( EXC7 == Approx( EXC5_ref ) );
+        CHECK( (VXC7 - VXC5_ref).norm() / basis.nbf() < 1e-10 );
+      }
+    }
+
   } else if (uks) {
     auto [ EXC, VXC, VXCz ] = integrator.eval_exc_vxc( P, Pz );
 
@@ -204,6 +304,18 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     // Check EXC-only path
     auto EXC2 = integrator.eval_exc( P, Pz );
     CHECK(EXC2 == Approx(EXC));
+
+    // Check every host accumulation strategy
+    if( ex == ExecutionSpace::Host )
+    for( auto strategy : host_accumulation_strategies ) {
+      IntegratorSettingsKS ks_settings;
+      ks_settings.accumulation = strategy;
+      auto [ EXC_a, VXC_a, VXCz_a ] = integrator.eval_exc_vxc( P, Pz, 
+        ks_settings );
+      CHECK( EXC_a == Approx( EXC_ref ) );
+      CHECK( (VXC_a  - VXC_ref ).norm() / basis.nbf() < 1e-10 );
+      CHECK( (VXCz_a - VXCz_ref).norm() / basis.nbf() < 1e-10 );
+    }
   } else if (gks) {
     auto [ EXC, VXC, VXCz, VXCy, VXCx ] = integrator.eval_exc_vxc( P, Pz, Py, Px );
 
@@ -237,6 +349,36 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     CHECK(EXC2 == Approx(EXC));
   }
 
+  // Integrands in node shared memory (single copy per node)
+  if( reduction_kernel == "NodeShared" and rks ) {
+    auto rd = ReductionDriverFactory::get_shared_instance( rt, reduction_kernel );
+    auto impl = detail::ReplicatedXCHostIntegratorFactory<double>::make_integrator_impl(
+      integrator_kernel, std::make_shared<functional_type>(func), 
+      std::make_shared<LoadBalancer>(lb),
+      LocalWorkDriverFactory::make_local_work_driver( ex, lwd_kernel ), rd );
+
+    const int64_t nbf = basis.nbf();
+    auto* VXC_shared = rd->allocate_node_shared<double>( nbf*nbf );
+    REQUIRE( rd->is_node_shared( VXC_shared ) );
+    Eigen::Map<matrix_type> VXC_map( VXC_shared, nbf, nbf );
+
+    double EXC;
+    impl->eval_exc_vxc( nbf, nbf, P.data(), nbf, VXC_shared, nbf, &EXC, 
+      IntegratorSettingsKS{} );
+    CHECK( EXC == Approx( EXC_ref ) );
+    CHECK( (VXC_map - VXC_ref).norm() / nbf < 1e-10 );
+
+    if( has_k and check_k ) {
+      impl->eval_exx( nbf, nbf, P.data(), nbf, VXC_shared, nbf, 
+        IntegratorSettingsSNLinK{} );
+      CHECK( (VXC_map - VXC_map.transpose()).norm() < std::numeric_limits<double>::epsilon() );
+      CHECK( (VXC_map - K_ref).norm() / nbf < 1e-7 );
+    }
+
+    rd->node_barrier();
+    rd->free_node_shared( VXC_shared );
+  }
+
 
 
   // Check EXC Grad
@@ -259,6 +401,64 @@ void test_xc_integrator( ExecutionSpace ex, const RuntimeEnvironment& rt,
     auto K = integrator.eval_exx( P );
     CHECK((K - K.transpose()).norm() < std::numeric_limits<double>::epsilon()); // Symmetric
     CHECK( (K - K_ref).norm() / basis.nbf() < 1e-7 );
+
+    // Reuse of the screening state across evaluations
+    auto K_reuse = integrator.eval_exx( P );
+    CHECK( (K_reuse - K).norm() / basis.nbf() < 1e-12 );
+
+    // The reused screening state has to refer to the current task order
+    // (XC evaluations and rebalancing may reorder the tasks)
+    if( ex == ExecutionSpace::Host ) {
+      auto& lb_tasks = integrator.load_balancer().get_tasks();
+      integrator.eval_exc_vxc( P );
+      std::reverse( lb_tasks.begin(), lb_tasks.end() );
+      integrator.load_balancer().state().task_version++;
+      auto K_reorder = integrator.eval_exx( P );
+      CHECK( (K_reorder - K).norm() / basis.nbf() < 1e-12 );
+      auto reused_tasks = lb_tasks;
+
+      IntegratorSettingsSNLinK sn_link_settings;
+      sn_link_settings.reuse_screening_plan = false;
+      integrator.eval_exx( P, sn_link_settings );
+      REQUIRE( reused_tasks.size() == lb_tasks.size() );
+      for( size_t i = 0; i < lb_tasks.size(); ++i ) {
+        const auto& t = reused_tasks[i];
+        CHECK( t.points == lb_tasks[i].points );
+        CHECK( t.cou_screening.shell_list == 
+               lb_tasks[i].cou_screening.shell_list );
+        CHECK( t.cou_screening.shell_pair_list == 
+               lb_tasks[i].cou_screening.shell_pair_list );
+        if( t.cou_screening.shell_list.size() ) 
+          CHECK( t.measured_cost.exx > 0. );
+      }
+    }
+
+    // Collocation cache across evaluations
+    {
+      IntegratorSettingsSNLinK sn_link_settings;
+      sn_link_settings.collocation_cache_bytes = 1ul << 30;
+      integrator.eval_exx( P, sn_link_settings );
+      auto K_cache = integrator.eval_exx( P, sn_link_settings );
+      CHECK( (K_cache - K).norm() / basis.nbf() < 1e-12 );
+    }
+
+    // Every host accumulation strategy
+    if( ex == ExecutionSpace::Host )
+    for( auto strategy : host_accumulation_strategies ) {
+      IntegratorSettingsSNLinK sn_link_settings;
+      sn_link_settings.accumulation = strategy;
+      auto K_a = integrator.eval_exx( P, sn_link_settings );
+      CHECK( (K_a - K_a.transpose()).norm() < 
+        std::numeric_limits<double>::epsilon() );
+      CHECK( (K_a - K_ref).norm() / basis.nbf() < 1e-7 );
+    }
+
+    // Incremental EXX (P accumulated from two increments)
+    integrator.reset_incremental();
+    matrix_type dP = 0.5 * P;
+    integrator.eval_exx_incremental( dP );
+    auto K_inc = integrator.eval_exx_incremental( dP );
+    CHECK( (K_inc - K_ref).norm() / basis.nbf() < 1e-7 );
   }
 
 }
@@ -281,6 +481,14 @@ void test_integrator(std::string reference_file, functional_type& func, PruningS
         test_xc_integrator( ExecutionSpace::Host, rt, reference_file, func,
           pruning_scheme, false, false, false, "ShellBatched" );
       }
+      SECTION("SinglePass") {
+        test_xc_integrator( ExecutionSpace::Host, rt, reference_file, func,
+          pruning_scheme, false, true, false, "Default", "Default", "SinglePass" );
+      }
+      SECTION("NodeShared") {
+        test_xc_integrator( ExecutionSpace::Host, rt, reference_file, func,
+          pruning_scheme, false, false, true, "Default", "NodeShared" );
+      }
     }
 #endif
 
@@ -450,3 +658,194 @@ TEST_CASE( "XC Integrator", "[xc-integrator]" ) {
         func, PruningScheme::Unpruned );
   }
 }
+
+#ifdef GAUXC_HAS_HOST
+// Results after a geometry update of the load balancer have to match those
+// of a load balancer / integrator generated at the new geometry, in 
+// particular the incremental state of the previous geometry is discarded
+void test_geometry_update( std::string reference_file, functional_type& func ) {
+
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  using matrix_type = Eigen::MatrixXd;
+  Molecule mol;
+  BasisSet<double> basis;
+  matrix_type P;
+  {
+    read_hdf5_record( mol,   reference_file, "/MOLECULE" );
+    read_hdf5_record( basis, reference_file, "/BASIS"    );
+
+    HighFive::File file( reference_file, HighFive::File::ReadOnly );
+    auto dset = file.getDataSet("/DENSITY");
+    auto dims = dset.getDimensions();
+    P = matrix_type( dims[0], dims[1] );
+    dset.read( P.data() );
+  }
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, PruningScheme::Unpruned,
+    BatchSize(512), RadialQuad::MuraKnowles, AtomicGridSizeDefault::UltraFineGrid);
+
+  LoadBalancerFactory lb_factory(ExecutionSpace::Host, "Default");
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  auto mw = mw_factory.get_instance();
+  XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host, 
+    "Replicated", "Default", "Default", "Default" );
+
+  auto lb = lb_factory.get_instance(rt, mol, mg, basis);
+  lb.state().retain_quadrature_weights = true;
+  mw.modify_weights(lb);
+  auto integrator = integrator_factory.get_instance( func, lb );
+
+  // Populate the cached and incremental state at the initial geometry
+  integrator.eval_exc_vxc( P );
+  integrator.eval_exc_vxc_incremental( P );
+  integrator.eval_exx_incremental( P );
+
+  // Displace two atoms
+  Molecule mol_d = mol;
+  mol_d[0].x += 0.05; mol_d[0].y -= 0.03;
+  mol_d[1].z += 0.04;
+
+  integrator.load_balancer().update_geometry( mol_d );
+  mw.modify_weights( integrator.load_balancer() );
+
+  auto basis_d = basis;
+  BasisSetMap basis_map( basis, mol );
+  for( size_t ish = 0; ish < basis_d.size(); ++ish ) {
+    const auto iAt = basis_map.shell_to_center()[ish];
+    double* O = basis_d[ish].O_data();
+    O[0] = mol_d[iAt].x; O[1] = mol_d[iAt].y; O[2] = mol_d[iAt].z;
+  }
+  auto mg_d = MolGridFactory::create_default_molgrid(mol_d, 
+    PruningScheme::Unpruned, BatchSize(512), RadialQuad::MuraKnowles, 
+    AtomicGridSizeDefault::UltraFineGrid);
+  auto lb_d = lb_factory.get_instance(rt, mol_d, mg_d, basis_d);
+  mw.modify_weights(lb_d);
+  auto integrator_d = integrator_factory.get_instance( func, lb_d );
+
+  auto [ EXC_d, VXC_d ] = integrator_d.eval_exc_vxc( P );
+  auto K_d = integrator_d.eval_exx( P );
+
+  auto [ EXC, VXC ] = integrator.eval_exc_vxc( P );
+  CHECK( EXC == Approx( EXC_d ) );
+  CHECK( (VXC - VXC_d).norm() / basis.nbf() < 1e-10 );
+
+  // The incremental references are reset by the geometry update
+  auto [ EXC_inc, VXC_inc ] = integrator.eval_exc_vxc_incremental( P );
+  CHECK( EXC_inc == Approx( EXC_d ) );
+  CHECK( (VXC_inc - VXC_d).norm() / basis.nbf() < 1e-10 );
+
+  auto K_inc = integrator.eval_exx_incremental( P );
+  CHECK( (K_inc - K_d).norm() / basis.nbf() < 1e-7 );
+
+}
+
+TEST_CASE( "XC Integrator (Geometry Update)", "[xc-integrator]" ) {
+
+  auto func = make_functional(ExchCXX::Functional::PBE0, 
+    ExchCXX::Spin::Unpolarized);
+  test_geometry_update(GAUXC_REF_DATA_PATH "/benzene_pbe0_cc-pvdz_ufg_ssf.hdf5", 
+    func );
+
+}
+#endif
+
+#ifdef GAUXC_HAS_HOST
+// Adaptive pruning has no reference data of its own: EXC/VXC are validated
+// against the unpruned reference at a loosened tolerance. For benzene / 
+// cc-pVDZ (UFG, default tolerance) the adaptive grid retains 47.5% of the 
+// unpruned points. The deviations from the unpruned grid, measured with 
+// product angular grids of the Lebedev orders in place of the Lebedev 
+// grids, are at most 4.0e-8 (EXC) and 7.7e-10 (|VXC| / nbf) for both SVWN5 
+// and PBE0. The tolerances leave a margin of 5x (EXC) and 6.5x (VXC) over 
+// these, they are to be revisited against the Lebedev grids.
+void test_adaptive_pruning( std::string reference_file, functional_type& func ) {
+
+  auto rt = RuntimeEnvironment(GAUXC_MPI_CODE(MPI_COMM_WORLD));
+
+  using matrix_type = Eigen::MatrixXd;
+  Molecule mol;
+  BasisSet<double> basis;
+  matrix_type P, VXC_ref;
+  double EXC_ref;
+  {
+    read_hdf5_record( mol,   reference_file, "/MOLECULE" );
+    read_hdf5_record( basis, reference_file, "/BASIS"    );
+
+    HighFive::File file( reference_file, HighFive::File::ReadOnly );
+    auto dset = file.getDataSet("/DENSITY");
+    auto dims = dset.getDimensions();
+    P       = matrix_type( dims[0], dims[1] );
+    VXC_ref = matrix_type( dims[0], dims[1] );
+    dset.read( P.data() );
+    dset = file.getDataSet("/VXC");
+    dset.read( VXC_ref.data() );
+    dset = file.getDataSet("/EXC");
+    dset.read( &EXC_ref );
+  }
+
+  for( auto& sh : basis ) 
+    sh.set_shell_tolerance( std::numeric_limits<double>::epsilon() );
+
+  auto rq  = RadialQuad::MuraKnowles;
+  auto gsz = AtomicGridSizeDefault::UltraFineGrid;
+
+  // Significantly fewer points than the unpruned grid
+  auto npts = [&]( const atomic_grid_spec_map& molmap ) {
+    size_t n = 0;
+    for( const auto& atom : mol ) {
+      const auto& gs = std::get<PrunedAtomicGridSpecification>(molmap.at(atom.Z));
+      for( const auto& r : gs.pruning_regions )
+        n += (r.idx_en - r.idx_st) * r.angular_size.get();
+    }
+    return n;
+  };
+  auto unp_map = MolGridFactory::create_default_grid_spec_map( mol, 
+    PruningScheme::Unpruned, rq, gsz );
+  auto ada_map = MolGridFactory::create_default_grid_spec_map( mol, basis,
+    PruningScheme::Adaptive, rq, gsz );
+  CHECK( npts(ada_map) < 0.5 * npts(unp_map) );
+
+  auto mg = MolGridFactory::create_default_molgrid(mol, basis, 
+    PruningScheme::Adaptive, BatchSize(512), rq, gsz);
+
+  LoadBalancerFactory lb_factory(ExecutionSpace::Host, "Default");
+  auto lb = lb_factory.get_instance(rt, mol, mg, basis);
+
+  MolecularWeightsFactory mw_factory( ExecutionSpace::Host, "Default", 
+    MolecularWeightsSettings{} );
+  auto mw = mw_factory.get_instance();
+  mw.modify_weights(lb);
+
+  XCIntegratorFactory<matrix_type> integrator_factory( ExecutionSpace::Host, 
+    "Replicated", "Default", "Default", "Default" );
+  auto integrator = integrator_factory.get_instance( func, lb );
+
+  auto [ EXC, VXC ] = integrator.eval_exc_vxc( P );
+  CHECK( EXC == Approx( EXC_ref ).margin(2e-7) );
+  CHECK( (VXC - VXC_ref).norm() / basis.nbf() < 5e-9 );
+
+}
+
+TEST_CASE( "XC Integrator (Adaptive Pruning)", "[xc-integrator]" ) {
+
+  auto unpol = ExchCXX::Spin::Unpolarized;
+
+  SECTION( "Benzene / SVWN5 / cc-pVDZ" ) {
+    auto func = make_functional(ExchCXX::Functional::SVWN5, unpol);
+    test_adaptive_pruning(GAUXC_REF_DATA_PATH "/benzene_svwn5_cc-pvdz_ufg_ssf.hdf5", 
+      func );
+  }
+
+  SECTION( "Benzene / PBE0 / cc-pVDZ" ) {
+    auto func = make_functional(ExchCXX::Functional::PBE0, unpol);
+    test_adaptive_pruning(GAUXC_REF_DATA_PATH "/benzene_pbe0_cc-pvdz_ufg_ssf.hdf5", 
+      func );
+  }
+
+}
+#endif